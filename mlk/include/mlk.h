@@ -43,6 +43,7 @@ typedef void * mIconTheme;
 typedef struct _mThread mThread;
 typedef void * mThreadMutex;
 typedef void * mThreadCond;
+typedef void * mThreadKey;
 
 typedef struct _mFontSystem mFontSystem;
 typedef struct _mFont mFont;
@@ -157,8 +157,10 @@ typedef struct
 	int type;
 	mWidget *widget;
 
-	int act,btt,raw_btt;
-	uint32_t state,flags;
+	int act,btt,raw_btt,
+		history_num;	//結合された MOTION の履歴数
+	uint32_t state,flags,
+		history_top;
 	double x,y,pressure;
 }mEventPenTablet;
 
@@ -175,6 +175,14 @@ enum MLK_TRSYS
 	MLK_TRSYS_FONT_PREVIEW_TEXT
 };
 
+/* mGuiSetTraceHandle() の種類 */
+
+enum MGUI_TRACE_TYPE
+{
+	MGUI_TRACE_RENDER,
+	MGUI_TRACE_TIMER
+};
+
 /* function */
 
 #ifdef __cplusplus
@@ -188,6 +196,7 @@ void mGuiEnd(void);
 void mGuiSetWMClass(const char *name,const char *classname);
 void mGuiSetEnablePenTablet(void);
 void mGuiSetBlockUserAction(mlkbool on);
+void mGuiSetTraceHandle(void (*handle)(int type,mlkbool end));
 
 mFontSystem *mGuiGetFontSystem(void);
 mFont *mGuiGetDefaultFont(void);
@@ -202,6 +211,8 @@ void mGuiThreadLock(void);
 void mGuiThreadUnlock(void);
 void mGuiThreadWakeup(void);
 
+mlkbool mGuiGetPenTabletHistory(const mEvent *ev,int no,mEvent *dst);
+
 void mGuiSetPath_data_exe(const char *path);
 void mGuiSetPath_config_home(const char *path);
 
@@ -29,6 +29,7 @@ typedef struct _mLoadImage mLoadImage;
 
 typedef mlkbool (*mFuncLoadImageCheck)(mLoadImageType *p,uint8_t *buf,int size);
 typedef void (*mFuncLoadImageProgress)(mLoadImage *p,int percent);
+typedef mlkerr (*mFuncLoadImageStrip)(mLoadImage *p,int y,int height);
 
 #define MLOADIMAGE_CHECKFORMAT_SKIP ((mFuncLoadImageCheck)1)
 
@@ -141,6 +142,10 @@ struct _mLoadImage
 
 	mFuncLoadImageProgress progress;
 	void *param;
+
+	mFuncLoadImageStrip setstrip;
+	int32_t strip_height,
+		strip_cnt;
 };
 
 
@@ -155,6 +160,8 @@ mlkerr mLoadImage_createHandle(mLoadImage *p,int size,int endian);
 void mLoadImage_closeHandle(mLoadImage *p);
 mlkerr mLoadImage_setPalette(mLoadImage *p,uint8_t *buf,int size,int palnum);
 void mLoadImage_setImageConv(mLoadImage *p,mImageConv *dst);
+uint8_t *mLoadImage_getRowBuf(mLoadImage *p,int y);
+mlkerr mLoadImage_putRow(mLoadImage *p,int y);
 
 void mLoadImage_init(mLoadImage *p);
 mlkerr mLoadImage_checkFormat(mLoadImageType *dst,mLoadImageOpen *open,mFuncLoadImageCheck *checks,int headsize);
@@ -216,6 +216,7 @@ mlkerr mPSDLoad_startLayer(mPSDLoad *p);
 mlkerr mPSDLoad_setLayerImageCh_id(mPSDLoad *p,int layerno,int chid,mPSDImageInfo *info);
 mlkerr mPSDLoad_setLayerImageCh_no(mPSDLoad *p,int layerno,int chno,mPSDImageInfo *info);
 mlkerr mPSDLoad_readLayerImageRowCh(mPSDLoad *p,uint8_t *buf);
+mlkerr mPSDLoad_readLayerImageCh_parallel(mPSDLoad *p,int layerno,int chid,uint8_t **ppbuf);
 mlkerr mPSDLoad_readLayerMaskImageRow(mPSDLoad *p,uint8_t *buf);
 
 /* save */
@@ -254,6 +255,7 @@ mlkerr mPSDSave_startLayerImage(mPSDSave *p);
 mlkerr mPSDSave_writeLayerImage_empty(mPSDSave *p);
 mlkerr mPSDSave_startLayerImageCh(mPSDSave *p,int chid);
 mlkerr mPSDSave_writeLayerImageRowCh(mPSDSave *p,uint8_t *buf);
+mlkerr mPSDSave_writeLayerImageRowsCh_parallel(mPSDSave *p,uint8_t **ppbuf,int rows);
 mlkerr mPSDSave_endLayerImageCh(mPSDSave *p);
 void mPSDSave_endLayerImage(mPSDSave *p);
 mlkerr mPSDSave_endLayer(mPSDSave *p);
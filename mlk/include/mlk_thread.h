@@ -38,6 +38,10 @@ void mThreadDestroy(mThread *p);
 mlkbool mThreadRun(mThread *p);
 mlkbool mThreadWait(mThread *p);
 
+int mThreadGetProcessorNum(void);
+int mThreadRunParallel(int jobnum,int (*func)(int no,void *param),void *param);
+int mThreadRunParallel_max(int jobnum,int maxnum,int (*func)(int no,void *param),void *param);
+
 mThreadMutex mThreadMutexNew(void);
 void mThreadMutexDestroy(mThreadMutex p);
 void mThreadMutexLock(mThreadMutex p);
@@ -49,6 +53,11 @@ void mThreadCondSignal(mThreadCond p);
 void mThreadCondBroadcast(mThreadCond p);
 void mThreadCondWait(mThreadCond p,mThreadMutex mutex);
 
+mThreadKey mThreadKeyNew(void (*destructor)(void *));
+void mThreadKeyDestroy(mThreadKey p);
+void *mThreadKeyGetValue(mThreadKey p);
+void mThreadKeySetValue(mThreadKey p,void *value);
+
 #ifdef __cplusplus
 }
 #endif
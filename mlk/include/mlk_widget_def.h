@@ -171,7 +171,8 @@ enum MWIDGET_EVENT_FLAGS
 	MWIDGET_EVENT_KEY     = 1<<2,
 	MWIDGET_EVENT_CHAR    = 1<<3,
 	MWIDGET_EVENT_STRING  = 1<<4,
-	MWIDGET_EVENT_PENTABLET = 1<<5
+	MWIDGET_EVENT_PENTABLET = 1<<5,
+	MWIDGET_EVENT_COMBINE_MOTION = 1<<6
 };
 
 enum MWIDGET_ACCEPTKEY_FLAGS
@@ -40,6 +40,51 @@ $*/
 
 #define _GETEVENT(p)  (mEvent *)((uint8_t *)(p) + sizeof(mListItem))
 
+/* イベントアイテムのプール
+ *
+ * [_blockhead][mListItem][mEvent] の形で確保する。
+ * サイズクラスごとに解放されたブロックを保持し、再利用する。
+ * クラスに収まらないサイズは、通常通り確保/解放する。 */
+
+#define _BLOCKHEAD_SIZE  16		//double のアライメントを保つため
+#define _POOL_CLASS_NUM  2
+#define _POOL_KEEP_MAX   256	//1クラスあたりの最大保持数
+
+#define _GETBLOCK(item)  ((_blockhead *)((uint8_t *)(item) - _BLOCKHEAD_SIZE))
+
+typedef struct _blockhead
+{
+	struct _blockhead *next;	//プール内での次のブロック
+	int sizeclass;				//-1 でプール外
+}_blockhead;
+
+typedef struct
+{
+	_blockhead *top;
+	int num;
+}_poolclass;
+
+static const int g_pool_size[_POOL_CLASS_NUM] = {64, 128};	//mListItem + イベントのサイズ
+
+static _poolclass g_pool[_POOL_CLASS_NUM];
+
+/* ペンタブレットの結合された履歴
+ *
+ * リングバッファ。イベントは古い順に処理されるため、
+ * 処理済みの位置 (read) まで解放される。 */
+
+#define _HISTORY_NUM  1024
+
+typedef struct
+{
+	double x,y,pressure;
+	uint32_t state,flags;
+}_histpoint;
+
+static _histpoint g_history[_HISTORY_NUM];
+static uint32_t g_history_write,
+	g_history_read;
+
 //------------------------
 
 
@@ -48,28 +93,96 @@ $*/
 //======================
 
 
-/** 指定イベントを一番新しいものから検索 */
+/* アイテム確保 (ゼロクリア済み) */
 
-/*
-static mEvent *_search_bottom(mWidget *widget,int type,mListItem **ppitem)
+static mListItem *_item_alloc(int size)
 {
-	mListItem *pi;
-	mEvent *ev;
+	_blockhead *p;
+	int cls;
+
+	size += sizeof(mListItem);
 
-	for(pi = _LIST.bottom; pi; pi = pi->prev)
+	for(cls = 0; cls < _POOL_CLASS_NUM; cls++)
 	{
-		ev = _GETEVENT(pi);
-	
-		if(ev->widget == widget && ev->type == type)
+		if(size <= g_pool_size[cls]) break;
+	}
+
+	if(cls == _POOL_CLASS_NUM)
+	{
+		//プール外
+
+		p = (_blockhead *)mMalloc(_BLOCKHEAD_SIZE + size);
+		cls = -1;
+	}
+	else if(g_pool[cls].top)
+	{
+		//プールから取得
+
+		p = g_pool[cls].top;
+		g_pool[cls].top = p->next;
+		g_pool[cls].num--;
+
+		size = g_pool_size[cls];
+	}
+	else
+	{
+		size = g_pool_size[cls];
+		
+		p = (_blockhead *)mMalloc(_BLOCKHEAD_SIZE + size);
+	}
+
+	if(!p) return NULL;
+
+	p->sizeclass = cls;
+
+	mMemset0((uint8_t *)p + _BLOCKHEAD_SIZE, size);
+
+	return (mListItem *)((uint8_t *)p + _BLOCKHEAD_SIZE);
+}
+
+/* アイテム解放 (破棄ハンドラは呼ばない) */
+
+static void _item_free(mListItem *item)
+{
+	_blockhead *p = _GETBLOCK(item);
+	_poolclass *pool;
+
+	if(p->sizeclass < 0)
+		mFree(p);
+	else
+	{
+		pool = g_pool + p->sizeclass;
+
+		if(pool->num >= _POOL_KEEP_MAX)
+			mFree(p);
+		else
 		{
-			if(ppitem) *ppitem = pi;
-			return ev;
+			p->next = pool->top;
+			pool->top = p;
+			pool->num++;
 		}
 	}
+}
 
-	return NULL;
+/* プールを空にする */
+
+static void _pool_free(void)
+{
+	_blockhead *p,*next;
+	int i;
+
+	for(i = 0; i < _POOL_CLASS_NUM; i++)
+	{
+		for(p = g_pool[i].top; p; p = next)
+		{
+			next = p->next;
+			mFree(p);
+		}
+
+		g_pool[i].top = NULL;
+		g_pool[i].num = 0;
+	}
 }
-*/
 
 /* アイテム破棄ハンドラ */
 
@@ -85,6 +198,82 @@ static void _item_destroy(mList *list,mListItem *item)
 	}
 }
 
+/* リストから削除 */
+
+static void _item_delete(mListItem *item)
+{
+	mListRemoveItem(_LISTPTR, item);
+
+	_item_destroy(NULL, item);
+	_item_free(item);
+}
+
+/* MOTION イベントか */
+
+static mlkbool _is_motion(mEvent *ev)
+{
+	return ((ev->type == MEVENT_POINTER && ev->pt.act == MEVENT_POINTER_ACT_MOTION)
+		|| (ev->type == MEVENT_PENTABLET && ev->pentab.act == MEVENT_POINTER_ACT_MOTION));
+}
+
+/* 結合する MOTION イベントを終端から検索
+ *
+ * 同じウィジェットの MOTION が続いている間のみ対象とする。
+ * POINTER と PENTABLET が交互に追加される場合があるため、2つ前まで見る。 */
+
+static mEvent *_search_combine_motion(mWidget *wg,int type,uint32_t state)
+{
+	mListItem *pi;
+	mEvent *ev;
+	int i;
+
+	for(pi = _LIST.bottom, i = 0; pi && i < 2; pi = pi->prev, i++)
+	{
+		ev = _GETEVENT(pi);
+
+		if(ev->widget != wg || !_is_motion(ev))
+			return NULL;
+
+		if(ev->type == type)
+		{
+			if(type == MEVENT_POINTER)
+				return (ev->pt.state == state)? ev: NULL;
+			else
+				return (ev->pentab.state == state)? ev: NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/* ペンタブレットのイベントの現在値を履歴に追加
+ *
+ * return: FALSE で、バッファがいっぱい */
+
+static mlkbool _add_pentab_history(mEventPenTablet *ev)
+{
+	_histpoint *pt;
+
+	if(g_history_write - g_history_read >= _HISTORY_NUM)
+		return FALSE;
+
+	if(ev->history_num == 0)
+		ev->history_top = g_history_write;
+
+	pt = g_history + (g_history_write % _HISTORY_NUM);
+
+	pt->x = ev->x;
+	pt->y = ev->y;
+	pt->pressure = ev->pressure;
+	pt->state = ev->state;
+	pt->flags = ev->flags;
+
+	g_history_write++;
+	ev->history_num++;
+
+	return TRUE;
+}
+
 
 //======================
 // main
@@ -98,20 +287,42 @@ void mEventListInit(void)
 	_LIST.item_destroy = _item_destroy;
 }
 
-/** イベントをすべて削除 */
+/** イベントをすべて削除
+ *
+ * プールも解放する。 */
 
 void mEventListEmpty(void)
 {
-	mListDeleteAll(_LISTPTR);
+	while(_LIST.top)
+		_item_delete(_LIST.top);
+
+	_pool_free();
+
+	g_history_read = g_history_write;
 }
 
 /** イベント取得後のアイテム削除 */
 
 void mEventFreeItem(void *item)
 {
+	mEvent *ev = _GETEVENT(item);
+
+	//処理済みの履歴を解放
+
+	if(ev->type == MEVENT_PENTABLET && ev->pentab.history_num)
+	{
+		if((int32_t)(ev->pentab.history_top + ev->pentab.history_num - g_history_read) > 0)
+			g_history_read = ev->pentab.history_top + ev->pentab.history_num;
+	}
+
+	//イベントが残っていない場合は、すべて解放
+
+	if(!_LIST.top)
+		g_history_read = g_history_write;
+
 	_item_destroy(NULL, MLISTITEM(item));
 
-	mFree(item);
+	_item_free(MLISTITEM(item));
 }
 
 /** イベント追加 (データサイズ指定) */
@@ -121,9 +332,11 @@ mEvent *mEventListAdd(mWidget *wg,int type,int size)
 	mListItem *p;
 	mEvent *ev;
 
-	p = mListAppendNew(_LISTPTR, sizeof(mListItem) + size);
+	p = _item_alloc(size);
 	if(!p) return NULL;
 
+	mListAppendItem(_LISTPTR, p);
+
 	ev = _GETEVENT(p);
 
 	ev->type = type;
@@ -132,6 +345,30 @@ mEvent *mEventListAdd(mWidget *wg,int type,int size)
 	return ev;
 }
 
+/** MOTION イベント追加
+ *
+ * ウィジェットが MWIDGET_EVENT_COMBINE_MOTION を持つ場合、
+ * 終端にある同じ状態の MOTION イベントと結合する。
+ * PENTABLET の場合、結合される前の値は履歴に残る。
+ *
+ * type: MEVENT_POINTER or MEVENT_PENTABLET
+ * return: 新規または結合先のイベント。値をセットすること。 */
+
+mEvent *mEventListAdd_motion(mWidget *wg,int type,int size,uint32_t state)
+{
+	mEvent *ev;
+
+	if(wg->fevent & MWIDGET_EVENT_COMBINE_MOTION)
+	{
+		ev = _search_combine_motion(wg, type, state);
+
+		if(ev && (type == MEVENT_POINTER || _add_pentab_history(&ev->pentab)))
+			return ev;
+	}
+
+	return mEventListAdd(wg, type, size);
+}
+
 /** イベント追加 (mEventBase) */
 
 void mEventListAdd_base(mWidget *widget,int type)
@@ -195,7 +432,7 @@ void mEventListDelete_widget(mWidget *widget)
 		ev = _GETEVENT(p);
 	
 		if(ev->widget == widget)
-			mListDelete(list, p);
+			_item_delete(p);
 	}
 }
 
@@ -231,7 +468,44 @@ void mEventListCombineConfigure(void)
 
 		//last 削除
 	
-		mListDelete(_LISTPTR, last);
+		_item_delete(last);
 	}
 }
 
+
+//======================
+// 履歴
+//======================
+
+
+/**@ 結合されたペンタブレットの MOTION の履歴を取得
+ *
+ * @d:MWIDGET_EVENT_COMBINE_MOTION により結合された PENTABLET イベントの場合、
+ * 結合される前の値が古い順に記録されている (ev->pentab.history_num 個)。\
+ * dst には ev がコピーされ、位置・筆圧・状態が履歴の値になる。\
+ * イベントハンドラ内でのみ有効。
+ *
+ * @p:no 履歴の番号 (0 が一番古い)
+ * @r:FALSE で範囲外 */
+
+mlkbool mGuiGetPenTabletHistory(const mEvent *ev,int no,mEvent *dst)
+{
+	const _histpoint *pt;
+
+	if(ev->type != MEVENT_PENTABLET
+		|| no < 0 || no >= ev->pentab.history_num)
+		return FALSE;
+
+	pt = g_history + ((ev->pentab.history_top + no) % _HISTORY_NUM);
+
+	*dst = *ev;
+
+	dst->pentab.x = pt->x;
+	dst->pentab.y = pt->y;
+	dst->pentab.pressure = pt->pressure;
+	dst->pentab.state = pt->state;
+	dst->pentab.flags = pt->flags;
+	dst->pentab.history_num = 0;
+
+	return TRUE;
+}
@@ -438,6 +438,17 @@ void mGuiSetBlockUserAction(mlkbool on)
 		MLKAPP->flags &= ~MAPPBASE_FLAGS_BLOCK_USER_ACTION;
 }
 
+/**@ 処理時間計測用のハンドラをセット
+ *
+ * @d:画面への転送時とタイマー処理時に、開始と終了で呼ばれる。
+ * @p:handle NULL で解除。\
+ * type は MGUI_TRACE_*。end は、開始時 FALSE、終了時 TRUE。 */
+
+void mGuiSetTraceHandle(void (*handle)(int type,mlkbool end))
+{
+	MLKAPP->trace_handle = handle;
+}
+
 /**@ GUI 用のデフォルトのフォントシステムを取得 */
 
 mFontSystem *mGuiGetFontSystem(void)
@@ -1020,6 +1031,9 @@ mlkbool mGuiRenderWindows(void)
 	mRect rc;
 	mWindowDecoInfo info;
 	mlkbool ret = FALSE;
+
+	if(MLKAPP->trace_handle)
+		(MLKAPP->trace_handle)(MGUI_TRACE_RENDER, FALSE);
 	
 	for(p = MLK_WINDOW(MLKAPP->widget_root->first); p; p = MLK_WINDOW(p->wg.next))
 	{
@@ -1065,6 +1079,9 @@ mlkbool mGuiRenderWindows(void)
 		p->wg.fui &= ~(MWIDGET_UI_UPDATE | MWIDGET_UI_DECO_UPDATE);
 	}
 
+	if(MLKAPP->trace_handle)
+		(MLKAPP->trace_handle)(MGUI_TRACE_RENDER, TRUE);
+
 	return ret;
 }
 
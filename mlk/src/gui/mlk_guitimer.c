@@ -111,6 +111,9 @@ void mGuiTimerProc(void)
 	p = _ITEM(list->top);
 	if(!p) return;
 
+	if(MLKAPP->trace_handle)
+		(MLKAPP->trace_handle)(MGUI_TRACE_TIMER, FALSE);
+
 	//現在時間
 
 	mNanoTimeGet(&nt_now);
@@ -151,6 +154,9 @@ void mGuiTimerProc(void)
 		
 		mListMove(list, MLISTITEM(p), MLISTITEM(pmove));
 	}
+
+	if(MLKAPP->trace_handle)
+		(MLKAPP->trace_handle)(MGUI_TRACE_TIMER, TRUE);
 }
 
 
@@ -1273,7 +1273,7 @@ mWidget *__mEventProcMotion(mWindow *win,int fx,int fy,uint32_t state,mlkbool ad
 
 	if(wg->fevent & MWIDGET_EVENT_POINTER)
 	{
-		ev = mEventListAdd(wg, MEVENT_POINTER, sizeof(mEventPointer));
+		ev = mEventListAdd_motion(wg, MEVENT_POINTER, sizeof(mEventPointer), state);
 		if(ev)
 		{
 			ev->pt.act = MEVENT_POINTER_ACT_MOTION;
@@ -1290,7 +1290,7 @@ mWidget *__mEventProcMotion(mWindow *win,int fx,int fy,uint32_t state,mlkbool ad
 	if((wg->fevent & MWIDGET_EVENT_PENTABLET)
 		&& add_pentab)
 	{
-		ev = mEventListAdd(wg, MEVENT_PENTABLET, sizeof(mEventPenTablet));
+		ev = mEventListAdd_motion(wg, MEVENT_PENTABLET, sizeof(mEventPenTablet), state);
 		if(ev)
 		{
 			ev->pentab.act = MEVENT_POINTER_ACT_MOTION;
@@ -1364,8 +1364,8 @@ void __mEventProcMotion_pentab(mWindow *win,double x,double y,
 
 	if(wg && (wg->fevent & MWIDGET_EVENT_PENTABLET))
 	{
-		ev = (mEventPenTablet *)mEventListAdd(wg, MEVENT_PENTABLET,
-			sizeof(mEventPenTablet));
+		ev = (mEventPenTablet *)mEventListAdd_motion(wg, MEVENT_PENTABLET,
+			sizeof(mEventPenTablet), state);
 
 		if(ev)
 		{
@@ -175,6 +175,8 @@ typedef struct _mAppBase
 	int32_t pointer_last_win_fx,	//Enter & Motion イベントの一番最後の位置
 		pointer_last_win_fy;		//(装飾含含むウィンドウ座標、24:8 固定少数)
 
+	void (*trace_handle)(int type,mlkbool end);	//処理時間計測用
+
 	uint32_t flags;
 }mAppBase;
 
@@ -222,6 +224,7 @@ void mEventFreeItem(void *item);
 mEvent *mEventListAdd(mWidget *wg,int type,int size);
 void mEventListAdd_base(mWidget *widget,int type);
 void mEventListAdd_focus(mWidget *widget,mlkbool is_out,int from);
+mEvent *mEventListAdd_motion(mWidget *wg,int type,int size,uint32_t state);
 
 mEvent *mEventListGetEvent(void **itemptr);
 void mEventListDelete_widget(mWidget *widget);
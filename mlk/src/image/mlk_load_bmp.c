@@ -708,18 +708,14 @@ static void _convline_bitfields(bmpdata *p,mLoadImage *pli,uint8_t *pd)
 
 static int _read_image(bmpdata *p,mLoadImage *pli)
 {
-	uint8_t **ppbuf,*rawbuf;
+	uint8_t *rawbuf,*dstbuf;
 	mFuncImageConv funcconv;
 	mImageConv conv;
-	int32_t pitch,i,ret,height,prog_cur,prog;
+	int32_t pitch,i,y,ret,height,prog_cur,prog;
 	mlkbool fRLE;
 
-	ppbuf = pli->imgbuf;
 	rawbuf = p->rawbuf;
 	height = p->height;
-
-	if(p->fbottomup)
-		ppbuf += height - 1;
 	
 	pitch = p->pitch;
 	fRLE = (p->compression == BI_RLE4 || p->compression == BI_RLE8);
@@ -783,20 +779,22 @@ static int _read_image(bmpdata *p,mLoadImage *pli)
 
 		//変換
 
+		y = (p->fbottomup)? height - 1 - i: i;
+
+		dstbuf = mLoadImage_getRowBuf(pli, y);
+
 		if(funcconv)
 		{
-			conv.dstbuf = *ppbuf;
+			conv.dstbuf = dstbuf;
 			(funcconv)(&conv);
 		}
 		else
-			_convline_bitfields(p, pli, *ppbuf);
+			_convline_bitfields(p, pli, dstbuf);
 
-		//
+		//ストリップ出力
 
-		if(p->fbottomup)
-			ppbuf--;
-		else
-			ppbuf++;
+		ret = mLoadImage_putRow(pli, y);
+		if(ret) return ret;
 
 		//進捗
 
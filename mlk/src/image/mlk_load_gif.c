@@ -21,6 +21,8 @@ $*/
  * GIF 読み込み
  *****************************************/
 
+#include <string.h>
+
 #include "mlk.h"
 #include "mlk_loadimage.h"
 #include "mlk_gifdec.h"
@@ -145,7 +147,7 @@ static mlkerr _gif_open(mLoadImage *pli)
 static mlkerr _gif_getimage(mLoadImage *pli)
 {
 	mGIFDec *gif = (mGIFDec *)pli->handle;
-	uint8_t **ppbuf,*palbuf;
+	uint8_t *palbuf,*buf;
 	int format,num,ret,prog,prog_cur,height,i;
 	mlkbool to_a0;
 
@@ -177,16 +179,22 @@ static mlkerr _gif_getimage(mLoadImage *pli)
 
 	//イメージセット
 
-	ppbuf = pli->imgbuf;
 	height = pli->height;
 	prog_cur = 0;
 
 	for(i = 0; i < height; i++)
 	{
-		if(!mGIFDec_getNextLine(gif, *ppbuf, format, to_a0))
-			break;
+		buf = mLoadImage_getRowBuf(pli, i);
+
+		//途中でデータが終わった場合は、残りを 0 に
+
+		if(!mGIFDec_getNextLine(gif, buf, format, to_a0))
+			memset(buf, 0, pli->line_bytes);
+
+		//ストリップ出力
 
-		ppbuf++;
+		ret = mLoadImage_putRow(pli, i);
+		if(ret) return ret;
 
 		//進捗
 
@@ -319,26 +319,36 @@ static mlkerr _jpeg_open(mLoadImage *pli)
 static mlkerr _jpeg_getimage(mLoadImage *pli)
 {
 	jpegdata *p = (jpegdata *)pli->handle;
-	uint8_t **ppbuf;
-	int i,cnt,to_rgba,height,prog,prog_cur;
+	uint8_t *buf;
+	int i,ret,to_rgba,is_cmyk,height,prog,prog_cur;
 
 	//読み込み
 
-	ppbuf = pli->imgbuf;
 	to_rgba = (pli->coltype == MLOADIMAGE_COLTYPE_RGBA);
+	is_cmyk = (pli->coltype == MLOADIMAGE_COLTYPE_CMYK);
 	height = p->jpg.output_height;
 	prog_cur = 0;
 
 	for(i = 0; i < height; i++)
 	{
-		jpeg_read_scanlines(&p->jpg, (JSAMPARRAY)ppbuf, 1);
+		buf = mLoadImage_getRowBuf(pli, i);
+	
+		jpeg_read_scanlines(&p->jpg, (JSAMPARRAY)&buf, 1);
 
 		//RGBA の場合、RGB -> RGBA
 
 		if(to_rgba)
-			mImageConv_rgb8_to_rgba8_extend(*ppbuf, pli->width);
+			mImageConv_rgb8_to_rgba8_extend(buf, pli->width);
+
+		//CMYK の場合、値を反転
+
+		if(is_cmyk)
+			mReverseVal_8bit(buf, pli->width << 2);
 
-		ppbuf++;
+		//ストリップ出力
+
+		ret = mLoadImage_putRow(pli, i);
+		if(ret) return ret;
 
 		//進捗
 
@@ -353,21 +363,6 @@ static mlkerr _jpeg_getimage(mLoadImage *pli)
 			}
 		}
 	}
-	
-	//CMYK の場合、値を反転
-
-	if(pli->coltype == MLOADIMAGE_COLTYPE_CMYK)
-	{
-		ppbuf = pli->imgbuf;
-		cnt = pli->width << 2;
-	
-		for(i = pli->height; i > 0; i--)
-		{
-			mReverseVal_8bit(*ppbuf, cnt);
-
-			ppbuf++;
-		}
-	}
 
 	//終了
 
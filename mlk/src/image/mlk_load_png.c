@@ -24,6 +24,8 @@ $*/
 #include <png.h>
 //[!] setjmp.h はインクルードしない。コンパイルエラーが出る場合がある
 
+#include <string.h>
+
 #include "mlk.h"
 #include "mlk_loadimage.h"
 #include "mlk_io.h"
@@ -41,6 +43,8 @@ typedef struct
 
 	mLoadImage *pli;
 	uint8_t *palbuf;
+	uint8_t *ilbuf,		//ストリップ出力時のインターレース用
+		**ilrows;
 	int palnum,
 		prog_cur,
 		fconvpal;	//透過付きパレット->RGBA 変換を行う
@@ -502,47 +506,113 @@ static int _read_info(pngdata *p,mLoadImage *pli)
 	return _proc_info(p, pli);
 }
 
-/* 透過付きパレット8bit -> RGBA 変換
+/* 透過付きパレット8bit -> RGBA 変換 (パレットの準備)
  *
  * - 透過色のアルファ値変換なし時。
  * - A=0 のパレットは、A=255 にする。それ以外のアルファ値はそのまま。 */
 
-static void _convert_pal_to_rgba(pngdata *p,mLoadImage *pli)
+static void _convert_pal_to_rgba_init(pngdata *p)
 {
-	uint8_t **ppbuf,*pd,*ps,*ppal,*palbuf;
-	int ix,iy,src_right,dst_right;
-
-	palbuf = p->palbuf;
+	uint8_t *pd;
+	int i;
 
-	//パレットの A=0 を 255 に
+	pd = p->palbuf + 3;
 
-	pd = palbuf + 3;
-
-	for(ix = p->palnum; ix; ix--, pd += 4)
+	for(i = p->palnum; i; i--, pd += 4)
 	{
 		if(*pd == 0)
 			*pd = 255;
 	}
+}
+
+/* 透過付きパレット8bit -> RGBA 変換 (Y1行) */
+
+static void _convert_pal_to_rgba_line(pngdata *p,uint8_t *buf,int width)
+{
+	uint8_t *pd,*ps,*ppal,*palbuf;
+	int i;
+
+	palbuf = p->palbuf;
+
+	ps = buf + width - 1;
+	pd = buf + (width - 1) * 4;
+
+	for(i = width; i; i--, pd -= 4, ps--)
+	{
+		ppal = palbuf + (*ps << 2);
+
+		*((uint32_t *)pd) = *((uint32_t *)ppal);
+	}
+}
 
-	//RGBA 変換
+/* 透過付きパレット8bit -> RGBA 変換 (全体) */
+
+static void _convert_pal_to_rgba(pngdata *p,mLoadImage *pli)
+{
+	uint8_t **ppbuf;
+	int i;
+
+	_convert_pal_to_rgba_init(p);
 
 	ppbuf = pli->imgbuf;
-	src_right = pli->width - 1;
-	dst_right = src_right * 4;
 
-	for(iy = pli->height; iy; iy--)
+	for(i = pli->height; i; i--)
+		_convert_pal_to_rgba_line(p, *(ppbuf++), pli->width);
+}
+
+/* イメージ読み込み (ストリップ出力)
+ *
+ * インターレースの場合は、全体を読み込んでから出力する。 */
+
+static mlkerr _getimage_strip(pngdata *p,mLoadImage *pli)
+{
+	uint8_t *buf;
+	int y,ret,rowbytes;
+
+	rowbytes = png_get_rowbytes(p->png, p->pnginfo);
+
+	if(setjmp(png_jmpbuf(p->png)))
+		return MLKERR_LONGJMP;
+
+	//インターレース
+
+	if(png_get_interlace_type(p->png, p->pnginfo) == PNG_INTERLACE_ADAM7)
 	{
-		pd = ps = *(ppbuf++);
-		ps += src_right;
-		pd += dst_right;
-	
-		for(ix = pli->width; ix; ix--, pd -= 4, ps--)
-		{
-			ppal = palbuf + (*ps << 2);
+		p->ilbuf = (uint8_t *)mMalloc((mlksize)rowbytes * pli->height);
+		p->ilrows = (uint8_t **)mMalloc(sizeof(void *) * pli->height);
 
-			*((uint32_t *)pd) = *((uint32_t *)ppal);
-		}
+		if(!p->ilbuf || !p->ilrows) return MLKERR_ALLOC;
+
+		for(y = 0; y < pli->height; y++)
+			p->ilrows[y] = p->ilbuf + (mlksize)rowbytes * y;
+
+		png_read_image(p->png, p->ilrows);
 	}
+
+	//
+
+	if(p->fconvpal)
+		_convert_pal_to_rgba_init(p);
+
+	for(y = 0; y < pli->height; y++)
+	{
+		buf = mLoadImage_getRowBuf(pli, y);
+
+		if(p->ilrows)
+			memcpy(buf, p->ilrows[y], rowbytes);
+		else
+			png_read_row(p->png, buf, NULL);
+
+		if(p->fconvpal)
+			_convert_pal_to_rgba_line(p, buf, pli->width);
+
+		ret = mLoadImage_putRow(pli, y);
+		if(ret) return ret;
+	}
+
+	png_read_end(p->png, NULL);
+
+	return MLKERR_OK;
 }
 
 
@@ -572,6 +642,8 @@ static void _png_close(mLoadImage *pli)
 		mIO_close(p->io);
 		
 		mFree(p->palbuf);
+		mFree(p->ilbuf);
+		mFree(p->ilrows);
 	}
 
 	mLoadImage_closeHandle(pli);
@@ -605,6 +677,11 @@ static mlkerr _png_getimage(mLoadImage *pli)
 	ret = mLoadImage_setPalette(pli, p->palbuf, 256 * 4, p->palnum);
 	if(ret) return ret;
 
+	//ストリップ出力
+
+	if(pli->setstrip)
+		return _getimage_strip(p, pli);
+
 	//イメージ
 
 	png_read_image(p->png, pli->imgbuf);
@@ -548,7 +548,7 @@ static mlkerr _tiff_open(mLoadImage *pli)
 static mlkerr _tiff_getimage(mLoadImage *pli)
 {
 	tiffdata *p = (tiffdata *)pli->handle;
-	uint8_t *rowbuf,**ppbuf;
+	uint8_t *rowbuf,*dstbuf;
 	mFuncImageConv funcconv;
 	mImageConv conv;
 	int y,ret,pitch,height,prog,prog_cur;
@@ -575,24 +575,30 @@ static mlkerr _tiff_getimage(mLoadImage *pli)
 	//変換
 
 	rowbuf = p->rowbuf;
-	ppbuf = pli->imgbuf;
 	height = pli->height;
 	prog_cur = 0;
 
-	for(y = 0; y < height; y++, ppbuf++)
+	for(y = 0; y < height; y++)
 	{
 		ret = _get_row_image(p, y);
 		if(ret) return ret;
 
+		dstbuf = mLoadImage_getRowBuf(pli, y);
+
 		if(!funcconv)
 			//CMYK 8,16bit raw
-			memcpy(*ppbuf, rowbuf, pitch);
+			memcpy(dstbuf, rowbuf, pitch);
 		else
 		{
-			conv.dstbuf = *ppbuf;
+			conv.dstbuf = dstbuf;
 			(funcconv)(&conv);
 		}
 
+		//ストリップ出力
+
+		ret = mLoadImage_putRow(pli, y);
+		if(ret) return ret;
+
 		//進捗
 
 		if(pli->progress)
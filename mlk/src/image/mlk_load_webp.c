@@ -242,7 +242,7 @@ static mlkerr _webp_open(mLoadImage *pli)
 static mlkerr _webp_getimage(mLoadImage *pli)
 {
 	webpdata *p = (webpdata *)pli->handle;
-	uint8_t **ppbuf,*ps;
+	uint8_t *ps;
 	mFuncImageConv funcconv;
 	mImageConv conv;
 	WebPDecBuffer decbuf;
@@ -261,7 +261,6 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 
 	//変換
 
-	ppbuf = pli->imgbuf;
 	height = pli->height;
 	ps = decbuf.u.RGBA.rgba;
 	prog_cur = 0;
@@ -269,15 +268,17 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 	for(i = 0; i < height; i++)
 	{
 		conv.srcbuf = ps;
-		conv.dstbuf = *ppbuf;
+		conv.dstbuf = mLoadImage_getRowBuf(pli, i);
 
 		(funcconv)(&conv);
 
-		//
-	
-		ppbuf++;
 		ps += decbuf.u.RGBA.stride;
 
+		//ストリップ出力
+
+		ret = mLoadImage_putRow(pli, i);
+		if(ret) break;
+
 		//進捗
 
 		if(pli->progress)
@@ -175,6 +175,62 @@ void mLoadImage_setImageConv(mLoadImage *p,mImageConv *dst)
 		dst->convtype = MIMAGECONV_CONVTYPE_NONE;
 }
 
+/**@ Y位置のラインバッファを取得
+ *
+ * @d:ストリップ出力時は、ストリップ内の位置のバッファが返る。
+ *
+ * @p:y イメージ上の Y 位置 */
+
+uint8_t *mLoadImage_getRowBuf(mLoadImage *p,int y)
+{
+	if(p->setstrip)
+		y %= p->strip_height;
+
+	return p->imgbuf[y];
+}
+
+/**@ Y1行のイメージをセットした後の処理
+ *
+ * @d:ストリップ出力時、ストリップ内のすべての行がセットされたら、
+ * setstrip() を呼び出す。\
+ * ストリップ内の行は、どの順番でセットしても良い (ボトムアップ時など)。\
+ * ストリップ出力でない場合は、何もしない。
+ *
+ * @r:setstrip() のエラーコード */
+
+mlkerr mLoadImage_putRow(mLoadImage *p,int y)
+{
+	int top,h;
+
+	if(!p->setstrip) return MLKERR_OK;
+
+	top = y - y % p->strip_height;
+	h = p->height - top;
+	if(h > p->strip_height) h = p->strip_height;
+
+	//ストリップ内のすべての行がセットされた
+
+	if(++(p->strip_cnt) >= h)
+	{
+		p->strip_cnt = 0;
+
+		return (p->setstrip)(p, top, h);
+	}
+
+	return MLKERR_OK;
+}
+
+
+/* imgbuf のライン数を取得 */
+
+static int _get_imgbuf_rows(mLoadImage *p)
+{
+	if(p->setstrip && p->strip_height < p->height)
+		return p->strip_height;
+	else
+		return p->height;
+}
+
 
 //==============================
 
@@ -262,7 +318,7 @@ void mLoadImage_freeImage(mLoadImage *p)
 
 	if(ppbuf)
 	{
-		for(i = p->height; i > 0; i--, ppbuf++)
+		for(i = _get_imgbuf_rows(p); i > 0; i--, ppbuf++)
 			mFree(*ppbuf);
 
 		mFree(p->imgbuf);
@@ -271,7 +327,8 @@ void mLoadImage_freeImage(mLoadImage *p)
 
 /**@ 読み込み用のイメージバッファを確保
  *
- * @d:実行後、imgbuf と line_bytes が上書きされる。
+ * @d:実行後、imgbuf と line_bytes が上書きされる。\
+ * setstrip がセットされている場合は、strip_height 分の行のみ確保する。
  * 
  * @p:line_bytes Y1行のバイト数。\
  *  0 以下で、カラータイプから計算 (4byte単位)。
@@ -280,7 +337,7 @@ void mLoadImage_freeImage(mLoadImage *p)
 mlkbool mLoadImage_allocImage(mLoadImage *p,int line_bytes)
 {
 	uint8_t **ppbuf;
-	int i;
+	int i,rows;
 
 	//Y1行バイト数
 
@@ -294,10 +351,14 @@ mlkbool mLoadImage_allocImage(mLoadImage *p,int line_bytes)
 
 	//イメージバッファ
 
-	ppbuf = p->imgbuf = (uint8_t **)mMalloc0(p->height * sizeof(void*));
+	rows = _get_imgbuf_rows(p);
+
+	p->strip_cnt = 0;
+
+	ppbuf = p->imgbuf = (uint8_t **)mMalloc0(rows * sizeof(void*));
 	if(!ppbuf) return FALSE;
 
-	for(i = p->height; i > 0; i--, ppbuf++)
+	for(i = rows; i > 0; i--, ppbuf++)
 	{
 		*ppbuf = (uint8_t *)mMalloc(line_bytes);
 		if(!(*ppbuf))
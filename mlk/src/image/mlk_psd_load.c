@@ -23,6 +23,9 @@ $*/
 
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 
 #include "mlk.h"
 #include "mlk_rectbox.h"
@@ -32,6 +35,7 @@ $*/
 #include "mlk_util.h"
 #include "mlk_packbits.h"
 #include "mlk_unicode.h"
+#include "mlk_thread.h"
 
 #include "mlk_psd.h"
 
@@ -45,6 +49,9 @@ $*/
 
 #define _INBUFSIZE  (8 * 1024)
 
+//並列読み込み時の1ジョブあたりの行数
+#define _PARALLEL_ROWS  32
+
 //---------------
 
 /* リソースリストアイテム */
@@ -84,9 +91,12 @@ struct _mPSDLoad
 	_layerinfo *layerinfo,	//各レイヤ情報バッファ
 		*curlayerinfo;
 
-	uint8_t *inbuf;			//入力作業用 & PackBits 展開用バッファ
+	uint8_t *inbuf,			//入力作業用 & PackBits 展開用バッファ
+		*mapbuf;			//ファイルのメモリマップ (並列読み込み用。NULL でなし)
 	uint16_t *encsizebuf;	//PackBits 圧縮時の圧縮サイズリストバッファ
 
+	size_t mapsize;			//メモリマップのサイズ
+
 	off_t fpos_resource,	//リソースデータの先頭位置
 		fpos_layertop,		//レイヤデータの先頭位置
 		fpos_imgch[5];		//イメージの各チャンネルのデータ位置
@@ -97,6 +107,7 @@ struct _mPSDLoad
 		size_layer;		//レイヤデータサイズ
 
 	int fp_open,		//ファイルから開いた fp か
+		map_tried,		//メモリマップを試みたか
 		layer_num,		//レイヤ数
 		compress,		//圧縮タイプ (0:無圧縮、1:PackBits)
 		rawlinesize,	//生のラインデータサイズ
@@ -501,6 +512,155 @@ static int _read_row_image(mPSDLoad *p,uint8_t *buf)
 	return MLKERR_OK;
 }
 
+//=========================
+// sub - 並列読み込み
+//=========================
+/* 各ワーカーが共有の FILE * をシークせずに読み込めるように、
+ * ファイルをメモリにマップするか、pread で位置を指定して読み込む。 */
+
+
+typedef struct
+{
+	mPSDLoad *p;
+	uint8_t **ppbuf;
+	off_t *rowpos;	//各行のデータ位置 (height + 1 個)
+	int height,
+		rowsize;
+}_parallel_read;
+
+typedef struct
+{
+	mPSDLoad *p;
+	off_t pos;
+}_pbread_pos;
+
+
+/* ファイルをメモリにマップ (初回時のみ)
+ *
+ * 失敗した場合は pread で読み込む。 */
+
+static void _map_file(mPSDLoad *p)
+{
+	struct stat st;
+	void *buf;
+
+	if(p->map_tried) return;
+
+	p->map_tried = 1;
+
+	if(fstat(fileno(p->fp), &st)
+		|| !S_ISREG(st.st_mode)
+		|| st.st_size == 0
+		|| (uintmax_t)st.st_size > SIZE_MAX)
+		return;
+
+	buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(p->fp), 0);
+	if(buf == MAP_FAILED) return;
+
+	p->mapbuf = (uint8_t *)buf;
+	p->mapsize = st.st_size;
+}
+
+/* 位置を指定して読み込み (スレッドセーフ)
+ *
+ * return: 0 で成功 */
+
+static int _read_pos(mPSDLoad *p,off_t pos,uint8_t *buf,uint32_t size)
+{
+	if(p->mapbuf)
+	{
+		if(pos < 0 || (uintmax_t)pos + size > p->mapsize)
+			return 1;
+
+		memcpy(buf, p->mapbuf + pos, size);
+
+		return 0;
+	}
+	else
+		return (pread(fileno(p->fp), buf, size, pos) != size);
+}
+
+/* PackBits 入力関数 (位置指定) */
+
+static mlkerr _packbits_read_pos(mPackBits *p,uint8_t *buf,int size)
+{
+	_pbread_pos *rd = (_pbread_pos *)p->param;
+
+	if(_read_pos(rd->p, rd->pos, buf, size))
+		return MLKERR_IO;
+
+	rd->pos += size;
+
+	return MLKERR_OK;
+}
+
+/* 並列読み込みのジョブ (_PARALLEL_ROWS 行単位) */
+
+static int _parallel_read_job(int no,void *param)
+{
+	_parallel_read *dat = (_parallel_read *)param;
+	mPSDLoad *p = dat->p;
+	mPackBits pb;
+	_pbread_pos rd;
+	uint8_t *workbuf = NULL,*buf;
+	int y,yend,rowsize,ret = MLKERR_OK;
+
+	y = no * _PARALLEL_ROWS;
+	yend = y + _PARALLEL_ROWS;
+	if(yend > dat->height) yend = dat->height;
+
+	rowsize = dat->rowsize;
+
+	//PackBits 作業用バッファ (ジョブごと)
+
+	if(p->compress == _COMPRESS_PACKBITS)
+	{
+		workbuf = (uint8_t *)mMalloc(_INBUFSIZE);
+		if(!workbuf) return MLKERR_ALLOC;
+
+		pb.workbuf = workbuf;
+		pb.worksize = _INBUFSIZE;
+		pb.readwrite = _packbits_read_pos;
+		pb.param = &rd;
+
+		rd.p = p;
+	}
+
+	for(; y < yend; y++)
+	{
+		buf = dat->ppbuf[y];
+	
+		if(p->compress == _COMPRESS_NONE)
+		{
+			if(_read_pos(p, dat->rowpos[0] + (off_t)rowsize * y, buf, rowsize))
+			{
+				ret = MLKERR_DAMAGED;
+				break;
+			}
+		}
+		else
+		{
+			pb.buf = buf;
+			pb.bufsize = rowsize;
+			pb.encsize = dat->rowpos[y + 1] - dat->rowpos[y];
+
+			rd.pos = dat->rowpos[y];
+
+			ret = mPackBits_decode(&pb);
+			if(ret) break;
+		}
+
+	#if !defined(MLK_BIG_ENDIAN)
+		if(p->bits == 16)
+			mSwapByte_16bit(buf, rowsize >> 1);
+	#endif
+	}
+
+	mFree(workbuf);
+
+	return ret;
+}
+
 /* レイヤマスクをイメージの範囲に合わせる場合の情報セット
  *  (各レイヤのイメージ読み込み開始時) */
 
@@ -1061,6 +1221,9 @@ void mPSDLoad_close(mPSDLoad *p)
 {
 	if(p)
 	{
+		if(p->mapbuf)
+			munmap(p->mapbuf, p->mapsize);
+
 		if(p->fp && p->fp_open)
 			fclose(p->fp);
 
@@ -1772,6 +1935,79 @@ mlkerr mPSDLoad_readLayerImageRowCh(mPSDLoad *p,uint8_t *buf)
 	 return _read_row_image(p, buf);
 }
 
+/**@ レイヤイメージの指定チャンネルの全体を並列で読み込み
+ *
+ * @d:mPSDLoad_setLayerImageCh_id と mPSDLoad_readLayerImageRowCh で、
+ * 全行を読み込むのと同じ結果になる。\
+ * 行単位で複数のスレッドに分けて展開する。\
+ * 各スレッドは、ファイルのメモリマップ (不可の場合は pread) で位置を指定して読み込む。\
+ * レイヤマスクのチャンネルは指定できない。
+ *
+ * @p:chid チャンネルID
+ * @p:ppbuf 各行のバッファのポインタ (イメージの高さ分)。\
+ * 各バッファは、イメージ幅の1行分のサイズが必要。
+ * @r:-1 = レイヤが範囲外、-2 = 指定チャンネルが存在しない */
+
+mlkerr mPSDLoad_readLayerImageCh_parallel(mPSDLoad *p,int layerno,int chid,uint8_t **ppbuf)
+{
+	_parallel_read dat;
+	uint16_t *ps;
+	off_t *rowpos,pos;
+	int i,height;
+	mlkerr ret;
+
+	if(chid == MPSD_CHID_MASK) return MLKERR_UNSUPPORTED;
+
+	//開始 (圧縮サイズリストまで読み込み)
+
+	ret = _set_layerimage_ch(p, layerno, chid, NULL);
+	if(ret) return ret;
+
+	height = p->curlayerinfo->i.box_img.h;
+
+	if(height == 0 || p->rawlinesize == 0)
+		return MLKERR_OK;
+
+	//各行のデータ位置
+
+	rowpos = (off_t *)mMalloc(sizeof(off_t) * (height + 1));
+	if(!rowpos) return MLKERR_ALLOC;
+
+	pos = ftello(p->fp);
+
+	rowpos[0] = pos;
+
+	if(p->compress == _COMPRESS_PACKBITS)
+	{
+		ps = p->encsizebuf;
+
+		for(i = 1; i <= height; i++)
+		{
+			pos += *(ps++);
+			rowpos[i] = pos;
+		}
+	}
+
+	//並列展開
+
+	_map_file(p);
+
+	dat.p = p;
+	dat.ppbuf = ppbuf;
+	dat.rowpos = rowpos;
+	dat.height = height;
+	dat.rowsize = p->rawlinesize;
+
+	ret = mThreadRunParallel((height + _PARALLEL_ROWS - 1) / _PARALLEL_ROWS,
+		_parallel_read_job, &dat);
+
+	mFree(rowpos);
+
+	p->cur_line = height;
+
+	return ret;
+}
+
 /**@ レイヤマスクイメージのY1行データを読み込み
  *
  * @d:マスクのイメージ範囲は、イメージと同じ範囲であるものとして処理され、
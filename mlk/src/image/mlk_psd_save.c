@@ -27,10 +27,12 @@ $*/
 #include "mlk.h"
 #include "mlk_rectbox.h"
 #include "mlk_list.h"
+#include "mlk_buf.h"
 #include "mlk_stdio.h"
 #include "mlk_util.h"
 #include "mlk_packbits.h"
 #include "mlk_unicode.h"
+#include "mlk_thread.h"
 
 #include "mlk_psd.h"
 
@@ -105,6 +107,9 @@ struct _mPSDSave
 
 #define _OUTBUFSIZE  (8 * 1024)
 
+//並列書き込み時の1ジョブあたりの行数
+#define _PARALLEL_ROWS  32
+
 //-------------------
 
 
@@ -261,6 +266,94 @@ static int _write_row_image(mPSDSave *p,uint8_t *buf)
 }
 
 
+//=========================
+// sub - 並列書き込み
+//=========================
+/* 行単位で各スレッドがメモリ上に圧縮し、
+ * 終了後にファイルへ順に書き込む。 */
+
+
+typedef struct
+{
+	mPSDSave *p;
+	uint8_t **ppbuf;
+	mBuf *outbuf;	//各ジョブの出力 (jobnum 個)
+	int top,		//ppbuf[0] の Y 位置
+		height;		//書き込む行数
+}_parallel_write;
+
+
+/* PackBits 出力関数 (メモリ) */
+
+static mlkerr _packbits_write_mem(mPackBits *p,uint8_t *buf,int size)
+{
+	if(!mBufAppend((mBuf *)p->param, buf, size))
+		return MLKERR_ALLOC;
+
+	return MLKERR_OK;
+}
+
+/* 並列書き込みのジョブ (_PARALLEL_ROWS 行単位) */
+
+static int _parallel_write_job(int no,void *param)
+{
+	_parallel_write *dat = (_parallel_write *)param;
+	mPSDSave *p = dat->p;
+	mBuf *outbuf;
+	mPackBits pb;
+	uint8_t *buf,*workbuf;
+	int y,yend,rowsize,ret = MLKERR_OK;
+
+	y = no * _PARALLEL_ROWS;
+	yend = y + _PARALLEL_ROWS;
+	if(yend > dat->height) yend = dat->height;
+
+	rowsize = p->rowsize;
+	outbuf = dat->outbuf + no;
+
+	//バッファ
+
+	workbuf = (uint8_t *)mMalloc(_OUTBUFSIZE);
+	if(!workbuf) return MLKERR_ALLOC;
+
+	if(!mBufAlloc(outbuf, rowsize * (yend - y) / 2 + 256, rowsize * 4 + 256))
+	{
+		mFree(workbuf);
+		return MLKERR_ALLOC;
+	}
+
+	pb.workbuf = workbuf;
+	pb.worksize = _OUTBUFSIZE;
+	pb.readwrite = _packbits_write_mem;
+	pb.param = outbuf;
+	pb.bufsize = rowsize;
+
+	//圧縮
+
+	for(; y < yend; y++)
+	{
+		buf = dat->ppbuf[y];
+
+	#if !defined(MLK_BIG_ENDIAN)
+		if(p->hd.bits == 16)
+			mSwapByte_16bit(buf, rowsize >> 1);
+	#endif
+
+		pb.buf = buf;
+
+		ret = mPackBits_encode(&pb);
+		if(ret) break;
+
+		//各行の圧縮サイズ (行ごとに位置が異なるため、排他不要)
+
+		mSetBufBE16((uint8_t *)(p->encsizebuf + dat->top + y), pb.encsize);
+	}
+
+	mFree(workbuf);
+
+	return ret;
+}
+
 //=========================
 // main
 //=========================
@@ -1170,6 +1263,82 @@ mlkerr mPSDSave_writeLayerImageRowCh(mPSDSave *p,uint8_t *buf)
 	return _write_row_image(p, buf);
 }
 
+/**@ レイヤイメージの各チャンネルの複数行を並列で書き込み
+ *
+ * @d:mPSDSave_writeLayerImageRowCh の代わりに使う。\
+ * 現在の行から rows 行分を書き込む。全体を一度に書き込む必要はなく、
+ * 複数回に分けて実行できる。\
+ * startLayerImageCh と endLayerImageCh の間で実行する。\
+ * PackBits 圧縮は、行単位で複数のスレッドに分けて行われる。\
+ * 16bit 時、ppbuf のデータはバイト順が変換される。
+ *
+ * @p:ppbuf 各行のバッファのポインタ (rows 個)。\
+ *  16bit 時はホストのバイト順。
+ * @p:rows 書き込む行数。残りの行数を超える場合は調整される。 */
+
+mlkerr mPSDSave_writeLayerImageRowsCh_parallel(mPSDSave *p,uint8_t **ppbuf,int rows)
+{
+	_parallel_write dat;
+	mBuf *outbuf;
+	int i,jobnum;
+	mlkerr ret;
+
+	if(rows > p->curimgbox->h - p->cur_line)
+		rows = p->curimgbox->h - p->cur_line;
+
+	if(p->curimgbox->w == 0 || rows <= 0)
+		return MLKERR_OK;
+
+	//無圧縮
+
+	if(p->compress == 0)
+	{
+		for(i = 0; i < rows; i++)
+		{
+			ret = _write_row_image(p, ppbuf[i]);
+			if(ret) return ret;
+		}
+
+		return MLKERR_OK;
+	}
+
+	//PackBits (各ジョブの出力バッファ)
+
+	jobnum = (rows + _PARALLEL_ROWS - 1) / _PARALLEL_ROWS;
+
+	outbuf = (mBuf *)mMalloc0(sizeof(mBuf) * jobnum);
+	if(!outbuf) return MLKERR_ALLOC;
+
+	dat.p = p;
+	dat.ppbuf = ppbuf;
+	dat.outbuf = outbuf;
+	dat.top = p->cur_line;
+	dat.height = rows;
+
+	ret = mThreadRunParallel(jobnum, _parallel_write_job, &dat);
+
+	//順に書き込み
+
+	for(i = 0; i < jobnum; i++)
+	{
+		if(!ret)
+		{
+			if(fwrite(outbuf[i].buf, 1, outbuf[i].cursize, p->fp) != outbuf[i].cursize)
+				ret = MLKERR_IO;
+			else
+				p->imgencsize += outbuf[i].cursize;
+		}
+
+		mBufFree(outbuf + i);
+	}
+
+	mFree(outbuf);
+
+	p->cur_line += rows;
+
+	return ret;
+}
+
 /**@ レイヤイメージの各チャンネルの書き込みを終了 */
 
 mlkerr mPSDSave_endLayerImageCh(mPSDSave *p)
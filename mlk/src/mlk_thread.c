@@ -22,6 +22,7 @@ $*/
  *****************************************/
 
 #include <pthread.h>
+#include <unistd.h>
 
 #include "mlk.h"
 #include "mlk_thread.h"
@@ -29,6 +30,9 @@ $*/
 
 #define _MUTEX(p)  ((pthread_mutex_t *)(p))
 #define _COND(p)   ((pthread_cond_t *)(p))
+#define _KEY(p)    ((pthread_key_t *)(p))
+
+#define _PARALLEL_MAXNUM  32	//並列実行の最大スレッド数
 
 
 
@@ -153,6 +157,165 @@ mlkbool mThreadWait(mThread *p)
 }
 
 
+//*******************************
+// 並列実行
+//*******************************
+
+
+typedef struct
+{
+	pthread_mutex_t mutex;
+	int (*func)(int,void *);
+	void *param;
+	int jobnum,
+		curno,	//次に実行するジョブ番号
+		ret;	//最初のエラー値
+}_parallel;
+
+
+/* 次のジョブ番号を取得
+ *
+ * return: -1 で終了 */
+
+static int _parallel_get_job(_parallel *p)
+{
+	int no;
+
+	pthread_mutex_lock(&p->mutex);
+
+	if(p->ret || p->curno >= p->jobnum)
+		no = -1;
+	else
+		no = p->curno++;
+
+	pthread_mutex_unlock(&p->mutex);
+
+	return no;
+}
+
+/* 各スレッドの処理 */
+
+static void *_parallel_run(void *arg)
+{
+	_parallel *p = (_parallel *)arg;
+	int no,ret;
+
+	while(1)
+	{
+		no = _parallel_get_job(p);
+		if(no < 0) break;
+
+		ret = (p->func)(no, p->param);
+
+		if(ret)
+		{
+			pthread_mutex_lock(&p->mutex);
+			if(!p->ret) p->ret = ret;
+			pthread_mutex_unlock(&p->mutex);
+		}
+	}
+
+	return 0;
+}
+
+/**@ 使用可能なプロセッサ数を取得
+ *
+ * @r:1 以上 */
+
+int mThreadGetProcessorNum(void)
+{
+	long n;
+
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (n < 1)? 1: (int)n;
+}
+
+/**@ ジョブを並列実行
+ *
+ * @d:0〜jobnum-1 の各ジョブ番号で func を実行する。\
+ * プロセッサ数分のスレッド (呼び出し元のスレッドを含む) で処理され、
+ * すべてのジョブが終了するまで戻らない。\
+ * 各ジョブの実行順は不定。\
+ * func が 0 以外を返した場合、以降のジョブは実行されない。
+ *
+ * @p:func ジョブ関数。no はジョブ番号。\
+ * 成功時は 0 を返す。
+ * @r:最初に返されたエラー値。すべて成功した場合は 0。 */
+
+int mThreadRunParallel(int jobnum,int (*func)(int no,void *param),void *param)
+{
+	return mThreadRunParallel_max(jobnum, 0, func, param);
+}
+
+/**@ ジョブを並列実行 (最大スレッド数指定)
+ *
+ * @d:mThreadRunParallel() と同じだが、同時に実行するスレッド数の上限を指定できる。 * ジョブごとに大きなメモリを使う場合など、同時実行数を制限したい時に使う。
+ *
+ * @p:maxnum 最大スレッド数 (呼び出し元のスレッドを含む)。0 以下でプロセッサ数。 */
+
+int mThreadRunParallel_max(int jobnum,int maxnum,int (*func)(int no,void *param),void *param)
+{
+	_parallel dat;
+	pthread_t id[_PARALLEL_MAXNUM];
+	int i,num,ret;
+
+	if(jobnum <= 0) return 0;
+
+	//スレッド数
+
+	num = mThreadGetProcessorNum();
+
+	if(maxnum > 0 && num > maxnum) num = maxnum;
+	if(num > jobnum) num = jobnum;
+	if(num > _PARALLEL_MAXNUM) num = _PARALLEL_MAXNUM;
+
+	//単一スレッド
+
+	if(num == 1)
+	{
+		for(i = 0; i < jobnum; i++)
+		{
+			ret = (func)(i, param);
+			if(ret) return ret;
+		}
+
+		return 0;
+	}
+
+	//並列
+
+	dat.func = func;
+	dat.param = param;
+	dat.jobnum = jobnum;
+	dat.curno = 0;
+	dat.ret = 0;
+
+	pthread_mutex_init(&dat.mutex, NULL);
+
+	//作成できなかった分は、残りのスレッドで処理される
+
+	for(i = 0; i < num - 1; i++)
+	{
+		if(pthread_create(id + i, NULL, _parallel_run, &dat) != 0)
+			break;
+	}
+
+	num = i;
+
+	//呼び出し元スレッドでも実行
+
+	_parallel_run(&dat);
+
+	for(i = 0; i < num; i++)
+		pthread_join(id[i], NULL);
+
+	pthread_mutex_destroy(&dat.mutex);
+
+	return dat.ret;
+}
+
+
 //*******************************
 // mThreadMutex
 //*******************************
@@ -283,3 +446,64 @@ void mThreadCondWait(mThreadCond p,mThreadMutex mutex)
 	if(p) pthread_cond_wait(_COND(p), _MUTEX(mutex));
 }
 
+
+//*******************************
+// mThreadKey
+//*******************************
+
+
+/**@ 削除
+ *
+ * @d:各スレッドにセットされている値は解放されない。 */
+
+void mThreadKeyDestroy(mThreadKey p)
+{
+	if(p)
+	{
+		pthread_key_delete(*_KEY(p));
+		mFree(p);
+	}
+}
+
+/**@ スレッドごとの値のキーを作成
+ *
+ * @g:mThreadKey
+ *
+ * @d:一つのキーで、スレッドごとに別々の値を保持できる。\
+ * 値の初期値は、すべてのスレッドで NULL。
+ *
+ * @p:destructor スレッドの終了時、値が NULL 以外の場合に呼ばれる関数。NULL でなし。\
+ * メインスレッドなど、終了時に呼ばれない場合もあるので、必要なら自身で処理すること。
+ * @r:NULL で失敗 */
+
+mThreadKey mThreadKeyNew(void (*destructor)(void *))
+{
+	pthread_key_t *p;
+
+	p = (pthread_key_t *)mMalloc0(sizeof(pthread_key_t));
+	if(!p) return NULL;
+
+	if(pthread_key_create(p, destructor) != 0)
+	{
+		mFree(p);
+		return NULL;
+	}
+
+	return (mThreadKey)p;
+}
+
+/**@ 現在のスレッドの値を取得
+ *
+ * @r:値がセットされていない場合、NULL */
+
+void *mThreadKeyGetValue(mThreadKey p)
+{
+	return (p)? pthread_getspecific(*_KEY(p)): NULL;
+}
+
+/**@ 現在のスレッドの値をセット */
+
+void mThreadKeySetValue(mThreadKey p,void *value)
+{
+	if(p) pthread_setspecific(*_KEY(p), value);
+}
@@ -0,0 +1,1085 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * ベンチマーク: 各項目
+ *****************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mlk_gui.h"
+#include "mlk_rand.h"
+#include "mlk_str.h"
+#include "mlk_file.h"
+#include "mlk_rectbox.h"
+#include "mlk_util.h"
+
+#include "def_config.h"
+#include "def_draw.h"
+#include "def_brushdraw.h"
+#include "def_filterdraw.h"
+#include "def_tool.h"
+#include "def_tool_option.h"
+
+#include "layerlist.h"
+#include "layeritem.h"
+#include "tileimage.h"
+#include "tileimage_drawinfo.h"
+#include "imagecanvas.h"
+#include "imagematerial.h"
+#include "blendcolor.h"
+#include "drawfill.h"
+#include "undo.h"
+
+#include "draw_main.h"
+#include "draw_calc.h"
+#include "draw_op_sub.h"
+#include "draw_file.h"
+
+#include "filter_drawfunc.h"
+
+#include "def_filterdlg_dat.h"
+
+#include "pv_bench.h"
+
+
+//-----------------
+
+/* フィルタ
+ * (mainwin_filter.c のテーブルと同じ) */
+
+typedef struct
+{
+	const char *name;
+	const uint8_t *dlgdat;	//ダイアログの項目データ (初期値を使う)
+	FilterDrawFunc func;
+	uint8_t flags;
+}_filterdat;
+
+enum
+{
+	_FDF_PROC_COLOR = 1<<0,
+	_FDF_COPYSRC    = 1<<1,
+	_FDF_CLIPPING   = 1<<2,
+	_FDF_NODLG_VAL  = 1<<3,
+	_FDF_NEED_CHECK = 1<<4,
+	_FDF_NEED_TEXTURE = 1<<5	//オプションのテクスチャが必要
+};
+
+#define _DLGDAT_INT(n)  (const uint8_t *)(n)
+
+static const _filterdat g_filter_dat[] = {
+	{"color_brightcont", g_col_brightconst, FilterDraw_color_brightcont, _FDF_PROC_COLOR},
+	{"color_gamma", g_col_gamma, FilterDraw_color_gamma, _FDF_PROC_COLOR},
+	{"color_level", g_col_level, FilterDraw_color_level, _FDF_PROC_COLOR},
+	{"color_rgb", g_col_rgb, FilterDraw_color_rgb, _FDF_PROC_COLOR},
+	{"color_hsv", g_col_hsv, FilterDraw_color_hsv, _FDF_PROC_COLOR},
+	{"color_hsl", g_col_hsl, FilterDraw_color_hsl, _FDF_PROC_COLOR},
+	{"color_nega", NULL, FilterDraw_color_nega, _FDF_PROC_COLOR},
+	{"color_grayscale", NULL, FilterDraw_color_grayscale, _FDF_PROC_COLOR},
+	{"color_sepia", NULL, FilterDraw_color_sepia, _FDF_PROC_COLOR},
+	{"color_gradmap", NULL, FilterDraw_color_gradmap, _FDF_PROC_COLOR},
+	{"color_threshold", g_col_threshold, FilterDraw_color_threshold, _FDF_PROC_COLOR},
+	{"color_threshold_dither", g_col_threshold_dither, FilterDraw_color_threshold_dither, _FDF_PROC_COLOR},
+	{"color_posterize", g_col_posterize, FilterDraw_color_posterize, _FDF_PROC_COLOR},
+
+	{"color_replace_drawcol", g_col_replace_drawcol, FilterDraw_color_replace_drawcol, _FDF_PROC_COLOR},
+	{"color_replace.0", _DLGDAT_INT(0), FilterDraw_color_replace, _FDF_PROC_COLOR | _FDF_NODLG_VAL},
+	{"color_replace.1", _DLGDAT_INT(1), FilterDraw_color_replace, _FDF_PROC_COLOR | _FDF_NODLG_VAL},
+	{"color_replace.2", _DLGDAT_INT(2), FilterDraw_color_replace, _FDF_PROC_COLOR | _FDF_NODLG_VAL},
+	{"color_replace.3", _DLGDAT_INT(3), FilterDraw_color_replace, _FDF_NODLG_VAL},
+
+	{"alpha_checked.0", _DLGDAT_INT(0), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.1", _DLGDAT_INT(1), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.2", _DLGDAT_INT(2), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.3", _DLGDAT_INT(3), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.4", _DLGDAT_INT(4), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.5", _DLGDAT_INT(5), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.6", _DLGDAT_INT(6), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+	{"alpha_checked.7", _DLGDAT_INT(7), FilterDraw_alpha_checked, _FDF_NODLG_VAL | _FDF_NEED_CHECK},
+
+	{"alpha_current.0", _DLGDAT_INT(0), FilterDraw_alpha_current, _FDF_NODLG_VAL},
+	{"alpha_current.1", _DLGDAT_INT(1), FilterDraw_alpha_current, _FDF_NODLG_VAL},
+	{"alpha_current.2", _DLGDAT_INT(2), FilterDraw_alpha_current, _FDF_NODLG_VAL},
+	{"alpha_current.3", _DLGDAT_INT(3), FilterDraw_alpha_current, _FDF_NODLG_VAL | _FDF_NEED_TEXTURE},
+	{"alpha_current.4", _DLGDAT_INT(4), FilterDraw_alpha_current, _FDF_NODLG_VAL},
+
+	{"blur", g_blur_blur, FilterDraw_blur, _FDF_COPYSRC},
+	{"gaussblur", g_blur_gauss, FilterDraw_gaussblur, _FDF_COPYSRC},
+	{"motionblur", g_blur_motion, FilterDraw_motionblur, _FDF_COPYSRC},
+	{"radialblur", g_blur_radial, FilterDraw_radialblur, _FDF_COPYSRC},
+	{"lensblur", g_blur_lens, FilterDraw_lensblur, _FDF_COPYSRC},
+
+	{"draw_cloud", g_draw_cloud, FilterDraw_draw_cloud, 0},
+	{"draw_amitone", g_draw_amitone, FilterDraw_draw_amitone, _FDF_CLIPPING},
+	{"draw_randpoint", g_draw_rndpoint, FilterDraw_draw_randpoint, 0},
+	{"draw_edgepoint", g_draw_edgepoint, FilterDraw_draw_edgepoint, _FDF_COPYSRC},
+	{"draw_frame", g_draw_frame, FilterDraw_draw_frame, _FDF_CLIPPING},
+	{"draw_horzvert_line", g_draw_horzvert_line, FilterDraw_draw_horzvertLine, _FDF_CLIPPING},
+	{"draw_plaid", g_draw_plaid, FilterDraw_draw_plaid, _FDF_CLIPPING},
+
+	{"comic_amitone_create", g_comic_amitone_create, FilterDraw_comic_amitone_create, _FDF_CLIPPING},
+	{"comic_to_amitone", g_comic_to_amitone, FilterDraw_comic_to_amitone, _FDF_PROC_COLOR},
+	{"comic_sand_tone", g_comic_sand_tone, FilterDraw_comic_sand_tone, 0},
+	{"comic_concline", g_comic_concline, FilterDraw_comic_concline_flash, 0},
+	{"comic_flash", g_comic_flash, FilterDraw_comic_concline_flash, 0},
+	{"comic_popupflash", g_comic_popupflash, FilterDraw_comic_popupflash, 0},
+	{"comic_uniflash", g_comic_uniflash, FilterDraw_comic_uniflash, 0},
+	{"comic_uniflash_wave", g_comic_uniflash_wave, FilterDraw_comic_uniflash_wave, 0},
+
+	{"mozaic", g_pix_mozaic, FilterDraw_mozaic, 0},
+	{"crystal", g_pix_crystal, FilterDraw_crystal, 0},
+	{"halftone", g_pix_halftone, FilterDraw_halftone, 0},
+
+	{"sharp", g_edge_sharp, FilterDraw_sharp, _FDF_PROC_COLOR|_FDF_COPYSRC|_FDF_CLIPPING},
+	{"unsharpmask", g_edge_unsharpmask, FilterDraw_unsharpmask, _FDF_PROC_COLOR|_FDF_COPYSRC},
+	{"edge_sobel", NULL, FilterDraw_edge_sobel, _FDF_PROC_COLOR|_FDF_COPYSRC|_FDF_CLIPPING},
+	{"edge_laplacian", NULL, FilterDraw_edge_laplacian, _FDF_PROC_COLOR|_FDF_COPYSRC|_FDF_CLIPPING},
+	{"highpass", g_edge_highpass, FilterDraw_highpass, _FDF_PROC_COLOR|_FDF_COPYSRC},
+
+	{"effect_glow", g_eff_glow, FilterDraw_effect_glow, _FDF_COPYSRC},
+	{"effect_rgbshift", g_eff_rgbshift, FilterDraw_effect_rgbshift, _FDF_COPYSRC},
+	{"effect_oilpaint", g_eff_oilpaint, FilterDraw_effect_oilpaint, _FDF_COPYSRC},
+	{"effect_emboss", g_eff_emboss, FilterDraw_effect_emboss, _FDF_PROC_COLOR|_FDF_COPYSRC},
+	{"effect_noise", g_eff_noise, FilterDraw_effect_noise, _FDF_PROC_COLOR},
+	{"effect_diffusion", g_eff_diffusion, FilterDraw_effect_diffusion, _FDF_COPYSRC},
+	{"effect_scratch", g_eff_scratch, FilterDraw_effect_scratch, _FDF_COPYSRC},
+	{"effect_median", g_eff_median, FilterDraw_effect_median, _FDF_COPYSRC},
+	{"effect_blurring", g_eff_blurring, FilterDraw_effect_blurring, _FDF_COPYSRC},
+
+	{"trans_wave", g_trans_wave, FilterDraw_trans_wave, _FDF_COPYSRC},
+	{"trans_ripple", g_trans_ripple, FilterDraw_trans_ripple, _FDF_COPYSRC},
+	{"trans_polar", g_trans_polar, FilterDraw_trans_polar, _FDF_COPYSRC|_FDF_CLIPPING},
+	{"trans_radial_shift", g_trans_radial_shift, FilterDraw_trans_radial_shift, _FDF_COPYSRC},
+	{"trans_swirl", g_trans_swirl, FilterDraw_trans_swirl, _FDF_COPYSRC|_FDF_CLIPPING},
+
+	{"lum_to_alpha", NULL, FilterDraw_lum_to_alpha, 0},
+	{"dot_thinning", NULL, FilterDraw_dot_thinning, _FDF_CLIPPING},
+	{"antialiasing", g_other_antialiasing, FilterDraw_antialiasing, _FDF_COPYSRC|_FDF_CLIPPING},
+	{"hemming", g_other_hemming, FilterDraw_hemming, _FDF_COPYSRC},
+	{"3dframe", g_other_3dframe, FilterDraw_3dframe, _FDF_CLIPPING},
+	{"shift", g_other_shift, FilterDraw_shift, _FDF_COPYSRC|_FDF_CLIPPING},
+	{NULL, NULL, NULL, 0}
+};
+
+static const char *g_blendmode_name[] = {
+	"normal", "mul", "add", "sub", "screen", "overlay", "hard_light", "soft_light",
+	"dodge", "burn", "linear_burn", "vivid_light", "linear_light", "pin_light",
+	"dark", "light", "diff", "luminous_add", "luminous_dodge"
+};
+
+//-----------------
+
+
+
+//===========================
+// イメージ
+//===========================
+
+
+/* ランダムな色をセット */
+
+static void _set_rand_color(mRandSFMT *rand,uint64_t *dst,int bits)
+{
+	RGBcombo rgb;
+
+	RGB32bit_to_RGBcombo(&rgb, mRandSFMT_getUint32(rand) & 0xffffff);
+
+	RGBcombo_to_bitcol(dst, &rgb, bits);
+
+	bitcol_set_alpha_density100(dst, mRandSFMT_getIntRange(rand, 30, 100), bits);
+}
+
+/* レイヤイメージに内容を描画
+ *
+ * 矩形をランダムに配置する。一部は空のタイルのまま残る。 */
+
+static void _draw_layer_image(AppDraw *p,TileImage *img,mRandSFMT *rand)
+{
+	uint64_t col;
+	int i,x,y,w,h;
+
+	for(i = 0; i < 6; i++)
+	{
+		w = mRandSFMT_getIntRange(rand, 1, p->imgw / 2);
+		h = mRandSFMT_getIntRange(rand, 1, p->imgh / 2);
+		x = mRandSFMT_getIntRange(rand, 0, p->imgw - w);
+		y = mRandSFMT_getIntRange(rand, 0, p->imgh - h);
+
+		_set_rand_color(rand, &col, p->imgbits);
+
+		TileImage_drawFillBox(img, x, y, w, h, &col);
+	}
+}
+
+/** ベンチマーク用のイメージを作成 */
+
+mlkbool BenchCase_createImage(void)
+{
+	AppDraw *p = APPDRAW;
+	BenchOption *opt = &g_bench_opt;
+	LayerItem *item;
+	mRandSFMT *rand;
+	int i;
+
+	if(!drawImage_newCanvas_openFile_bkcol(p, opt->width, opt->height,
+		opt->bits, 96, 0xffffff))
+		return FALSE;
+
+	//色
+
+	RGB32bit_to_RGBcombo(&p->col.drawcol, 0x2040c0);
+	RGB32bit_to_RGBcombo(&p->col.bkgndcol, 0xffffff);
+
+	//レイヤ
+
+	rand = mRandSFMT_new();
+	if(!rand) return FALSE;
+
+	mRandSFMT_init(rand, opt->seed);
+
+	g_tileimage_dinfo.func_setpixel = TileImage_setPixel_new;
+
+	for(i = 0; i < opt->layers; i++)
+	{
+		item = LayerList_addLayer_image(p->layerlist, NULL, LAYERTYPE_RGBA, p->imgw, p->imgh);
+		if(!item) break;
+
+		_draw_layer_image(p, item->img, rand);
+
+		//カレント以外はチェックレイヤとする (チェックレイヤ用フィルタ)
+
+		if(p->curlayer)
+			p->curlayer->flags |= LAYERITEM_F_CHECKED;
+
+		p->curlayer = item;
+	}
+
+	mRandSFMT_free(rand);
+
+	return (i == opt->layers);
+}
+
+/* カレントレイヤのイメージを置き換え */
+
+static void _restore_curlayer(AppDraw *p,TileImage *src)
+{
+	TileImage *img;
+
+	img = TileImage_newClone(src);
+
+	if(img)
+		LayerItem_replaceImage(p->curlayer, img, -1);
+}
+
+
+//===========================
+// 合成
+//===========================
+
+
+/* 全レイヤをキャンバスイメージに合成
+ *
+ * tex: NULL 以外で、すべてのレイヤにテクスチャを適用 */
+
+static void _blend_layers(AppDraw *p,int mode,ImageMaterial *tex)
+{
+	LayerItem *pi;
+	TileImageBlendSrcInfo sinfo;
+	mBox box;
+
+	box.x = box.y = 0;
+	box.w = p->imgw;
+	box.h = p->imgh;
+
+	ImageCanvas_fill(p->imgcanvas, &p->imgbkcol);
+
+	pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
+
+	for(; pi; pi = LayerItem_getPrevVisibleImage(pi))
+	{
+		drawUpdate_setCanvasBlendInfo(pi, &sinfo);
+
+		sinfo.blendmode = mode;
+
+		if(tex)
+			sinfo.img_texture = tex;
+
+		TileImage_blendToCanvas(pi->img, p->imgcanvas, &box, &sinfo);
+	}
+}
+
+/* 合成用のテクスチャを作成 (ランダムな濃度) */
+
+static ImageMaterial *_create_texture(void)
+{
+	ImageMaterial *img;
+	mRandSFMT *rand;
+	uint8_t *pd;
+	int ix,iy;
+
+	img = ImageMaterial_new(300, 200, 8);
+	if(!img) return NULL;
+
+	img->type = IMAGEMATERIAL_TYPE_TEXTURE;
+
+	rand = mRandSFMT_new();
+	if(!rand)
+	{
+		ImageMaterial_free(img);
+		return NULL;
+	}
+
+	mRandSFMT_init(rand, g_bench_opt.seed);
+
+	for(iy = 0; iy < img->height; iy++)
+	{
+		pd = img->buf + iy * img->pitch;
+
+		for(ix = 0; ix < img->width; ix++)
+			*(pd++) = mRandSFMT_getIntRange(rand, 128, 255);
+	}
+
+	mRandSFMT_free(rand);
+
+	return img;
+}
+
+/* 合成モードごとに、全レイヤをキャンバスイメージに合成 */
+
+static void _run_blend(AppDraw *p)
+{
+	ImageMaterial *tex;
+	char name[48];
+	int mode,i;
+
+	for(mode = 0; mode < BLENDMODE_NUM; mode++)
+	{
+		snprintf(name, 48, "blend.%s", g_blendmode_name[mode]);
+
+		if(!Bench_begin(name)) continue;
+
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+
+			_blend_layers(p, mode, NULL);
+
+			Bench_timeEnd();
+		}
+
+		Bench_end();
+	}
+
+	//テクスチャあり (通常)
+
+	if(Bench_begin("blend.texture"))
+	{
+		tex = _create_texture();
+
+		for(i = 0; tex && i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+
+			_blend_layers(p, BLENDMODE_NORMAL, tex);
+
+			Bench_timeEnd();
+		}
+
+		ImageMaterial_free(tex);
+
+		Bench_end();
+	}
+}
+
+/* トーン化レイヤ (GRAY/A1) をキャンバスイメージに合成
+ *
+ * 2回目以降は、トーン化のキャッシュが使われる。 */
+
+static void _run_blend_tone(AppDraw *p)
+{
+	LayerItem *item[2];
+	TileImageBlendSrcInfo sinfo;
+	mRandSFMT *rand;
+	mBox box;
+	int i,j;
+
+	if(!Bench_begin("blend.tone")) return;
+
+	rand = mRandSFMT_new();
+	if(!rand) return;
+
+	mRandSFMT_init(rand, g_bench_opt.seed);
+
+	item[0] = LayerList_addLayer_image(p->layerlist, NULL, LAYERTYPE_GRAY, p->imgw, p->imgh);
+	item[1] = LayerList_addLayer_image(p->layerlist, NULL, LAYERTYPE_ALPHA1BIT, p->imgw, p->imgh);
+
+	for(i = 0; i < 2; i++)
+	{
+		if(item[i])
+		{
+			_draw_layer_image(p, item[i]->img, rand);
+			item[i]->flags |= LAYERITEM_F_TONE;
+		}
+	}
+
+	mRandSFMT_free(rand);
+
+	//
+
+	box.x = box.y = 0;
+	box.w = p->imgw;
+	box.h = p->imgh;
+
+	for(i = 0; item[0] && item[1] && i < g_bench_opt.repeat; i++)
+	{
+		Bench_timeStart();
+
+		ImageCanvas_fill(p->imgcanvas, &p->imgbkcol);
+
+		for(j = 0; j < 2; j++)
+		{
+			drawUpdate_setCanvasBlendInfo(item[j], &sinfo);
+
+			TileImage_blendToCanvas(item[j]->img, p->imgcanvas, &box, &sinfo);
+		}
+
+		Bench_timeEnd();
+	}
+
+	for(i = 0; i < 2; i++)
+	{
+		if(item[i])
+			LayerList_deleteLayer(p->layerlist, item[i]);
+	}
+
+	Bench_end();
+}
+
+
+//===========================
+// ブラシ/塗りつぶし
+//===========================
+
+
+/* ブラシ描画情報をセット */
+
+static void _set_brush_info(AppDraw *p,BrushDrawParam *dp)
+{
+	mMemset0(dp, sizeof(BrushDrawParam));
+
+	dp->shape_hard = 0.26;
+	dp->radius = 20;
+	dp->opacity = 1;
+	dp->interval = 0.15;
+	dp->pressure_range = 1;
+
+	drawOpSub_setDrawInfo(p, -1, 0);
+
+	g_tileimage_dinfo.texture = NULL;
+	g_tileimage_dinfo.brushdp = dp;
+	g_tileimage_dinfo.drawcol = p->w.drawcol;
+}
+
+/* ブラシで複数の直線を描画 (キャンバス全体を斜めに横切る) */
+
+static void _draw_brush_lines(AppDraw *p,TileImage *img)
+{
+	double x1,x2,y2,t;
+	int i;
+
+	TileImage_drawBrush_beginOther(img, 0, 0);
+
+	t = 0;
+
+	for(i = 0; i < 16; i++)
+	{
+		x1 = (double)p->imgw * i / 16;
+		x2 = p->imgw - x1;
+		y2 = p->imgh - 1;
+
+		t = TileImage_drawBrushLine(img, x1, 0, x2, y2, 0.3, 1.0, t);
+	}
+}
+
+/* ブラシ */
+
+static void _run_brush(AppDraw *p)
+{
+	BrushDrawParam dp;
+	TileImage *imgsrc;
+	mRect rc;
+	int i;
+
+	if(!Bench_begin("brush.line")) return;
+
+	imgsrc = TileImage_newClone(p->curlayer->img);
+	if(!imgsrc) return;
+
+	for(i = 0; i < g_bench_opt.repeat; i++)
+	{
+		_set_brush_info(p, &dp);
+		drawOpSub_beginDraw(p);
+
+		Bench_timeStart();
+
+		_draw_brush_lines(p, p->curlayer->img);
+
+		Bench_timeEnd();
+
+		rc = g_tileimage_dinfo.rcdraw;
+		drawOpSub_endDraw(p, &rc);
+
+		Undo_deleteAll();
+
+		_restore_curlayer(p, imgsrc);
+	}
+
+	TileImage_free(imgsrc);
+
+	Bench_end();
+}
+
+/* 塗りつぶし */
+
+static void _run_fill(AppDraw *p)
+{
+	DrawFill *draw;
+	LayerItem *item;
+	TileImage *imgsrc;
+	mPoint pt;
+	int i;
+
+	if(!Bench_begin("fill.rgb")) return;
+
+	imgsrc = TileImage_newClone(p->curlayer->img);
+	if(!imgsrc) return;
+
+	pt.x = p->imgw / 2;
+	pt.y = p->imgh / 2;
+
+	for(i = 0; i < g_bench_opt.repeat; i++)
+	{
+		item = LayerList_setLink_filltool(p->layerlist, p->curlayer, 0);
+
+		drawOpSub_setDrawInfo(p, -1, 0);
+		drawOpSub_beginDraw(p);
+
+		Bench_timeStart();
+
+		draw = DrawFill_new(p->curlayer->img, item->img, &pt, DRAWFILL_TYPE_RGB, 0, 100);
+
+		if(draw)
+		{
+			DrawFill_run(draw, &p->w.drawcol);
+			DrawFill_free(draw);
+		}
+
+		Bench_timeEnd();
+
+		TileImage_freeAllTiles(p->tileimg_tmp_save);
+
+		_restore_curlayer(p, imgsrc);
+	}
+
+	TileImage_free(imgsrc);
+
+	Bench_end();
+}
+
+/* グラデーション (4種類) */
+
+static void _run_gradation(AppDraw *p)
+{
+	TileImageDrawGradInfo info;
+	TileImage *imgsrc;
+	mRect rc;
+	int i,type;
+	TileImageDrawGradationFunc drawfunc[] = {
+		TileImage_drawGradation_line, TileImage_drawGradation_circle,
+		TileImage_drawGradation_box, TileImage_drawGradation_radial
+	};
+	const char *names[] = {
+		"gradation.line", "gradation.circle", "gradation.box", "gradation.radial"
+	};
+
+	imgsrc = NULL;
+
+	//描画色->背景色、濃度 100
+
+	p->tool.opt_grad = TOOLOPT_GRAD_DEFAULT;
+	p->w.is_toollist_toolopt = FALSE;
+
+	for(type = 0; type < 4; type++)
+	{
+		if(!Bench_begin(names[type])) continue;
+
+		if(!imgsrc)
+		{
+			imgsrc = TileImage_newClone(p->curlayer->img);
+			if(!imgsrc) return;
+		}
+
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			drawOpSub_setDrawGradationInfo(p, &info);
+			if(!info.buf) break;
+
+			drawOpSub_setDrawInfo(p, TOOL_GRADATION, 0);
+			drawOpSub_beginDraw(p);
+
+			rc.x1 = rc.y1 = 0;
+			rc.x2 = p->imgw - 1;
+			rc.y2 = p->imgh - 1;
+
+			Bench_timeStart();
+
+			(drawfunc[type])(p->curlayer->img,
+				p->imgw / 4, p->imgh / 3, p->imgw * 3 / 4, p->imgh / 2, &rc, &info);
+
+			Bench_timeEnd();
+
+			mFree(info.buf);
+
+			rc = g_tileimage_dinfo.rcdraw;
+			drawOpSub_endDraw(p, &rc);
+
+			Undo_deleteAll();
+
+			_restore_curlayer(p, imgsrc);
+		}
+
+		Bench_end();
+	}
+
+	TileImage_free(imgsrc);
+}
+
+
+//===========================
+// フィルタ
+//===========================
+
+
+/* ダイアログの項目データから、初期値をセット */
+
+static void _set_filter_default(AppDraw *p,FilterDrawInfo *info,const uint8_t *dat)
+{
+	int flags,type,trid,size,min,nbar,nck,ncombo;
+
+	nbar = nck = ncombo = 0;
+
+	//先頭データ
+
+	flags = *(dat++);
+
+	if((flags & 7) == FDDAT_PREV_IN_DIALOG)
+		dat += 4;
+
+	if(flags & FDDAT_F_GET_CANVAS_POS)
+	{
+		info->imgx = p->imgw / 2;
+		info->imgy = p->imgh / 2;
+	}
+
+	//各項目
+
+	while(1)
+	{
+		type = *(dat++);
+		if(type == WG_END) break;
+
+		//定義ウィジェット
+
+		if(type >= 128)
+		{
+			switch(type)
+			{
+				case WG_DEF_CLIPPING:
+					info->clipping = TRUE;
+					break;
+				case WG_DEF_LEVEL:
+					info->val_bar[0] = 0;
+					info->val_bar[1] = (p->imgbits == 8)? 128: 0x4000;
+					info->val_bar[2] = info->val_bar[4] = (p->imgbits == 8)? 255: 0x8000;
+					info->val_bar[3] = 0;
+					break;
+				case WG_DEF_REPLACE_COL:
+					info->val_bar[0] = p->col.drawcol.c8.r;
+					info->val_bar[1] = p->col.drawcol.c8.g;
+					info->val_bar[2] = p->col.drawcol.c8.b;
+					break;
+			}
+
+			continue;
+		}
+
+		//ラベル
+
+		trid = *(dat++);
+
+		if(trid == 255 && (type == WG_BAR || type == WG_BAR_TYPE || type == WG_COMBO))
+			dat++;
+
+		//値
+
+		size = *(dat++);
+
+		switch(type)
+		{
+			case WG_BAR:
+				if(nbar >= FILTER_BAR_NUM) break;
+
+				if(size >= 8)
+					info->val_bar[nbar] = (int16_t)mGetBufBE16(dat + 6);
+				else
+				{
+					min = (int16_t)mGetBufBE16(dat + 2);
+					info->val_bar[nbar] = (min < 0)? 0: min;
+				}
+				nbar++;
+				break;
+			case WG_BAR_TYPE:
+				if(nbar < FILTER_BAR_NUM)
+					info->val_bar[nbar++] = (p->imgbits == 8)? 128: 0x4000;
+				break;
+			case WG_CHECK:
+				if(nck < FILTER_CHECKBTT_NUM)
+					info->val_ckbtt[nck++] = (size >= 1 && dat[0]);
+				break;
+			case WG_COMBO:
+				if(ncombo < FILTER_COMBOBOX_NUM)
+					info->val_combo[ncombo++] = (size >= 3)? dat[2]: 0;
+				break;
+		}
+
+		dat += size;
+	}
+}
+
+/* 処理範囲をセット */
+
+static mlkbool _set_filter_area(AppDraw *p,FilterDrawInfo *info,uint8_t flags)
+{
+	mRect rc;
+
+	if(flags & _FDF_PROC_COLOR)
+	{
+		if(!TileImage_getHaveImageRect_pixel(p->curlayer->img, &rc, NULL))
+			return FALSE;
+	}
+	else
+		TileImage_getCanDrawRect_pixel(p->curlayer->img, &rc);
+
+	if(info->clipping)
+	{
+		if(!drawCalc_clipImageRect(p, &rc))
+			return FALSE;
+	}
+
+	info->rc = rc;
+
+	mBoxSetRect(&info->box, &rc);
+
+	return TRUE;
+}
+
+/* フィルタを 1 回実行 */
+
+static void _run_filter_one(AppDraw *p,const _filterdat *dat)
+{
+	FilterDrawInfo info;
+	TileImage *imgsrc = NULL;
+
+	mMemset0(&info, sizeof(FilterDrawInfo));
+
+	info.func_draw = dat->func;
+	info.clipping = ((dat->flags & _FDF_CLIPPING) != 0);
+	info.rgb_drawcol = p->col.drawcol;
+	info.rgb_bkgnd = p->col.bkgndcol;
+	info.bits = p->imgbits;
+	info.rand = (mRandSFMT *)TileImage_global_getRand();
+
+	if(dat->flags & _FDF_NODLG_VAL)
+		info.ntmp[0] = (intptr_t)dat->dlgdat;
+	else if(dat->dlgdat)
+		_set_filter_default(p, &info, dat->dlgdat);
+
+	if(!_set_filter_area(p, &info, dat->flags))
+		return;
+
+	info.imgsrc = info.imgdst = p->curlayer->img;
+	info.imgsel = p->tileimg_sel;
+
+	//準備 (ソースの複製も計測に含める)
+
+	drawOpSub_setDrawInfo_filter();
+	drawOpSub_beginDraw(p);
+
+	Bench_timeStart();
+
+	if(dat->flags & _FDF_COPYSRC)
+	{
+		imgsrc = TileImage_newClone(info.imgdst);
+		if(imgsrc) info.imgsrc = imgsrc;
+	}
+
+	(dat->func)(&info);
+
+	Bench_timeEnd();
+
+	TileImage_free(imgsrc);
+
+	TileImage_freeAllTiles(p->tileimg_tmp_save);
+}
+
+/* フィルタ */
+
+static void _run_filter(AppDraw *p)
+{
+	const _filterdat *dat;
+	TileImage *imgsrc;
+	char name[64];
+	int i;
+
+	imgsrc = TileImage_newClone(p->curlayer->img);
+	if(!imgsrc) return;
+
+	for(dat = g_filter_dat; dat->name; dat++)
+	{
+		snprintf(name, 64, "filter.%s", dat->name);
+
+		if(!Bench_begin(name)) continue;
+
+		if(!(dat->flags & _FDF_NEED_TEXTURE) || p->imgmat_opttex)
+		{
+			for(i = 0; i < g_bench_opt.repeat; i++)
+			{
+				_run_filter_one(p, dat);
+
+				_restore_curlayer(p, imgsrc);
+			}
+		}
+
+		Bench_end();
+	}
+
+	TileImage_free(imgsrc);
+}
+
+
+//===========================
+// アンドゥ
+//===========================
+
+
+/* ブラシ描画後、アンドゥデータを追加
+ *
+ * timing: TRUE で、アンドゥデータの作成を計測 */
+
+static void _undo_add_stroke(AppDraw *p,mlkbool timing)
+{
+	BrushDrawParam dp;
+	mRect rc;
+
+	_set_brush_info(p, &dp);
+	drawOpSub_beginDraw(p);
+
+	_draw_brush_lines(p, p->curlayer->img);
+
+	rc = g_tileimage_dinfo.rcdraw;
+
+	if(timing) Bench_timeStart();
+
+	drawOpSub_endDraw(p, &rc);
+
+	if(timing) Bench_timeEnd();
+}
+
+/* アンドゥ */
+
+static void _run_undo(AppDraw *p)
+{
+	UndoUpdateInfo info;
+	int i;
+
+	//アンドゥデータ作成
+
+	if(Bench_begin("undo.encode"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			_undo_add_stroke(p, TRUE);
+
+			Undo_runUndoRedo(FALSE, &info);
+			Undo_deleteAll();
+		}
+
+		Bench_end();
+	}
+
+	//アンドゥ
+
+	if(Bench_begin("undo.undo"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			_undo_add_stroke(p, FALSE);
+
+			Bench_timeStart();
+			Undo_runUndoRedo(FALSE, &info);
+			Bench_timeEnd();
+
+			Undo_deleteAll();
+		}
+
+		Bench_end();
+	}
+
+	//リドゥ
+
+	if(Bench_begin("undo.redo"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			_undo_add_stroke(p, FALSE);
+
+			Undo_runUndoRedo(FALSE, &info);
+
+			Bench_timeStart();
+			Undo_runUndoRedo(TRUE, &info);
+			Bench_timeEnd();
+
+			Undo_runUndoRedo(FALSE, &info);
+			Undo_deleteAll();
+		}
+
+		Bench_end();
+	}
+}
+
+
+//===========================
+// ファイル
+//===========================
+
+
+/* ファイル読み書き
+ *
+ * [!] 読み込み後はイメージが置き換わるため、最後に行う。 */
+
+static void _run_file(AppDraw *p)
+{
+	mStr str_apd = MSTR_INIT,str_psd = MSTR_INIT;
+	int i;
+
+	mStrSetText(&str_apd, Bench_getTempDir());
+	mStrPathJoin(&str_apd, "bench.apd");
+
+	mStrSetText(&str_psd, Bench_getTempDir());
+	mStrPathJoin(&str_psd, "bench.psd");
+
+	//APD v4 保存
+
+	if(Bench_begin("io.apd4_save"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+			drawFile_save_apd_v4(p, str_apd.buf, NULL);
+			Bench_timeEnd();
+		}
+
+		Bench_end();
+	}
+
+	//PSD 保存
+
+	if(Bench_begin("io.psd_save"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+			drawFile_save_psd(p, str_psd.buf, NULL);
+			Bench_timeEnd();
+		}
+
+		Bench_end();
+	}
+
+	//APD v4 読み込み (遅延読み込みのレイヤもすべて展開)
+
+	if(mIsExistFile(str_apd.buf) && Bench_begin("io.apd4_load"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+
+			if(drawFile_load_apd_v4(p, str_apd.buf, NULL) == MLKERR_OK)
+				LayerList_loadPendingImage_all(p->layerlist);
+
+			Bench_timeEnd();
+		}
+
+		Bench_end();
+	}
+
+	//PSD 読み込み
+
+	if(mIsExistFile(str_psd.buf) && Bench_begin("io.psd_load"))
+	{
+		for(i = 0; i < g_bench_opt.repeat; i++)
+		{
+			Bench_timeStart();
+			drawFile_load_psd(p, str_psd.buf, NULL);
+			Bench_timeEnd();
+		}
+
+		Bench_end();
+	}
+
+	mDeleteFile(str_apd.buf);
+	mDeleteFile(str_psd.buf);
+
+	mStrFree(&str_apd);
+	mStrFree(&str_psd);
+}
+
+
+//===========================
+// main
+//===========================
+
+
+/** すべての項目を実行 */
+
+void BenchCase_runAll(void)
+{
+	AppDraw *p = APPDRAW;
+
+	_run_blend(p);
+	_run_blend_tone(p);
+	_run_brush(p);
+	_run_fill(p);
+	_run_gradation(p);
+	_run_filter(p);
+	_run_undo(p);
+	_run_file(p);
+}
@@ -0,0 +1,451 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * ベンチマーク: main
+ *****************************************/
+/*
+  - X サーバーなしで実行できるように、mGuiInit() は行わず、
+    描画関連のデータのみ初期化する。
+  - 合成イメージを作成し、各処理の時間を計測して JSON で出力する。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>	//qsort
+#include <string.h>
+
+#include "mlk_gui.h"
+#include "mlk_argparse.h"
+#include "mlk_nanotime.h"
+#include "mlk_str.h"
+#include "mlk_file.h"
+#include "mlk_stdio.h"
+#include "mlk_util.h"
+
+#include "def_config.h"
+#include "def_widget.h"
+#include "def_draw_ptr.h"
+
+#include "appconfig.h"
+#include "table_data.h"
+#include "undo.h"
+#include "layerswap.h"
+#include "draw_main.h"
+
+#include "pv_bench.h"
+
+
+//-----------------------
+/* グローバル変数定義 */
+
+AppWidgets *g_app_widgets = NULL;
+AppConfig *g_app_config = NULL;
+AppDraw *g_app_draw = NULL;
+
+BenchOption g_bench_opt;
+
+//-----------------------
+
+typedef struct
+{
+	FILE *fp;			//出力先
+	double *buf;		//計測値 (ms)
+	const char *name;	//現在の項目名
+	int num,			//計測済みの数
+		result_num;		//出力済みの項目数
+	mNanoTime nt_start;
+}_bench;
+
+static _bench g_bench;
+
+#define _HELP_TEXT \
+"[usage] azpainter-bench [OPTION]\n\n" \
+"  --width=N     image width (default 2000)\n" \
+"  --height=N    image height (default 2000)\n" \
+"  --bits=N      image bits, 8 or 16 (default 8)\n" \
+"  --layers=N    number of layers (default 4)\n" \
+"  --repeat=N    iterations per case (default 5)\n" \
+"  --seed=N      random seed (default 1)\n" \
+"  --only=NAME   run only the cases whose name starts with NAME\n" \
+"  --output=FILE write JSON to FILE (default stdout)\n" \
+"  --help        show this help"
+
+//-----------------------
+
+
+
+//===========================
+// 計測
+//===========================
+
+
+/* qsort 比較関数 */
+
+static int _cmp_double(const void *p1,const void *p2)
+{
+	double d1,d2;
+
+	d1 = *((const double *)p1);
+	d2 = *((const double *)p2);
+
+	if(d1 < d2)
+		return -1;
+	else if(d1 > d2)
+		return 1;
+	else
+		return 0;
+}
+
+/** 項目の計測開始
+ *
+ * return: FALSE で、この項目は計測しない */
+
+mlkbool Bench_begin(const char *name)
+{
+	const char *only = g_bench_opt.only;
+
+	if(only && strncmp(name, only, strlen(only)) != 0)
+		return FALSE;
+
+	g_bench.name = name;
+	g_bench.num = 0;
+
+	fprintf(stderr, "%s ... ", name);
+	fflush(stderr);
+
+	return TRUE;
+}
+
+/** 項目の計測終了 (結果を出力) */
+
+void Bench_end(void)
+{
+	double *buf,min,max,median,sum;
+	int i,num;
+
+	num = g_bench.num;
+
+	if(!num)
+	{
+		fputs("skip\n", stderr);
+		return;
+	}
+
+	buf = g_bench.buf;
+
+	qsort(buf, num, sizeof(double), _cmp_double);
+
+	min = buf[0];
+	max = buf[num - 1];
+
+	if(num & 1)
+		median = buf[num / 2];
+	else
+		median = (buf[num / 2 - 1] + buf[num / 2]) / 2;
+
+	for(i = 0, sum = 0; i < num; i++)
+		sum += buf[i];
+
+	//JSON
+
+	fprintf(g_bench.fp,
+		"%s\n    {\"name\": \"%s\", \"iterations\": %d, "
+		"\"min_ms\": %.3f, \"median_ms\": %.3f, \"mean_ms\": %.3f, \"max_ms\": %.3f}",
+		(g_bench.result_num)? ",": "",
+		g_bench.name, num, min, median, sum / num, max);
+
+	g_bench.result_num++;
+
+	//進捗
+
+	fprintf(stderr, "%.3f ms\n", median);
+}
+
+/** 時間計測開始 */
+
+void Bench_timeStart(void)
+{
+	mNanoTimeGet(&g_bench.nt_start);
+}
+
+/** 時間計測終了 */
+
+void Bench_timeEnd(void)
+{
+	mNanoTime nt;
+
+	mNanoTimeGet(&nt);
+	mNanoTimeSub(&nt, &nt, &g_bench.nt_start);
+
+	if(g_bench.num < g_bench_opt.repeat)
+		g_bench.buf[g_bench.num++] = nt.sec * 1000.0 + nt.ns / 1000000.0;
+}
+
+/** 作業用ディレクトリのパスを取得 */
+
+const char *Bench_getTempDir(void)
+{
+	return APPCONF->strTempDirProc.buf;
+}
+
+
+//===========================
+// オプション
+//===========================
+
+
+static void _opt_width(mArgParse *p,char *arg)
+{
+	g_bench_opt.width = atoi(arg);
+}
+
+static void _opt_height(mArgParse *p,char *arg)
+{
+	g_bench_opt.height = atoi(arg);
+}
+
+static void _opt_bits(mArgParse *p,char *arg)
+{
+	g_bench_opt.bits = (atoi(arg) == 16)? 16: 8;
+}
+
+static void _opt_layers(mArgParse *p,char *arg)
+{
+	g_bench_opt.layers = atoi(arg);
+}
+
+static void _opt_repeat(mArgParse *p,char *arg)
+{
+	g_bench_opt.repeat = atoi(arg);
+}
+
+static void _opt_seed(mArgParse *p,char *arg)
+{
+	g_bench_opt.seed = strtoul(arg, NULL, 10);
+}
+
+static void _opt_only(mArgParse *p,char *arg)
+{
+	g_bench_opt.only = arg;
+}
+
+static void _opt_output(mArgParse *p,char *arg)
+{
+	g_bench_opt.output = arg;
+}
+
+/* オプション処理
+ *
+ * return: FALSE で終了 */
+
+static mlkbool _parse_option(int argc,char **argv)
+{
+	BenchOption *p = &g_bench_opt;
+	mArgParse ap;
+	mArgParseOpt opts[] = {
+		{"width", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_width},
+		{"height", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_height},
+		{"bits", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_bits},
+		{"layers", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_layers},
+		{"repeat", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_repeat},
+		{"seed", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_seed},
+		{"only", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_only},
+		{"output", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_output},
+		{"help", 0, 0, NULL},
+		{0,0,0,0}
+	};
+
+	//デフォルト
+
+	p->width = p->height = 2000;
+	p->bits = 8;
+	p->layers = 4;
+	p->repeat = 5;
+	p->seed = 1;
+
+	//
+
+	ap.argc = argc;
+	ap.argv = argv;
+	ap.opts = opts;
+	ap.flags = 0;
+
+	if(mArgParseRun(&ap) == -1
+		|| (opts[8].flags & MARGPARSEOPT_F_PROCESSED))
+	{
+		puts(_HELP_TEXT);
+		return FALSE;
+	}
+
+	//値の調整
+
+	if(p->width < 1) p->width = 1;
+	if(p->height < 1) p->height = 1;
+	if(p->layers < 1) p->layers = 1;
+	if(p->repeat < 1) p->repeat = 1;
+
+	return TRUE;
+}
+
+
+//===========================
+// 初期化/終了
+//===========================
+
+
+/* 作業用ディレクトリ作成 */
+
+static void _create_tempdir(AppConfig *p)
+{
+	mStr *pstr = &p->strTempDirProc;
+	char *name;
+
+	mStrPathSetTempDir(&p->strTempDir);
+
+	mStrCopy(pstr, &p->strTempDir);
+	mStrPathJoin(pstr, "azpainter-bench-");
+
+	name = mGetProcessName();
+	mStrAppendText(pstr, name);
+	mFree(name);
+
+	if(mCreateDir(pstr->buf, -1) != MLKERR_OK)
+		mStrFree(pstr);
+}
+
+/* 初期化 */
+
+static int _init(void)
+{
+	g_app_widgets = (AppWidgets *)mMalloc0(sizeof(AppWidgets));
+
+	TableData_init();
+
+	if(AppConfig_new()
+		|| AppDraw_new()
+		|| Undo_new())
+		return 1;
+
+	//設定ファイルは読み込まないため、必要な値のみセット
+
+	APPCONF->undo_maxbufsize = 10 * 1024 * 1024;
+
+	_create_tempdir(APPCONF);
+
+	//計測値バッファ
+
+	g_bench.buf = (double *)mMalloc(sizeof(double) * g_bench_opt.repeat);
+	if(!g_bench.buf) return 1;
+
+	return 0;
+}
+
+/* 終了 */
+
+static void _finish(void)
+{
+	TableData_free();
+
+	Undo_free();
+
+	AppDraw_free();
+
+	LayerSwap_finish();
+
+	if(APPCONF)
+	{
+		AppConfig_deleteTempDir();
+		AppConfig_free();
+	}
+
+	mFree(g_app_widgets);
+	mFree(g_bench.buf);
+}
+
+/* 出力ファイルを開く */
+
+static mlkbool _open_output(void)
+{
+	BenchOption *p = &g_bench_opt;
+
+	if(!p->output)
+		g_bench.fp = stdout;
+	else
+	{
+		g_bench.fp = mFILEopen(p->output, "wt");
+		if(!g_bench.fp)
+		{
+			fprintf(stderr, "can not open '%s'\n", p->output);
+			return FALSE;
+		}
+	}
+
+	fprintf(g_bench.fp,
+		"{\n  \"config\": {\"width\": %d, \"height\": %d, \"bits\": %d, "
+		"\"layers\": %d, \"repeat\": %d, \"seed\": %u},\n  \"results\": [",
+		p->width, p->height, p->bits, p->layers, p->repeat, p->seed);
+
+	return TRUE;
+}
+
+/* 出力ファイルを閉じる */
+
+static void _close_output(void)
+{
+	fputs("\n  ]\n}\n", g_bench.fp);
+
+	if(g_bench.fp != stdout)
+		fclose(g_bench.fp);
+}
+
+/** メイン */
+
+int main(int argc,char **argv)
+{
+	int ret = 1;
+
+	if(!_parse_option(argc, argv))
+		return 0;
+
+	if(_init())
+	{
+		fputs("failed initialize\n", stderr);
+		goto END;
+	}
+
+	if(!BenchCase_createImage())
+	{
+		fputs("failed create image\n", stderr);
+		goto END;
+	}
+
+	if(_open_output())
+	{
+		BenchCase_runAll();
+
+		_close_output();
+
+		ret = 0;
+	}
+
+END:
+	_finish();
+
+	return ret;
+}
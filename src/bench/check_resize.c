@@ -0,0 +1,377 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * 検証: キャンバスリサイズの誤差
+ *****************************************/
+/*
+  - ImageCanvas_resize_rgba() の結果を、double で計算した結果と比較する。
+  - 比較元は、重み・積和ともに double で、水平方向の結果を整数に丸める
+    (以前の実装と同じ計算)。
+  - 各チャンネルの差の最大値が _MAX_DIFF を超えた場合、終了コード 1 を返す。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>	//abs
+#include <string.h>
+#include <math.h>
+
+#include "mlk.h"
+#include "mlk_rand.h"
+
+#include "imagecanvas.h"
+
+
+//----------------
+
+#define _MAX_DIFF  1	//許容する誤差 (LSB)
+
+typedef double (*weightfunc)(double);
+
+typedef struct
+{
+	int method,	//リサイズ方法 (ImageCanvas_resize の値)
+		range;	//半径
+	weightfunc func;
+	const char *name;
+}_method;
+
+typedef struct
+{
+	int srcw,srch,dstw,dsth;
+}_size;
+
+//----------------
+
+
+/* mitchell */
+
+static double _weight_mitchell(double d)
+{
+	if (d < 1.0)
+		return (7.0 / 6.0 * d - 2) * d * d + 8.0 / 9.0;
+	else if(d < 2.0)
+		return (d - 2) * (d - 2) * (7 * d - 8) / -18;
+	else
+		return 0;
+}
+
+/* lanczos3 */
+
+static double _weight_lanczos3(double d)
+{
+	if(d < MLK_MATH_DBL_EPSILON)
+		return 1.0;
+	else if(d >= 3.0)
+		return 0.0;
+	else
+	{
+		d *= MLK_MATH_PI;
+		return sin(d) * sin(d / 3.0) / (d * d / 3.0);
+	}
+}
+
+/* spline36 */
+
+static double _weight_spline36(double d)
+{
+	if(d < 1.0)
+		return (d - 1) * (247 * d * d - 206 * d - 209) / 209;
+	else if(d < 2.0)
+		return (19 * d - 45) * (d - 1) * (d - 2) * 6 / -209;
+	else if(d < 3.0)
+		return (19 * d - 64) * (d - 2) * (d - 3) / 209;
+	else
+		return 0;
+}
+
+static const _method g_methods[] = {
+	{1, 2, _weight_mitchell, "mitchell"},
+	{4, 3, _weight_lanczos3, "lanczos3"},
+	{6, 3, _weight_spline36, "spline36"},
+	{0,0,0,0}
+};
+
+static const _size g_sizes[] = {
+	{640, 480, 257, 193},	//縮小
+	{640, 480, 97, 61},		//縮小 (高倍率)
+	{150, 110, 413, 331},	//拡大
+	{320, 240, 200, 390},	//水平縮小・垂直拡大
+	{0,0,0,0}
+};
+
+
+//=======================
+// double で計算
+//=======================
+
+
+/* 重みと位置をセット
+ *
+ * return: tap 数 (ppw, ppi は確保される) */
+
+static int _set_param(int srcw,int dstw,const _method *m,double **ppw,int **ppi)
+{
+	double *pw,*dwork,dsum,dscale,dpos,dmid,d;
+	int *pi,i,j,tap,pos;
+
+	if(dstw < srcw)
+		tap = (int)((double)srcw / dstw * m->range * 2 + 0.5);
+	else
+		tap = m->range * 2;
+
+	pw = *ppw = (double *)mMalloc(sizeof(double) * dstw * tap);
+	pi = *ppi = (int *)mMalloc(sizeof(int) * dstw * tap);
+
+	for(i = 0; i < dstw; i++, pw += tap, pi += tap)
+	{
+		dwork = pw;
+		dsum = 0;
+
+		if(dstw < srcw)
+		{
+			dscale = (double)dstw / srcw;
+			pos = floor((i - m->range + 0.5) * ((double)srcw / dstw) + 0.5);
+			dpos = 0;
+		}
+		else
+		{
+			dscale = (double)srcw / dstw;
+			dmid = tap * 0.5 + 0.5;
+			dpos = (i + 0.5) * dscale;
+			pos = floor(dpos - dmid);
+			dpos = pos + 0.5 - dpos;
+		}
+
+		for(j = 0; j < tap; j++, pos++)
+		{
+			if(pos < 0)
+				pi[j] = 0;
+			else if(pos >= srcw)
+				pi[j] = srcw - 1;
+			else
+				pi[j] = pos;
+
+			if(dstw < srcw)
+				d = fabs((pos + 0.5) * dscale - (i + 0.5));
+			else
+			{
+				d = fabs(dpos);
+				dpos += 1.0;
+			}
+
+			dwork[j] = (m->func)(d);
+			dsum += dwork[j];
+		}
+
+		for(j = 0; j < tap; j++)
+			dwork[j] /= dsum;
+	}
+
+	return tap;
+}
+
+/* 1チャンネルの値を取得 */
+
+static int _get_value(ImageCanvas *img,int x,int y,int ch)
+{
+	if(img->bits == 8)
+		return img->ppbuf[y][(x << 2) + ch];
+	else
+		return ((uint16_t *)img->ppbuf[y])[(x << 2) + ch];
+}
+
+/* double で計算したリサイズ結果と比較
+ *
+ * return: 差の最大値 */
+
+static int _compare(ImageCanvas *src,ImageCanvas *dst,const _method *m)
+{
+	double *pwx,*pwy,c;
+	int *pix,*piy,*tmp,tapx,tapy,x,y,ch,i,n,max,diff,maxdiff = 0;
+
+	tapx = _set_param(src->width, dst->width, m, &pwx, &pix);
+	tapy = _set_param(src->height, dst->height, m, &pwy, &piy);
+
+	max = (src->bits == 8)? 255: 0x8000;
+
+	//水平 (整数に丸める)
+
+	tmp = (int *)mMalloc(sizeof(int) * dst->width * src->height * 4);
+
+	for(y = 0; y < src->height; y++)
+	{
+		for(x = 0; x < dst->width; x++)
+		{
+			for(ch = 0; ch < 4; ch++)
+			{
+				c = 0;
+
+				for(i = 0; i < tapx; i++)
+					c += _get_value(src, pix[x * tapx + i], y, ch) * pwx[x * tapx + i];
+
+				n = lround(c);
+				if(n < 0) n = 0;
+				else if(n > max) n = max;
+
+				tmp[(y * dst->width + x) * 4 + ch] = n;
+			}
+		}
+	}
+
+	//垂直
+
+	for(y = 0; y < dst->height; y++)
+	{
+		for(x = 0; x < dst->width; x++)
+		{
+			for(ch = 0; ch < 4; ch++)
+			{
+				c = 0;
+
+				for(i = 0; i < tapy; i++)
+					c += tmp[(piy[y * tapy + i] * dst->width + x) * 4 + ch] * pwy[y * tapy + i];
+
+				n = lround(c);
+				if(n < 0) n = 0;
+				else if(n > max) n = max;
+
+				diff = abs(n - _get_value(dst, x, y, ch));
+				if(diff > maxdiff) maxdiff = diff;
+			}
+		}
+	}
+
+	mFree(tmp);
+	mFree(pwx);
+	mFree(pix);
+	mFree(pwy);
+	mFree(piy);
+
+	return maxdiff;
+}
+
+
+//=======================
+// main
+//=======================
+
+
+/* ランダムなイメージを作成 */
+
+static ImageCanvas *_create_image(mRandSFMT *rand,int w,int h,int bits)
+{
+	ImageCanvas *img;
+	uint16_t *pd16;
+	int x,y;
+
+	img = ImageCanvas_new(w, h, bits);
+	if(!img) return NULL;
+
+	for(y = 0; y < h; y++)
+	{
+		pd16 = (uint16_t *)img->ppbuf[y];
+
+		for(x = 0; x < w * 4; x++)
+		{
+			if(bits == 8)
+				img->ppbuf[y][x] = mRandSFMT_getIntRange(rand, 0, 255);
+			else
+				pd16[x] = mRandSFMT_getIntRange(rand, 0, 0x8000);
+		}
+	}
+
+	return img;
+}
+
+/* 1つの条件で検証
+ *
+ * return: 差の最大値 (-1 でエラー) */
+
+static int _check_one(mRandSFMT *rand,const _size *size,const _method *m,int bits)
+{
+	ImageCanvas *src,*srccopy,*dst;
+	int diff;
+
+	src = _create_image(rand, size->srcw, size->srch, bits);
+	srccopy = ImageCanvas_new(size->srcw, size->srch, bits);
+
+	if(!src || !srccopy)
+	{
+		ImageCanvas_free(src);
+		ImageCanvas_free(srccopy);
+		return -1;
+	}
+
+	//src は解放されるので、コピーをリサイズする
+
+	for(diff = 0; diff < size->srch; diff++)
+		memcpy(srccopy->ppbuf[diff], src->ppbuf[diff], src->line_bytes);
+
+	dst = ImageCanvas_resize_rgba(srccopy, size->dstw, size->dsth, m->method, NULL, 0, 0);
+	if(!dst)
+	{
+		ImageCanvas_free(src);
+		return -1;
+	}
+
+	diff = _compare(src, dst, m);
+
+	ImageCanvas_free(src);
+	ImageCanvas_free(dst);
+
+	return diff;
+}
+
+/** main */
+
+int main(void)
+{
+	mRandSFMT *rand;
+	const _method *m;
+	const _size *size;
+	int bits,diff,ret = 0;
+
+	rand = mRandSFMT_new();
+	if(!rand) return 1;
+
+	mRandSFMT_init(rand, 1);
+
+	for(bits = 8; bits <= 16; bits += 8)
+	{
+		for(m = g_methods; m->func; m++)
+		{
+			for(size = g_sizes; size->srcw; size++)
+			{
+				diff = _check_one(rand, size, m, bits);
+
+				printf("%dbit %s %dx%d -> %dx%d : max diff %d%s\n",
+					bits, m->name, size->srcw, size->srch, size->dstw, size->dsth, diff,
+					(diff < 0 || diff > _MAX_DIFF)? " [NG]": "");
+
+				if(diff < 0 || diff > _MAX_DIFF)
+					ret = 1;
+			}
+		}
+	}
+
+	mRandSFMT_free(rand);
+
+	return ret;
+}
@@ -0,0 +1,48 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * ベンチマーク
+ ************************************/
+
+typedef struct
+{
+	int width,height,	//イメージサイズ
+		bits,			//イメージビット数 (8/16)
+		layers,			//レイヤ数
+		repeat;			//各項目の計測回数
+	uint32_t seed;		//乱数の種
+	const char *output,	//出力ファイル (NULL で標準出力)
+		*only;			//計測する項目名の先頭 (NULL ですべて)
+}BenchOption;
+
+extern BenchOption g_bench_opt;
+
+/* bench_main.c */
+
+mlkbool Bench_begin(const char *name);
+void Bench_end(void);
+void Bench_timeStart(void);
+void Bench_timeEnd(void);
+const char *Bench_getTempDir(void);
+
+/* bench_case.c */
+
+mlkbool BenchCase_createImage(void);
+void BenchCase_runAll(void);
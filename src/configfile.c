@@ -287,9 +287,11 @@ static void _load_configdata(mIniRead *ini,AppConfig *cf)
 	cf->iconsize_panel_tool = mIniRead_getInt(ini, "iconsize_panel_tool", 16);
 	cf->iconsize_other = mIniRead_getInt(ini, "iconsize_other", 16);
 	cf->canvas_scale_method = mIniRead_getInt(ini, "canvas_scale_method", 0);
+	cf->canvas_scale_keep_layer = mIniRead_getInt(ini, "canvas_scale_keep_layer", 0);
 
 	cf->undo_maxbufsize = mIniRead_getInt(ini, "undo_maxbufsize", 10 * 1024 * 1024);
 	cf->undo_maxnum = mIniRead_getInt(ini, "undo_maxnum", 100);
+	cf->layer_swap_size = mIniRead_getInt(ini, "layer_swap_size", 0);
 	cf->savedup_type = mIniRead_getInt(ini, "savedup_type", 0);
 
 	mIniRead_getNumbers(ini, "cursor_hotspot", cf->cursor_hotspot, 2, 2, FALSE);
@@ -758,9 +760,11 @@ static void _save_configdata(FILE *fp,AppConfig *cf)
 	mIniWrite_putInt(fp, "iconsize_panel_tool", cf->iconsize_panel_tool);
 	mIniWrite_putInt(fp, "iconsize_other", cf->iconsize_other);
 	mIniWrite_putInt(fp, "canvas_scale_method", cf->canvas_scale_method);
+	mIniWrite_putInt(fp, "canvas_scale_keep_layer", cf->canvas_scale_keep_layer);
 
 	mIniWrite_putInt(fp, "undo_maxbufsize", cf->undo_maxbufsize);
 	mIniWrite_putInt(fp, "undo_maxnum", cf->undo_maxnum);
+	mIniWrite_putInt(fp, "layer_swap_size", cf->layer_swap_size);
 	mIniWrite_putInt(fp, "savedup_type", cf->savedup_type);
 
 	mIniWrite_putNumbers(fp, "cursor_hotspot", cf->cursor_hotspot, 2, 2, FALSE);
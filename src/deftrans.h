@@ -1,5 +1,5 @@
 static const unsigned char g_deftransdat[] = {
-0,0,0,55,0,0,3,193,0,0,77,164,0,0,0,21,
+0,0,0,55,0,0,3,197,0,0,78,108,0,0,0,21,
 0,0,0,0,0,1,0,10,0,0,0,126,0,2,0,15,
 0,0,0,186,0,3,0,18,0,0,1,20,0,10,0,12,
 0,0,1,128,0,11,0,9,0,0,1,200,0,12,0,19,
@@ -16,18 +16,18 @@ static const unsigned char g_deftransdat[] = {
 0,0,8,142,7,208,0,8,0,0,8,154,7,209,0,7,
 0,0,8,202,7,210,0,7,0,0,8,244,7,211,0,1,
 0,0,9,30,7,212,0,28,0,0,9,36,7,213,0,1,
-0,0,9,204,7,214,0,8,0,0,9,210,7,215,0,2,
-0,0,10,2,7,216,0,14,0,0,10,14,7,217,0,2,
-0,0,10,98,7,218,0,10,0,0,10,110,7,219,0,20,
-0,0,10,170,7,220,0,21,0,0,11,34,7,221,0,4,
-0,0,11,160,7,222,0,7,0,0,11,184,7,223,0,1,
-0,0,11,226,7,224,0,3,0,0,11,232,7,225,0,19,
-0,0,11,250,7,226,0,35,0,0,12,108,7,227,0,77,
-0,0,13,62,7,228,0,5,0,0,15,12,7,229,0,2,
-0,0,15,42,7,230,0,52,0,0,15,54,39,16,0,207,
-0,0,16,110,39,17,0,14,0,0,21,72,39,18,0,7,
-0,0,21,156,39,19,0,5,0,0,21,198,255,255,0,27,
-0,0,21,228,0,0,0,0,0,0,0,1,0,0,0,8,
+0,0,9,204,7,214,0,9,0,0,9,210,7,215,0,2,
+0,0,10,8,7,216,0,14,0,0,10,20,7,217,0,2,
+0,0,10,104,7,218,0,10,0,0,10,116,7,219,0,20,
+0,0,10,176,7,220,0,21,0,0,11,40,7,221,0,4,
+0,0,11,166,7,222,0,7,0,0,11,190,7,223,0,1,
+0,0,11,232,7,224,0,3,0,0,11,238,7,225,0,19,
+0,0,12,0,7,226,0,35,0,0,12,114,7,227,0,77,
+0,0,13,68,7,228,0,5,0,0,15,18,7,229,0,2,
+0,0,15,48,7,230,0,54,0,0,15,60,39,16,0,207,
+0,0,16,128,39,17,0,14,0,0,21,90,39,18,0,7,
+0,0,21,174,39,19,0,6,0,0,21,216,255,255,0,27,
+0,0,21,252,0,0,0,0,0,0,0,1,0,0,0,8,
 0,2,0,0,0,13,0,3,0,0,0,19,0,4,0,0,
 0,26,0,5,0,0,0,37,0,6,0,0,0,48,0,7,
 0,0,0,56,0,8,0,0,0,62,0,9,0,0,0,67,
@@ -187,1429 +187,1443 @@ static const unsigned char g_deftransdat[] = {
 0,0,0,0,32,172,0,0,0,0,32,187,0,1,0,0,
 32,201,0,100,0,0,32,227,0,101,0,0,32,239,0,102,
 0,0,33,0,0,103,0,0,33,6,0,104,0,0,33,31,
-0,105,0,0,33,42,0,0,0,0,33,63,0,1,0,0,
-33,87,0,0,0,0,33,132,0,1,0,0,33,149,0,2,
-0,0,33,158,0,3,0,0,33,172,0,4,0,0,33,189,
-0,5,0,0,33,205,0,6,0,0,33,211,0,7,0,0,
-33,227,0,8,0,0,33,241,0,100,0,0,34,150,0,101,
-0,0,34,175,0,102,0,0,34,211,0,103,0,0,35,9,
-0,104,0,0,35,31,0,0,0,0,35,43,0,1,0,0,
-35,74,0,0,0,0,35,96,0,1,0,0,35,111,0,2,
-0,0,35,118,0,3,0,0,35,130,0,4,0,0,35,136,
-0,5,0,0,35,152,0,6,0,0,35,168,0,7,0,0,
-35,183,0,8,0,0,35,208,0,9,0,0,35,220,0,0,
-0,0,36,155,0,1,0,0,36,160,0,2,0,0,36,165,
-0,3,0,0,36,170,0,4,0,0,36,186,0,5,0,0,
-36,205,0,6,0,0,36,223,0,7,0,0,36,236,0,8,
-0,0,36,245,0,9,0,0,36,253,0,10,0,0,37,18,
-0,11,0,0,37,23,0,12,0,0,37,37,0,100,0,0,
-37,60,0,101,0,0,37,78,0,102,0,0,37,95,0,103,
-0,0,37,119,0,104,0,0,37,132,0,105,0,0,37,151,
-0,200,0,0,37,174,0,0,0,0,37,196,0,1,0,0,
-37,217,0,2,0,0,37,230,0,3,0,0,38,5,0,4,
-0,0,38,21,0,5,0,0,38,31,0,6,0,0,38,50,
-0,7,0,0,38,69,0,8,0,0,38,87,0,9,0,0,
-38,102,0,10,0,0,38,121,0,100,0,0,38,153,0,101,
-0,0,38,165,0,102,0,0,38,174,0,103,0,0,38,183,
-0,104,0,0,38,189,0,105,0,0,38,206,3,232,0,0,
-38,245,3,233,0,0,39,7,3,234,0,0,39,33,3,235,
-0,0,39,81,0,0,0,0,39,102,0,1,0,0,39,120,
-0,2,0,0,39,125,0,3,0,0,39,130,0,0,0,0,
-39,135,0,1,0,0,39,145,0,2,0,0,39,160,0,3,
-0,0,39,179,0,100,0,0,39,193,0,101,0,0,39,224,
-0,102,0,0,39,232,0,0,0,0,39,240,0,0,0,0,
-39,255,0,1,0,0,40,17,0,2,0,0,40,23,0,0,
-0,0,40,28,0,1,0,0,40,42,0,2,0,0,40,66,
-0,3,0,0,40,80,0,4,0,0,40,96,0,5,0,0,
-40,111,0,6,0,0,40,143,0,7,0,0,40,155,0,8,
-0,0,40,167,0,9,0,0,40,180,0,10,0,0,40,197,
-0,11,0,0,40,215,0,12,0,0,40,230,0,13,0,0,
-40,251,0,50,0,0,41,13,0,100,0,0,41,131,0,101,
-0,0,41,147,0,102,0,0,41,165,0,103,0,0,41,189,
-0,0,0,0,41,224,0,1,0,0,41,242,0,100,0,0,
-42,6,0,101,0,0,42,16,0,102,0,0,42,26,3,232,
-0,0,42,61,3,233,0,0,42,73,3,234,0,0,42,93,
-3,235,0,0,42,108,3,236,0,0,42,140,3,237,0,0,
-42,180,3,238,0,0,42,222,3,239,0,0,43,11,3,240,
-0,0,43,45,4,76,0,0,43,58,4,77,0,0,43,63,
-4,78,0,0,43,68,4,79,0,0,43,95,4,80,0,0,
-43,122,4,81,0,0,43,144,4,82,0,0,43,181,4,83,
-0,0,43,204,4,84,0,0,43,227,4,85,0,0,44,3,
-4,86,0,0,44,41,4,87,0,0,44,83,4,176,0,0,
-44,123,4,177,0,0,44,141,4,178,0,0,44,157,4,179,
-0,0,44,174,4,180,0,0,44,185,4,181,0,0,44,196,
-5,20,0,0,44,220,5,21,0,0,44,252,5,22,0,0,
-45,32,0,1,0,0,45,53,0,2,0,0,45,59,0,10,
-0,0,45,90,0,11,0,0,45,101,0,12,0,0,45,110,
-0,13,0,0,45,122,0,14,0,0,45,126,0,15,0,0,
-45,137,0,16,0,0,45,147,0,17,0,0,45,152,0,18,
-0,0,45,157,0,19,0,0,45,164,0,20,0,0,45,170,
-0,21,0,0,45,179,0,22,0,0,45,245,0,23,0,0,
-45,254,0,24,0,0,46,15,0,25,0,0,46,23,0,26,
-0,0,46,29,0,27,0,0,46,34,0,28,0,0,46,42,
-0,29,0,0,46,56,0,30,0,0,46,63,0,31,0,0,
-46,80,0,32,0,0,46,98,0,33,0,0,46,109,0,34,
-0,0,46,119,0,35,0,0,46,137,0,36,0,0,46,155,
-0,37,0,0,46,172,0,38,0,0,46,189,0,39,0,0,
-46,205,0,40,0,0,46,219,0,41,0,0,46,225,0,42,
-0,0,46,232,0,43,0,0,47,14,0,44,0,0,47,32,
-0,45,0,0,47,40,0,46,0,0,47,48,0,47,0,0,
-47,56,0,48,0,0,47,86,0,49,0,0,47,96,0,50,
-0,0,47,114,0,51,0,0,47,123,0,52,0,0,47,131,
-0,53,0,0,47,138,0,54,0,0,47,144,0,55,0,0,
-47,158,0,56,0,0,47,169,0,57,0,0,47,175,0,58,
-0,0,47,191,0,59,0,0,47,215,0,60,0,0,47,237,
-0,61,0,0,47,244,0,62,0,0,48,4,0,63,0,0,
-48,18,0,64,0,0,48,44,0,65,0,0,48,57,0,66,
-0,0,48,65,0,67,0,0,48,81,0,68,0,0,48,98,
-0,69,0,0,48,112,0,70,0,0,48,124,0,71,0,0,
-48,143,0,72,0,0,48,158,3,232,0,0,48,173,3,233,
-0,0,48,210,3,234,0,0,48,254,3,235,0,0,49,42,
-3,236,0,0,49,87,3,237,0,0,49,216,3,238,0,0,
-50,15,3,239,0,0,50,42,3,240,0,0,50,66,3,241,
-0,0,50,102,3,242,0,0,50,193,3,243,0,0,50,226,
-0,0,0,0,51,28,0,1,0,0,51,49,0,2,0,0,
-51,55,0,3,0,0,51,60,0,4,0,0,51,67,0,0,
-0,0,51,74,0,1,0,0,51,96,0,0,0,0,51,115,
-0,1,0,0,51,137,0,2,0,0,51,147,0,3,0,0,
-51,153,0,4,0,0,51,170,0,5,0,0,51,180,0,100,
-0,0,51,187,0,101,0,0,51,211,0,102,0,0,51,234,
-0,103,0,0,51,252,0,104,0,0,52,41,0,105,0,0,
-52,73,0,106,0,0,52,98,0,107,0,0,52,157,0,150,
-0,0,52,185,0,151,0,0,52,210,0,152,0,0,53,4,
-0,153,0,0,53,56,0,200,0,0,53,117,0,201,0,0,
-53,131,0,202,0,0,53,153,0,203,0,0,53,171,0,204,
-0,0,53,182,0,205,0,0,53,189,0,206,0,0,53,197,
-0,207,0,0,54,57,0,208,0,0,54,91,0,209,0,0,
-54,106,0,210,0,0,54,134,0,211,0,0,54,150,0,250,
-0,0,54,165,0,251,0,0,54,180,0,252,0,0,54,194,
-0,253,0,0,54,202,0,254,0,0,54,207,0,255,0,0,
-54,213,1,44,0,0,54,235,1,45,0,0,55,1,1,46,
-0,0,55,30,1,47,0,0,55,61,1,48,0,0,55,76,
-1,49,0,0,55,119,3,232,0,0,55,174,3,233,0,0,
-55,202,4,76,0,0,55,243,4,77,0,0,56,7,4,78,
-0,0,56,21,4,79,0,0,56,36,4,80,0,0,56,52,
-4,81,0,0,56,64,4,82,0,0,56,78,4,83,0,0,
-56,92,0,1,0,0,56,107,0,2,0,0,56,116,0,3,
-0,0,56,125,0,4,0,0,56,135,0,5,0,0,56,149,
-0,6,0,0,56,160,0,7,0,0,56,169,3,232,0,0,
-56,181,3,233,0,0,56,192,3,234,0,0,56,204,3,235,
-0,0,56,213,3,236,0,0,56,228,3,237,0,0,56,250,
-3,238,0,0,57,18,3,239,0,0,57,27,4,76,0,0,
-57,45,4,77,0,0,57,54,4,78,0,0,57,63,4,79,
-0,0,57,72,4,80,0,0,57,82,4,81,0,0,57,108,
-4,82,0,0,57,141,4,83,0,0,57,163,4,176,0,0,
-57,207,4,177,0,0,57,220,4,178,0,0,57,235,4,179,
-0,0,57,247,4,180,0,0,58,18,4,181,0,0,58,27,
-4,182,0,0,58,35,4,183,0,0,58,58,4,184,0,0,
-58,98,4,185,0,0,58,145,5,20,0,0,58,192,5,21,
-0,0,58,221,5,22,0,0,58,242,5,23,0,0,59,11,
-5,24,0,0,59,38,5,25,0,0,59,66,7,208,0,0,
-59,79,7,209,0,0,59,96,7,210,0,0,59,111,7,211,
-0,0,59,138,7,212,0,0,59,184,7,213,0,0,59,198,
-7,214,0,0,59,209,7,215,0,0,59,219,7,216,0,0,
-59,254,7,217,0,0,60,25,7,218,0,0,60,53,7,219,
-0,0,60,67,7,220,0,0,60,103,7,221,0,0,60,125,
-7,222,0,0,60,138,7,223,0,0,60,159,7,224,0,0,
-60,168,7,225,0,0,60,177,7,226,0,0,60,188,8,52,
-0,0,60,198,8,53,0,0,60,220,8,54,0,0,60,245,
-8,102,0,0,61,14,8,152,0,0,61,42,8,153,0,0,
-61,62,8,154,0,0,61,83,8,155,0,0,61,117,8,252,
-0,0,61,152,8,253,0,0,61,165,8,254,0,0,61,178,
-8,255,0,0,61,206,9,0,0,0,61,231,9,96,0,0,
-62,12,9,97,0,0,62,53,9,98,0,0,62,93,9,196,
-0,0,62,106,9,197,0,0,62,138,9,198,0,0,62,153,
-11,184,0,0,62,169,11,185,0,0,62,182,11,186,0,0,
-62,197,11,187,0,0,62,207,11,188,0,0,62,225,11,189,
-0,0,63,6,11,190,0,0,63,20,11,191,0,0,63,43,
-11,192,0,0,63,64,11,193,0,0,63,76,11,194,0,0,
-63,91,11,195,0,0,63,111,11,196,0,0,63,156,11,197,
-0,0,63,177,11,198,0,0,63,195,12,28,0,0,63,241,
-12,29,0,0,64,12,12,30,0,0,64,36,12,31,0,0,
-64,45,12,32,0,0,64,59,12,33,0,0,64,77,12,34,
-0,0,64,88,12,35,0,0,64,98,12,36,0,0,64,108,
-12,37,0,0,64,124,12,38,0,0,64,142,12,39,0,0,
-64,163,12,40,0,0,64,179,12,41,0,0,64,196,12,128,
-0,0,64,212,12,129,0,0,64,224,12,130,0,0,64,237,
-12,131,0,0,64,246,12,228,0,0,65,5,12,229,0,0,
-65,30,12,230,0,0,65,56,12,231,0,0,65,65,12,232,
-0,0,65,75,12,233,0,0,65,86,19,136,0,0,65,97,
-19,137,0,0,65,103,19,138,0,0,65,121,19,139,0,0,
-65,142,19,140,0,0,65,163,19,141,0,0,65,168,19,142,
-0,0,65,174,19,143,0,0,65,184,19,144,0,0,65,197,
-19,145,0,0,65,205,19,146,0,0,65,212,19,147,0,0,
-65,227,19,236,0,0,65,234,19,237,0,0,66,1,19,238,
-0,0,66,10,19,239,0,0,66,19,19,240,0,0,66,37,
-19,241,0,0,66,55,19,242,0,0,66,73,19,243,0,0,
-66,100,19,244,0,0,66,110,19,245,0,0,66,122,19,246,
-0,0,66,152,19,247,0,0,66,168,19,248,0,0,66,193,
-19,249,0,0,66,210,19,250,0,0,66,234,19,251,0,0,
-67,14,19,252,0,0,67,60,19,253,0,0,67,95,19,254,
-0,0,67,131,19,255,0,0,67,180,20,0,0,0,67,230,
-20,1,0,0,68,7,20,2,0,0,68,33,20,3,0,0,
-68,64,20,4,0,0,68,95,20,5,0,0,68,144,20,6,
-0,0,68,185,20,7,0,0,68,209,20,8,0,0,68,229,
-20,9,0,0,68,254,20,10,0,0,69,18,20,11,0,0,
-69,52,20,12,0,0,69,60,20,13,0,0,69,74,20,14,
-0,0,69,89,20,15,0,0,69,104,20,16,0,0,69,117,
-20,17,0,0,69,127,20,18,0,0,69,142,20,19,0,0,
-69,163,20,20,0,0,69,192,20,21,0,0,69,202,20,22,
-0,0,69,235,20,23,0,0,69,244,20,24,0,0,70,14,
-20,25,0,0,70,32,20,26,0,0,70,48,20,27,0,0,
-70,70,20,28,0,0,70,94,20,29,0,0,70,115,20,30,
-0,0,70,128,20,31,0,0,70,148,20,32,0,0,70,158,
-20,33,0,0,70,169,20,34,0,0,70,182,20,35,0,0,
-70,191,20,36,0,0,70,207,20,37,0,0,70,234,20,38,
-0,0,71,9,20,39,0,0,71,22,20,40,0,0,71,30,
-20,41,0,0,71,44,20,42,0,0,71,60,20,43,0,0,
-71,70,20,44,0,0,71,79,20,45,0,0,71,91,20,46,
-0,0,71,102,20,47,0,0,71,112,20,48,0,0,71,120,
-20,49,0,0,71,128,20,50,0,0,71,138,20,51,0,0,
-71,159,20,52,0,0,71,176,20,53,0,0,71,186,20,54,
-0,0,71,213,20,55,0,0,71,237,20,56,0,0,71,254,
-20,57,0,0,72,8,20,58,0,0,72,35,0,0,0,0,
-72,44,0,1,0,0,72,52,0,2,0,0,72,100,0,3,
-0,0,72,115,0,4,0,0,72,130,0,5,0,0,72,176,
-0,6,0,0,72,245,0,7,0,0,73,18,0,8,0,0,
-73,124,0,9,0,0,73,171,0,100,0,0,74,54,0,200,
-0,0,74,105,0,201,0,0,74,187,0,202,0,0,74,227,
-0,0,0,0,75,8,0,1,0,0,75,14,0,2,0,0,
-75,40,0,3,0,0,75,65,0,4,0,0,75,84,0,5,
-0,0,75,106,0,6,0,0,75,156,0,1,0,0,75,201,
-0,2,0,0,75,231,0,3,0,0,76,9,0,4,0,0,
-76,33,0,5,0,0,76,61,0,1,0,0,76,98,0,2,
-0,0,76,101,0,3,0,0,76,108,0,4,0,0,76,112,
-0,5,0,0,76,115,0,6,0,0,76,120,0,7,0,0,
-76,131,0,8,0,0,76,137,0,9,0,0,76,161,0,10,
-0,0,76,174,0,11,0,0,76,184,0,12,0,0,76,194,
-0,13,0,0,76,211,0,14,0,0,76,216,0,15,0,0,
-76,225,0,16,0,0,76,234,0,17,0,0,76,243,0,18,
-0,0,77,2,0,19,0,0,77,20,0,20,0,0,77,70,
-0,21,0,0,77,95,0,22,0,0,77,107,0,23,0,0,
-77,113,0,24,0,0,77,120,0,25,0,0,77,125,0,26,
-0,0,77,135,0,27,0,0,77,142,80,114,101,118,105,101,
-119,0,78,97,109,101,0,87,105,100,116,104,0,72,101,105,
-103,104,116,0,82,101,115,111,108,117,116,105,111,110,0,73,
-109,97,103,101,32,98,105,116,115,0,68,101,110,115,105,116,
-121,0,67,111,108,111,114,0,84,121,112,101,0,66,108,101,
-110,100,32,109,111,100,101,0,79,112,97,99,105,116,121,0,
-84,101,120,116,117,114,101,0,65,110,103,108,101,0,66,97,
-99,107,103,114,111,117,110,100,32,99,111,108,111,114,0,83,
-105,122,101,0,85,110,105,116,0,84,101,109,112,108,97,116,
-101,0,65,110,116,105,45,97,108,105,97,115,105,110,103,0,
-80,105,120,101,108,32,109,111,100,101,0,99,105,114,99,108,
-101,0,99,105,114,99,108,101,32,102,114,97,109,101,0,114,
-101,99,116,97,110,103,108,101,0,114,101,99,116,97,110,103,
-108,101,32,102,114,97,109,101,0,100,105,97,109,111,110,100,
-0,100,105,97,109,111,110,100,32,102,114,97,109,101,0,88,
-32,109,97,114,107,0,99,114,111,115,115,0,103,108,105,116,
-116,101,114,0,0,82,101,115,101,116,0,65,100,100,0,68,
-101,108,101,116,101,0,85,112,0,68,111,119,110,0,82,101,
-110,97,109,101,0,68,117,112,108,105,99,97,116,101,0,69,
-100,105,116,0,79,112,101,110,0,83,97,118,101,0,77,111,
-118,101,0,91,83,104,105,102,116,58,32,66,114,117,115,104,
-32,115,105,122,101,32,99,104,97,110,103,101,93,32,91,67,
-116,114,108,58,32,82,117,108,101,114,32,115,101,116,116,105,
-110,103,93,32,91,65,108,116,58,32,67,111,108,111,114,32,
-80,105,99,107,101,114,40,99,97,110,118,97,115,41,93,0,
-91,83,104,105,102,116,58,32,49,112,120,32,101,114,97,115,
-101,114,93,32,91,67,116,114,108,58,32,82,117,108,101,114,
-32,115,101,116,116,105,110,103,93,32,91,65,108,116,58,32,
-67,111,108,111,114,32,80,105,99,107,101,114,40,99,97,110,
-118,97,115,41,93,0,91,67,116,114,108,58,32,82,117,108,
+0,105,0,0,33,42,0,106,0,0,33,63,0,0,0,0,
+33,101,0,1,0,0,33,125,0,0,0,0,33,170,0,1,
+0,0,33,187,0,2,0,0,33,196,0,3,0,0,33,210,
+0,4,0,0,33,227,0,5,0,0,33,243,0,6,0,0,
+33,249,0,7,0,0,34,9,0,8,0,0,34,23,0,100,
+0,0,34,188,0,101,0,0,34,213,0,102,0,0,34,249,
+0,103,0,0,35,47,0,104,0,0,35,69,0,0,0,0,
+35,81,0,1,0,0,35,112,0,0,0,0,35,134,0,1,
+0,0,35,149,0,2,0,0,35,156,0,3,0,0,35,168,
+0,4,0,0,35,174,0,5,0,0,35,190,0,6,0,0,
+35,206,0,7,0,0,35,221,0,8,0,0,35,246,0,9,
+0,0,36,2,0,0,0,0,36,193,0,1,0,0,36,198,
+0,2,0,0,36,203,0,3,0,0,36,208,0,4,0,0,
+36,224,0,5,0,0,36,243,0,6,0,0,37,5,0,7,
+0,0,37,18,0,8,0,0,37,27,0,9,0,0,37,35,
+0,10,0,0,37,56,0,11,0,0,37,61,0,12,0,0,
+37,75,0,100,0,0,37,98,0,101,0,0,37,116,0,102,
+0,0,37,133,0,103,0,0,37,157,0,104,0,0,37,170,
+0,105,0,0,37,189,0,200,0,0,37,212,0,0,0,0,
+37,234,0,1,0,0,37,255,0,2,0,0,38,12,0,3,
+0,0,38,43,0,4,0,0,38,59,0,5,0,0,38,69,
+0,6,0,0,38,88,0,7,0,0,38,107,0,8,0,0,
+38,125,0,9,0,0,38,140,0,10,0,0,38,159,0,100,
+0,0,38,191,0,101,0,0,38,203,0,102,0,0,38,212,
+0,103,0,0,38,221,0,104,0,0,38,227,0,105,0,0,
+38,244,3,232,0,0,39,27,3,233,0,0,39,45,3,234,
+0,0,39,71,3,235,0,0,39,119,0,0,0,0,39,140,
+0,1,0,0,39,158,0,2,0,0,39,163,0,3,0,0,
+39,168,0,0,0,0,39,173,0,1,0,0,39,183,0,2,
+0,0,39,198,0,3,0,0,39,217,0,100,0,0,39,231,
+0,101,0,0,40,6,0,102,0,0,40,14,0,0,0,0,
+40,22,0,0,0,0,40,37,0,1,0,0,40,55,0,2,
+0,0,40,61,0,0,0,0,40,66,0,1,0,0,40,80,
+0,2,0,0,40,104,0,3,0,0,40,118,0,4,0,0,
+40,134,0,5,0,0,40,149,0,6,0,0,40,181,0,7,
+0,0,40,193,0,8,0,0,40,205,0,9,0,0,40,218,
+0,10,0,0,40,235,0,11,0,0,40,253,0,12,0,0,
+41,12,0,13,0,0,41,33,0,50,0,0,41,51,0,100,
+0,0,41,169,0,101,0,0,41,185,0,102,0,0,41,203,
+0,103,0,0,41,227,0,0,0,0,42,6,0,1,0,0,
+42,24,0,100,0,0,42,44,0,101,0,0,42,54,0,102,
+0,0,42,64,3,232,0,0,42,99,3,233,0,0,42,111,
+3,234,0,0,42,131,3,235,0,0,42,146,3,236,0,0,
+42,178,3,237,0,0,42,218,3,238,0,0,43,4,3,239,
+0,0,43,49,3,240,0,0,43,83,4,76,0,0,43,96,
+4,77,0,0,43,101,4,78,0,0,43,106,4,79,0,0,
+43,133,4,80,0,0,43,160,4,81,0,0,43,182,4,82,
+0,0,43,219,4,83,0,0,43,242,4,84,0,0,44,9,
+4,85,0,0,44,41,4,86,0,0,44,79,4,87,0,0,
+44,121,4,176,0,0,44,161,4,177,0,0,44,179,4,178,
+0,0,44,195,4,179,0,0,44,212,4,180,0,0,44,223,
+4,181,0,0,44,234,5,20,0,0,45,2,5,21,0,0,
+45,34,5,22,0,0,45,70,0,1,0,0,45,91,0,2,
+0,0,45,97,0,10,0,0,45,128,0,11,0,0,45,139,
+0,12,0,0,45,148,0,13,0,0,45,160,0,14,0,0,
+45,164,0,15,0,0,45,175,0,16,0,0,45,185,0,17,
+0,0,45,190,0,18,0,0,45,195,0,19,0,0,45,202,
+0,20,0,0,45,208,0,21,0,0,45,217,0,22,0,0,
+46,27,0,23,0,0,46,36,0,24,0,0,46,53,0,25,
+0,0,46,61,0,26,0,0,46,67,0,27,0,0,46,72,
+0,28,0,0,46,80,0,29,0,0,46,94,0,30,0,0,
+46,101,0,31,0,0,46,118,0,32,0,0,46,136,0,33,
+0,0,46,147,0,34,0,0,46,157,0,35,0,0,46,175,
+0,36,0,0,46,193,0,37,0,0,46,210,0,38,0,0,
+46,227,0,39,0,0,46,243,0,40,0,0,47,1,0,41,
+0,0,47,7,0,42,0,0,47,14,0,43,0,0,47,52,
+0,44,0,0,47,70,0,45,0,0,47,78,0,46,0,0,
+47,86,0,47,0,0,47,94,0,48,0,0,47,124,0,49,
+0,0,47,134,0,50,0,0,47,152,0,51,0,0,47,161,
+0,52,0,0,47,169,0,53,0,0,47,176,0,54,0,0,
+47,182,0,55,0,0,47,196,0,56,0,0,47,207,0,57,
+0,0,47,213,0,58,0,0,47,229,0,59,0,0,47,253,
+0,60,0,0,48,19,0,61,0,0,48,26,0,62,0,0,
+48,42,0,63,0,0,48,56,0,64,0,0,48,82,0,65,
+0,0,48,95,0,66,0,0,48,103,0,67,0,0,48,119,
+0,68,0,0,48,136,0,69,0,0,48,150,0,70,0,0,
+48,162,0,71,0,0,48,181,0,72,0,0,48,196,3,232,
+0,0,48,211,3,233,0,0,48,248,3,234,0,0,49,36,
+3,235,0,0,49,80,3,236,0,0,49,125,3,237,0,0,
+49,254,3,238,0,0,50,53,3,239,0,0,50,80,3,240,
+0,0,50,104,3,241,0,0,50,140,3,242,0,0,50,231,
+3,243,0,0,51,8,0,0,0,0,51,66,0,1,0,0,
+51,87,0,2,0,0,51,93,0,3,0,0,51,98,0,4,
+0,0,51,105,0,0,0,0,51,112,0,1,0,0,51,134,
+0,0,0,0,51,153,0,1,0,0,51,175,0,2,0,0,
+51,185,0,3,0,0,51,191,0,4,0,0,51,208,0,5,
+0,0,51,218,0,100,0,0,51,225,0,101,0,0,51,249,
+0,102,0,0,52,16,0,103,0,0,52,34,0,104,0,0,
+52,79,0,105,0,0,52,111,0,106,0,0,52,136,0,107,
+0,0,52,195,0,108,0,0,52,223,0,150,0,0,53,36,
+0,151,0,0,53,61,0,152,0,0,53,111,0,153,0,0,
+53,163,0,154,0,0,53,224,0,200,0,0,54,30,0,201,
+0,0,54,44,0,202,0,0,54,66,0,203,0,0,54,84,
+0,204,0,0,54,95,0,205,0,0,54,102,0,206,0,0,
+54,110,0,207,0,0,54,226,0,208,0,0,55,4,0,209,
+0,0,55,19,0,210,0,0,55,47,0,211,0,0,55,63,
+0,250,0,0,55,78,0,251,0,0,55,93,0,252,0,0,
+55,107,0,253,0,0,55,115,0,254,0,0,55,120,0,255,
+0,0,55,126,1,44,0,0,55,148,1,45,0,0,55,170,
+1,46,0,0,55,199,1,47,0,0,55,230,1,48,0,0,
+55,245,1,49,0,0,56,32,3,232,0,0,56,87,3,233,
+0,0,56,115,4,76,0,0,56,156,4,77,0,0,56,176,
+4,78,0,0,56,190,4,79,0,0,56,205,4,80,0,0,
+56,221,4,81,0,0,56,233,4,82,0,0,56,247,4,83,
+0,0,57,5,0,1,0,0,57,20,0,2,0,0,57,29,
+0,3,0,0,57,38,0,4,0,0,57,48,0,5,0,0,
+57,62,0,6,0,0,57,73,0,7,0,0,57,82,3,232,
+0,0,57,94,3,233,0,0,57,105,3,234,0,0,57,117,
+3,235,0,0,57,126,3,236,0,0,57,141,3,237,0,0,
+57,163,3,238,0,0,57,187,3,239,0,0,57,196,4,76,
+0,0,57,214,4,77,0,0,57,223,4,78,0,0,57,232,
+4,79,0,0,57,241,4,80,0,0,57,251,4,81,0,0,
+58,21,4,82,0,0,58,54,4,83,0,0,58,76,4,176,
+0,0,58,120,4,177,0,0,58,133,4,178,0,0,58,148,
+4,179,0,0,58,160,4,180,0,0,58,187,4,181,0,0,
+58,196,4,182,0,0,58,204,4,183,0,0,58,227,4,184,
+0,0,59,11,4,185,0,0,59,58,5,20,0,0,59,105,
+5,21,0,0,59,134,5,22,0,0,59,155,5,23,0,0,
+59,180,5,24,0,0,59,207,5,25,0,0,59,235,7,208,
+0,0,59,248,7,209,0,0,60,9,7,210,0,0,60,24,
+7,211,0,0,60,51,7,212,0,0,60,97,7,213,0,0,
+60,111,7,214,0,0,60,122,7,215,0,0,60,132,7,216,
+0,0,60,167,7,217,0,0,60,194,7,218,0,0,60,222,
+7,219,0,0,60,236,7,220,0,0,61,16,7,221,0,0,
+61,38,7,222,0,0,61,51,7,223,0,0,61,72,7,224,
+0,0,61,81,7,225,0,0,61,90,7,226,0,0,61,101,
+8,52,0,0,61,111,8,53,0,0,61,133,8,54,0,0,
+61,158,8,102,0,0,61,183,8,152,0,0,61,211,8,153,
+0,0,61,231,8,154,0,0,61,252,8,155,0,0,62,30,
+8,252,0,0,62,65,8,253,0,0,62,78,8,254,0,0,
+62,91,8,255,0,0,62,119,9,0,0,0,62,144,9,96,
+0,0,62,181,9,97,0,0,62,222,9,98,0,0,63,6,
+9,196,0,0,63,19,9,197,0,0,63,51,9,198,0,0,
+63,66,11,184,0,0,63,82,11,185,0,0,63,95,11,186,
+0,0,63,110,11,187,0,0,63,120,11,188,0,0,63,138,
+11,189,0,0,63,175,11,190,0,0,63,189,11,191,0,0,
+63,212,11,192,0,0,63,233,11,193,0,0,63,245,11,194,
+0,0,64,4,11,195,0,0,64,24,11,196,0,0,64,69,
+11,197,0,0,64,90,11,198,0,0,64,108,12,28,0,0,
+64,154,12,29,0,0,64,181,12,30,0,0,64,205,12,31,
+0,0,64,214,12,32,0,0,64,228,12,33,0,0,64,246,
+12,34,0,0,65,1,12,35,0,0,65,11,12,36,0,0,
+65,21,12,37,0,0,65,37,12,38,0,0,65,55,12,39,
+0,0,65,76,12,40,0,0,65,92,12,41,0,0,65,109,
+12,128,0,0,65,125,12,129,0,0,65,137,12,130,0,0,
+65,150,12,131,0,0,65,159,12,228,0,0,65,174,12,229,
+0,0,65,199,12,230,0,0,65,225,12,231,0,0,65,234,
+12,232,0,0,65,244,12,233,0,0,65,255,19,136,0,0,
+66,10,19,137,0,0,66,16,19,138,0,0,66,34,19,139,
+0,0,66,55,19,140,0,0,66,76,19,141,0,0,66,81,
+19,142,0,0,66,87,19,143,0,0,66,97,19,144,0,0,
+66,110,19,145,0,0,66,118,19,146,0,0,66,125,19,147,
+0,0,66,140,19,236,0,0,66,147,19,237,0,0,66,170,
+19,238,0,0,66,179,19,239,0,0,66,188,19,240,0,0,
+66,206,19,241,0,0,66,224,19,242,0,0,66,242,19,243,
+0,0,67,13,19,244,0,0,67,23,19,245,0,0,67,35,
+19,246,0,0,67,65,19,247,0,0,67,81,19,248,0,0,
+67,106,19,249,0,0,67,123,19,250,0,0,67,147,19,251,
+0,0,67,183,19,252,0,0,67,229,19,253,0,0,68,8,
+19,254,0,0,68,44,19,255,0,0,68,93,20,0,0,0,
+68,143,20,1,0,0,68,176,20,2,0,0,68,202,20,3,
+0,0,68,233,20,4,0,0,69,8,20,5,0,0,69,57,
+20,6,0,0,69,98,20,7,0,0,69,122,20,8,0,0,
+69,142,20,9,0,0,69,167,20,10,0,0,69,187,20,11,
+0,0,69,221,20,12,0,0,69,229,20,13,0,0,69,243,
+20,14,0,0,70,2,20,15,0,0,70,17,20,16,0,0,
+70,30,20,17,0,0,70,40,20,18,0,0,70,55,20,19,
+0,0,70,76,20,20,0,0,70,105,20,21,0,0,70,115,
+20,22,0,0,70,148,20,23,0,0,70,157,20,24,0,0,
+70,183,20,25,0,0,70,201,20,26,0,0,70,217,20,27,
+0,0,70,239,20,28,0,0,71,7,20,29,0,0,71,28,
+20,30,0,0,71,41,20,31,0,0,71,61,20,32,0,0,
+71,71,20,33,0,0,71,82,20,34,0,0,71,95,20,35,
+0,0,71,104,20,36,0,0,71,120,20,37,0,0,71,147,
+20,38,0,0,71,178,20,39,0,0,71,191,20,40,0,0,
+71,199,20,41,0,0,71,213,20,42,0,0,71,229,20,43,
+0,0,71,239,20,44,0,0,71,248,20,45,0,0,72,4,
+20,46,0,0,72,15,20,47,0,0,72,25,20,48,0,0,
+72,33,20,49,0,0,72,41,20,50,0,0,72,51,20,51,
+0,0,72,72,20,52,0,0,72,89,20,53,0,0,72,99,
+20,54,0,0,72,126,20,55,0,0,72,150,20,56,0,0,
+72,167,20,57,0,0,72,177,20,58,0,0,72,204,0,0,
+0,0,72,213,0,1,0,0,72,221,0,2,0,0,73,13,
+0,3,0,0,73,28,0,4,0,0,73,43,0,5,0,0,
+73,89,0,6,0,0,73,158,0,7,0,0,73,187,0,8,
+0,0,74,37,0,9,0,0,74,84,0,100,0,0,74,223,
+0,200,0,0,75,18,0,201,0,0,75,100,0,202,0,0,
+75,140,0,0,0,0,75,177,0,1,0,0,75,183,0,2,
+0,0,75,209,0,3,0,0,75,234,0,4,0,0,75,253,
+0,5,0,0,76,19,0,6,0,0,76,69,0,1,0,0,
+76,114,0,2,0,0,76,144,0,3,0,0,76,178,0,4,
+0,0,76,202,0,5,0,0,76,230,0,6,0,0,77,11,
+0,1,0,0,77,42,0,2,0,0,77,45,0,3,0,0,
+77,52,0,4,0,0,77,56,0,5,0,0,77,59,0,6,
+0,0,77,64,0,7,0,0,77,75,0,8,0,0,77,81,
+0,9,0,0,77,105,0,10,0,0,77,118,0,11,0,0,
+77,128,0,12,0,0,77,138,0,13,0,0,77,155,0,14,
+0,0,77,160,0,15,0,0,77,169,0,16,0,0,77,178,
+0,17,0,0,77,187,0,18,0,0,77,202,0,19,0,0,
+77,220,0,20,0,0,78,14,0,21,0,0,78,39,0,22,
+0,0,78,51,0,23,0,0,78,57,0,24,0,0,78,64,
+0,25,0,0,78,69,0,26,0,0,78,79,0,27,0,0,
+78,86,80,114,101,118,105,101,119,0,78,97,109,101,0,87,
+105,100,116,104,0,72,101,105,103,104,116,0,82,101,115,111,
+108,117,116,105,111,110,0,73,109,97,103,101,32,98,105,116,
+115,0,68,101,110,115,105,116,121,0,67,111,108,111,114,0,
+84,121,112,101,0,66,108,101,110,100,32,109,111,100,101,0,
+79,112,97,99,105,116,121,0,84,101,120,116,117,114,101,0,
+65,110,103,108,101,0,66,97,99,107,103,114,111,117,110,100,
+32,99,111,108,111,114,0,83,105,122,101,0,85,110,105,116,
+0,84,101,109,112,108,97,116,101,0,65,110,116,105,45,97,
+108,105,97,115,105,110,103,0,80,105,120,101,108,32,109,111,
+100,101,0,99,105,114,99,108,101,0,99,105,114,99,108,101,
+32,102,114,97,109,101,0,114,101,99,116,97,110,103,108,101,
+0,114,101,99,116,97,110,103,108,101,32,102,114,97,109,101,
+0,100,105,97,109,111,110,100,0,100,105,97,109,111,110,100,
+32,102,114,97,109,101,0,88,32,109,97,114,107,0,99,114,
+111,115,115,0,103,108,105,116,116,101,114,0,0,82,101,115,
+101,116,0,65,100,100,0,68,101,108,101,116,101,0,85,112,
+0,68,111,119,110,0,82,101,110,97,109,101,0,68,117,112,
+108,105,99,97,116,101,0,69,100,105,116,0,79,112,101,110,
+0,83,97,118,101,0,77,111,118,101,0,91,83,104,105,102,
+116,58,32,66,114,117,115,104,32,115,105,122,101,32,99,104,
+97,110,103,101,93,32,91,67,116,114,108,58,32,82,117,108,
 101,114,32,115,101,116,116,105,110,103,93,32,91,65,108,116,
 58,32,67,111,108,111,114,32,80,105,99,107,101,114,40,99,
 97,110,118,97,115,41,93,0,91,83,104,105,102,116,58,32,
-72,111,114,105,122,111,110,116,97,108,93,32,91,67,116,114,
-108,58,32,86,101,114,116,105,99,97,108,93,0,91,43,67,
-116,114,108,32,119,104,101,110,32,112,114,101,115,115,101,100,
-58,32,82,97,110,103,101,32,100,101,108,101,116,105,111,110,
-93,0,91,67,116,114,108,58,32,72,105,100,101,32,115,101,
-108,101,99,116,105,111,110,32,119,104,105,108,101,32,100,114,
-97,103,103,105,110,103,93,0,91,73,102,32,116,104,101,114,
-101,32,105,115,32,97,110,32,105,109,97,103,101,44,32,99,
-108,105,99,107,32,116,111,32,112,97,115,116,101,93,32,91,
-67,116,114,108,58,32,67,108,101,97,114,32,116,104,101,32,
-105,109,97,103,101,32,97,110,100,32,115,116,97,114,116,32,
-115,101,108,101,99,116,105,110,103,93,0,91,67,116,114,108,
-58,32,71,101,116,32,116,104,101,32,99,111,108,111,114,32,
-111,110,32,116,104,101,32,108,97,121,101,114,93,32,91,83,
-104,105,102,116,58,32,70,105,114,115,116,32,115,101,116,32,
-111,102,32,99,111,108,111,114,32,109,97,115,107,115,93,0,
-91,83,104,105,102,116,58,32,52,53,32,100,101,103,114,101,
-101,32,117,110,105,116,93,0,91,83,104,105,102,116,58,32,
-115,113,117,97,114,101,93,0,91,83,104,105,102,116,58,32,
-99,105,114,99,108,101,93,32,91,67,116,114,108,58,32,114,
-101,99,116,97,110,103,108,101,93,0,91,83,104,105,102,116,
-58,32,52,53,32,100,101,103,114,101,101,32,117,110,105,116,
-93,32,91,82,105,103,104,116,47,76,101,102,116,32,68,66,
-76,67,76,75,47,69,110,116,101,114,47,69,83,67,58,32,
-102,105,110,105,115,104,93,32,91,66,97,99,107,83,112,97,
-99,101,58,32,67,111,110,110,101,99,116,32,119,105,116,104,
-32,116,104,101,32,115,116,97,114,116,32,112,111,105,110,116,
-32,97,110,100,32,101,110,100,93,0,91,83,104,105,102,116,
-58,32,52,53,32,100,101,103,114,101,101,32,117,110,105,116,
-93,32,91,82,105,103,104,116,47,76,101,102,116,32,68,66,
-76,67,76,75,47,69,110,116,101,114,58,32,102,105,110,105,
-115,104,93,32,91,69,83,67,58,32,99,97,110,99,101,108,
+49,112,120,32,101,114,97,115,101,114,93,32,91,67,116,114,
+108,58,32,82,117,108,101,114,32,115,101,116,116,105,110,103,
+93,32,91,65,108,116,58,32,67,111,108,111,114,32,80,105,
+99,107,101,114,40,99,97,110,118,97,115,41,93,0,91,67,
+116,114,108,58,32,82,117,108,101,114,32,115,101,116,116,105,
+110,103,93,32,91,65,108,116,58,32,67,111,108,111,114,32,
+80,105,99,107,101,114,40,99,97,110,118,97,115,41,93,0,
+91,83,104,105,102,116,58,32,72,111,114,105,122,111,110,116,
+97,108,93,32,91,67,116,114,108,58,32,86,101,114,116,105,
+99,97,108,93,0,91,43,67,116,114,108,32,119,104,101,110,
+32,112,114,101,115,115,101,100,58,32,82,97,110,103,101,32,
+100,101,108,101,116,105,111,110,93,0,91,67,116,114,108,58,
+32,72,105,100,101,32,115,101,108,101,99,116,105,111,110,32,
+119,104,105,108,101,32,100,114,97,103,103,105,110,103,93,0,
+91,73,102,32,116,104,101,114,101,32,105,115,32,97,110,32,
+105,109,97,103,101,44,32,99,108,105,99,107,32,116,111,32,
+112,97,115,116,101,93,32,91,67,116,114,108,58,32,67,108,
+101,97,114,32,116,104,101,32,105,109,97,103,101,32,97,110,
+100,32,115,116,97,114,116,32,115,101,108,101,99,116,105,110,
+103,93,0,91,67,116,114,108,58,32,71,101,116,32,116,104,
+101,32,99,111,108,111,114,32,111,110,32,116,104,101,32,108,
+97,121,101,114,93,32,91,83,104,105,102,116,58,32,70,105,
+114,115,116,32,115,101,116,32,111,102,32,99,111,108,111,114,
+32,109,97,115,107,115,93,0,91,83,104,105,102,116,58,32,
+52,53,32,100,101,103,114,101,101,32,117,110,105,116,93,0,
+91,83,104,105,102,116,58,32,115,113,117,97,114,101,93,0,
+91,83,104,105,102,116,58,32,99,105,114,99,108,101,93,32,
+91,67,116,114,108,58,32,114,101,99,116,97,110,103,108,101,
 93,0,91,83,104,105,102,116,58,32,52,53,32,100,101,103,
 114,101,101,32,117,110,105,116,93,32,91,82,105,103,104,116,
-47,69,83,67,58,32,99,97,110,99,101,108,93,32,91,66,
-97,99,107,83,112,97,99,101,58,32,82,101,116,117,114,110,
-32,116,111,32,99,111,110,116,114,111,108,32,112,111,105,110,
-116,32,49,93,0,91,83,104,105,102,116,58,32,52,53,32,
-100,101,103,114,101,101,32,117,110,105,116,93,32,91,82,105,
-103,104,116,47,76,101,102,116,32,68,66,76,67,76,75,47,
-69,110,116,101,114,58,32,100,114,97,119,93,32,91,69,83,
-67,58,32,99,97,110,99,101,108,93,0,78,101,119,0,79,
-112,101,110,0,79,112,101,110,32,114,101,99,101,110,116,108,
-121,32,117,115,101,100,32,102,105,108,101,115,0,79,118,101,
-114,119,114,105,116,101,0,83,97,118,101,32,97,115,0,83,
-97,118,101,32,100,117,112,108,105,99,97,116,101,0,85,110,
-100,111,0,82,101,100,111,0,67,108,101,97,114,32,108,97,
-121,101,114,0,82,101,108,101,97,115,101,32,115,101,108,101,
-99,116,105,111,110,0,83,104,111,119,32,112,97,110,101,108,
-115,0,70,108,105,112,32,99,97,110,118,97,115,32,104,111,
-114,105,122,111,110,116,97,108,108,121,0,83,104,111,119,32,
-98,97,99,107,103,114,111,117,110,100,32,97,115,32,112,108,
-97,105,100,32,112,97,116,116,101,114,110,0,83,104,111,119,
-32,103,114,105,100,0,83,104,111,119,32,100,105,118,105,100,
-105,110,103,32,108,105,110,101,0,71,114,105,100,32,115,101,
-116,116,105,110,103,115,0,70,105,108,116,101,114,32,108,105,
-115,116,32,112,97,110,101,108,0,90,111,111,109,0,84,111,
-111,108,0,84,111,111,108,32,108,105,115,116,0,66,114,117,
-115,104,32,115,101,116,116,105,110,103,115,0,79,112,116,105,
-111,110,0,76,97,121,101,114,0,67,111,108,111,114,0,67,
-111,108,111,114,32,119,104,101,101,108,0,67,111,108,111,114,
-32,112,97,108,101,116,116,101,0,67,97,110,118,97,115,32,
-99,111,110,116,114,111,108,0,67,97,110,118,97,115,32,118,
-105,101,119,0,73,109,97,103,101,32,118,105,101,119,101,114,
-0,70,105,108,116,101,114,32,108,105,115,116,0,67,111,108,
-111,114,0,71,114,97,121,115,99,97,108,101,0,65,108,112,
-104,97,32,118,97,108,117,101,0,65,108,112,104,97,32,118,
-97,108,117,101,40,49,98,105,116,41,0,70,111,108,100,101,
-114,0,84,111,110,101,32,108,97,121,101,114,58,71,114,97,
-121,115,99,97,108,101,0,84,111,110,101,32,108,97,121,101,
-114,58,65,108,112,104,97,32,118,97,108,117,101,40,49,98,
-105,116,41,0,84,101,120,116,32,108,97,121,101,114,58,65,
-108,112,104,97,32,118,97,108,117,101,0,84,101,120,116,32,
-108,97,121,101,114,58,65,108,112,104,97,32,118,97,108,117,
-101,40,49,98,105,116,41,0,110,111,114,109,97,108,0,109,
-117,108,116,105,112,108,105,99,97,116,105,111,110,0,97,100,
-100,105,116,105,111,110,0,115,117,98,116,114,97,99,116,105,
-111,110,0,115,99,114,101,101,110,0,111,118,101,114,108,97,
-121,0,104,97,114,100,32,108,105,103,104,116,0,115,111,102,
-116,32,108,105,103,104,116,0,100,111,100,103,101,0,98,117,
-114,110,0,108,105,110,101,97,114,32,98,117,114,110,0,118,
-105,118,105,100,32,108,105,103,104,116,0,108,105,110,101,97,
-114,32,108,105,103,104,116,0,112,105,110,32,108,105,103,104,
-116,0,100,105,109,0,98,114,105,103,104,116,101,110,0,100,
-105,102,102,101,114,101,110,99,101,0,108,117,109,105,110,111,
-117,115,40,97,100,100,41,0,108,117,109,105,110,111,117,115,
-40,100,111,100,103,101,41,0,84,111,111,108,32,108,105,115,
-116,0,68,111,116,32,108,105,110,101,0,68,111,116,32,101,
-114,97,115,101,114,0,70,105,110,103,101,114,0,83,104,97,
-112,101,100,32,102,105,108,108,0,83,104,97,112,101,100,32,
-101,114,97,115,101,114,0,70,105,108,108,0,79,112,97,113,
-117,101,32,97,114,101,97,32,99,108,101,97,114,0,71,114,
-97,100,105,101,110,116,0,84,101,120,116,0,77,111,118,101,
-0,77,97,103,105,99,32,119,97,110,100,0,83,101,108,101,
-99,116,105,111,110,0,67,117,116,32,97,110,100,32,112,97,
-115,116,101,0,82,101,99,116,97,110,103,108,101,32,101,100,
-105,116,105,110,103,0,83,116,97,109,112,0,77,111,118,101,
-32,99,97,110,118,97,115,0,82,111,116,97,116,101,32,99,
-97,110,118,97,115,0,67,111,108,111,114,32,112,105,99,107,
-101,114,0,70,114,101,101,32,104,97,110,100,0,76,105,110,
-101,0,82,101,99,116,97,110,103,108,101,0,67,105,114,99,
-108,101,0,67,111,110,116,105,110,117,111,117,115,32,115,116,
-114,97,105,103,104,116,32,108,105,110,101,0,67,111,110,99,
-101,110,116,114,97,116,101,100,32,108,105,110,101,0,66,101,
-122,105,101,114,32,99,117,114,118,101,0,108,105,110,101,97,
-114,0,82,111,117,110,100,0,82,101,99,116,97,110,103,108,
-101,0,82,97,100,105,97,108,0,67,117,114,114,101,110,116,
-32,108,97,121,101,114,0,71,114,97,98,98,101,100,32,108,
-97,121,101,114,0,67,104,101,99,107,101,100,32,108,97,121,
-101,114,115,0,65,108,108,32,108,97,121,101,114,115,0,67,
-111,108,111,114,32,111,110,32,99,97,110,118,97,115,0,67,
-111,108,111,114,32,111,110,32,116,104,101,32,99,117,114,114,
-101,110,116,32,108,97,121,101,114,0,67,114,101,97,116,101,
-32,110,101,117,116,114,97,108,32,99,111,108,111,114,32,40,
-99,108,105,99,107,32,50,32,112,111,105,110,116,115,41,0,
-82,101,112,108,97,99,101,32,116,104,101,32,99,111,108,111,
-114,32,97,99,113,117,105,114,101,100,32,111,110,32,116,104,
-101,32,108,97,121,101,114,32,119,105,116,104,32,116,104,101,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,0,82,
-101,112,108,97,99,101,32,116,104,101,32,99,111,108,111,114,
-32,97,99,113,117,105,114,101,100,32,111,110,32,116,104,101,
-32,108,97,121,101,114,32,119,105,116,104,32,116,114,97,110,
-115,112,97,114,101,110,116,0,80,111,108,121,103,111,110,0,
-77,111,118,101,32,105,109,97,103,101,0,67,111,112,121,32,
-105,109,97,103,101,0,77,111,118,101,32,115,101,108,101,99,
-116,105,111,110,0,67,111,112,121,0,67,117,116,0,80,97,
-115,116,101,0,80,97,115,116,101,32,102,114,111,109,32,105,
-109,97,103,101,0,70,108,105,112,32,104,111,114,105,122,111,
-110,116,97,108,0,102,108,105,112,32,117,112,115,105,100,101,
-32,100,111,119,110,0,82,111,116,97,116,101,32,57,48,32,
-100,101,103,114,101,101,115,32,116,111,32,116,104,101,32,108,
-101,102,116,0,82,111,116,97,116,101,32,57,48,32,100,101,
-103,114,101,101,115,32,116,111,32,116,104,101,32,114,105,103,
-104,116,0,84,114,97,110,115,102,111,114,109,97,116,105,111,
-110,0,84,114,105,109,109,105,110,103,0,80,105,120,101,108,
-32,111,118,101,114,108,97,112,0,83,116,114,111,107,101,32,
+47,76,101,102,116,32,68,66,76,67,76,75,47,69,110,116,
+101,114,47,69,83,67,58,32,102,105,110,105,115,104,93,32,
+91,66,97,99,107,83,112,97,99,101,58,32,67,111,110,110,
+101,99,116,32,119,105,116,104,32,116,104,101,32,115,116,97,
+114,116,32,112,111,105,110,116,32,97,110,100,32,101,110,100,
+93,0,91,83,104,105,102,116,58,32,52,53,32,100,101,103,
+114,101,101,32,117,110,105,116,93,32,91,82,105,103,104,116,
+47,76,101,102,116,32,68,66,76,67,76,75,47,69,110,116,
+101,114,58,32,102,105,110,105,115,104,93,32,91,69,83,67,
+58,32,99,97,110,99,101,108,93,0,91,83,104,105,102,116,
+58,32,52,53,32,100,101,103,114,101,101,32,117,110,105,116,
+93,32,91,82,105,103,104,116,47,69,83,67,58,32,99,97,
+110,99,101,108,93,32,91,66,97,99,107,83,112,97,99,101,
+58,32,82,101,116,117,114,110,32,116,111,32,99,111,110,116,
+114,111,108,32,112,111,105,110,116,32,49,93,0,91,83,104,
+105,102,116,58,32,52,53,32,100,101,103,114,101,101,32,117,
+110,105,116,93,32,91,82,105,103,104,116,47,76,101,102,116,
+32,68,66,76,67,76,75,47,69,110,116,101,114,58,32,100,
+114,97,119,93,32,91,69,83,67,58,32,99,97,110,99,101,
+108,93,0,78,101,119,0,79,112,101,110,0,79,112,101,110,
+32,114,101,99,101,110,116,108,121,32,117,115,101,100,32,102,
+105,108,101,115,0,79,118,101,114,119,114,105,116,101,0,83,
+97,118,101,32,97,115,0,83,97,118,101,32,100,117,112,108,
+105,99,97,116,101,0,85,110,100,111,0,82,101,100,111,0,
+67,108,101,97,114,32,108,97,121,101,114,0,82,101,108,101,
+97,115,101,32,115,101,108,101,99,116,105,111,110,0,83,104,
+111,119,32,112,97,110,101,108,115,0,70,108,105,112,32,99,
+97,110,118,97,115,32,104,111,114,105,122,111,110,116,97,108,
+108,121,0,83,104,111,119,32,98,97,99,107,103,114,111,117,
+110,100,32,97,115,32,112,108,97,105,100,32,112,97,116,116,
+101,114,110,0,83,104,111,119,32,103,114,105,100,0,83,104,
+111,119,32,100,105,118,105,100,105,110,103,32,108,105,110,101,
+0,71,114,105,100,32,115,101,116,116,105,110,103,115,0,70,
+105,108,116,101,114,32,108,105,115,116,32,112,97,110,101,108,
+0,90,111,111,109,0,84,111,111,108,0,84,111,111,108,32,
+108,105,115,116,0,66,114,117,115,104,32,115,101,116,116,105,
+110,103,115,0,79,112,116,105,111,110,0,76,97,121,101,114,
+0,67,111,108,111,114,0,67,111,108,111,114,32,119,104,101,
+101,108,0,67,111,108,111,114,32,112,97,108,101,116,116,101,
+0,67,97,110,118,97,115,32,99,111,110,116,114,111,108,0,
+67,97,110,118,97,115,32,118,105,101,119,0,73,109,97,103,
+101,32,118,105,101,119,101,114,0,70,105,108,116,101,114,32,
+108,105,115,116,0,67,111,108,111,114,0,71,114,97,121,115,
+99,97,108,101,0,65,108,112,104,97,32,118,97,108,117,101,
+0,65,108,112,104,97,32,118,97,108,117,101,40,49,98,105,
+116,41,0,70,111,108,100,101,114,0,84,111,110,101,32,108,
+97,121,101,114,58,71,114,97,121,115,99,97,108,101,0,84,
+111,110,101,32,108,97,121,101,114,58,65,108,112,104,97,32,
+118,97,108,117,101,40,49,98,105,116,41,0,84,101,120,116,
+32,108,97,121,101,114,58,65,108,112,104,97,32,118,97,108,
+117,101,0,84,101,120,116,32,108,97,121,101,114,58,65,108,
+112,104,97,32,118,97,108,117,101,40,49,98,105,116,41,0,
+110,111,114,109,97,108,0,109,117,108,116,105,112,108,105,99,
+97,116,105,111,110,0,97,100,100,105,116,105,111,110,0,115,
+117,98,116,114,97,99,116,105,111,110,0,115,99,114,101,101,
+110,0,111,118,101,114,108,97,121,0,104,97,114,100,32,108,
+105,103,104,116,0,115,111,102,116,32,108,105,103,104,116,0,
+100,111,100,103,101,0,98,117,114,110,0,108,105,110,101,97,
+114,32,98,117,114,110,0,118,105,118,105,100,32,108,105,103,
+104,116,0,108,105,110,101,97,114,32,108,105,103,104,116,0,
+112,105,110,32,108,105,103,104,116,0,100,105,109,0,98,114,
+105,103,104,116,101,110,0,100,105,102,102,101,114,101,110,99,
+101,0,108,117,109,105,110,111,117,115,40,97,100,100,41,0,
+108,117,109,105,110,111,117,115,40,100,111,100,103,101,41,0,
+84,111,111,108,32,108,105,115,116,0,68,111,116,32,108,105,
+110,101,0,68,111,116,32,101,114,97,115,101,114,0,70,105,
+110,103,101,114,0,83,104,97,112,101,100,32,102,105,108,108,
+0,83,104,97,112,101,100,32,101,114,97,115,101,114,0,70,
+105,108,108,0,79,112,97,113,117,101,32,97,114,101,97,32,
+99,108,101,97,114,0,71,114,97,100,105,101,110,116,0,84,
+101,120,116,0,77,111,118,101,0,77,97,103,105,99,32,119,
+97,110,100,0,83,101,108,101,99,116,105,111,110,0,67,117,
+116,32,97,110,100,32,112,97,115,116,101,0,82,101,99,116,
+97,110,103,108,101,32,101,100,105,116,105,110,103,0,83,116,
+97,109,112,0,77,111,118,101,32,99,97,110,118,97,115,0,
+82,111,116,97,116,101,32,99,97,110,118,97,115,0,67,111,
+108,111,114,32,112,105,99,107,101,114,0,70,114,101,101,32,
+104,97,110,100,0,76,105,110,101,0,82,101,99,116,97,110,
+103,108,101,0,67,105,114,99,108,101,0,67,111,110,116,105,
+110,117,111,117,115,32,115,116,114,97,105,103,104,116,32,108,
+105,110,101,0,67,111,110,99,101,110,116,114,97,116,101,100,
+32,108,105,110,101,0,66,101,122,105,101,114,32,99,117,114,
+118,101,0,108,105,110,101,97,114,0,82,111,117,110,100,0,
+82,101,99,116,97,110,103,108,101,0,82,97,100,105,97,108,
+0,67,117,114,114,101,110,116,32,108,97,121,101,114,0,71,
+114,97,98,98,101,100,32,108,97,121,101,114,0,67,104,101,
+99,107,101,100,32,108,97,121,101,114,115,0,65,108,108,32,
+108,97,121,101,114,115,0,67,111,108,111,114,32,111,110,32,
+99,97,110,118,97,115,0,67,111,108,111,114,32,111,110,32,
+116,104,101,32,99,117,114,114,101,110,116,32,108,97,121,101,
+114,0,67,114,101,97,116,101,32,110,101,117,116,114,97,108,
+32,99,111,108,111,114,32,40,99,108,105,99,107,32,50,32,
+112,111,105,110,116,115,41,0,82,101,112,108,97,99,101,32,
+116,104,101,32,99,111,108,111,114,32,97,99,113,117,105,114,
+101,100,32,111,110,32,116,104,101,32,108,97,121,101,114,32,
+119,105,116,104,32,116,104,101,32,100,114,97,119,105,110,103,
+32,99,111,108,111,114,0,82,101,112,108,97,99,101,32,116,
+104,101,32,99,111,108,111,114,32,97,99,113,117,105,114,101,
+100,32,111,110,32,116,104,101,32,108,97,121,101,114,32,119,
+105,116,104,32,116,114,97,110,115,112,97,114,101,110,116,0,
+80,111,108,121,103,111,110,0,77,111,118,101,32,105,109,97,
+103,101,0,67,111,112,121,32,105,109,97,103,101,0,77,111,
+118,101,32,115,101,108,101,99,116,105,111,110,0,67,111,112,
+121,0,67,117,116,0,80,97,115,116,101,0,80,97,115,116,
+101,32,102,114,111,109,32,105,109,97,103,101,0,70,108,105,
+112,32,104,111,114,105,122,111,110,116,97,108,0,102,108,105,
+112,32,117,112,115,105,100,101,32,100,111,119,110,0,82,111,
+116,97,116,101,32,57,48,32,100,101,103,114,101,101,115,32,
+116,111,32,116,104,101,32,108,101,102,116,0,82,111,116,97,
+116,101,32,57,48,32,100,101,103,114,101,101,115,32,116,111,
+32,116,104,101,32,114,105,103,104,116,0,84,114,97,110,115,
+102,111,114,109,97,116,105,111,110,0,84,114,105,109,109,105,
+110,103,0,80,105,120,101,108,32,111,118,101,114,108,97,112,
+0,83,116,114,111,107,101,32,111,118,101,114,108,97,112,0,
+65,108,112,104,97,32,99,111,109,112,97,114,105,115,111,110,
+32,111,118,101,114,119,114,105,116,101,0,83,104,97,112,101,
+32,111,118,101,114,119,114,105,116,101,0,82,101,99,116,97,
+110,103,108,101,32,111,118,101,114,119,114,105,116,101,0,68,
+111,100,103,101,0,66,117,114,110,0,65,100,100,105,116,105,
+111,110,0,69,114,97,115,101,114,0,80,105,120,101,108,32,
 111,118,101,114,108,97,112,0,65,108,112,104,97,32,99,111,
 109,112,97,114,105,115,111,110,32,111,118,101,114,119,114,105,
-116,101,0,83,104,97,112,101,32,111,118,101,114,119,114,105,
-116,101,0,82,101,99,116,97,110,103,108,101,32,111,118,101,
-114,119,114,105,116,101,0,68,111,100,103,101,0,66,117,114,
-110,0,65,100,100,105,116,105,111,110,0,69,114,97,115,101,
-114,0,80,105,120,101,108,32,111,118,101,114,108,97,112,0,
-65,108,112,104,97,32,99,111,109,112,97,114,105,115,111,110,
-32,111,118,101,114,119,114,105,116,101,0,79,118,101,114,119,
-114,105,116,101,0,69,114,97,115,101,114,0,100,111,32,110,
-111,116,32,117,115,101,0,80,97,114,97,108,108,101,108,32,
-108,105,110,101,0,80,97,114,97,108,108,101,108,32,108,105,
-110,101,32,40,71,114,105,100,41,0,67,111,110,99,101,110,
-116,114,97,116,101,100,32,108,105,110,101,0,67,111,110,99,
-101,110,116,114,105,99,32,99,105,114,99,108,101,115,32,40,
-67,105,114,99,108,101,41,0,67,111,110,99,101,110,116,114,
-105,99,32,99,105,114,99,108,101,115,32,40,69,108,108,105,
-112,115,101,41,0,76,105,110,101,32,115,121,109,109,101,116,
-114,121,0,83,101,116,116,105,110,103,32,109,111,100,101,32,
-40,111,112,101,114,97,116,101,100,32,111,110,32,99,97,110,
-118,97,115,41,0,78,111,110,101,0,78,111,110,101,40,70,
-111,114,99,101,100,41,0,85,115,101,32,111,112,116,105,111,
-110,97,108,32,116,101,120,116,117,114,101,115,0,85,115,117,
-97,108,108,121,32,99,105,114,99,117,108,97,114,0,73,109,
-97,103,101,32,115,101,108,101,99,116,105,111,110,0,84,101,
-120,116,117,114,101,32,105,109,97,103,101,32,115,101,108,101,
-99,116,105,111,110,0,78,101,119,32,116,101,120,116,40,38,
-78,41,0,69,100,105,116,40,38,84,41,0,68,101,108,101,
-116,101,40,38,76,41,0,67,111,112,121,40,38,67,41,0,
-80,97,115,116,101,40,38,80,41,0,82,101,100,114,97,119,
-32,101,118,101,114,121,116,104,105,110,103,40,38,82,41,0,
-69,100,105,116,32,116,104,105,115,32,116,101,120,116,40,38,
-69,41,0,68,101,108,101,116,101,32,116,104,105,115,32,116,
-101,120,116,40,38,68,41,0,83,97,118,101,32,102,111,114,
-109,97,116,0,83,97,109,101,32,102,111,114,109,97,116,32,
-97,115,32,116,104,101,32,99,117,114,114,101,110,116,32,102,
-105,108,101,0,79,112,101,110,40,38,79,41,46,46,46,0,
-80,114,101,118,105,111,117,115,32,102,105,108,101,40,38,80,
-41,0,78,101,120,116,32,102,105,108,101,40,38,78,41,0,
-67,108,101,97,114,40,38,67,41,0,70,117,108,108,32,118,
-105,101,119,40,38,70,41,0,77,105,114,114,111,114,40,38,
-72,41,0,83,101,116,116,105,110,103,40,38,83,41,46,46,
-46,0,77,101,110,117,0,79,112,101,110,0,80,114,101,118,
-105,111,117,115,32,102,105,108,101,0,78,101,120,116,32,102,
-105,108,101,0,90,111,111,109,0,70,117,108,108,32,118,105,
-101,119,0,77,105,114,114,111,114,0,83,101,116,32,116,111,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,0,83,
-101,116,32,116,111,32,98,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,78,117,109,101,114,105,99,97,108,
-32,105,110,112,117,116,0,82,71,66,32,115,112,101,99,105,
-102,105,99,97,116,105,111,110,58,32,50,53,53,44,48,44,
-49,50,56,32,40,83,101,112,97,114,97,116,101,32,119,105,
-116,104,32,110,111,110,45,110,117,109,101,114,105,99,32,99,
-104,97,114,97,99,116,101,114,115,41,10,72,84,77,76,32,
-99,111,108,111,114,32,115,112,101,99,105,102,105,99,97,116,
-105,111,110,58,32,35,102,102,48,48,56,48,32,40,54,32,
-100,105,103,105,116,32,111,110,108,121,41,0,83,101,116,32,
-100,114,97,119,105,110,103,32,99,111,108,111,114,40,38,83,
-41,32,91,76,66,84,84,93,0,79,78,47,79,70,70,32,
-115,119,105,116,99,104,105,110,103,40,38,84,41,32,91,67,
-116,114,108,43,76,66,84,84,93,0,71,101,116,32,99,111,
-108,111,114,40,38,80,41,32,91,83,104,105,102,116,43,76,
-66,84,84,93,0,72,83,86,40,84,114,105,97,110,103,108,
-101,41,0,72,83,86,40,82,101,99,116,97,110,103,108,101,
-41,0,80,97,108,101,116,116,101,32,108,105,115,116,40,38,
-76,41,46,46,46,0,83,101,116,116,105,110,103,40,38,79,
-41,46,46,46,0,69,100,105,116,40,38,69,41,0,70,105,
-108,101,40,38,70,41,0,72,101,108,112,40,38,72,41,0,
-80,97,108,101,116,116,101,32,101,100,105,116,105,110,103,40,
-38,69,41,46,46,46,0,77,97,107,101,32,97,108,108,32,
-100,114,97,119,105,110,103,32,99,111,108,111,114,115,40,38,
-87,41,0,82,101,97,100,32,102,114,111,109,32,102,105,108,
-101,40,38,76,41,46,46,46,0,65,100,100,105,116,105,111,
-110,97,108,32,114,101,97,100,105,110,103,32,102,114,111,109,
-32,102,105,108,101,40,38,65,41,46,46,46,0,71,101,116,
-32,112,97,108,101,116,116,101,32,102,114,111,109,32,105,109,
-97,103,101,32,99,111,108,111,114,40,38,73,41,46,46,46,
-0,83,97,118,101,32,116,111,32,102,105,108,101,40,38,83,
-41,46,46,46,0,71,114,97,100,97,116,105,111,110,32,115,
-101,116,116,105,110,103,115,40,38,79,41,0,67,111,108,111,
-114,32,80,97,108,101,116,116,101,0,67,111,109,112,97,99,
-116,32,109,111,100,101,40,38,67,41,0,80,97,108,101,116,
-116,101,40,38,80,41,0,72,83,76,40,38,83,41,0,71,
-114,97,100,97,116,105,111,110,40,38,77,41,0,77,97,107,
-101,32,97,108,108,32,100,114,97,119,105,110,103,32,99,111,
-108,111,114,115,46,10,65,114,101,32,121,111,117,32,115,117,
-114,101,63,0,83,101,116,116,105,110,103,115,32,102,111,114,
-32,101,97,99,104,32,98,97,114,0,78,117,109,98,101,114,
-32,111,102,32,115,116,97,103,101,115,0,51,126,54,52,46,
-32,78,111,32,115,116,101,112,115,32,97,116,32,48,46,0,
-80,97,108,101,116,116,101,32,108,105,115,116,0,83,101,116,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,40,38,
-83,41,0,71,101,116,32,116,104,105,115,32,99,111,108,111,
-114,40,38,71,41,0,80,97,108,101,116,116,101,32,115,101,
-116,116,105,110,103,115,0,78,117,109,98,101,114,32,111,102,
-32,99,111,108,111,114,115,0,84,104,101,32,119,105,100,116,
-104,32,111,102,32,111,110,101,32,99,111,108,111,114,0,84,
-104,101,32,104,101,105,103,104,116,32,111,102,32,111,110,101,
-32,99,111,108,111,114,0,77,97,120,105,109,117,109,32,110,
-117,109,98,101,114,32,111,102,32,104,111,114,105,122,111,110,
-116,97,108,32,100,105,115,112,108,97,121,115,10,40,48,32,
-116,111,32,109,97,116,99,104,32,116,104,101,32,119,105,100,
-116,104,41,0,80,97,108,101,116,116,101,32,101,100,105,116,
-105,110,103,0,82,71,66,32,105,110,112,117,116,0,34,82,
-44,71,44,66,34,32,111,114,32,34,35,82,82,71,71,66,
-66,34,46,10,83,101,116,32,119,105,116,104,32,69,110,116,
-101,114,46,0,83,104,105,102,116,43,76,32,111,114,32,82,
-105,103,104,116,32,99,108,105,99,107,58,32,83,101,108,101,
-99,116,32,102,114,111,109,32,116,104,101,32,99,117,114,114,
-101,110,116,32,112,111,115,105,116,105,111,110,32,116,111,32,
-116,104,101,32,112,114,101,115,115,101,100,32,112,111,115,105,
-116,105,111,110,10,68,38,68,58,32,77,111,118,101,32,116,
-104,101,32,99,111,108,111,114,32,111,102,32,116,104,101,32,
-115,101,108,101,99,116,105,111,110,32,116,111,32,116,104,101,
-32,115,112,101,99,105,102,105,101,100,32,112,111,115,105,116,
-105,111,110,0,78,117,109,98,101,114,32,111,102,32,97,100,
-100,105,116,105,111,110,115,32,47,32,105,110,115,101,114,116,
-105,111,110,115,0,82,101,109,111,118,101,32,114,97,110,103,
-101,32,99,111,108,111,114,0,71,114,97,100,97,116,105,111,
-110,32,98,101,116,119,101,101,110,32,114,97,110,103,101,115,
-0,65,100,100,32,116,104,101,32,115,112,101,99,105,102,105,
-101,100,32,110,117,109,98,101,114,32,116,111,32,116,104,101,
-32,101,110,100,0,73,110,115,101,114,116,32,116,104,101,32,
-115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,
-32,97,116,32,116,104,101,32,99,117,114,114,101,110,116,32,
-112,111,115,105,116,105,111,110,0,90,111,111,109,40,38,90,
+116,101,0,79,118,101,114,119,114,105,116,101,0,69,114,97,
+115,101,114,0,100,111,32,110,111,116,32,117,115,101,0,80,
+97,114,97,108,108,101,108,32,108,105,110,101,0,80,97,114,
+97,108,108,101,108,32,108,105,110,101,32,40,71,114,105,100,
+41,0,67,111,110,99,101,110,116,114,97,116,101,100,32,108,
+105,110,101,0,67,111,110,99,101,110,116,114,105,99,32,99,
+105,114,99,108,101,115,32,40,67,105,114,99,108,101,41,0,
+67,111,110,99,101,110,116,114,105,99,32,99,105,114,99,108,
+101,115,32,40,69,108,108,105,112,115,101,41,0,76,105,110,
+101,32,115,121,109,109,101,116,114,121,0,83,101,116,116,105,
+110,103,32,109,111,100,101,32,40,111,112,101,114,97,116,101,
+100,32,111,110,32,99,97,110,118,97,115,41,0,78,111,110,
+101,0,78,111,110,101,40,70,111,114,99,101,100,41,0,85,
+115,101,32,111,112,116,105,111,110,97,108,32,116,101,120,116,
+117,114,101,115,0,85,115,117,97,108,108,121,32,99,105,114,
+99,117,108,97,114,0,73,109,97,103,101,32,115,101,108,101,
+99,116,105,111,110,0,84,101,120,116,117,114,101,32,105,109,
+97,103,101,32,115,101,108,101,99,116,105,111,110,0,78,101,
+119,32,116,101,120,116,40,38,78,41,0,69,100,105,116,40,
+38,84,41,0,68,101,108,101,116,101,40,38,76,41,0,67,
+111,112,121,40,38,67,41,0,80,97,115,116,101,40,38,80,
+41,0,82,101,100,114,97,119,32,101,118,101,114,121,116,104,
+105,110,103,40,38,82,41,0,69,100,105,116,32,116,104,105,
+115,32,116,101,120,116,40,38,69,41,0,68,101,108,101,116,
+101,32,116,104,105,115,32,116,101,120,116,40,38,68,41,0,
+83,97,118,101,32,102,111,114,109,97,116,0,83,97,109,101,
+32,102,111,114,109,97,116,32,97,115,32,116,104,101,32,99,
+117,114,114,101,110,116,32,102,105,108,101,0,79,112,101,110,
+40,38,79,41,46,46,46,0,80,114,101,118,105,111,117,115,
+32,102,105,108,101,40,38,80,41,0,78,101,120,116,32,102,
+105,108,101,40,38,78,41,0,67,108,101,97,114,40,38,67,
 41,0,70,117,108,108,32,118,105,101,119,40,38,70,41,0,
-77,105,114,114,111,114,40,38,72,41,0,84,111,111,108,98,
-97,114,32,105,115,32,97,108,119,97,121,115,32,118,105,115,
-105,98,108,101,40,38,84,41,0,83,101,116,116,105,110,103,
-40,38,79,41,46,46,46,0,77,101,110,117,0,90,111,111,
-109,0,70,117,108,108,32,118,105,101,119,0,77,105,114,114,
-111,114,0,70,105,108,108,32,114,101,102,101,114,101,110,99,
-101,0,68,114,97,119,105,110,103,32,108,111,99,107,0,67,
-104,101,99,107,0,71,114,97,121,115,99,97,108,101,32,100,
-105,115,112,108,97,121,32,111,102,32,97,108,108,32,116,111,
-110,101,32,108,97,121,101,114,115,0,78,111,32,97,108,112,
-104,97,32,109,97,115,107,0,75,101,101,112,32,97,108,112,
-104,97,32,118,97,108,117,101,0,84,114,97,110,115,112,97,
-114,101,110,116,32,99,111,108,111,114,32,112,114,111,116,101,
-99,116,105,111,110,0,79,112,97,99,105,116,121,32,99,111,
-108,111,114,32,112,114,111,116,101,99,116,105,111,110,0,78,
-101,119,0,68,117,112,108,105,99,97,116,101,0,67,108,101,
-97,114,32,116,104,101,32,105,109,97,103,101,0,68,101,108,
-101,116,101,0,67,111,109,98,105,110,101,32,116,111,32,108,
-111,119,101,114,32,108,97,121,101,114,0,68,114,111,112,32,
-116,111,32,108,111,119,101,114,32,108,97,121,101,114,0,85,
-112,0,68,111,119,110,0,72,101,108,112,40,38,72,41,0,
-84,111,111,108,32,111,112,116,105,111,110,0,82,117,108,101,
-114,0,84,101,120,116,117,114,101,0,73,110,47,79,117,116,
-32,111,102,32,108,105,110,101,0,76,111,97,100,0,83,97,
-118,101,0,76,105,110,101,0,66,101,122,105,101,114,32,99,
-117,114,118,101,0,73,110,0,79,117,116,0,84,104,105,110,
-32,108,105,110,101,0,83,104,97,112,101,0,83,116,114,101,
-110,103,116,104,0,65,114,101,97,32,116,111,32,102,105,108,
-108,0,83,97,109,101,32,99,111,108,111,114,32,111,110,32,
-108,97,121,101,114,32,91,33,79,110,108,121,32,111,110,101,
-32,114,101,102,101,114,101,110,99,101,32,108,97,121,101,114,
-93,0,84,114,97,110,115,112,97,114,101,110,116,32,97,114,
-101,97,32,40,97,110,116,105,45,97,108,105,97,115,32,97,
-117,116,111,109,97,116,105,99,32,106,117,100,103,109,101,110,
-116,41,0,84,114,97,110,115,112,97,114,101,110,116,32,97,
-114,101,97,32,40,65,32,61,32,48,41,0,84,104,101,32,
-115,97,109,101,32,97,114,101,97,32,111,102,32,97,108,112,
-104,97,32,118,97,108,117,101,115,0,83,97,109,101,32,99,
-111,108,111,114,32,111,110,32,99,97,110,118,97,115,0,0,
-97,108,108,111,119,97,98,108,101,32,101,114,114,111,114,0,
-76,97,121,101,114,32,116,104,97,116,32,114,101,102,101,114,
-101,110,99,101,115,32,97,32,99,111,108,111,114,0,70,105,
-108,108,32,114,101,102,101,114,101,110,99,101,32,108,97,121,
-101,114,0,67,117,114,114,101,110,116,32,108,97,121,101,114,
-0,65,108,108,32,100,105,115,112,108,97,121,32,108,97,121,
-101,114,115,0,0,68,114,97,119,105,110,103,32,99,111,108,
-111,114,45,62,98,97,99,107,103,114,111,117,110,100,32,99,
-111,108,111,114,0,66,108,97,99,107,32,45,62,32,87,104,
-105,116,101,0,87,104,105,116,101,32,45,62,32,66,108,97,
-99,107,0,67,117,115,116,111,109,0,0,82,101,118,101,114,
-115,101,0,82,101,112,101,97,116,0,72,105,100,101,32,102,
-114,97,109,101,32,119,104,105,108,101,32,109,111,118,105,110,
-103,0,76,111,97,100,0,67,108,101,97,114,0,84,114,97,
-110,115,102,111,114,109,97,116,105,111,110,0,78,111,110,101,
-0,70,108,105,112,32,104,111,114,122,0,70,108,105,112,32,
-118,101,114,116,0,82,97,110,100,111,109,32,102,108,105,112,
-32,104,111,114,122,0,82,97,110,100,111,109,32,102,108,105,
-112,32,118,101,114,116,0,82,97,110,100,111,109,32,114,111,
-116,97,116,105,111,110,0,0,79,118,101,114,119,114,105,116,
-101,32,112,97,115,116,101,0,65,112,112,108,121,32,109,97,
-115,107,115,32,119,104,101,110,32,112,97,115,116,105,110,103,
-0,69,110,108,97,114,103,101,109,101,110,116,32,40,110,111,
-32,105,110,116,101,114,112,111,108,97,116,105,111,110,41,0,
+77,105,114,114,111,114,40,38,72,41,0,83,101,116,116,105,
+110,103,40,38,83,41,46,46,46,0,77,101,110,117,0,79,
+112,101,110,0,80,114,101,118,105,111,117,115,32,102,105,108,
+101,0,78,101,120,116,32,102,105,108,101,0,90,111,111,109,
+0,70,117,108,108,32,118,105,101,119,0,77,105,114,114,111,
+114,0,83,101,116,32,116,111,32,100,114,97,119,105,110,103,
+32,99,111,108,111,114,0,83,101,116,32,116,111,32,98,97,
+99,107,103,114,111,117,110,100,32,99,111,108,111,114,0,78,
+117,109,101,114,105,99,97,108,32,105,110,112,117,116,0,82,
+71,66,32,115,112,101,99,105,102,105,99,97,116,105,111,110,
+58,32,50,53,53,44,48,44,49,50,56,32,40,83,101,112,
+97,114,97,116,101,32,119,105,116,104,32,110,111,110,45,110,
+117,109,101,114,105,99,32,99,104,97,114,97,99,116,101,114,
+115,41,10,72,84,77,76,32,99,111,108,111,114,32,115,112,
+101,99,105,102,105,99,97,116,105,111,110,58,32,35,102,102,
+48,48,56,48,32,40,54,32,100,105,103,105,116,32,111,110,
+108,121,41,0,83,101,116,32,100,114,97,119,105,110,103,32,
+99,111,108,111,114,40,38,83,41,32,91,76,66,84,84,93,
+0,79,78,47,79,70,70,32,115,119,105,116,99,104,105,110,
+103,40,38,84,41,32,91,67,116,114,108,43,76,66,84,84,
+93,0,71,101,116,32,99,111,108,111,114,40,38,80,41,32,
+91,83,104,105,102,116,43,76,66,84,84,93,0,72,83,86,
+40,84,114,105,97,110,103,108,101,41,0,72,83,86,40,82,
+101,99,116,97,110,103,108,101,41,0,80,97,108,101,116,116,
+101,32,108,105,115,116,40,38,76,41,46,46,46,0,83,101,
+116,116,105,110,103,40,38,79,41,46,46,46,0,69,100,105,
+116,40,38,69,41,0,70,105,108,101,40,38,70,41,0,72,
+101,108,112,40,38,72,41,0,80,97,108,101,116,116,101,32,
+101,100,105,116,105,110,103,40,38,69,41,46,46,46,0,77,
+97,107,101,32,97,108,108,32,100,114,97,119,105,110,103,32,
+99,111,108,111,114,115,40,38,87,41,0,82,101,97,100,32,
+102,114,111,109,32,102,105,108,101,40,38,76,41,46,46,46,
+0,65,100,100,105,116,105,111,110,97,108,32,114,101,97,100,
+105,110,103,32,102,114,111,109,32,102,105,108,101,40,38,65,
+41,46,46,46,0,71,101,116,32,112,97,108,101,116,116,101,
+32,102,114,111,109,32,105,109,97,103,101,32,99,111,108,111,
+114,40,38,73,41,46,46,46,0,83,97,118,101,32,116,111,
+32,102,105,108,101,40,38,83,41,46,46,46,0,71,114,97,
+100,97,116,105,111,110,32,115,101,116,116,105,110,103,115,40,
+38,79,41,0,67,111,108,111,114,32,80,97,108,101,116,116,
+101,0,67,111,109,112,97,99,116,32,109,111,100,101,40,38,
+67,41,0,80,97,108,101,116,116,101,40,38,80,41,0,72,
+83,76,40,38,83,41,0,71,114,97,100,97,116,105,111,110,
+40,38,77,41,0,77,97,107,101,32,97,108,108,32,100,114,
+97,119,105,110,103,32,99,111,108,111,114,115,46,10,65,114,
+101,32,121,111,117,32,115,117,114,101,63,0,83,101,116,116,
+105,110,103,115,32,102,111,114,32,101,97,99,104,32,98,97,
+114,0,78,117,109,98,101,114,32,111,102,32,115,116,97,103,
+101,115,0,51,126,54,52,46,32,78,111,32,115,116,101,112,
+115,32,97,116,32,48,46,0,80,97,108,101,116,116,101,32,
+108,105,115,116,0,83,101,116,32,100,114,97,119,105,110,103,
+32,99,111,108,111,114,40,38,83,41,0,71,101,116,32,116,
+104,105,115,32,99,111,108,111,114,40,38,71,41,0,80,97,
+108,101,116,116,101,32,115,101,116,116,105,110,103,115,0,78,
+117,109,98,101,114,32,111,102,32,99,111,108,111,114,115,0,
+84,104,101,32,119,105,100,116,104,32,111,102,32,111,110,101,
+32,99,111,108,111,114,0,84,104,101,32,104,101,105,103,104,
+116,32,111,102,32,111,110,101,32,99,111,108,111,114,0,77,
+97,120,105,109,117,109,32,110,117,109,98,101,114,32,111,102,
+32,104,111,114,105,122,111,110,116,97,108,32,100,105,115,112,
+108,97,121,115,10,40,48,32,116,111,32,109,97,116,99,104,
+32,116,104,101,32,119,105,100,116,104,41,0,80,97,108,101,
+116,116,101,32,101,100,105,116,105,110,103,0,82,71,66,32,
+105,110,112,117,116,0,34,82,44,71,44,66,34,32,111,114,
+32,34,35,82,82,71,71,66,66,34,46,10,83,101,116,32,
+119,105,116,104,32,69,110,116,101,114,46,0,83,104,105,102,
+116,43,76,32,111,114,32,82,105,103,104,116,32,99,108,105,
+99,107,58,32,83,101,108,101,99,116,32,102,114,111,109,32,
+116,104,101,32,99,117,114,114,101,110,116,32,112,111,115,105,
+116,105,111,110,32,116,111,32,116,104,101,32,112,114,101,115,
+115,101,100,32,112,111,115,105,116,105,111,110,10,68,38,68,
+58,32,77,111,118,101,32,116,104,101,32,99,111,108,111,114,
+32,111,102,32,116,104,101,32,115,101,108,101,99,116,105,111,
+110,32,116,111,32,116,104,101,32,115,112,101,99,105,102,105,
+101,100,32,112,111,115,105,116,105,111,110,0,78,117,109,98,
+101,114,32,111,102,32,97,100,100,105,116,105,111,110,115,32,
+47,32,105,110,115,101,114,116,105,111,110,115,0,82,101,109,
+111,118,101,32,114,97,110,103,101,32,99,111,108,111,114,0,
+71,114,97,100,97,116,105,111,110,32,98,101,116,119,101,101,
+110,32,114,97,110,103,101,115,0,65,100,100,32,116,104,101,
+32,115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,
+114,32,116,111,32,116,104,101,32,101,110,100,0,73,110,115,
+101,114,116,32,116,104,101,32,115,112,101,99,105,102,105,101,
+100,32,110,117,109,98,101,114,32,97,116,32,116,104,101,32,
+99,117,114,114,101,110,116,32,112,111,115,105,116,105,111,110,
+0,90,111,111,109,40,38,90,41,0,70,117,108,108,32,118,
+105,101,119,40,38,70,41,0,77,105,114,114,111,114,40,38,
+72,41,0,84,111,111,108,98,97,114,32,105,115,32,97,108,
+119,97,121,115,32,118,105,115,105,98,108,101,40,38,84,41,
+0,83,101,116,116,105,110,103,40,38,79,41,46,46,46,0,
+77,101,110,117,0,90,111,111,109,0,70,117,108,108,32,118,
+105,101,119,0,77,105,114,114,111,114,0,70,105,108,108,32,
+114,101,102,101,114,101,110,99,101,0,68,114,97,119,105,110,
+103,32,108,111,99,107,0,67,104,101,99,107,0,71,114,97,
+121,115,99,97,108,101,32,100,105,115,112,108,97,121,32,111,
+102,32,97,108,108,32,116,111,110,101,32,108,97,121,101,114,
+115,0,78,111,32,97,108,112,104,97,32,109,97,115,107,0,
+75,101,101,112,32,97,108,112,104,97,32,118,97,108,117,101,
+0,84,114,97,110,115,112,97,114,101,110,116,32,99,111,108,
+111,114,32,112,114,111,116,101,99,116,105,111,110,0,79,112,
+97,99,105,116,121,32,99,111,108,111,114,32,112,114,111,116,
+101,99,116,105,111,110,0,78,101,119,0,68,117,112,108,105,
+99,97,116,101,0,67,108,101,97,114,32,116,104,101,32,105,
+109,97,103,101,0,68,101,108,101,116,101,0,67,111,109,98,
+105,110,101,32,116,111,32,108,111,119,101,114,32,108,97,121,
+101,114,0,68,114,111,112,32,116,111,32,108,111,119,101,114,
+32,108,97,121,101,114,0,85,112,0,68,111,119,110,0,72,
+101,108,112,40,38,72,41,0,84,111,111,108,32,111,112,116,
+105,111,110,0,82,117,108,101,114,0,84,101,120,116,117,114,
+101,0,73,110,47,79,117,116,32,111,102,32,108,105,110,101,
+0,76,111,97,100,0,83,97,118,101,0,76,105,110,101,0,
+66,101,122,105,101,114,32,99,117,114,118,101,0,73,110,0,
+79,117,116,0,84,104,105,110,32,108,105,110,101,0,83,104,
+97,112,101,0,83,116,114,101,110,103,116,104,0,65,114,101,
+97,32,116,111,32,102,105,108,108,0,83,97,109,101,32,99,
+111,108,111,114,32,111,110,32,108,97,121,101,114,32,91,33,
+79,110,108,121,32,111,110,101,32,114,101,102,101,114,101,110,
+99,101,32,108,97,121,101,114,93,0,84,114,97,110,115,112,
+97,114,101,110,116,32,97,114,101,97,32,40,97,110,116,105,
+45,97,108,105,97,115,32,97,117,116,111,109,97,116,105,99,
+32,106,117,100,103,109,101,110,116,41,0,84,114,97,110,115,
+112,97,114,101,110,116,32,97,114,101,97,32,40,65,32,61,
+32,48,41,0,84,104,101,32,115,97,109,101,32,97,114,101,
+97,32,111,102,32,97,108,112,104,97,32,118,97,108,117,101,
+115,0,83,97,109,101,32,99,111,108,111,114,32,111,110,32,
+99,97,110,118,97,115,0,0,97,108,108,111,119,97,98,108,
+101,32,101,114,114,111,114,0,76,97,121,101,114,32,116,104,
+97,116,32,114,101,102,101,114,101,110,99,101,115,32,97,32,
+99,111,108,111,114,0,70,105,108,108,32,114,101,102,101,114,
+101,110,99,101,32,108,97,121,101,114,0,67,117,114,114,101,
+110,116,32,108,97,121,101,114,0,65,108,108,32,100,105,115,
+112,108,97,121,32,108,97,121,101,114,115,0,0,68,114,97,
+119,105,110,103,32,99,111,108,111,114,45,62,98,97,99,107,
+103,114,111,117,110,100,32,99,111,108,111,114,0,66,108,97,
+99,107,32,45,62,32,87,104,105,116,101,0,87,104,105,116,
+101,32,45,62,32,66,108,97,99,107,0,67,117,115,116,111,
+109,0,0,82,101,118,101,114,115,101,0,82,101,112,101,97,
+116,0,72,105,100,101,32,102,114,97,109,101,32,119,104,105,
+108,101,32,109,111,118,105,110,103,0,76,111,97,100,0,67,
+108,101,97,114,0,84,114,97,110,115,102,111,114,109,97,116,
+105,111,110,0,78,111,110,101,0,70,108,105,112,32,104,111,
+114,122,0,70,108,105,112,32,118,101,114,116,0,82,97,110,
+100,111,109,32,102,108,105,112,32,104,111,114,122,0,82,97,
+110,100,111,109,32,102,108,105,112,32,118,101,114,116,0,82,
+97,110,100,111,109,32,114,111,116,97,116,105,111,110,0,0,
+79,118,101,114,119,114,105,116,101,32,112,97,115,116,101,0,
+65,112,112,108,121,32,109,97,115,107,115,32,119,104,101,110,
+32,112,97,115,116,105,110,103,0,69,110,108,97,114,103,101,
+109,101,110,116,32,40,110,111,32,105,110,116,101,114,112,111,
+108,97,116,105,111,110,41,0,65,114,114,97,110,103,101,32,
+105,110,32,116,105,108,101,115,32,40,102,117,108,108,41,0,
 65,114,114,97,110,103,101,32,105,110,32,116,105,108,101,115,
-32,40,102,117,108,108,41,0,65,114,114,97,110,103,101,32,
-105,110,32,116,105,108,101,115,32,40,104,111,114,105,122,111,
-110,116,97,108,32,114,111,119,41,0,65,114,114,97,110,103,
-101,32,105,110,32,116,105,108,101,115,32,40,118,101,114,116,
-105,99,97,108,32,114,111,119,41,0,0,82,117,110,0,71,
-114,97,100,105,101,110,116,32,101,100,105,116,105,110,103,40,
-38,69,41,46,46,46,0,78,101,119,40,38,78,41,46,46,
-46,0,69,100,105,116,32,108,105,115,116,40,38,76,41,46,
-46,46,0,79,112,101,110,40,38,79,41,46,46,46,0,83,
-97,118,101,40,38,83,41,46,46,46,0,78,101,119,32,103,
-114,111,117,112,40,38,71,41,46,46,46,0,69,100,105,116,
-40,38,69,41,46,46,46,0,73,110,115,101,114,116,32,103,
-114,111,117,112,40,38,78,41,46,46,46,0,68,101,108,101,
-116,101,32,103,114,111,117,112,40,38,68,41,0,73,110,115,
-101,114,116,32,110,101,119,32,98,114,117,115,104,40,38,66,
-41,46,46,46,0,73,110,115,101,114,116,32,99,117,114,114,
-101,110,116,32,116,111,111,108,40,38,84,41,0,67,111,112,
-121,40,38,67,41,0,80,97,115,116,101,40,38,80,41,0,
-83,101,116,116,105,110,103,40,38,79,41,46,46,46,0,84,
-111,111,108,40,38,76,41,0,68,101,108,101,116,101,40,38,
-68,41,0,82,101,103,105,115,116,114,97,116,105,111,110,40,
-38,82,41,0,79,118,101,114,114,105,100,101,32,116,111,111,
-108,32,111,112,116,105,111,110,32,118,97,108,117,101,115,40,
-38,79,41,0,68,105,115,112,108,97,121,32,115,101,116,32,
-118,97,108,117,101,40,38,86,41,0,85,110,115,112,101,99,
-105,102,105,101,100,0,82,101,108,101,97,115,101,32,97,108,
-108,0,65,100,100,40,38,65,41,0,68,101,108,101,116,101,
-40,38,68,41,32,91,83,104,105,102,116,43,76,66,84,84,
-93,0,65,100,100,32,115,105,122,101,115,0,80,108,101,97,
-115,101,32,101,110,116,101,114,32,116,104,101,32,98,114,117,
-115,104,32,115,105,122,101,46,10,89,111,117,32,99,97,110,
-32,115,112,101,99,105,102,121,32,109,111,114,101,32,116,104,
-97,110,32,111,110,101,32,98,121,32,115,101,112,97,114,97,
-116,105,110,103,32,116,104,101,109,10,119,105,116,104,32,99,
-104,97,114,97,99,116,101,114,115,32,111,116,104,101,114,32,
-116,104,97,110,32,110,117,109,98,101,114,115,32,97,110,100,
-32,39,46,39,46,10,91,69,120,97,109,112,108,101,93,32,
-49,46,48,44,49,48,46,50,59,53,48,0,65,108,119,97,
-121,115,32,115,97,118,101,0,78,111,114,109,97,108,0,69,
-114,97,115,101,114,0,87,97,116,101,114,0,66,108,117,114,
-0,0,83,105,122,101,32,40,100,105,97,109,101,116,101,114,
-41,0,76,105,110,101,32,99,111,114,114,101,99,116,105,111,
-110,0,78,111,110,101,0,65,118,101,114,97,103,101,40,115,
-116,114,111,110,103,41,0,65,118,101,114,97,103,101,40,109,
-101,100,105,117,109,41,0,65,118,101,114,97,103,101,40,119,
-101,97,107,41,0,70,105,120,101,100,32,100,105,115,116,97,
-110,99,101,0,0,80,111,105,110,116,32,105,110,116,101,114,
-118,97,108,32,40,49,46,48,32,61,32,114,97,100,105,117,
-115,41,0,82,97,110,100,111,109,32,119,105,100,116,104,32,
-111,102,32,98,114,117,115,104,32,115,105,122,101,40,37,41,
-0,82,97,110,100,111,109,32,119,105,100,116,104,32,111,102,
-32,112,111,105,110,116,32,112,111,115,105,116,105,111,110,0,
-67,117,114,118,101,32,105,110,116,101,114,112,111,108,97,116,
-105,111,110,0,87,97,116,101,114,0,65,109,111,117,110,116,
-32,111,102,32,100,114,97,119,105,110,103,32,99,111,108,111,
-114,0,65,109,111,117,110,116,32,116,111,32,101,120,116,101,
-110,100,0,84,114,101,97,116,32,116,104,101,32,98,97,99,
-107,103,114,111,117,110,100,32,97,115,32,119,104,105,116,101,
-0,80,114,101,115,101,116,0,66,114,117,115,104,32,115,104,
-97,112,101,0,83,104,97,112,101,32,105,109,97,103,101,0,
-72,97,114,100,110,101,115,115,32,119,104,101,110,32,110,111,
-114,109,97,108,108,121,32,114,111,117,110,100,0,83,116,114,
-101,110,103,116,104,32,111,102,32,115,97,110,100,105,110,103,
-0,66,97,115,101,32,97,110,103,108,101,32,111,102,32,114,
-111,116,97,116,105,111,110,0,82,97,110,100,111,109,32,114,
-111,116,97,116,105,111,110,32,119,105,100,116,104,0,82,111,
-116,97,116,101,32,105,110,32,116,104,101,32,100,105,114,101,
-99,116,105,111,110,32,111,102,32,116,114,97,118,101,108,0,
-80,101,110,32,112,114,101,115,115,117,114,101,0,83,105,122,
-101,32,119,104,101,110,32,48,32,112,114,101,115,115,117,114,
-101,40,37,41,0,68,101,110,115,105,116,121,32,119,104,101,
-110,32,48,32,112,114,101,115,115,117,114,101,40,37,41,0,
-80,114,101,115,115,117,114,101,32,99,117,114,118,101,32,101,
-100,105,116,105,110,103,0,85,115,101,32,97,32,99,111,109,
-109,111,110,32,112,114,101,115,115,117,114,101,32,99,117,114,
-118,101,0,86,97,114,105,111,117,115,0,82,101,103,105,115,
-116,101,114,101,100,32,105,110,32,37,99,0,82,101,115,101,
-116,40,38,82,41,0,69,100,105,116,32,103,114,97,100,105,
-101,110,116,32,108,105,115,116,0,83,112,101,99,105,102,121,
-105,110,103,32,116,104,101,32,105,109,97,103,101,32,112,111,
-115,105,116,105,111,110,0,83,101,116,116,105,110,103,0,76,
-101,102,116,32,98,117,116,116,111,110,0,67,116,114,108,43,
-76,101,102,116,0,83,104,105,102,116,43,76,101,102,116,0,
-82,105,103,104,116,32,98,117,116,116,111,110,0,77,105,100,
-100,108,101,32,98,117,116,116,111,110,0,83,99,114,111,108,
-108,32,116,104,101,32,118,105,101,119,32,98,121,32,100,114,
-97,103,103,105,110,103,9,83,99,114,111,108,108,32,116,104,
-101,32,99,97,110,118,97,115,32,98,121,32,100,114,97,103,
-103,105,110,103,9,90,111,111,109,32,98,121,32,100,114,97,
-103,103,105,110,103,32,117,112,32,97,110,100,32,100,111,119,
-110,9,77,101,110,117,0,83,99,114,111,108,108,32,98,121,
-32,100,114,97,103,103,105,110,103,9,90,111,111,109,32,98,
-121,32,100,114,97,103,103,105,110,103,32,117,112,32,97,110,
-100,32,100,111,119,110,9,71,101,116,32,99,111,108,111,114,
-40,100,114,97,119,105,110,103,32,99,111,108,111,114,41,9,
-71,101,116,32,99,111,108,111,114,40,98,97,99,107,103,114,
-111,117,110,100,32,99,111,108,111,114,41,9,67,111,108,111,
-114,32,97,99,113,117,105,115,105,116,105,111,110,32,109,101,
-110,117,0,78,101,119,32,99,97,110,118,97,115,0,73,110,
-105,116,105,97,108,32,108,97,121,101,114,0,83,101,116,32,
-97,115,32,115,116,97,114,116,117,112,32,115,105,122,101,0,
-84,104,101,32,109,97,120,105,109,117,109,32,101,100,105,116,
-97,98,108,101,32,112,120,32,115,105,122,101,32,104,97,115,
-32,98,101,101,110,32,101,120,99,101,101,100,101,100,46,0,
-72,105,115,116,111,114,121,0,82,101,103,105,115,116,114,97,
-116,105,111,110,0,82,101,103,117,108,97,116,105,111,110,115,
-0,71,114,105,100,32,115,101,116,116,105,110,103,115,0,71,
-114,105,100,0,68,105,118,105,100,105,110,103,32,108,105,110,
-101,0,78,117,109,98,101,114,32,111,102,32,104,111,114,105,
-122,111,110,116,97,108,32,100,105,118,105,115,105,111,110,115,
-0,78,117,109,98,101,114,32,111,102,32,118,101,114,116,105,
-99,97,108,32,100,105,118,105,115,105,111,110,115,0,83,104,
-111,119,32,49,112,120,32,103,114,105,100,0,37,100,37,37,
-32,111,114,32,109,111,114,101,0,73,103,110,111,114,101,32,
-97,108,112,104,97,32,99,104,97,110,110,101,108,0,78,101,
-119,32,108,97,121,101,114,0,76,97,121,101,114,32,115,101,
-116,116,105,110,103,115,0,76,97,121,101,114,32,99,111,108,
-111,114,32,115,101,108,101,99,116,105,111,110,0,66,97,116,
-99,104,32,99,111,110,118,101,114,115,105,111,110,32,111,102,
-32,110,117,109,98,101,114,32,111,102,32,108,105,110,101,115,
-0,84,101,109,112,108,97,116,101,32,108,105,115,116,32,101,
-100,105,116,0,67,111,109,98,105,110,101,32,109,117,108,116,
-105,112,108,101,32,108,97,121,101,114,115,0,67,104,97,110,
-103,101,32,108,97,121,101,114,32,116,121,112,101,0,84,111,
-110,105,110,103,0,78,117,109,98,101,114,32,111,102,32,108,
-105,110,101,115,0,70,105,120,101,100,32,100,101,110,115,105,
-116,121,0,77,97,107,101,32,116,104,101,32,98,97,99,107,
-103,114,111,117,110,100,32,119,104,105,116,101,0,83,101,116,
-32,102,114,111,109,32,100,114,97,119,105,110,103,32,99,111,
-108,111,114,0,83,101,116,32,116,111,32,100,114,97,119,105,
-110,103,32,99,111,108,111,114,0,83,101,116,32,116,111,32,
-100,101,102,97,117,108,116,32,110,117,109,98,101,114,32,111,
-102,32,108,105,110,101,115,0,84,97,114,103,101,116,0,65,
-108,108,32,108,97,121,101,114,115,0,76,97,121,101,114,32,
-119,105,116,104,32,115,112,101,99,105,102,105,101,100,32,110,
-117,109,98,101,114,32,111,102,32,108,105,110,101,115,0,86,
-97,108,117,101,32,116,111,32,114,101,112,108,97,99,101,0,
-80,114,111,99,101,115,115,105,110,103,0,68,101,108,101,116,
-101,32,97,110,100,32,99,111,109,98,105,110,101,32,108,97,
-121,101,114,115,0,74,111,105,110,32,116,111,32,110,101,119,
-32,108,97,121,101,114,44,32,108,101,97,118,105,110,103,32,
-108,97,121,101,114,0,76,97,121,101,114,115,32,105,110,32,
-116,104,101,32,102,111,108,100,101,114,0,67,104,101,99,107,
-101,100,32,108,97,121,101,114,32,40,119,104,101,110,32,110,
-101,119,108,121,32,106,111,105,110,101,100,41,0,84,121,112,
-101,32,97,102,116,101,114,32,98,105,110,100,105,110,103,0,
-42,32,73,102,32,116,104,101,32,97,108,112,104,97,32,118,
-97,108,117,101,32,111,102,32,116,104,101,32,108,111,119,101,
-114,32,108,97,121,101,114,32,105,115,32,110,111,116,32,116,
-104,101,32,109,97,120,105,109,117,109,44,10,116,104,101,32,
-99,111,114,114,101,99,116,32,99,111,108,111,114,32,119,105,
-108,108,32,110,111,116,32,98,101,32,111,98,116,97,105,110,
-101,100,32,105,102,32,116,104,101,32,99,111,109,98,105,110,
-97,116,105,111,110,32,105,115,32,112,101,114,102,111,114,109,
-101,100,10,105,110,32,97,32,115,116,97,116,101,32,111,116,
-104,101,114,32,116,104,97,110,32,34,110,111,114,109,97,108,
-34,32,105,110,32,116,104,101,32,99,111,109,112,111,115,105,
-116,105,111,110,32,109,111,100,101,46,0,73,110,118,101,114,
-116,32,116,104,101,32,98,114,105,103,104,116,110,101,115,115,
-32,111,102,32,116,104,101,32,99,111,108,111,114,32,116,111,
-32,116,104,101,32,97,108,112,104,97,32,118,97,108,117,101,
-0,65,100,100,32,116,111,32,116,101,109,112,108,97,116,101,
-40,38,65,41,0,69,100,105,116,32,108,105,115,116,40,38,
-69,41,46,46,46,0,73,109,97,103,101,32,115,101,116,116,
-105,110,103,115,0,82,101,115,105,122,101,32,99,97,110,118,
-97,115,0,73,110,116,101,103,114,97,116,101,32,105,109,97,
-103,101,115,32,116,111,32,115,99,97,108,101,0,65,114,114,
-97,110,103,101,109,101,110,116,0,67,117,116,32,111,117,116,
-32,111,102,32,114,97,110,103,101,0,82,97,116,105,111,0,
-65,115,112,101,99,116,32,114,97,116,105,111,32,109,97,105,
-110,116,101,110,97,110,99,101,0,68,80,73,32,99,104,97,
-110,103,101,0,73,110,116,101,114,112,111,108,97,116,105,111,
-110,32,109,101,116,104,111,100,0,69,120,112,97,110,100,47,
-114,101,100,117,99,101,32,115,101,108,101,99,116,105,111,110,
-0,78,117,109,98,101,114,32,111,102,32,112,105,120,101,108,
-115,32,40,114,101,100,117,99,101,100,32,98,121,32,110,101,
-103,97,116,105,118,101,32,118,97,108,117,101,41,0,71,114,
-97,100,105,101,110,116,32,101,100,105,116,105,110,103,0,80,
-111,115,105,116,105,111,110,0,68,114,97,119,105,110,103,32,
-99,111,108,111,114,0,66,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,83,112,101,99,105,102,105,101,100,
-32,99,111,108,111,114,0,86,97,108,117,101,0,82,101,112,
-101,97,116,32,40,97,108,119,97,121,115,41,0,77,111,110,
-111,99,104,114,111,109,97,116,105,99,0,43,67,116,114,108,
-32,58,32,69,113,117,97,108,108,121,32,115,112,97,99,101,
-100,32,112,111,105,110,116,115,32,102,114,111,109,32,116,104,
-101,32,99,117,114,114,101,110,116,32,112,111,115,105,116,105,
-111,110,32,116,111,32,116,104,101,32,112,114,101,115,115,101,
-100,32,112,111,115,105,116,105,111,110,10,43,83,104,105,102,
-116,32,58,32,83,101,116,32,116,104,101,32,99,117,114,114,
-101,110,116,32,99,111,108,111,114,32,97,110,100,32,118,97,
-108,117,101,32,97,116,32,116,104,101,32,112,114,101,115,115,
-101,100,32,112,111,115,105,116,105,111,110,10,43,65,108,116,
-32,58,32,68,101,108,101,116,101,32,112,111,105,110,116,0,
-68,101,108,101,116,101,32,99,117,114,114,101,110,116,32,112,
-111,105,110,116,40,38,68,41,0,83,112,108,105,116,32,98,
-101,116,119,101,101,110,32,116,104,101,32,110,101,120,116,32,
-112,111,115,105,116,105,111,110,40,38,83,41,0,77,111,118,
-101,32,116,111,32,116,104,101,32,109,105,100,100,108,101,32,
-112,111,115,105,116,105,111,110,32,111,110,32,116,104,101,32,
-108,101,102,116,32,97,110,100,32,114,105,103,104,116,40,38,
-77,41,0,65,108,108,32,101,118,101,110,108,121,32,115,112,
-97,99,101,100,40,38,69,41,0,82,101,118,101,114,115,101,
-40,38,82,41,0,69,110,108,97,114,103,101,109,101,110,116,
-32,40,110,111,32,105,110,116,101,114,112,111,108,97,116,105,
-111,110,41,0,69,120,112,97,110,115,105,111,110,32,114,97,
-116,101,32,40,50,126,50,48,41,0,84,114,97,110,115,102,
-111,114,109,97,116,105,111,110,0,78,111,114,109,97,108,0,
-80,101,114,115,112,101,99,116,105,118,101,0,82,101,115,101,
-116,0,88,32,109,97,103,110,105,102,105,99,97,116,105,111,
-110,0,89,32,109,97,103,110,105,102,105,99,97,116,105,111,
-110,0,82,111,116,97,116,105,111,110,32,97,110,103,108,101,
-0,65,115,112,101,99,116,32,114,97,116,105,111,32,109,97,
-105,110,116,101,110,97,110,99,101,0,65,112,112,108,121,32,
-118,97,108,117,101,0,91,82,105,103,104,116,32,98,117,116,
-116,111,110,32,111,114,32,109,105,100,100,108,101,32,98,117,
-116,116,111,110,93,10,83,99,114,101,101,110,32,115,99,114,
-111,108,108,105,110,103,10,91,67,116,114,108,43,114,105,103,
-104,116,32,98,117,116,116,111,110,32,117,112,47,100,111,119,
-110,32,100,114,97,103,93,10,67,104,97,110,103,101,32,100,
-105,115,112,108,97,121,32,109,97,103,110,105,102,105,99,97,
-116,105,111,110,10,91,84,114,97,110,115,108,97,116,105,111,
-110,32,47,32,80,111,105,110,116,32,109,111,118,101,109,101,
-110,116,93,10,43,83,104,105,102,116,58,32,72,111,114,105,
-122,111,110,116,97,108,32,109,111,118,101,109,101,110,116,10,
-43,67,116,114,108,58,32,86,101,114,116,105,99,97,108,32,
-109,111,118,101,0,84,101,120,116,0,70,111,110,116,0,76,
-105,115,116,0,82,101,103,105,115,116,101,114,101,100,32,102,
-111,110,116,0,70,105,108,101,32,115,112,101,99,105,102,105,
-99,97,116,105,111,110,0,67,104,97,114,97,99,116,101,114,
-32,115,112,97,99,105,110,103,0,76,105,110,101,32,115,112,
-97,99,105,110,103,0,82,111,116,97,116,105,111,110,0,72,
-105,110,116,105,110,103,0,68,105,115,97,98,108,101,32,97,
-117,116,111,32,104,105,110,116,105,110,103,0,82,117,98,121,
-0,82,117,98,121,32,112,111,115,105,116,105,111,110,0,68,
-111,32,110,111,116,32,117,115,101,32,114,117,98,121,32,103,
-108,121,112,104,115,0,77,111,110,111,99,104,114,111,109,101,
-32,98,105,110,97,114,121,0,86,101,114,116,105,99,97,108,
-32,119,114,105,116,105,110,103,0,69,110,97,98,108,101,32,
-115,112,101,99,105,97,108,32,110,111,116,97,116,105,111,110,
-0,66,111,108,100,32,111,117,116,108,105,110,101,0,73,116,
-97,108,105,99,105,122,101,100,32,111,117,116,108,105,110,101,
-0,69,110,97,98,108,101,32,101,109,98,101,100,100,101,100,
-32,98,105,116,109,97,112,0,87,111,114,100,32,108,105,115,
-116,32,101,100,105,116,105,110,103,40,38,69,41,0,69,100,
-105,116,32,114,101,103,105,115,116,101,114,101,100,32,102,111,
-110,116,0,70,111,110,116,32,101,100,105,116,105,110,103,0,
-69,100,105,116,105,110,103,32,114,101,112,108,97,99,101,109,
-101,110,116,32,99,104,97,114,97,99,116,101,114,115,0,82,
-101,103,105,115,116,101,114,101,100,32,110,97,109,101,0,66,
-97,115,101,32,102,111,110,116,0,82,101,112,108,97,99,101,
-109,101,110,116,32,102,111,110,116,32,49,0,82,101,112,108,
-97,99,101,109,101,110,116,32,102,111,110,116,32,50,0,67,
-104,97,114,97,99,116,101,114,32,101,100,105,116,105,110,103,
-0,67,104,97,114,97,99,116,101,114,32,116,121,112,101,0,
-67,111,100,101,32,115,112,101,99,105,102,105,99,97,116,105,
-111,110,0,68,105,115,112,108,97,121,32,85,110,105,99,111,
-100,101,32,102,114,111,109,32,99,104,97,114,97,99,116,101,
-114,115,0,66,97,115,105,99,32,76,97,116,105,110,0,72,
-105,114,97,103,97,110,97,0,75,97,116,97,107,97,110,97,
-0,75,97,110,106,105,0,80,117,110,99,116,117,97,116,105,
-111,110,32,101,116,99,46,0,69,120,116,101,114,110,97,108,
-32,99,104,97,114,97,99,116,101,114,115,32,40,112,114,105,
-118,97,116,101,32,117,115,101,32,97,114,101,97,41,0,80,
-108,101,97,115,101,32,101,110,116,101,114,32,110,97,109,101,
-0,80,108,101,97,115,101,32,115,101,108,101,99,116,32,97,
-32,98,97,115,101,32,102,111,110,116,0,84,104,101,114,101,
-32,105,115,32,97,110,32,101,114,114,111,114,32,105,110,32,
-116,104,101,32,99,111,100,101,32,118,97,108,117,101,32,100,
-101,115,99,114,105,112,116,105,111,110,0,68,117,112,108,105,
-99,97,116,101,32,99,111,100,101,32,118,97,108,117,101,0,
-87,111,114,100,32,108,105,115,116,32,101,100,105,116,105,110,
-103,0,87,111,114,100,0,78,97,109,101,0,84,101,120,116,
-0,78,101,119,32,103,114,111,117,112,0,71,114,111,117,112,
-32,115,101,116,116,105,110,103,115,0,66,114,117,115,104,32,
-115,105,122,101,32,115,101,116,116,105,110,103,0,84,111,111,
-108,32,115,101,116,116,105,110,103,115,0,78,117,109,98,101,
-114,32,116,111,32,108,105,110,101,32,117,112,32,115,105,100,
-101,32,98,121,32,115,105,100,101,0,109,105,110,105,109,117,
-109,0,109,97,120,105,109,117,109,0,80,114,101,115,115,117,
-114,101,32,99,117,114,118,101,0,84,111,111,108,32,108,105,
-115,116,32,101,100,105,116,105,110,103,0,71,114,111,117,112,
-0,73,116,101,109,0,83,97,118,101,32,115,101,116,116,105,
-110,103,115,0,67,111,109,112,114,101,115,115,105,111,110,32,
-108,101,118,101,108,32,91,48,45,57,93,0,65,108,112,104,
-97,32,99,104,97,110,110,101,108,0,81,117,97,108,105,116,
-121,32,91,48,45,49,48,48,93,0,83,97,109,112,108,105,
-110,103,32,114,97,116,105,111,0,52,58,52,58,52,32,40,
-72,105,103,104,41,0,52,58,50,58,50,0,52,58,50,58,
-48,32,40,76,111,119,41,0,0,49,54,98,105,116,32,99,
-111,108,111,114,0,80,114,111,103,114,101,115,115,105,118,101,
-0,85,110,99,111,109,112,114,101,115,115,101,100,0,67,111,
-109,112,114,101,115,115,105,111,110,32,116,121,112,101,0,84,
-114,97,110,115,112,97,114,101,110,116,32,99,111,108,111,114,
-0,67,111,108,111,114,32,112,111,115,105,116,105,111,110,0,
-76,111,115,115,108,101,115,115,32,99,111,109,112,114,101,115,
-115,105,111,110,0,76,111,115,115,121,32,99,111,109,112,114,
-101,115,115,105,111,110,0,42,32,73,102,32,116,104,101,32,
-108,97,121,101,114,32,104,97,115,32,97,110,32,97,108,112,
-104,97,32,99,104,97,110,110,101,108,44,10,97,108,108,32,
-108,97,121,101,114,115,32,119,105,108,108,32,98,101,32,99,
-111,109,98,105,110,101,100,32,105,110,32,34,110,111,114,109,
-97,108,34,32,109,111,100,101,46,10,65,108,115,111,44,32,
-116,104,101,32,116,111,110,101,32,108,97,121,101,114,32,105,
-115,32,110,111,116,32,116,111,110,101,100,46,0,76,97,121,
-101,114,32,115,116,114,117,99,116,117,114,101,0,79,110,101,
-32,112,105,99,116,117,114,101,32,40,82,71,66,41,0,79,
-110,101,32,112,105,99,116,117,114,101,32,40,71,114,97,121,
-115,99,97,108,101,41,0,79,110,101,32,112,105,99,116,117,
-114,101,32,40,49,98,105,116,32,66,108,97,99,107,32,97,
-110,100,32,119,104,105,116,101,41,0,77,101,110,117,32,107,
-101,121,32,115,101,116,116,105,110,103,115,0,67,97,110,118,
-97,115,32,107,101,121,32,115,101,116,116,105,110,103,115,0,
-67,108,101,97,114,32,97,108,108,0,67,108,101,97,114,32,
-107,101,121,0,84,104,101,32,115,97,109,101,32,107,101,121,
-32,104,97,115,32,97,108,114,101,97,100,121,32,98,101,101,
-110,32,115,101,116,46,0,67,104,97,110,103,101,32,116,111,
-111,108,0,67,104,97,110,103,101,32,100,114,97,119,105,110,
-103,32,116,121,112,101,0,79,116,104,101,114,32,99,111,109,
-109,97,110,100,115,0,84,111,111,108,32,111,112,101,114,97,
-116,105,111,110,32,98,121,32,107,101,121,43,111,112,101,114,
-97,116,105,111,110,0,68,114,97,119,105,110,103,32,116,121,
-112,101,32,111,112,101,114,97,116,105,111,110,32,98,121,32,
-107,101,121,43,111,112,101,114,97,116,105,111,110,0,83,101,
-108,101,99,116,105,111,110,32,116,111,111,108,32,111,112,101,
-114,97,116,105,111,110,32,98,121,32,107,101,121,43,111,112,
-101,114,97,116,105,111,110,0,82,101,103,105,115,116,114,97,
-116,105,111,110,32,116,111,111,108,32,111,112,101,114,97,116,
-105,111,110,32,98,121,32,107,101,121,43,111,112,101,114,97,
-116,105,111,110,0,79,116,104,101,114,32,111,112,101,114,97,
-116,105,111,110,115,32,98,121,32,107,101,121,43,111,112,101,
-114,97,116,105,111,110,0,82,117,108,101,114,32,79,78,47,
-79,70,70,0,85,110,100,111,0,82,101,100,111,0,90,111,
-111,109,32,114,97,116,101,32,111,110,101,32,108,101,118,101,
-108,32,101,120,112,97,110,100,0,90,111,111,109,32,114,97,
-116,101,32,111,110,101,32,108,101,118,101,108,32,114,101,100,
-117,99,101,0,67,97,110,118,97,115,32,114,111,116,97,116,
-105,111,110,32,114,101,115,101,116,0,68,114,97,119,105,110,
-103,47,98,97,99,107,103,114,111,117,110,100,32,99,111,108,
-111,114,32,105,110,116,101,114,99,104,97,110,103,101,0,83,
-101,108,101,99,116,32,111,110,101,32,108,97,121,101,114,32,
-97,98,111,118,101,0,83,101,108,101,99,116,32,111,110,101,
-32,108,97,121,101,114,32,98,101,108,111,119,0,67,117,114,
-114,101,110,116,32,108,97,121,101,114,32,118,105,115,105,98,
-108,101,47,105,110,118,105,115,105,98,108,101,0,83,101,108,
-101,99,116,32,116,104,101,32,110,101,120,116,32,105,116,101,
-109,32,105,110,32,116,104,101,32,116,111,111,108,32,108,105,
-115,116,0,83,101,108,101,99,116,32,116,104,101,32,112,114,
-101,118,105,111,117,115,32,105,116,101,109,32,105,110,32,116,
-104,101,32,116,111,111,108,32,108,105,115,116,0,84,111,111,
-108,32,108,105,115,116,44,32,115,119,105,116,99,104,32,116,
-111,32,108,97,115,116,32,115,101,108,101,99,116,101,100,32,
-105,116,101,109,0,83,101,108,101,99,116,58,32,114,101,99,
-116,97,110,103,108,101,0,83,101,108,101,99,116,58,32,112,
-111,108,121,103,111,110,0,83,101,108,101,99,116,58,32,102,
-114,101,101,104,97,110,100,0,77,111,118,101,32,105,109,97,
-103,101,0,67,111,112,121,32,105,109,97,103,101,0,77,111,
-118,101,32,115,101,108,101,99,116,105,111,110,32,112,111,115,
-105,116,105,111,110,0,67,104,97,110,103,101,32,122,111,111,
-109,32,114,97,116,101,32,40,117,112,45,100,111,119,110,32,
-100,114,97,103,41,0,67,104,97,110,103,101,32,98,114,117,
-115,104,32,115,105,122,101,32,40,108,101,102,116,45,114,105,
-103,104,116,32,100,114,97,103,41,0,83,101,108,101,99,116,
-32,103,114,97,98,98,101,100,32,108,97,121,101,114,0,82,
-101,115,101,116,0,80,114,111,99,101,115,115,32,111,110,108,
-121,32,119,105,116,104,105,110,32,116,104,101,32,99,97,110,
-118,97,115,0,66,114,105,103,104,116,110,101,115,115,0,67,
-111,110,116,114,97,115,116,0,71,97,109,109,97,32,118,97,
-108,117,101,0,72,117,101,0,83,97,116,117,114,97,116,105,
-111,110,0,84,104,114,101,115,104,111,108,100,0,84,121,112,
-101,0,84,111,110,101,0,82,97,100,105,117,115,0,65,110,
-103,108,101,0,83,116,114,101,110,103,116,104,0,89,111,117,
-32,99,97,110,32,99,104,97,110,103,101,32,116,104,101,32,
-99,101,110,116,101,114,32,112,111,115,105,116,105,111,110,10,
-98,121,32,108,101,102,116,45,99,108,105,99,107,105,110,103,
-32,111,110,32,116,104,101,32,99,97,110,118,97,115,0,69,
-109,112,104,97,115,105,115,0,78,117,109,98,101,114,32,111,
-102,32,99,121,99,108,101,115,0,67,108,97,114,105,116,121,
-0,67,111,108,111,114,0,83,105,122,101,0,68,101,110,115,
-105,116,121,0,65,110,116,105,45,97,108,105,97,115,105,110,
-103,0,65,109,111,117,110,116,0,82,97,110,100,111,109,58,
-114,97,100,105,117,115,40,37,41,0,82,97,110,100,111,109,
-58,68,101,110,115,105,116,121,40,37,41,0,80,111,105,110,
-116,32,116,121,112,101,0,84,104,105,99,107,110,101,115,115,
-0,77,105,110,105,109,117,109,32,116,104,105,99,107,110,101,
-115,115,0,77,97,120,105,109,117,109,32,116,104,105,99,107,
-110,101,115,115,0,77,105,110,105,109,117,109,32,105,110,116,
-101,114,118,97,108,0,77,97,120,105,109,117,109,32,105,110,
-116,101,114,118,97,108,0,72,111,114,105,122,111,110,116,97,
-108,32,108,105,110,101,0,86,101,114,116,105,99,97,108,32,
-108,105,110,101,0,87,105,100,116,104,0,72,101,105,103,104,
-116,0,77,97,107,101,32,116,104,101,32,104,101,105,103,104,
-116,32,116,104,101,32,115,97,109,101,32,97,115,32,116,104,
-101,32,119,105,100,116,104,0,85,115,101,32,97,118,101,114,
-97,103,101,32,99,111,108,111,114,0,65,110,103,108,101,32,
-82,0,65,110,103,108,101,32,71,0,65,110,103,108,101,32,
-66,0,77,97,107,101,32,97,108,108,32,97,110,103,108,101,
-115,32,116,104,101,32,115,97,109,101,32,97,115,32,82,0,
-71,114,97,121,115,99,97,108,101,0,65,112,112,108,105,99,
-97,98,108,101,32,97,109,111,117,110,116,0,68,105,115,116,
-97,110,99,101,0,82,101,118,101,114,115,101,0,76,101,110,
-103,116,104,0,87,105,100,116,104,0,76,111,111,112,32,116,
-104,101,32,101,110,100,115,0,66,97,99,107,103,114,111,117,
-110,100,0,83,99,97,108,101,0,78,117,109,98,101,114,32,
-111,102,32,116,105,109,101,115,0,83,111,117,114,99,101,32,
-105,115,32,99,104,101,99,107,101,100,32,108,97,121,101,114,
-0,67,114,111,112,32,116,104,101,32,115,111,117,114,99,101,
-32,105,109,97,103,101,0,83,109,111,111,116,104,0,78,117,
-109,98,101,114,32,111,102,32,108,105,110,101,115,0,70,105,
-120,101,100,32,100,101,110,115,105,116,121,0,77,97,107,101,
+32,40,104,111,114,105,122,111,110,116,97,108,32,114,111,119,
+41,0,65,114,114,97,110,103,101,32,105,110,32,116,105,108,
+101,115,32,40,118,101,114,116,105,99,97,108,32,114,111,119,
+41,0,0,82,117,110,0,71,114,97,100,105,101,110,116,32,
+101,100,105,116,105,110,103,40,38,69,41,46,46,46,0,78,
+101,119,40,38,78,41,46,46,46,0,69,100,105,116,32,108,
+105,115,116,40,38,76,41,46,46,46,0,79,112,101,110,40,
+38,79,41,46,46,46,0,83,97,118,101,40,38,83,41,46,
+46,46,0,78,101,119,32,103,114,111,117,112,40,38,71,41,
+46,46,46,0,69,100,105,116,40,38,69,41,46,46,46,0,
+73,110,115,101,114,116,32,103,114,111,117,112,40,38,78,41,
+46,46,46,0,68,101,108,101,116,101,32,103,114,111,117,112,
+40,38,68,41,0,73,110,115,101,114,116,32,110,101,119,32,
+98,114,117,115,104,40,38,66,41,46,46,46,0,73,110,115,
+101,114,116,32,99,117,114,114,101,110,116,32,116,111,111,108,
+40,38,84,41,0,67,111,112,121,40,38,67,41,0,80,97,
+115,116,101,40,38,80,41,0,83,101,116,116,105,110,103,40,
+38,79,41,46,46,46,0,84,111,111,108,40,38,76,41,0,
+68,101,108,101,116,101,40,38,68,41,0,82,101,103,105,115,
+116,114,97,116,105,111,110,40,38,82,41,0,79,118,101,114,
+114,105,100,101,32,116,111,111,108,32,111,112,116,105,111,110,
+32,118,97,108,117,101,115,40,38,79,41,0,68,105,115,112,
+108,97,121,32,115,101,116,32,118,97,108,117,101,40,38,86,
+41,0,85,110,115,112,101,99,105,102,105,101,100,0,82,101,
+108,101,97,115,101,32,97,108,108,0,65,100,100,40,38,65,
+41,0,68,101,108,101,116,101,40,38,68,41,32,91,83,104,
+105,102,116,43,76,66,84,84,93,0,65,100,100,32,115,105,
+122,101,115,0,80,108,101,97,115,101,32,101,110,116,101,114,
+32,116,104,101,32,98,114,117,115,104,32,115,105,122,101,46,
+10,89,111,117,32,99,97,110,32,115,112,101,99,105,102,121,
+32,109,111,114,101,32,116,104,97,110,32,111,110,101,32,98,
+121,32,115,101,112,97,114,97,116,105,110,103,32,116,104,101,
+109,10,119,105,116,104,32,99,104,97,114,97,99,116,101,114,
+115,32,111,116,104,101,114,32,116,104,97,110,32,110,117,109,
+98,101,114,115,32,97,110,100,32,39,46,39,46,10,91,69,
+120,97,109,112,108,101,93,32,49,46,48,44,49,48,46,50,
+59,53,48,0,65,108,119,97,121,115,32,115,97,118,101,0,
+78,111,114,109,97,108,0,69,114,97,115,101,114,0,87,97,
+116,101,114,0,66,108,117,114,0,0,83,105,122,101,32,40,
+100,105,97,109,101,116,101,114,41,0,76,105,110,101,32,99,
+111,114,114,101,99,116,105,111,110,0,78,111,110,101,0,65,
+118,101,114,97,103,101,40,115,116,114,111,110,103,41,0,65,
+118,101,114,97,103,101,40,109,101,100,105,117,109,41,0,65,
+118,101,114,97,103,101,40,119,101,97,107,41,0,70,105,120,
+101,100,32,100,105,115,116,97,110,99,101,0,0,80,111,105,
+110,116,32,105,110,116,101,114,118,97,108,32,40,49,46,48,
+32,61,32,114,97,100,105,117,115,41,0,82,97,110,100,111,
+109,32,119,105,100,116,104,32,111,102,32,98,114,117,115,104,
+32,115,105,122,101,40,37,41,0,82,97,110,100,111,109,32,
+119,105,100,116,104,32,111,102,32,112,111,105,110,116,32,112,
+111,115,105,116,105,111,110,0,67,117,114,118,101,32,105,110,
+116,101,114,112,111,108,97,116,105,111,110,0,87,97,116,101,
+114,0,65,109,111,117,110,116,32,111,102,32,100,114,97,119,
+105,110,103,32,99,111,108,111,114,0,65,109,111,117,110,116,
+32,116,111,32,101,120,116,101,110,100,0,84,114,101,97,116,
 32,116,104,101,32,98,97,99,107,103,114,111,117,110,100,32,
-119,104,105,116,101,0,65,115,112,101,99,116,32,114,97,116,
-105,111,0,68,101,110,115,105,116,121,0,73,110,116,101,114,
-118,97,108,58,82,97,110,100,111,109,0,84,104,105,99,107,
-110,101,115,115,58,82,97,110,100,111,109,0,76,101,110,103,
-116,104,58,82,97,110,100,111,109,0,87,97,118,101,32,108,
-101,110,103,116,104,0,84,104,105,99,107,110,101,115,115,32,
-102,97,100,101,32,111,117,116,0,83,105,109,112,108,101,32,
-112,114,101,118,105,101,119,0,80,114,101,118,105,101,119,32,
-105,110,32,114,101,100,0,66,97,121,101,114,50,120,50,0,
-66,97,121,101,114,52,120,52,0,83,112,105,114,97,108,0,
-68,111,116,0,82,97,110,100,111,109,0,0,66,108,97,99,
-107,47,87,104,105,116,101,0,68,114,97,119,105,110,103,47,
-66,97,99,107,103,114,111,117,110,100,0,66,108,97,99,107,
-43,65,108,112,104,97,0,0,68,114,97,119,105,110,103,32,
-99,111,108,111,114,0,66,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,66,108,97,99,107,0,87,104,105,
-116,101,0,0,68,111,116,32,99,105,114,99,108,101,0,65,
-110,116,105,45,97,108,105,97,115,105,110,103,32,99,105,114,
-99,108,101,0,83,111,102,116,32,99,105,114,99,108,101,0,
-0,68,114,97,119,105,110,103,32,99,111,108,111,114,0,82,
-97,110,100,111,109,40,103,114,97,121,115,99,97,108,101,41,
-0,82,97,110,100,111,109,40,82,71,66,41,0,82,97,110,
-100,111,109,40,72,117,101,41,0,82,97,110,100,111,109,40,
-115,97,116,117,114,97,116,105,111,110,32,111,102,32,100,114,
-97,119,105,110,103,32,99,111,108,111,114,41,0,82,97,110,
-100,111,109,40,98,114,105,103,104,116,110,101,115,115,32,111,
-102,32,100,114,97,119,105,110,103,32,99,111,108,111,114,41,
-0,0,79,117,116,101,114,32,115,105,100,101,32,111,102,32,
-111,112,97,99,105,116,121,32,97,114,101,97,0,73,110,110,
-101,114,32,115,105,100,101,32,111,102,32,111,112,97,99,105,
-116,121,32,97,114,101,97,0,0,83,108,97,110,116,0,72,
-111,114,105,122,111,110,116,97,108,0,86,101,114,116,105,99,
-97,108,0,0,77,105,110,105,109,117,109,0,77,105,100,100,
-108,101,0,77,97,120,105,109,117,109,0,0,72,111,114,105,
-122,111,110,116,97,108,32,111,110,108,121,0,86,101,114,116,
-105,99,97,108,32,111,110,108,121,0,66,111,116,104,0,0,
+97,115,32,119,104,105,116,101,0,80,114,101,115,101,116,0,
+66,114,117,115,104,32,115,104,97,112,101,0,83,104,97,112,
+101,32,105,109,97,103,101,0,72,97,114,100,110,101,115,115,
+32,119,104,101,110,32,110,111,114,109,97,108,108,121,32,114,
+111,117,110,100,0,83,116,114,101,110,103,116,104,32,111,102,
+32,115,97,110,100,105,110,103,0,66,97,115,101,32,97,110,
+103,108,101,32,111,102,32,114,111,116,97,116,105,111,110,0,
+82,97,110,100,111,109,32,114,111,116,97,116,105,111,110,32,
+119,105,100,116,104,0,82,111,116,97,116,101,32,105,110,32,
+116,104,101,32,100,105,114,101,99,116,105,111,110,32,111,102,
+32,116,114,97,118,101,108,0,80,101,110,32,112,114,101,115,
+115,117,114,101,0,83,105,122,101,32,119,104,101,110,32,48,
+32,112,114,101,115,115,117,114,101,40,37,41,0,68,101,110,
+115,105,116,121,32,119,104,101,110,32,48,32,112,114,101,115,
+115,117,114,101,40,37,41,0,80,114,101,115,115,117,114,101,
+32,99,117,114,118,101,32,101,100,105,116,105,110,103,0,85,
+115,101,32,97,32,99,111,109,109,111,110,32,112,114,101,115,
+115,117,114,101,32,99,117,114,118,101,0,86,97,114,105,111,
+117,115,0,82,101,103,105,115,116,101,114,101,100,32,105,110,
+32,37,99,0,82,101,115,101,116,40,38,82,41,0,69,100,
+105,116,32,103,114,97,100,105,101,110,116,32,108,105,115,116,
+0,83,112,101,99,105,102,121,105,110,103,32,116,104,101,32,
+105,109,97,103,101,32,112,111,115,105,116,105,111,110,0,83,
+101,116,116,105,110,103,0,76,101,102,116,32,98,117,116,116,
+111,110,0,67,116,114,108,43,76,101,102,116,0,83,104,105,
+102,116,43,76,101,102,116,0,82,105,103,104,116,32,98,117,
+116,116,111,110,0,77,105,100,100,108,101,32,98,117,116,116,
+111,110,0,83,99,114,111,108,108,32,116,104,101,32,118,105,
+101,119,32,98,121,32,100,114,97,103,103,105,110,103,9,83,
+99,114,111,108,108,32,116,104,101,32,99,97,110,118,97,115,
+32,98,121,32,100,114,97,103,103,105,110,103,9,90,111,111,
+109,32,98,121,32,100,114,97,103,103,105,110,103,32,117,112,
+32,97,110,100,32,100,111,119,110,9,77,101,110,117,0,83,
+99,114,111,108,108,32,98,121,32,100,114,97,103,103,105,110,
+103,9,90,111,111,109,32,98,121,32,100,114,97,103,103,105,
+110,103,32,117,112,32,97,110,100,32,100,111,119,110,9,71,
+101,116,32,99,111,108,111,114,40,100,114,97,119,105,110,103,
+32,99,111,108,111,114,41,9,71,101,116,32,99,111,108,111,
+114,40,98,97,99,107,103,114,111,117,110,100,32,99,111,108,
+111,114,41,9,67,111,108,111,114,32,97,99,113,117,105,115,
+105,116,105,111,110,32,109,101,110,117,0,78,101,119,32,99,
+97,110,118,97,115,0,73,110,105,116,105,97,108,32,108,97,
+121,101,114,0,83,101,116,32,97,115,32,115,116,97,114,116,
+117,112,32,115,105,122,101,0,84,104,101,32,109,97,120,105,
+109,117,109,32,101,100,105,116,97,98,108,101,32,112,120,32,
+115,105,122,101,32,104,97,115,32,98,101,101,110,32,101,120,
+99,101,101,100,101,100,46,0,72,105,115,116,111,114,121,0,
+82,101,103,105,115,116,114,97,116,105,111,110,0,82,101,103,
+117,108,97,116,105,111,110,115,0,71,114,105,100,32,115,101,
+116,116,105,110,103,115,0,71,114,105,100,0,68,105,118,105,
+100,105,110,103,32,108,105,110,101,0,78,117,109,98,101,114,
+32,111,102,32,104,111,114,105,122,111,110,116,97,108,32,100,
+105,118,105,115,105,111,110,115,0,78,117,109,98,101,114,32,
+111,102,32,118,101,114,116,105,99,97,108,32,100,105,118,105,
+115,105,111,110,115,0,83,104,111,119,32,49,112,120,32,103,
+114,105,100,0,37,100,37,37,32,111,114,32,109,111,114,101,
+0,73,103,110,111,114,101,32,97,108,112,104,97,32,99,104,
+97,110,110,101,108,0,78,101,119,32,108,97,121,101,114,0,
+76,97,121,101,114,32,115,101,116,116,105,110,103,115,0,76,
+97,121,101,114,32,99,111,108,111,114,32,115,101,108,101,99,
+116,105,111,110,0,66,97,116,99,104,32,99,111,110,118,101,
+114,115,105,111,110,32,111,102,32,110,117,109,98,101,114,32,
+111,102,32,108,105,110,101,115,0,84,101,109,112,108,97,116,
+101,32,108,105,115,116,32,101,100,105,116,0,67,111,109,98,
+105,110,101,32,109,117,108,116,105,112,108,101,32,108,97,121,
+101,114,115,0,67,104,97,110,103,101,32,108,97,121,101,114,
+32,116,121,112,101,0,84,111,110,105,110,103,0,78,117,109,
+98,101,114,32,111,102,32,108,105,110,101,115,0,70,105,120,
+101,100,32,100,101,110,115,105,116,121,0,77,97,107,101,32,
+116,104,101,32,98,97,99,107,103,114,111,117,110,100,32,119,
+104,105,116,101,0,83,101,116,32,102,114,111,109,32,100,114,
+97,119,105,110,103,32,99,111,108,111,114,0,83,101,116,32,
+116,111,32,100,114,97,119,105,110,103,32,99,111,108,111,114,
+0,83,101,116,32,116,111,32,100,101,102,97,117,108,116,32,
+110,117,109,98,101,114,32,111,102,32,108,105,110,101,115,0,
+84,97,114,103,101,116,0,65,108,108,32,108,97,121,101,114,
+115,0,76,97,121,101,114,32,119,105,116,104,32,115,112,101,
+99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,
+32,108,105,110,101,115,0,86,97,108,117,101,32,116,111,32,
+114,101,112,108,97,99,101,0,80,114,111,99,101,115,115,105,
+110,103,0,68,101,108,101,116,101,32,97,110,100,32,99,111,
+109,98,105,110,101,32,108,97,121,101,114,115,0,74,111,105,
+110,32,116,111,32,110,101,119,32,108,97,121,101,114,44,32,
+108,101,97,118,105,110,103,32,108,97,121,101,114,0,76,97,
+121,101,114,115,32,105,110,32,116,104,101,32,102,111,108,100,
+101,114,0,67,104,101,99,107,101,100,32,108,97,121,101,114,
+32,40,119,104,101,110,32,110,101,119,108,121,32,106,111,105,
+110,101,100,41,0,84,121,112,101,32,97,102,116,101,114,32,
+98,105,110,100,105,110,103,0,42,32,73,102,32,116,104,101,
+32,97,108,112,104,97,32,118,97,108,117,101,32,111,102,32,
+116,104,101,32,108,111,119,101,114,32,108,97,121,101,114,32,
+105,115,32,110,111,116,32,116,104,101,32,109,97,120,105,109,
+117,109,44,10,116,104,101,32,99,111,114,114,101,99,116,32,
+99,111,108,111,114,32,119,105,108,108,32,110,111,116,32,98,
+101,32,111,98,116,97,105,110,101,100,32,105,102,32,116,104,
+101,32,99,111,109,98,105,110,97,116,105,111,110,32,105,115,
+32,112,101,114,102,111,114,109,101,100,10,105,110,32,97,32,
+115,116,97,116,101,32,111,116,104,101,114,32,116,104,97,110,
+32,34,110,111,114,109,97,108,34,32,105,110,32,116,104,101,
+32,99,111,109,112,111,115,105,116,105,111,110,32,109,111,100,
+101,46,0,73,110,118,101,114,116,32,116,104,101,32,98,114,
+105,103,104,116,110,101,115,115,32,111,102,32,116,104,101,32,
+99,111,108,111,114,32,116,111,32,116,104,101,32,97,108,112,
+104,97,32,118,97,108,117,101,0,65,100,100,32,116,111,32,
+116,101,109,112,108,97,116,101,40,38,65,41,0,69,100,105,
+116,32,108,105,115,116,40,38,69,41,46,46,46,0,73,109,
+97,103,101,32,115,101,116,116,105,110,103,115,0,82,101,115,
+105,122,101,32,99,97,110,118,97,115,0,73,110,116,101,103,
+114,97,116,101,32,105,109,97,103,101,115,32,116,111,32,115,
+99,97,108,101,0,65,114,114,97,110,103,101,109,101,110,116,
+0,67,117,116,32,111,117,116,32,111,102,32,114,97,110,103,
+101,0,82,97,116,105,111,0,65,115,112,101,99,116,32,114,
+97,116,105,111,32,109,97,105,110,116,101,110,97,110,99,101,
+0,68,80,73,32,99,104,97,110,103,101,0,73,110,116,101,
+114,112,111,108,97,116,105,111,110,32,109,101,116,104,111,100,
+0,75,101,101,112,32,108,97,121,101,114,115,32,40,116,101,
+120,116,32,108,97,121,101,114,115,32,97,114,101,32,114,101,
+100,114,97,119,110,41,0,69,120,112,97,110,100,47,114,101,
+100,117,99,101,32,115,101,108,101,99,116,105,111,110,0,78,
+117,109,98,101,114,32,111,102,32,112,105,120,101,108,115,32,
+40,114,101,100,117,99,101,100,32,98,121,32,110,101,103,97,
+116,105,118,101,32,118,97,108,117,101,41,0,71,114,97,100,
+105,101,110,116,32,101,100,105,116,105,110,103,0,80,111,115,
+105,116,105,111,110,0,68,114,97,119,105,110,103,32,99,111,
+108,111,114,0,66,97,99,107,103,114,111,117,110,100,32,99,
+111,108,111,114,0,83,112,101,99,105,102,105,101,100,32,99,
+111,108,111,114,0,86,97,108,117,101,0,82,101,112,101,97,
+116,32,40,97,108,119,97,121,115,41,0,77,111,110,111,99,
+104,114,111,109,97,116,105,99,0,43,67,116,114,108,32,58,
+32,69,113,117,97,108,108,121,32,115,112,97,99,101,100,32,
+112,111,105,110,116,115,32,102,114,111,109,32,116,104,101,32,
+99,117,114,114,101,110,116,32,112,111,115,105,116,105,111,110,
+32,116,111,32,116,104,101,32,112,114,101,115,115,101,100,32,
+112,111,115,105,116,105,111,110,10,43,83,104,105,102,116,32,
+58,32,83,101,116,32,116,104,101,32,99,117,114,114,101,110,
+116,32,99,111,108,111,114,32,97,110,100,32,118,97,108,117,
+101,32,97,116,32,116,104,101,32,112,114,101,115,115,101,100,
+32,112,111,115,105,116,105,111,110,10,43,65,108,116,32,58,
+32,68,101,108,101,116,101,32,112,111,105,110,116,0,68,101,
+108,101,116,101,32,99,117,114,114,101,110,116,32,112,111,105,
+110,116,40,38,68,41,0,83,112,108,105,116,32,98,101,116,
+119,101,101,110,32,116,104,101,32,110,101,120,116,32,112,111,
+115,105,116,105,111,110,40,38,83,41,0,77,111,118,101,32,
+116,111,32,116,104,101,32,109,105,100,100,108,101,32,112,111,
+115,105,116,105,111,110,32,111,110,32,116,104,101,32,108,101,
+102,116,32,97,110,100,32,114,105,103,104,116,40,38,77,41,
+0,65,108,108,32,101,118,101,110,108,121,32,115,112,97,99,
+101,100,40,38,69,41,0,82,101,118,101,114,115,101,40,38,
+82,41,0,69,110,108,97,114,103,101,109,101,110,116,32,40,
+110,111,32,105,110,116,101,114,112,111,108,97,116,105,111,110,
+41,0,69,120,112,97,110,115,105,111,110,32,114,97,116,101,
+32,40,50,126,50,48,41,0,84,114,97,110,115,102,111,114,
+109,97,116,105,111,110,0,78,111,114,109,97,108,0,80,101,
+114,115,112,101,99,116,105,118,101,0,82,101,115,101,116,0,
+88,32,109,97,103,110,105,102,105,99,97,116,105,111,110,0,
+89,32,109,97,103,110,105,102,105,99,97,116,105,111,110,0,
+82,111,116,97,116,105,111,110,32,97,110,103,108,101,0,65,
+115,112,101,99,116,32,114,97,116,105,111,32,109,97,105,110,
+116,101,110,97,110,99,101,0,65,112,112,108,121,32,118,97,
+108,117,101,0,91,82,105,103,104,116,32,98,117,116,116,111,
+110,32,111,114,32,109,105,100,100,108,101,32,98,117,116,116,
+111,110,93,10,83,99,114,101,101,110,32,115,99,114,111,108,
+108,105,110,103,10,91,67,116,114,108,43,114,105,103,104,116,
+32,98,117,116,116,111,110,32,117,112,47,100,111,119,110,32,
+100,114,97,103,93,10,67,104,97,110,103,101,32,100,105,115,
+112,108,97,121,32,109,97,103,110,105,102,105,99,97,116,105,
+111,110,10,91,84,114,97,110,115,108,97,116,105,111,110,32,
+47,32,80,111,105,110,116,32,109,111,118,101,109,101,110,116,
+93,10,43,83,104,105,102,116,58,32,72,111,114,105,122,111,
+110,116,97,108,32,109,111,118,101,109,101,110,116,10,43,67,
+116,114,108,58,32,86,101,114,116,105,99,97,108,32,109,111,
+118,101,0,84,101,120,116,0,70,111,110,116,0,76,105,115,
+116,0,82,101,103,105,115,116,101,114,101,100,32,102,111,110,
+116,0,70,105,108,101,32,115,112,101,99,105,102,105,99,97,
+116,105,111,110,0,67,104,97,114,97,99,116,101,114,32,115,
+112,97,99,105,110,103,0,76,105,110,101,32,115,112,97,99,
+105,110,103,0,82,111,116,97,116,105,111,110,0,72,105,110,
+116,105,110,103,0,68,105,115,97,98,108,101,32,97,117,116,
+111,32,104,105,110,116,105,110,103,0,82,117,98,121,0,82,
+117,98,121,32,112,111,115,105,116,105,111,110,0,68,111,32,
+110,111,116,32,117,115,101,32,114,117,98,121,32,103,108,121,
+112,104,115,0,77,111,110,111,99,104,114,111,109,101,32,98,
+105,110,97,114,121,0,86,101,114,116,105,99,97,108,32,119,
+114,105,116,105,110,103,0,69,110,97,98,108,101,32,115,112,
+101,99,105,97,108,32,110,111,116,97,116,105,111,110,0,66,
+111,108,100,32,111,117,116,108,105,110,101,0,73,116,97,108,
+105,99,105,122,101,100,32,111,117,116,108,105,110,101,0,69,
+110,97,98,108,101,32,101,109,98,101,100,100,101,100,32,98,
+105,116,109,97,112,0,87,111,114,100,32,108,105,115,116,32,
+101,100,105,116,105,110,103,40,38,69,41,0,69,100,105,116,
+32,114,101,103,105,115,116,101,114,101,100,32,102,111,110,116,
+0,70,111,110,116,32,101,100,105,116,105,110,103,0,69,100,
+105,116,105,110,103,32,114,101,112,108,97,99,101,109,101,110,
+116,32,99,104,97,114,97,99,116,101,114,115,0,82,101,103,
+105,115,116,101,114,101,100,32,110,97,109,101,0,66,97,115,
+101,32,102,111,110,116,0,82,101,112,108,97,99,101,109,101,
+110,116,32,102,111,110,116,32,49,0,82,101,112,108,97,99,
+101,109,101,110,116,32,102,111,110,116,32,50,0,67,104,97,
+114,97,99,116,101,114,32,101,100,105,116,105,110,103,0,67,
+104,97,114,97,99,116,101,114,32,116,121,112,101,0,67,111,
+100,101,32,115,112,101,99,105,102,105,99,97,116,105,111,110,
+0,68,105,115,112,108,97,121,32,85,110,105,99,111,100,101,
+32,102,114,111,109,32,99,104,97,114,97,99,116,101,114,115,
+0,66,97,115,105,99,32,76,97,116,105,110,0,72,105,114,
+97,103,97,110,97,0,75,97,116,97,107,97,110,97,0,75,
+97,110,106,105,0,80,117,110,99,116,117,97,116,105,111,110,
+32,101,116,99,46,0,69,120,116,101,114,110,97,108,32,99,
+104,97,114,97,99,116,101,114,115,32,40,112,114,105,118,97,
+116,101,32,117,115,101,32,97,114,101,97,41,0,80,108,101,
+97,115,101,32,101,110,116,101,114,32,110,97,109,101,0,80,
+108,101,97,115,101,32,115,101,108,101,99,116,32,97,32,98,
+97,115,101,32,102,111,110,116,0,84,104,101,114,101,32,105,
+115,32,97,110,32,101,114,114,111,114,32,105,110,32,116,104,
+101,32,99,111,100,101,32,118,97,108,117,101,32,100,101,115,
+99,114,105,112,116,105,111,110,0,68,117,112,108,105,99,97,
+116,101,32,99,111,100,101,32,118,97,108,117,101,0,87,111,
+114,100,32,108,105,115,116,32,101,100,105,116,105,110,103,0,
+87,111,114,100,0,78,97,109,101,0,84,101,120,116,0,78,
+101,119,32,103,114,111,117,112,0,71,114,111,117,112,32,115,
+101,116,116,105,110,103,115,0,66,114,117,115,104,32,115,105,
+122,101,32,115,101,116,116,105,110,103,0,84,111,111,108,32,
+115,101,116,116,105,110,103,115,0,78,117,109,98,101,114,32,
+116,111,32,108,105,110,101,32,117,112,32,115,105,100,101,32,
+98,121,32,115,105,100,101,0,109,105,110,105,109,117,109,0,
+109,97,120,105,109,117,109,0,80,114,101,115,115,117,114,101,
+32,99,117,114,118,101,0,84,111,111,108,32,108,105,115,116,
+32,101,100,105,116,105,110,103,0,71,114,111,117,112,0,73,
+116,101,109,0,83,97,118,101,32,115,101,116,116,105,110,103,
+115,0,67,111,109,112,114,101,115,115,105,111,110,32,108,101,
+118,101,108,32,91,48,45,57,93,0,65,108,112,104,97,32,
+99,104,97,110,110,101,108,0,81,117,97,108,105,116,121,32,
+91,48,45,49,48,48,93,0,83,97,109,112,108,105,110,103,
+32,114,97,116,105,111,0,52,58,52,58,52,32,40,72,105,
+103,104,41,0,52,58,50,58,50,0,52,58,50,58,48,32,
+40,76,111,119,41,0,0,49,54,98,105,116,32,99,111,108,
+111,114,0,80,114,111,103,114,101,115,115,105,118,101,0,85,
+110,99,111,109,112,114,101,115,115,101,100,0,67,111,109,112,
+114,101,115,115,105,111,110,32,116,121,112,101,0,84,114,97,
+110,115,112,97,114,101,110,116,32,99,111,108,111,114,0,67,
+111,108,111,114,32,112,111,115,105,116,105,111,110,0,76,111,
+115,115,108,101,115,115,32,99,111,109,112,114,101,115,115,105,
+111,110,0,76,111,115,115,121,32,99,111,109,112,114,101,115,
+115,105,111,110,0,42,32,73,102,32,116,104,101,32,108,97,
+121,101,114,32,104,97,115,32,97,110,32,97,108,112,104,97,
+32,99,104,97,110,110,101,108,44,10,97,108,108,32,108,97,
+121,101,114,115,32,119,105,108,108,32,98,101,32,99,111,109,
+98,105,110,101,100,32,105,110,32,34,110,111,114,109,97,108,
+34,32,109,111,100,101,46,10,65,108,115,111,44,32,116,104,
+101,32,116,111,110,101,32,108,97,121,101,114,32,105,115,32,
+110,111,116,32,116,111,110,101,100,46,0,76,97,121,101,114,
+32,115,116,114,117,99,116,117,114,101,0,79,110,101,32,112,
+105,99,116,117,114,101,32,40,82,71,66,41,0,79,110,101,
+32,112,105,99,116,117,114,101,32,40,71,114,97,121,115,99,
+97,108,101,41,0,79,110,101,32,112,105,99,116,117,114,101,
+32,40,49,98,105,116,32,66,108,97,99,107,32,97,110,100,
+32,119,104,105,116,101,41,0,77,101,110,117,32,107,101,121,
+32,115,101,116,116,105,110,103,115,0,67,97,110,118,97,115,
+32,107,101,121,32,115,101,116,116,105,110,103,115,0,67,108,
+101,97,114,32,97,108,108,0,67,108,101,97,114,32,107,101,
+121,0,84,104,101,32,115,97,109,101,32,107,101,121,32,104,
+97,115,32,97,108,114,101,97,100,121,32,98,101,101,110,32,
+115,101,116,46,0,67,104,97,110,103,101,32,116,111,111,108,
+0,67,104,97,110,103,101,32,100,114,97,119,105,110,103,32,
+116,121,112,101,0,79,116,104,101,114,32,99,111,109,109,97,
+110,100,115,0,84,111,111,108,32,111,112,101,114,97,116,105,
+111,110,32,98,121,32,107,101,121,43,111,112,101,114,97,116,
+105,111,110,0,68,114,97,119,105,110,103,32,116,121,112,101,
+32,111,112,101,114,97,116,105,111,110,32,98,121,32,107,101,
+121,43,111,112,101,114,97,116,105,111,110,0,83,101,108,101,
+99,116,105,111,110,32,116,111,111,108,32,111,112,101,114,97,
+116,105,111,110,32,98,121,32,107,101,121,43,111,112,101,114,
+97,116,105,111,110,0,82,101,103,105,115,116,114,97,116,105,
+111,110,32,116,111,111,108,32,111,112,101,114,97,116,105,111,
+110,32,98,121,32,107,101,121,43,111,112,101,114,97,116,105,
+111,110,0,79,116,104,101,114,32,111,112,101,114,97,116,105,
+111,110,115,32,98,121,32,107,101,121,43,111,112,101,114,97,
+116,105,111,110,0,82,117,108,101,114,32,79,78,47,79,70,
+70,0,85,110,100,111,0,82,101,100,111,0,90,111,111,109,
+32,114,97,116,101,32,111,110,101,32,108,101,118,101,108,32,
+101,120,112,97,110,100,0,90,111,111,109,32,114,97,116,101,
+32,111,110,101,32,108,101,118,101,108,32,114,101,100,117,99,
+101,0,67,97,110,118,97,115,32,114,111,116,97,116,105,111,
+110,32,114,101,115,101,116,0,68,114,97,119,105,110,103,47,
+98,97,99,107,103,114,111,117,110,100,32,99,111,108,111,114,
+32,105,110,116,101,114,99,104,97,110,103,101,0,83,101,108,
+101,99,116,32,111,110,101,32,108,97,121,101,114,32,97,98,
+111,118,101,0,83,101,108,101,99,116,32,111,110,101,32,108,
+97,121,101,114,32,98,101,108,111,119,0,67,117,114,114,101,
+110,116,32,108,97,121,101,114,32,118,105,115,105,98,108,101,
+47,105,110,118,105,115,105,98,108,101,0,83,101,108,101,99,
+116,32,116,104,101,32,110,101,120,116,32,105,116,101,109,32,
+105,110,32,116,104,101,32,116,111,111,108,32,108,105,115,116,
+0,83,101,108,101,99,116,32,116,104,101,32,112,114,101,118,
+105,111,117,115,32,105,116,101,109,32,105,110,32,116,104,101,
+32,116,111,111,108,32,108,105,115,116,0,84,111,111,108,32,
+108,105,115,116,44,32,115,119,105,116,99,104,32,116,111,32,
+108,97,115,116,32,115,101,108,101,99,116,101,100,32,105,116,
+101,109,0,83,101,108,101,99,116,58,32,114,101,99,116,97,
+110,103,108,101,0,83,101,108,101,99,116,58,32,112,111,108,
+121,103,111,110,0,83,101,108,101,99,116,58,32,102,114,101,
+101,104,97,110,100,0,77,111,118,101,32,105,109,97,103,101,
+0,67,111,112,121,32,105,109,97,103,101,0,77,111,118,101,
+32,115,101,108,101,99,116,105,111,110,32,112,111,115,105,116,
+105,111,110,0,67,104,97,110,103,101,32,122,111,111,109,32,
+114,97,116,101,32,40,117,112,45,100,111,119,110,32,100,114,
+97,103,41,0,67,104,97,110,103,101,32,98,114,117,115,104,
+32,115,105,122,101,32,40,108,101,102,116,45,114,105,103,104,
+116,32,100,114,97,103,41,0,83,101,108,101,99,116,32,103,
+114,97,98,98,101,100,32,108,97,121,101,114,0,82,101,115,
+101,116,0,80,114,111,99,101,115,115,32,111,110,108,121,32,
+119,105,116,104,105,110,32,116,104,101,32,99,97,110,118,97,
+115,0,66,114,105,103,104,116,110,101,115,115,0,67,111,110,
+116,114,97,115,116,0,71,97,109,109,97,32,118,97,108,117,
+101,0,72,117,101,0,83,97,116,117,114,97,116,105,111,110,
+0,84,104,114,101,115,104,111,108,100,0,84,121,112,101,0,
+84,111,110,101,0,82,97,100,105,117,115,0,65,110,103,108,
+101,0,83,116,114,101,110,103,116,104,0,89,111,117,32,99,
+97,110,32,99,104,97,110,103,101,32,116,104,101,32,99,101,
+110,116,101,114,32,112,111,115,105,116,105,111,110,10,98,121,
+32,108,101,102,116,45,99,108,105,99,107,105,110,103,32,111,
+110,32,116,104,101,32,99,97,110,118,97,115,0,69,109,112,
+104,97,115,105,115,0,78,117,109,98,101,114,32,111,102,32,
+99,121,99,108,101,115,0,67,108,97,114,105,116,121,0,67,
+111,108,111,114,0,83,105,122,101,0,68,101,110,115,105,116,
+121,0,65,110,116,105,45,97,108,105,97,115,105,110,103,0,
+65,109,111,117,110,116,0,82,97,110,100,111,109,58,114,97,
+100,105,117,115,40,37,41,0,82,97,110,100,111,109,58,68,
+101,110,115,105,116,121,40,37,41,0,80,111,105,110,116,32,
+116,121,112,101,0,84,104,105,99,107,110,101,115,115,0,77,
+105,110,105,109,117,109,32,116,104,105,99,107,110,101,115,115,
+0,77,97,120,105,109,117,109,32,116,104,105,99,107,110,101,
+115,115,0,77,105,110,105,109,117,109,32,105,110,116,101,114,
+118,97,108,0,77,97,120,105,109,117,109,32,105,110,116,101,
+114,118,97,108,0,72,111,114,105,122,111,110,116,97,108,32,
+108,105,110,101,0,86,101,114,116,105,99,97,108,32,108,105,
+110,101,0,87,105,100,116,104,0,72,101,105,103,104,116,0,
+77,97,107,101,32,116,104,101,32,104,101,105,103,104,116,32,
+116,104,101,32,115,97,109,101,32,97,115,32,116,104,101,32,
+119,105,100,116,104,0,85,115,101,32,97,118,101,114,97,103,
+101,32,99,111,108,111,114,0,65,110,103,108,101,32,82,0,
+65,110,103,108,101,32,71,0,65,110,103,108,101,32,66,0,
+77,97,107,101,32,97,108,108,32,97,110,103,108,101,115,32,
+116,104,101,32,115,97,109,101,32,97,115,32,82,0,71,114,
+97,121,115,99,97,108,101,0,65,112,112,108,105,99,97,98,
+108,101,32,97,109,111,117,110,116,0,68,105,115,116,97,110,
+99,101,0,82,101,118,101,114,115,101,0,76,101,110,103,116,
+104,0,87,105,100,116,104,0,76,111,111,112,32,116,104,101,
+32,101,110,100,115,0,66,97,99,107,103,114,111,117,110,100,
+0,83,99,97,108,101,0,78,117,109,98,101,114,32,111,102,
+32,116,105,109,101,115,0,83,111,117,114,99,101,32,105,115,
+32,99,104,101,99,107,101,100,32,108,97,121,101,114,0,67,
+114,111,112,32,116,104,101,32,115,111,117,114,99,101,32,105,
+109,97,103,101,0,83,109,111,111,116,104,0,78,117,109,98,
+101,114,32,111,102,32,108,105,110,101,115,0,70,105,120,101,
+100,32,100,101,110,115,105,116,121,0,77,97,107,101,32,116,
+104,101,32,98,97,99,107,103,114,111,117,110,100,32,119,104,
+105,116,101,0,65,115,112,101,99,116,32,114,97,116,105,111,
+0,68,101,110,115,105,116,121,0,73,110,116,101,114,118,97,
+108,58,82,97,110,100,111,109,0,84,104,105,99,107,110,101,
+115,115,58,82,97,110,100,111,109,0,76,101,110,103,116,104,
+58,82,97,110,100,111,109,0,87,97,118,101,32,108,101,110,
+103,116,104,0,84,104,105,99,107,110,101,115,115,32,102,97,
+100,101,32,111,117,116,0,83,105,109,112,108,101,32,112,114,
+101,118,105,101,119,0,80,114,101,118,105,101,119,32,105,110,
+32,114,101,100,0,66,97,121,101,114,50,120,50,0,66,97,
+121,101,114,52,120,52,0,83,112,105,114,97,108,0,68,111,
+116,0,82,97,110,100,111,109,0,0,66,108,97,99,107,47,
+87,104,105,116,101,0,68,114,97,119,105,110,103,47,66,97,
+99,107,103,114,111,117,110,100,0,66,108,97,99,107,43,65,
+108,112,104,97,0,0,68,114,97,119,105,110,103,32,99,111,
+108,111,114,0,66,97,99,107,103,114,111,117,110,100,32,99,
+111,108,111,114,0,66,108,97,99,107,0,87,104,105,116,101,
+0,0,68,111,116,32,99,105,114,99,108,101,0,65,110,116,
+105,45,97,108,105,97,115,105,110,103,32,99,105,114,99,108,
+101,0,83,111,102,116,32,99,105,114,99,108,101,0,0,68,
+114,97,119,105,110,103,32,99,111,108,111,114,0,82,97,110,
+100,111,109,40,103,114,97,121,115,99,97,108,101,41,0,82,
+97,110,100,111,109,40,82,71,66,41,0,82,97,110,100,111,
+109,40,72,117,101,41,0,82,97,110,100,111,109,40,115,97,
+116,117,114,97,116,105,111,110,32,111,102,32,100,114,97,119,
+105,110,103,32,99,111,108,111,114,41,0,82,97,110,100,111,
+109,40,98,114,105,103,104,116,110,101,115,115,32,111,102,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,41,0,0,
+79,117,116,101,114,32,115,105,100,101,32,111,102,32,111,112,
+97,99,105,116,121,32,97,114,101,97,0,73,110,110,101,114,
+32,115,105,100,101,32,111,102,32,111,112,97,99,105,116,121,
+32,97,114,101,97,0,0,83,108,97,110,116,0,72,111,114,
+105,122,111,110,116,97,108,0,86,101,114,116,105,99,97,108,
+0,0,77,105,110,105,109,117,109,0,77,105,100,100,108,101,
+0,77,97,120,105,109,117,109,0,0,72,111,114,105,122,111,
+110,116,97,108,32,111,110,108,121,0,86,101,114,116,105,99,
+97,108,32,111,110,108,121,0,66,111,116,104,0,0,82,101,
+99,116,97,110,103,117,108,97,114,32,99,111,111,114,100,105,
+110,97,116,101,115,32,45,62,32,80,111,108,97,114,32,99,
+111,111,114,100,105,110,97,116,101,115,0,80,111,108,97,114,
+32,99,111,111,114,100,105,110,97,116,101,115,32,45,62,32,
 82,101,99,116,97,110,103,117,108,97,114,32,99,111,111,114,
-100,105,110,97,116,101,115,32,45,62,32,80,111,108,97,114,
-32,99,111,111,114,100,105,110,97,116,101,115,0,80,111,108,
-97,114,32,99,111,111,114,100,105,110,97,116,101,115,32,45,
-62,32,82,101,99,116,97,110,103,117,108,97,114,32,99,111,
-111,114,100,105,110,97,116,101,115,0,0,84,114,97,110,115,
-112,97,114,101,110,116,0,83,105,100,101,32,99,111,108,111,
-114,0,84,104,97,116,32,119,97,121,0,0,66,114,117,115,
-104,40,97,110,116,105,45,97,108,105,97,115,105,110,103,41,
-0,66,114,117,115,104,40,110,111,32,97,110,116,105,45,97,
-108,105,97,115,105,110,103,41,0,49,112,120,32,100,111,116,
-32,112,101,110,0,0,80,97,110,101,108,32,108,97,121,111,
-117,116,32,115,101,116,116,105,110,103,0,80,97,110,101,108,
-0,80,97,110,101,0,80,97,110,101,37,100,0,67,97,110,
-118,97,115,0,84,111,111,108,98,97,114,32,99,117,115,116,
-111,109,105,122,97,116,105,111,110,0,45,45,45,32,83,101,
-112,97,114,97,116,105,111,110,32,45,45,45,0,69,110,118,
-105,114,111,110,109,101,110,116,97,108,32,115,101,116,116,105,
-110,103,0,83,101,116,116,105,110,103,32,49,0,70,108,97,
-103,115,0,66,117,116,116,111,110,32,111,112,101,114,97,116,
-105,111,110,0,73,110,116,101,114,102,97,99,101,0,83,121,
-115,116,101,109,0,67,97,110,118,97,115,32,98,97,99,107,
-103,114,111,117,110,100,32,99,111,108,111,114,0,80,108,97,
-105,100,32,98,97,99,107,103,114,111,117,110,100,32,99,111,
-108,111,114,0,82,117,108,101,114,32,103,117,105,100,101,32,
-99,111,108,111,114,0,68,101,102,97,117,108,116,32,110,117,
-109,98,101,114,32,111,102,32,98,105,116,115,32,119,104,101,
-110,32,114,101,97,100,105,110,103,32,97,110,32,105,109,97,
-103,101,0,77,97,120,105,109,117,109,32,110,117,109,98,101,
-114,32,111,102,32,117,110,100,111,115,32,91,50,45,52,48,
-48,93,0,77,97,120,105,109,117,109,32,117,110,100,111,32,
-98,117,102,102,101,114,32,115,105,122,101,0,79,110,101,32,
-115,116,101,112,32,111,102,32,99,97,110,118,97,115,32,100,
-105,115,112,108,97,121,32,109,97,103,110,105,102,105,99,97,
-116,105,111,110,32,40,97,116,32,49,48,48,37,32,111,114,
-32,109,111,114,101,41,0,79,110,101,32,115,116,101,112,32,
-111,102,32,99,97,110,118,97,115,32,114,111,116,97,116,105,
-111,110,0,67,111,110,102,105,114,109,32,119,104,101,110,32,
-111,118,101,114,119,114,105,116,105,110,103,0,67,104,101,99,
-107,32,119,104,101,110,32,111,118,101,114,119,114,105,116,105,
-110,103,32,105,110,32,97,32,102,111,114,109,97,116,32,111,
-116,104,101,114,32,116,104,97,110,32,65,80,68,0,68,111,
-32,110,111,116,32,119,114,105,116,101,32,97,32,115,105,110,
-103,108,101,32,112,105,99,116,117,114,101,32,105,109,97,103,
-101,32,119,104,101,110,32,115,97,118,105,110,103,32,65,80,
-68,0,40,80,97,110,101,108,41,32,70,105,108,116,101,114,
-32,108,105,115,116,32,105,116,101,109,115,32,99,97,110,32,
-98,101,32,101,120,101,99,117,116,101,100,32,98,121,32,100,
-111,117,98,108,101,45,99,108,105,99,107,105,110,103,0,78,
-111,114,109,97,108,32,100,101,118,105,99,101,0,68,101,118,
-105,99,101,115,32,119,105,116,104,32,112,114,101,115,115,117,
-114,101,0,67,111,109,109,97,110,100,32,115,101,108,101,99,
-116,105,111,110,0,71,101,116,32,98,117,116,116,111,110,0,
-66,117,116,116,111,110,0,67,111,109,109,97,110,100,0,87,
-104,101,110,32,121,111,117,32,112,114,101,115,115,32,116,104,
-101,32,98,117,116,116,111,110,32,111,102,32,101,97,99,104,
-32,100,101,118,105,99,101,32,111,110,32,116,104,101,32,34,
-71,101,116,32,66,117,116,116,111,110,34,32,97,114,101,97,
-44,10,116,104,101,32,105,116,101,109,32,111,102,32,116,104,
-97,116,32,98,117,116,116,111,110,32,105,115,32,115,101,108,
-101,99,116,101,100,32,105,110,32,116,104,101,32,108,105,115,
-116,46,0,78,111,116,32,115,112,101,99,105,102,105,101,100,
-32,40,100,101,102,97,117,108,116,32,111,112,101,114,97,116,
-105,111,110,41,0,84,111,111,108,32,111,112,101,114,97,116,
-105,111,110,0,82,101,103,105,115,116,114,97,116,105,111,110,
-32,116,111,111,108,32,111,112,101,114,97,116,105,111,110,0,
-79,116,104,101,114,32,111,112,101,114,97,116,105,111,110,0,
-79,116,104,101,114,32,99,111,109,109,97,110,100,115,0,80,
-97,110,101,108,32,102,111,110,116,32,91,42,93,0,73,99,
-111,110,32,115,105,122,101,32,91,42,93,0,84,111,111,108,
-98,97,114,0,84,111,111,108,0,79,116,104,101,114,0,84,
-111,111,108,98,97,114,32,99,117,115,116,111,109,105,122,97,
-116,105,111,110,0,87,111,114,107,105,110,103,32,100,105,114,
-101,99,116,111,114,121,32,91,42,93,0,85,115,101,114,39,
-115,32,98,114,117,115,104,32,105,109,97,103,101,32,100,105,
-114,101,99,116,111,114,121,0,85,115,101,114,39,115,32,116,
-101,120,116,117,114,101,32,105,109,97,103,101,32,100,105,114,
-101,99,116,111,114,121,0,68,114,97,119,105,110,103,32,99,
-117,114,115,111,114,0,73,109,97,103,101,32,102,105,108,101,
-32,40,116,114,97,110,115,112,97,114,101,110,116,32,111,114,
-32,80,78,71,32,119,105,116,104,32,97,108,112,104,97,41,
-0,67,101,110,116,101,114,32,112,111,115,105,116,105,111,110,
-32,40,116,104,101,32,117,112,112,101,114,32,108,101,102,116,
-32,111,102,32,116,104,101,32,105,109,97,103,101,32,105,115,
-32,40,48,44,48,41,41,0,91,42,93,32,61,32,65,112,
-112,108,121,32,97,116,32,110,101,120,116,32,115,116,97,114,
-116,117,112,0,83,101,116,32,116,104,101,32,119,111,114,107,
-105,110,103,32,100,105,114,101,99,116,111,114,121,32,112,97,
-116,104,32,99,111,114,114,101,99,116,108,121,0,48,58,69,
-114,97,115,101,114,32,111,102,32,116,104,101,32,112,101,110,
-0,49,58,76,101,102,116,32,98,117,116,116,111,110,0,50,
-58,82,105,103,104,116,32,98,117,116,116,111,110,0,51,58,
-77,105,100,100,108,101,32,98,117,116,116,111,110,0,52,58,
-83,99,114,111,108,108,32,117,112,0,53,58,83,99,114,111,
-108,108,32,100,111,119,110,0,54,58,83,99,114,111,108,108,
-32,108,101,102,116,0,55,58,83,99,114,111,108,108,32,114,
-105,103,104,116,0,70,105,108,101,40,38,70,41,0,69,100,
-105,116,40,38,69,41,0,76,97,121,101,114,40,38,76,41,
-0,83,101,108,101,99,116,105,111,110,40,38,83,41,0,70,
-105,108,116,101,114,40,38,84,41,0,86,105,101,119,40,38,
-86,41,0,83,101,116,116,105,110,103,40,38,79,41,0,78,
-101,119,40,38,78,41,46,46,46,0,79,112,101,110,40,38,
-79,41,46,46,46,0,83,97,118,101,40,38,83,41,0,83,
-97,118,101,32,97,115,40,38,87,41,46,46,46,0,83,97,
-118,101,32,100,117,112,108,105,99,97,116,101,40,38,68,41,
-46,46,46,0,82,101,99,101,110,116,108,121,32,117,115,101,
-100,32,102,105,108,101,115,40,38,82,41,0,69,120,105,116,
-40,38,88,41,0,67,108,101,97,114,32,104,105,115,116,111,
-114,121,40,38,67,41,0,85,110,100,111,40,38,90,41,0,
-82,101,100,111,40,38,89,41,0,70,105,108,108,40,38,70,
-41,0,69,114,97,115,101,40,38,69,41,0,67,104,97,110,
-103,101,32,99,97,110,118,97,115,32,115,105,122,101,40,38,
-83,41,46,46,46,0,73,110,116,101,103,114,97,116,101,32,
-105,109,97,103,101,115,32,116,111,32,115,99,97,108,101,40,
-38,82,41,46,46,46,0,73,109,97,103,101,32,115,101,116,
-116,105,110,103,115,40,38,79,41,46,46,46,0,68,114,97,
-119,105,110,103,32,99,111,108,111,114,32,97,115,32,105,109,
-97,103,101,32,98,97,99,107,103,114,111,117,110,100,32,99,
-111,108,111,114,40,38,66,41,0,68,101,115,101,108,101,99,
-116,40,38,68,41,0,83,101,108,101,99,116,32,97,108,108,
-40,38,65,41,0,82,101,118,101,114,115,101,40,38,73,41,
-0,69,120,112,97,110,115,105,111,110,47,82,101,100,117,99,
-116,105,111,110,40,38,69,41,46,46,46,0,67,111,112,121,
-40,38,67,41,0,67,117,116,40,38,88,41,0,80,97,115,
-116,101,32,116,111,32,110,101,119,32,108,97,121,101,114,40,
-38,86,41,0,83,101,108,101,99,116,32,116,104,101,32,111,
-112,97,113,117,101,32,97,114,101,97,32,111,102,32,116,104,
-101,32,108,97,121,101,114,40,38,79,41,0,83,101,108,101,
-99,116,32,116,104,101,32,100,114,97,119,105,110,103,32,99,
-111,108,111,114,32,97,114,101,97,32,111,102,32,116,104,101,
-32,108,97,121,101,114,40,38,76,41,0,79,117,116,112,117,
-116,32,116,104,101,32,105,109,97,103,101,32,105,110,32,115,
-101,108,101,99,116,105,111,110,32,116,111,32,97,32,102,105,
-108,101,40,38,80,41,46,46,46,0,69,110,118,105,114,111,
-110,109,101,110,116,97,108,32,115,101,116,116,105,110,103,40,
-38,69,41,46,46,46,0,71,114,105,100,32,115,101,116,116,
-105,110,103,115,40,38,71,41,46,46,46,0,77,101,110,117,
-32,107,101,121,32,115,101,116,116,105,110,103,115,40,38,75,
-41,46,46,46,0,67,97,110,118,97,115,32,107,101,121,32,
-115,101,116,116,105,110,103,115,40,38,67,41,46,46,46,0,
-80,97,110,101,108,32,108,97,121,111,117,116,32,115,101,116,
-116,105,110,103,40,38,80,41,46,46,46,0,65,98,111,117,
-116,40,38,65,41,46,46,46,0,78,101,119,32,108,97,121,
-101,114,40,38,78,41,46,46,46,0,78,101,119,32,102,111,
-108,100,101,114,40,38,70,41,0,78,101,119,32,108,97,121,
-101,114,32,102,114,111,109,32,102,105,108,101,40,38,73,41,
-46,46,46,0,67,114,101,97,116,101,32,110,101,119,32,111,
-110,32,116,111,112,32,111,102,32,116,104,101,32,99,117,114,
-114,101,110,116,32,108,97,121,101,114,40,38,81,41,46,46,
-46,0,68,117,112,108,105,99,97,116,101,40,38,67,41,0,
-68,101,108,101,116,101,40,38,68,41,0,69,114,97,115,101,
-40,38,88,41,0,77,111,118,101,32,105,109,97,103,101,32,
-100,111,119,110,32,116,111,32,108,97,121,101,114,32,98,101,
-108,111,119,40,38,90,41,0,77,101,114,103,101,32,119,105,
-116,104,32,108,97,121,101,114,32,98,101,108,111,119,40,38,
-66,41,0,77,101,114,103,101,32,118,97,114,105,111,117,115,
-32,108,97,121,101,114,115,40,38,87,41,46,46,46,0,77,
-101,114,103,101,32,97,108,108,40,38,77,41,0,68,105,115,
-112,108,97,121,32,116,111,110,101,32,108,97,121,101,114,32,
-105,110,32,103,114,97,121,115,99,97,108,101,40,38,84,41,
-0,79,117,116,112,117,116,32,116,111,32,102,105,108,101,40,
-38,83,41,46,46,46,0,83,101,116,116,105,110,103,115,40,
-38,79,41,0,66,97,116,99,104,32,99,111,110,118,101,114,
-115,105,111,110,40,38,65,41,0,69,100,105,116,40,38,69,
-41,0,86,105,101,119,40,38,86,41,0,70,111,108,100,101,
-114,40,38,74,41,0,70,108,97,103,115,40,38,71,41,0,
-76,97,121,101,114,32,115,101,116,116,105,110,103,115,40,38,
-79,41,46,46,46,0,67,104,97,110,103,101,32,108,97,121,
-101,114,32,116,121,112,101,40,38,84,41,46,46,46,0,67,
-104,97,110,103,101,32,108,105,110,101,32,99,111,108,111,114,
-40,38,67,41,46,46,46,0,78,117,109,98,101,114,32,111,
-102,32,116,111,110,101,32,108,105,110,101,115,40,38,76,41,
-46,46,46,0,70,108,105,112,32,104,111,114,105,122,111,110,
-116,97,108,40,38,72,41,0,70,108,105,112,32,117,112,115,
-105,100,101,32,100,111,119,110,40,38,86,41,0,82,111,116,
-97,116,101,32,57,48,32,100,101,103,114,101,101,115,32,116,
-111,32,116,104,101,32,108,101,102,116,40,38,76,41,0,82,
-111,116,97,116,101,32,57,48,32,100,101,103,114,101,101,115,
-32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,82,
-41,0,83,104,111,119,32,97,108,108,40,38,65,41,0,72,
-105,100,101,32,97,108,108,40,38,72,41,0,83,104,111,119,
-32,111,110,108,121,32,99,117,114,114,101,110,116,32,108,97,
-121,101,114,40,38,67,41,0,84,111,103,103,108,101,32,99,
-104,101,99,107,101,100,32,108,97,121,101,114,40,38,75,41,
-0,84,111,103,103,108,101,32,108,97,121,101,114,115,32,111,
-116,104,101,114,32,116,104,97,110,32,102,111,108,100,101,114,
-115,40,38,78,41,0,77,111,118,101,32,99,104,101,99,107,
-101,100,32,108,97,121,101,114,32,116,111,32,99,117,114,114,
-101,110,116,32,102,111,108,100,101,114,40,38,77,41,0,67,
-108,111,115,101,32,111,116,104,101,114,32,116,104,97,110,32,
-116,104,101,32,99,117,114,114,101,110,116,32,102,111,108,100,
-101,114,40,38,83,41,0,79,112,101,110,32,97,108,108,40,
-38,79,41,0,82,101,108,101,97,115,101,32,97,108,108,32,
-102,105,108,108,32,114,101,102,101,114,101,110,99,101,115,40,
-38,70,41,0,85,110,108,111,99,107,32,97,108,108,40,38,
-76,41,0,85,110,99,104,101,99,107,32,97,108,108,40,38,
-75,41,0,77,105,110,105,109,105,122,101,40,38,78,41,0,
-83,104,111,119,32,112,97,110,101,108,40,38,86,41,0,80,
-97,110,101,108,40,38,80,41,0,77,105,114,114,111,114,32,
-99,97,110,118,97,115,40,38,81,41,0,83,104,111,119,32,
-98,97,99,107,103,114,111,117,110,100,32,97,115,32,99,104,
-101,99,107,32,112,97,116,116,101,114,110,40,38,75,41,0,
-83,104,111,119,32,103,114,105,100,40,38,71,41,0,83,104,
-111,119,32,100,105,118,105,100,105,110,103,32,108,105,110,101,
-40,38,77,41,0,83,104,111,119,32,82,117,108,101,114,32,
-103,117,105,100,101,40,38,76,41,0,84,111,111,108,98,97,
-114,40,38,84,41,0,83,116,97,116,117,115,32,98,97,114,
-40,38,83,41,0,67,117,114,115,111,114,32,112,111,115,105,
-116,105,111,110,40,38,85,41,0,68,105,115,112,108,97,121,
-32,108,97,121,101,114,32,110,97,109,101,32,119,104,101,110,
-32,111,112,101,114,97,116,105,110,103,32,99,97,110,118,97,
-115,40,38,65,41,0,67,97,110,118,97,115,32,122,111,111,
-109,32,114,97,116,101,40,38,67,41,0,67,97,110,118,97,
-115,32,114,111,116,97,116,101,40,38,82,41,0,68,105,115,
-112,108,97,121,32,99,111,111,114,100,105,110,97,116,101,115,
-32,111,102,32,115,101,108,101,99,116,101,100,32,114,101,99,
-116,97,110,103,108,101,40,38,90,41,0,83,101,116,32,116,
-111,32,97,108,108,32,119,105,110,100,111,119,32,109,111,100,
-101,40,38,77,41,0,65,108,108,32,115,116,111,114,101,100,
-32,105,110,32,112,97,110,101,115,40,38,83,41,0,84,111,
-111,108,40,38,84,41,0,84,111,111,108,32,108,105,115,116,
-40,38,69,41,0,66,114,117,115,104,32,115,101,116,116,105,
-110,103,40,38,66,41,0,79,112,116,105,111,110,40,38,79,
-41,0,76,97,121,101,114,40,38,76,41,0,67,111,108,111,
-114,40,38,67,41,0,67,111,108,111,114,32,119,104,101,101,
-108,40,38,72,41,0,67,111,108,111,114,32,112,97,108,101,
-116,116,101,40,38,80,41,0,67,97,110,118,97,115,32,111,
-112,101,114,97,116,105,111,110,40,38,82,41,0,67,97,110,
-118,97,115,32,118,105,101,119,40,38,87,41,0,73,109,97,
-103,101,32,118,105,101,119,101,114,40,38,73,41,0,70,105,
-108,116,101,114,32,108,105,115,116,40,38,70,41,0,90,111,
-111,109,32,105,110,40,38,85,41,0,90,111,111,109,32,111,
-117,116,40,38,68,41,0,49,48,48,37,40,38,79,41,0,
-70,105,116,32,119,105,110,100,111,119,40,38,70,41,0,111,
-110,101,32,115,116,101,112,32,116,111,32,116,104,101,32,108,
-101,102,116,40,38,76,41,0,111,110,101,32,115,116,101,112,
-32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,82,
-41,0,48,32,100,101,103,114,101,101,0,57,48,32,100,101,
-103,114,101,101,0,49,56,48,32,100,101,103,114,101,101,0,
-50,55,48,32,100,101,103,114,101,101,0,67,111,108,111,114,
-0,67,111,108,111,114,32,114,101,112,108,97,99,101,109,101,
-110,116,0,65,108,112,104,97,40,99,104,101,99,107,101,100,
-32,108,97,121,101,114,41,0,65,108,112,104,97,40,99,117,
-114,114,101,110,116,32,108,97,121,101,114,41,0,66,108,117,
-114,0,80,97,105,110,116,0,70,111,114,32,99,111,109,105,
-99,0,80,105,120,101,108,105,122,97,116,105,111,110,0,79,
-117,116,108,105,110,101,0,69,102,102,101,99,116,0,84,114,
-97,110,115,102,111,114,109,97,116,105,111,110,0,79,116,104,
-101,114,115,0,66,114,105,103,104,116,110,101,115,115,47,67,
-111,110,116,114,97,115,116,46,46,46,0,71,97,109,109,97,
-46,46,46,0,76,101,118,101,108,46,46,46,0,82,71,66,
-32,97,100,106,117,115,116,109,101,110,116,46,46,46,0,72,
-83,86,32,97,100,106,117,115,116,109,101,110,116,46,46,46,
-0,72,83,76,32,97,100,106,117,115,116,109,101,110,116,46,
-46,46,0,78,101,103,97,116,105,118,101,45,112,111,115,105,
-116,105,118,101,32,114,101,118,101,114,115,97,108,0,71,114,
-97,121,115,99,97,108,101,0,83,101,112,105,97,32,99,111,
-108,111,114,0,71,114,97,100,105,101,110,116,32,109,97,112,
-32,40,103,114,97,100,97,116,105,111,110,32,116,111,111,108,
-41,0,84,104,114,101,115,104,111,108,100,105,110,103,46,46,
-46,0,84,104,114,101,115,104,111,108,100,105,110,103,32,40,
-68,105,116,104,101,114,41,46,46,46,0,80,111,115,116,101,
-114,105,122,97,116,105,111,110,46,46,46,0,67,104,97,110,
-103,101,32,100,114,97,119,105,110,103,32,99,111,108,111,114,
-46,46,46,0,67,104,97,110,103,101,32,100,114,97,119,105,
-110,103,32,99,111,108,111,114,32,116,111,32,116,114,97,110,
-115,112,97,114,101,110,116,0,67,104,97,110,103,101,32,101,
-120,99,101,112,116,32,111,102,32,100,114,97,119,105,110,103,
-32,99,111,108,111,114,32,116,111,32,116,114,97,110,115,112,
-97,114,101,110,116,0,67,104,97,110,103,101,32,100,114,97,
-119,105,110,103,32,99,111,108,111,114,32,116,111,32,98,97,
-99,107,103,114,111,117,110,100,0,67,104,97,110,103,101,32,
-116,114,97,110,115,112,97,114,101,110,116,32,116,111,32,100,
-114,97,119,105,110,103,32,99,111,108,111,114,0,40,109,117,
-108,116,105,112,108,101,41,32,97,108,108,32,116,114,97,110,
-115,112,97,114,101,110,99,121,32,112,111,105,110,116,32,116,
-111,32,116,114,97,110,115,112,97,114,101,110,116,0,40,109,
-117,108,116,105,112,108,101,41,32,101,105,116,104,101,114,32,
-111,110,101,32,111,112,97,113,117,101,32,112,111,105,110,116,
-32,116,111,32,116,114,97,110,115,112,97,114,101,110,116,0,
-40,109,117,108,116,105,112,108,101,41,32,97,108,108,32,98,
-108,101,110,100,105,110,103,32,97,110,100,32,99,111,112,121,
-0,40,109,117,108,116,105,112,108,101,41,32,97,100,100,32,
+100,105,110,97,116,101,115,0,0,84,114,97,110,115,112,97,
+114,101,110,116,0,83,105,100,101,32,99,111,108,111,114,0,
+84,104,97,116,32,119,97,121,0,0,66,114,117,115,104,40,
+97,110,116,105,45,97,108,105,97,115,105,110,103,41,0,66,
+114,117,115,104,40,110,111,32,97,110,116,105,45,97,108,105,
+97,115,105,110,103,41,0,49,112,120,32,100,111,116,32,112,
+101,110,0,0,80,97,110,101,108,32,108,97,121,111,117,116,
+32,115,101,116,116,105,110,103,0,80,97,110,101,108,0,80,
+97,110,101,0,80,97,110,101,37,100,0,67,97,110,118,97,
+115,0,84,111,111,108,98,97,114,32,99,117,115,116,111,109,
+105,122,97,116,105,111,110,0,45,45,45,32,83,101,112,97,
+114,97,116,105,111,110,32,45,45,45,0,69,110,118,105,114,
+111,110,109,101,110,116,97,108,32,115,101,116,116,105,110,103,
+0,83,101,116,116,105,110,103,32,49,0,70,108,97,103,115,
+0,66,117,116,116,111,110,32,111,112,101,114,97,116,105,111,
+110,0,73,110,116,101,114,102,97,99,101,0,83,121,115,116,
+101,109,0,67,97,110,118,97,115,32,98,97,99,107,103,114,
+111,117,110,100,32,99,111,108,111,114,0,80,108,97,105,100,
+32,98,97,99,107,103,114,111,117,110,100,32,99,111,108,111,
+114,0,82,117,108,101,114,32,103,117,105,100,101,32,99,111,
+108,111,114,0,68,101,102,97,117,108,116,32,110,117,109,98,
+101,114,32,111,102,32,98,105,116,115,32,119,104,101,110,32,
+114,101,97,100,105,110,103,32,97,110,32,105,109,97,103,101,
+0,77,97,120,105,109,117,109,32,110,117,109,98,101,114,32,
+111,102,32,117,110,100,111,115,32,91,50,45,52,48,48,93,
+0,77,97,120,105,109,117,109,32,117,110,100,111,32,98,117,
+102,102,101,114,32,115,105,122,101,0,79,110,101,32,115,116,
+101,112,32,111,102,32,99,97,110,118,97,115,32,100,105,115,
+112,108,97,121,32,109,97,103,110,105,102,105,99,97,116,105,
+111,110,32,40,97,116,32,49,48,48,37,32,111,114,32,109,
+111,114,101,41,0,79,110,101,32,115,116,101,112,32,111,102,
+32,99,97,110,118,97,115,32,114,111,116,97,116,105,111,110,
+0,87,114,105,116,101,32,104,105,100,100,101,110,32,108,97,
+121,101,114,115,32,116,111,32,97,32,102,105,108,101,32,119,
+104,101,110,32,116,105,108,101,32,109,101,109,111,114,121,32,
+101,120,99,101,101,100,115,32,40,77,66,44,32,48,32,61,
+32,111,102,102,41,0,67,111,110,102,105,114,109,32,119,104,
+101,110,32,111,118,101,114,119,114,105,116,105,110,103,0,67,
+104,101,99,107,32,119,104,101,110,32,111,118,101,114,119,114,
+105,116,105,110,103,32,105,110,32,97,32,102,111,114,109,97,
+116,32,111,116,104,101,114,32,116,104,97,110,32,65,80,68,
+0,68,111,32,110,111,116,32,119,114,105,116,101,32,97,32,
+115,105,110,103,108,101,32,112,105,99,116,117,114,101,32,105,
+109,97,103,101,32,119,104,101,110,32,115,97,118,105,110,103,
+32,65,80,68,0,40,80,97,110,101,108,41,32,70,105,108,
+116,101,114,32,108,105,115,116,32,105,116,101,109,115,32,99,
+97,110,32,98,101,32,101,120,101,99,117,116,101,100,32,98,
+121,32,100,111,117,98,108,101,45,99,108,105,99,107,105,110,
+103,0,87,104,101,110,32,108,111,97,100,105,110,103,32,65,
+80,68,44,32,101,120,112,97,110,100,32,104,105,100,100,101,
+110,32,108,97,121,101,114,32,105,109,97,103,101,115,32,111,
+110,108,121,32,119,104,101,110,32,110,101,101,100,101,100,0,
+78,111,114,109,97,108,32,100,101,118,105,99,101,0,68,101,
+118,105,99,101,115,32,119,105,116,104,32,112,114,101,115,115,
+117,114,101,0,67,111,109,109,97,110,100,32,115,101,108,101,
+99,116,105,111,110,0,71,101,116,32,98,117,116,116,111,110,
+0,66,117,116,116,111,110,0,67,111,109,109,97,110,100,0,
+87,104,101,110,32,121,111,117,32,112,114,101,115,115,32,116,
+104,101,32,98,117,116,116,111,110,32,111,102,32,101,97,99,
+104,32,100,101,118,105,99,101,32,111,110,32,116,104,101,32,
+34,71,101,116,32,66,117,116,116,111,110,34,32,97,114,101,
+97,44,10,116,104,101,32,105,116,101,109,32,111,102,32,116,
+104,97,116,32,98,117,116,116,111,110,32,105,115,32,115,101,
+108,101,99,116,101,100,32,105,110,32,116,104,101,32,108,105,
+115,116,46,0,78,111,116,32,115,112,101,99,105,102,105,101,
+100,32,40,100,101,102,97,117,108,116,32,111,112,101,114,97,
+116,105,111,110,41,0,84,111,111,108,32,111,112,101,114,97,
+116,105,111,110,0,82,101,103,105,115,116,114,97,116,105,111,
+110,32,116,111,111,108,32,111,112,101,114,97,116,105,111,110,
+0,79,116,104,101,114,32,111,112,101,114,97,116,105,111,110,
+0,79,116,104,101,114,32,99,111,109,109,97,110,100,115,0,
+80,97,110,101,108,32,102,111,110,116,32,91,42,93,0,73,
+99,111,110,32,115,105,122,101,32,91,42,93,0,84,111,111,
+108,98,97,114,0,84,111,111,108,0,79,116,104,101,114,0,
+84,111,111,108,98,97,114,32,99,117,115,116,111,109,105,122,
+97,116,105,111,110,0,87,111,114,107,105,110,103,32,100,105,
+114,101,99,116,111,114,121,32,91,42,93,0,85,115,101,114,
+39,115,32,98,114,117,115,104,32,105,109,97,103,101,32,100,
+105,114,101,99,116,111,114,121,0,85,115,101,114,39,115,32,
+116,101,120,116,117,114,101,32,105,109,97,103,101,32,100,105,
+114,101,99,116,111,114,121,0,68,114,97,119,105,110,103,32,
+99,117,114,115,111,114,0,73,109,97,103,101,32,102,105,108,
+101,32,40,116,114,97,110,115,112,97,114,101,110,116,32,111,
+114,32,80,78,71,32,119,105,116,104,32,97,108,112,104,97,
+41,0,67,101,110,116,101,114,32,112,111,115,105,116,105,111,
+110,32,40,116,104,101,32,117,112,112,101,114,32,108,101,102,
+116,32,111,102,32,116,104,101,32,105,109,97,103,101,32,105,
+115,32,40,48,44,48,41,41,0,91,42,93,32,61,32,65,
+112,112,108,121,32,97,116,32,110,101,120,116,32,115,116,97,
+114,116,117,112,0,83,101,116,32,116,104,101,32,119,111,114,
+107,105,110,103,32,100,105,114,101,99,116,111,114,121,32,112,
+97,116,104,32,99,111,114,114,101,99,116,108,121,0,48,58,
+69,114,97,115,101,114,32,111,102,32,116,104,101,32,112,101,
+110,0,49,58,76,101,102,116,32,98,117,116,116,111,110,0,
+50,58,82,105,103,104,116,32,98,117,116,116,111,110,0,51,
+58,77,105,100,100,108,101,32,98,117,116,116,111,110,0,52,
+58,83,99,114,111,108,108,32,117,112,0,53,58,83,99,114,
+111,108,108,32,100,111,119,110,0,54,58,83,99,114,111,108,
+108,32,108,101,102,116,0,55,58,83,99,114,111,108,108,32,
+114,105,103,104,116,0,70,105,108,101,40,38,70,41,0,69,
+100,105,116,40,38,69,41,0,76,97,121,101,114,40,38,76,
+41,0,83,101,108,101,99,116,105,111,110,40,38,83,41,0,
+70,105,108,116,101,114,40,38,84,41,0,86,105,101,119,40,
+38,86,41,0,83,101,116,116,105,110,103,40,38,79,41,0,
+78,101,119,40,38,78,41,46,46,46,0,79,112,101,110,40,
+38,79,41,46,46,46,0,83,97,118,101,40,38,83,41,0,
+83,97,118,101,32,97,115,40,38,87,41,46,46,46,0,83,
+97,118,101,32,100,117,112,108,105,99,97,116,101,40,38,68,
+41,46,46,46,0,82,101,99,101,110,116,108,121,32,117,115,
+101,100,32,102,105,108,101,115,40,38,82,41,0,69,120,105,
+116,40,38,88,41,0,67,108,101,97,114,32,104,105,115,116,
+111,114,121,40,38,67,41,0,85,110,100,111,40,38,90,41,
+0,82,101,100,111,40,38,89,41,0,70,105,108,108,40,38,
+70,41,0,69,114,97,115,101,40,38,69,41,0,67,104,97,
+110,103,101,32,99,97,110,118,97,115,32,115,105,122,101,40,
+38,83,41,46,46,46,0,73,110,116,101,103,114,97,116,101,
+32,105,109,97,103,101,115,32,116,111,32,115,99,97,108,101,
+40,38,82,41,46,46,46,0,73,109,97,103,101,32,115,101,
+116,116,105,110,103,115,40,38,79,41,46,46,46,0,68,114,
+97,119,105,110,103,32,99,111,108,111,114,32,97,115,32,105,
+109,97,103,101,32,98,97,99,107,103,114,111,117,110,100,32,
+99,111,108,111,114,40,38,66,41,0,68,101,115,101,108,101,
+99,116,40,38,68,41,0,83,101,108,101,99,116,32,97,108,
+108,40,38,65,41,0,82,101,118,101,114,115,101,40,38,73,
+41,0,69,120,112,97,110,115,105,111,110,47,82,101,100,117,
+99,116,105,111,110,40,38,69,41,46,46,46,0,67,111,112,
+121,40,38,67,41,0,67,117,116,40,38,88,41,0,80,97,
+115,116,101,32,116,111,32,110,101,119,32,108,97,121,101,114,
+40,38,86,41,0,83,101,108,101,99,116,32,116,104,101,32,
+111,112,97,113,117,101,32,97,114,101,97,32,111,102,32,116,
+104,101,32,108,97,121,101,114,40,38,79,41,0,83,101,108,
+101,99,116,32,116,104,101,32,100,114,97,119,105,110,103,32,
+99,111,108,111,114,32,97,114,101,97,32,111,102,32,116,104,
+101,32,108,97,121,101,114,40,38,76,41,0,79,117,116,112,
+117,116,32,116,104,101,32,105,109,97,103,101,32,105,110,32,
+115,101,108,101,99,116,105,111,110,32,116,111,32,97,32,102,
+105,108,101,40,38,80,41,46,46,46,0,69,110,118,105,114,
+111,110,109,101,110,116,97,108,32,115,101,116,116,105,110,103,
+40,38,69,41,46,46,46,0,71,114,105,100,32,115,101,116,
+116,105,110,103,115,40,38,71,41,46,46,46,0,77,101,110,
+117,32,107,101,121,32,115,101,116,116,105,110,103,115,40,38,
+75,41,46,46,46,0,67,97,110,118,97,115,32,107,101,121,
+32,115,101,116,116,105,110,103,115,40,38,67,41,46,46,46,
+0,80,97,110,101,108,32,108,97,121,111,117,116,32,115,101,
+116,116,105,110,103,40,38,80,41,46,46,46,0,65,98,111,
+117,116,40,38,65,41,46,46,46,0,78,101,119,32,108,97,
+121,101,114,40,38,78,41,46,46,46,0,78,101,119,32,102,
+111,108,100,101,114,40,38,70,41,0,78,101,119,32,108,97,
+121,101,114,32,102,114,111,109,32,102,105,108,101,40,38,73,
+41,46,46,46,0,67,114,101,97,116,101,32,110,101,119,32,
+111,110,32,116,111,112,32,111,102,32,116,104,101,32,99,117,
+114,114,101,110,116,32,108,97,121,101,114,40,38,81,41,46,
+46,46,0,68,117,112,108,105,99,97,116,101,40,38,67,41,
+0,68,101,108,101,116,101,40,38,68,41,0,69,114,97,115,
+101,40,38,88,41,0,77,111,118,101,32,105,109,97,103,101,
+32,100,111,119,110,32,116,111,32,108,97,121,101,114,32,98,
+101,108,111,119,40,38,90,41,0,77,101,114,103,101,32,119,
+105,116,104,32,108,97,121,101,114,32,98,101,108,111,119,40,
+38,66,41,0,77,101,114,103,101,32,118,97,114,105,111,117,
+115,32,108,97,121,101,114,115,40,38,87,41,46,46,46,0,
+77,101,114,103,101,32,97,108,108,40,38,77,41,0,68,105,
+115,112,108,97,121,32,116,111,110,101,32,108,97,121,101,114,
+32,105,110,32,103,114,97,121,115,99,97,108,101,40,38,84,
+41,0,79,117,116,112,117,116,32,116,111,32,102,105,108,101,
+40,38,83,41,46,46,46,0,83,101,116,116,105,110,103,115,
+40,38,79,41,0,66,97,116,99,104,32,99,111,110,118,101,
+114,115,105,111,110,40,38,65,41,0,69,100,105,116,40,38,
+69,41,0,86,105,101,119,40,38,86,41,0,70,111,108,100,
+101,114,40,38,74,41,0,70,108,97,103,115,40,38,71,41,
+0,76,97,121,101,114,32,115,101,116,116,105,110,103,115,40,
+38,79,41,46,46,46,0,67,104,97,110,103,101,32,108,97,
+121,101,114,32,116,121,112,101,40,38,84,41,46,46,46,0,
+67,104,97,110,103,101,32,108,105,110,101,32,99,111,108,111,
+114,40,38,67,41,46,46,46,0,78,117,109,98,101,114,32,
+111,102,32,116,111,110,101,32,108,105,110,101,115,40,38,76,
+41,46,46,46,0,70,108,105,112,32,104,111,114,105,122,111,
+110,116,97,108,40,38,72,41,0,70,108,105,112,32,117,112,
+115,105,100,101,32,100,111,119,110,40,38,86,41,0,82,111,
+116,97,116,101,32,57,48,32,100,101,103,114,101,101,115,32,
+116,111,32,116,104,101,32,108,101,102,116,40,38,76,41,0,
+82,111,116,97,116,101,32,57,48,32,100,101,103,114,101,101,
+115,32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,
+82,41,0,83,104,111,119,32,97,108,108,40,38,65,41,0,
+72,105,100,101,32,97,108,108,40,38,72,41,0,83,104,111,
+119,32,111,110,108,121,32,99,117,114,114,101,110,116,32,108,
+97,121,101,114,40,38,67,41,0,84,111,103,103,108,101,32,
+99,104,101,99,107,101,100,32,108,97,121,101,114,40,38,75,
+41,0,84,111,103,103,108,101,32,108,97,121,101,114,115,32,
+111,116,104,101,114,32,116,104,97,110,32,102,111,108,100,101,
+114,115,40,38,78,41,0,77,111,118,101,32,99,104,101,99,
+107,101,100,32,108,97,121,101,114,32,116,111,32,99,117,114,
+114,101,110,116,32,102,111,108,100,101,114,40,38,77,41,0,
+67,108,111,115,101,32,111,116,104,101,114,32,116,104,97,110,
+32,116,104,101,32,99,117,114,114,101,110,116,32,102,111,108,
+100,101,114,40,38,83,41,0,79,112,101,110,32,97,108,108,
+40,38,79,41,0,82,101,108,101,97,115,101,32,97,108,108,
+32,102,105,108,108,32,114,101,102,101,114,101,110,99,101,115,
+40,38,70,41,0,85,110,108,111,99,107,32,97,108,108,40,
+38,76,41,0,85,110,99,104,101,99,107,32,97,108,108,40,
+38,75,41,0,77,105,110,105,109,105,122,101,40,38,78,41,
+0,83,104,111,119,32,112,97,110,101,108,40,38,86,41,0,
+80,97,110,101,108,40,38,80,41,0,77,105,114,114,111,114,
+32,99,97,110,118,97,115,40,38,81,41,0,83,104,111,119,
+32,98,97,99,107,103,114,111,117,110,100,32,97,115,32,99,
+104,101,99,107,32,112,97,116,116,101,114,110,40,38,75,41,
+0,83,104,111,119,32,103,114,105,100,40,38,71,41,0,83,
+104,111,119,32,100,105,118,105,100,105,110,103,32,108,105,110,
+101,40,38,77,41,0,83,104,111,119,32,82,117,108,101,114,
+32,103,117,105,100,101,40,38,76,41,0,84,111,111,108,98,
+97,114,40,38,84,41,0,83,116,97,116,117,115,32,98,97,
+114,40,38,83,41,0,67,117,114,115,111,114,32,112,111,115,
+105,116,105,111,110,40,38,85,41,0,68,105,115,112,108,97,
+121,32,108,97,121,101,114,32,110,97,109,101,32,119,104,101,
+110,32,111,112,101,114,97,116,105,110,103,32,99,97,110,118,
+97,115,40,38,65,41,0,67,97,110,118,97,115,32,122,111,
+111,109,32,114,97,116,101,40,38,67,41,0,67,97,110,118,
+97,115,32,114,111,116,97,116,101,40,38,82,41,0,68,105,
+115,112,108,97,121,32,99,111,111,114,100,105,110,97,116,101,
+115,32,111,102,32,115,101,108,101,99,116,101,100,32,114,101,
+99,116,97,110,103,108,101,40,38,90,41,0,83,101,116,32,
+116,111,32,97,108,108,32,119,105,110,100,111,119,32,109,111,
+100,101,40,38,77,41,0,65,108,108,32,115,116,111,114,101,
+100,32,105,110,32,112,97,110,101,115,40,38,83,41,0,84,
+111,111,108,40,38,84,41,0,84,111,111,108,32,108,105,115,
+116,40,38,69,41,0,66,114,117,115,104,32,115,101,116,116,
+105,110,103,40,38,66,41,0,79,112,116,105,111,110,40,38,
+79,41,0,76,97,121,101,114,40,38,76,41,0,67,111,108,
+111,114,40,38,67,41,0,67,111,108,111,114,32,119,104,101,
+101,108,40,38,72,41,0,67,111,108,111,114,32,112,97,108,
+101,116,116,101,40,38,80,41,0,67,97,110,118,97,115,32,
+111,112,101,114,97,116,105,111,110,40,38,82,41,0,67,97,
+110,118,97,115,32,118,105,101,119,40,38,87,41,0,73,109,
+97,103,101,32,118,105,101,119,101,114,40,38,73,41,0,70,
+105,108,116,101,114,32,108,105,115,116,40,38,70,41,0,90,
+111,111,109,32,105,110,40,38,85,41,0,90,111,111,109,32,
+111,117,116,40,38,68,41,0,49,48,48,37,40,38,79,41,
+0,70,105,116,32,119,105,110,100,111,119,40,38,70,41,0,
+111,110,101,32,115,116,101,112,32,116,111,32,116,104,101,32,
+108,101,102,116,40,38,76,41,0,111,110,101,32,115,116,101,
+112,32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,
+82,41,0,48,32,100,101,103,114,101,101,0,57,48,32,100,
+101,103,114,101,101,0,49,56,48,32,100,101,103,114,101,101,
+0,50,55,48,32,100,101,103,114,101,101,0,67,111,108,111,
+114,0,67,111,108,111,114,32,114,101,112,108,97,99,101,109,
+101,110,116,0,65,108,112,104,97,40,99,104,101,99,107,101,
+100,32,108,97,121,101,114,41,0,65,108,112,104,97,40,99,
+117,114,114,101,110,116,32,108,97,121,101,114,41,0,66,108,
+117,114,0,80,97,105,110,116,0,70,111,114,32,99,111,109,
+105,99,0,80,105,120,101,108,105,122,97,116,105,111,110,0,
+79,117,116,108,105,110,101,0,69,102,102,101,99,116,0,84,
+114,97,110,115,102,111,114,109,97,116,105,111,110,0,79,116,
+104,101,114,115,0,66,114,105,103,104,116,110,101,115,115,47,
+67,111,110,116,114,97,115,116,46,46,46,0,71,97,109,109,
+97,46,46,46,0,76,101,118,101,108,46,46,46,0,82,71,
+66,32,97,100,106,117,115,116,109,101,110,116,46,46,46,0,
+72,83,86,32,97,100,106,117,115,116,109,101,110,116,46,46,
+46,0,72,83,76,32,97,100,106,117,115,116,109,101,110,116,
+46,46,46,0,78,101,103,97,116,105,118,101,45,112,111,115,
+105,116,105,118,101,32,114,101,118,101,114,115,97,108,0,71,
+114,97,121,115,99,97,108,101,0,83,101,112,105,97,32,99,
+111,108,111,114,0,71,114,97,100,105,101,110,116,32,109,97,
+112,32,40,103,114,97,100,97,116,105,111,110,32,116,111,111,
+108,41,0,84,104,114,101,115,104,111,108,100,105,110,103,46,
+46,46,0,84,104,114,101,115,104,111,108,100,105,110,103,32,
+40,68,105,116,104,101,114,41,46,46,46,0,80,111,115,116,
+101,114,105,122,97,116,105,111,110,46,46,46,0,67,104,97,
+110,103,101,32,100,114,97,119,105,110,103,32,99,111,108,111,
+114,46,46,46,0,67,104,97,110,103,101,32,100,114,97,119,
+105,110,103,32,99,111,108,111,114,32,116,111,32,116,114,97,
+110,115,112,97,114,101,110,116,0,67,104,97,110,103,101,32,
+101,120,99,101,112,116,32,111,102,32,100,114,97,119,105,110,
+103,32,99,111,108,111,114,32,116,111,32,116,114,97,110,115,
+112,97,114,101,110,116,0,67,104,97,110,103,101,32,100,114,
+97,119,105,110,103,32,99,111,108,111,114,32,116,111,32,98,
+97,99,107,103,114,111,117,110,100,0,67,104,97,110,103,101,
+32,116,114,97,110,115,112,97,114,101,110,116,32,116,111,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,0,40,109,
+117,108,116,105,112,108,101,41,32,97,108,108,32,116,114,97,
+110,115,112,97,114,101,110,99,121,32,112,111,105,110,116,32,
+116,111,32,116,114,97,110,115,112,97,114,101,110,116,0,40,
+109,117,108,116,105,112,108,101,41,32,101,105,116,104,101,114,
+32,111,110,101,32,111,112,97,113,117,101,32,112,111,105,110,
+116,32,116,111,32,116,114,97,110,115,112,97,114,101,110,116,
+0,40,109,117,108,116,105,112,108,101,41,32,97,108,108,32,
+98,108,101,110,100,105,110,103,32,97,110,100,32,99,111,112,
+121,0,40,109,117,108,116,105,112,108,101,41,32,97,100,100,
+32,97,108,108,32,118,97,108,117,101,115,0,40,109,117,108,
+116,105,112,108,101,41,32,115,117,98,116,114,97,99,116,32,
 97,108,108,32,118,97,108,117,101,115,0,40,109,117,108,116,
-105,112,108,101,41,32,115,117,98,116,114,97,99,116,32,97,
-108,108,32,118,97,108,117,101,115,0,40,109,117,108,116,105,
-112,108,101,41,32,109,117,108,116,105,112,108,121,32,97,108,
-108,32,118,97,108,117,101,115,0,40,115,105,110,103,108,101,
-41,32,115,101,116,32,114,101,118,101,114,115,101,32,98,114,
-105,103,104,116,110,101,115,115,32,111,102,32,99,104,101,99,
-107,101,100,32,108,97,121,101,114,0,40,115,105,110,103,108,
-101,41,32,115,101,116,32,98,114,105,103,104,116,110,101,115,
-115,32,111,102,32,99,104,101,99,107,101,100,32,108,97,121,
-101,114,0,83,101,116,32,98,114,105,103,104,116,110,101,115,
-115,32,114,101,118,101,114,115,101,100,0,83,101,116,32,102,
-114,111,109,32,98,114,105,103,104,116,110,101,115,115,0,65,
-108,108,32,111,112,97,113,117,101,32,116,111,32,109,97,120,
-32,111,112,97,113,117,101,0,84,101,120,116,117,114,101,32,
-97,112,112,108,105,99,97,116,105,111,110,0,67,114,101,97,
-116,101,32,103,114,97,121,115,99,97,108,101,32,102,114,111,
-109,32,97,108,112,104,97,32,118,97,108,117,101,0,66,108,
-117,114,46,46,46,0,71,97,117,115,115,32,98,108,117,114,
-46,46,46,0,77,111,116,105,111,110,32,98,108,117,114,46,
-46,46,0,82,97,100,105,97,108,32,98,108,117,114,46,46,
-46,0,76,101,110,115,32,98,108,117,114,46,46,46,0,67,
-108,111,117,100,115,46,46,46,0,68,111,116,32,112,97,116,
-116,101,114,110,46,46,46,0,82,97,110,100,111,109,32,112,
-111,105,110,116,32,100,114,97,119,46,46,46,0,68,114,97,
-119,32,112,111,105,110,116,115,32,97,108,111,110,103,32,116,
-104,101,32,114,105,109,46,46,46,0,66,111,114,100,101,114,
-46,46,46,0,72,111,114,105,122,111,110,116,97,108,32,97,
-110,100,32,118,101,114,116,105,99,97,108,32,108,105,110,101,
-115,46,46,46,0,80,108,97,105,100,46,46,46,0,68,111,
-116,32,112,97,116,116,101,114,110,32,103,101,110,101,114,97,
-116,105,111,110,46,46,46,0,84,111,32,100,111,116,32,112,
-97,116,116,101,114,110,46,46,46,0,84,111,32,115,97,110,
-100,32,116,111,110,101,46,46,46,0,67,111,110,99,101,110,
-116,114,97,116,105,111,110,32,108,105,110,101,46,46,46,0,
-70,108,97,115,104,32,40,114,105,110,103,32,111,102,32,102,
-105,114,101,41,46,46,46,0,83,111,108,105,100,32,102,108,
-97,115,104,32,40,115,117,110,41,46,46,46,0,85,110,105,
-32,102,108,97,115,104,46,46,46,0,85,110,105,32,102,108,
-97,115,104,32,40,119,97,118,101,41,46,46,46,0,77,111,
-115,97,105,99,46,46,46,0,67,114,121,115,116,97,108,46,
-46,46,0,72,97,108,102,32,116,111,110,101,46,46,46,0,
-83,104,97,114,112,46,46,46,0,85,110,115,104,97,114,112,
-32,109,97,115,107,46,46,46,0,67,111,110,116,111,117,114,
-32,101,120,116,114,97,99,116,105,111,110,32,40,83,111,98,
-101,108,41,0,67,111,110,116,111,117,114,32,101,120,116,114,
-97,99,116,105,111,110,32,40,76,97,112,108,97,99,105,97,
-110,41,0,72,105,103,104,45,112,97,115,115,46,46,46,0,
-71,108,111,119,46,46,46,0,82,71,66,32,111,102,102,115,
-101,116,46,46,46,0,79,105,108,32,112,97,105,110,116,105,
-110,103,46,46,46,0,69,109,98,111,115,115,46,46,46,0,
-78,111,105,115,101,46,46,46,0,69,102,102,117,115,105,111,
-110,46,46,46,0,83,99,114,97,116,99,104,46,46,46,0,
-77,101,100,105,97,110,46,46,46,0,66,108,117,114,46,46,
-46,0,87,97,118,101,46,46,46,0,82,105,112,112,108,101,
-46,46,46,0,80,111,108,97,114,32,99,111,111,114,100,105,
-110,97,116,101,115,46,46,46,0,82,97,100,105,97,108,32,
-111,102,102,115,101,116,46,46,46,0,83,112,105,114,97,108,
-46,46,46,0,69,120,116,114,97,99,116,105,111,110,32,111,
-102,32,108,105,110,101,32,100,114,97,119,105,110,103,0,49,
-112,120,32,100,111,116,32,108,105,110,101,32,99,111,114,114,
-101,99,116,105,111,110,0,65,110,116,105,45,97,108,105,97,
-115,105,110,103,46,46,46,0,69,100,103,105,110,103,46,46,
-46,0,84,104,114,101,101,45,100,105,109,101,110,115,105,111,
-110,97,108,32,102,114,97,109,101,46,46,46,0,83,104,105,
-102,116,46,46,46,0,67,111,110,102,105,114,109,0,68,101,
-108,101,116,101,46,10,84,104,105,115,32,112,114,111,99,101,
-115,115,32,105,115,32,105,114,114,101,118,101,114,115,105,98,
-108,101,46,32,73,115,32,105,116,32,79,75,63,0,70,97,
-105,108,101,100,32,116,111,32,114,101,97,100,0,70,97,105,
-108,101,100,32,116,111,32,115,97,118,101,0,84,104,101,32,
-102,105,108,101,32,100,111,101,115,32,110,111,116,32,101,120,
-105,115,116,46,10,68,101,108,101,116,101,32,102,114,111,109,
-32,104,105,115,116,111,114,121,46,0,70,97,105,108,101,100,
-32,116,111,32,99,114,101,97,116,101,32,116,104,101,32,119,
-111,114,107,105,110,103,32,100,105,114,101,99,116,111,114,121,
-46,10,85,110,100,111,32,100,111,101,115,32,110,111,116,32,
-119,111,114,107,32,112,114,111,112,101,114,108,121,46,0,68,
-111,32,121,111,117,32,119,97,110,116,32,116,111,32,111,118,
-101,114,119,114,105,116,101,32,105,116,63,0,73,32,97,109,
-32,116,114,121,105,110,103,32,116,111,32,111,118,101,114,119,
-114,105,116,101,32,97,110,100,32,115,97,118,101,32,105,110,
-32,97,32,102,111,114,109,97,116,32,111,116,104,101,114,32,
-116,104,97,110,32,65,80,68,46,10,68,111,32,121,111,117,
-32,119,97,110,116,32,116,111,32,111,118,101,114,119,114,105,
-116,101,32,97,110,100,32,115,97,118,101,32,97,115,32,105,
-116,32,105,115,63,0,84,104,101,32,105,109,97,103,101,32,
-104,97,115,32,99,104,97,110,103,101,100,46,10,68,111,32,
-121,111,117,32,119,97,110,116,32,116,111,32,115,97,118,101,
-32,105,116,63,0,84,104,101,32,111,108,100,32,118,101,114,
-115,105,111,110,32,111,102,32,116,104,101,32,115,101,116,116,
-105,110,103,115,32,100,105,114,101,99,116,111,114,121,32,101,
-120,105,115,116,115,46,10,68,111,32,121,111,117,32,119,97,
-110,116,32,116,111,32,99,111,110,118,101,114,116,32,116,104,
-101,32,118,101,114,32,50,32,99,111,110,102,105,103,117,114,
-97,116,105,111,110,32,102,105,108,101,63,10,40,66,114,117,
-115,104,47,67,111,108,111,114,32,112,97,108,101,116,116,101,
-47,71,114,97,100,105,101,110,116,32,111,110,108,121,41,0,
-78,111,32,116,101,120,116,32,105,115,32,97,100,100,101,100,
-32,98,101,99,97,117,115,101,32,116,104,101,114,101,32,105,
-115,32,110,111,32,100,114,97,119,105,110,103,32,114,97,110,
-103,101,0,65,112,112,108,121,105,110,103,32,97,32,102,105,
-108,116,101,114,32,104,97,115,32,110,111,32,101,102,102,101,
-99,116,10,97,115,32,116,104,101,114,101,32,97,114,101,32,
-110,111,32,99,111,108,111,114,32,118,97,108,117,101,115,32,
-105,110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,
-97,121,101,114,0,80,108,101,97,115,101,32,115,101,116,32,
-97,32,99,104,101,99,107,32,102,111,114,32,116,104,101,32,
-116,97,114,103,101,116,32,108,97,121,101,114,0,83,101,116,
-32,116,104,101,32,116,101,120,116,117,114,101,32,105,110,32,
-116,104,101,32,111,112,116,105,111,110,115,32,112,97,110,101,
-108,0,69,114,114,111,114,0,70,97,105,108,101,100,32,116,
-111,32,97,108,108,111,99,97,116,101,32,109,101,109,111,114,
-121,0,73,109,97,103,101,32,115,105,122,101,32,101,120,99,
-101,101,100,115,32,108,105,109,105,116,0,85,110,115,117,112,
-112,111,114,116,101,100,32,102,111,114,109,97,116,0,84,104,
-101,32,102,105,108,101,32,105,115,32,99,111,114,114,117,112,
-116,101,100,0,73,102,32,116,104,101,32,71,73,70,32,101,
-120,99,101,101,100,115,32,50,53,54,32,99,111,108,111,114,
-115,44,32,105,116,32,99,97,110,110,111,116,32,98,101,32,
-115,97,118,101,100,0,87,69,66,80,32,99,97,110,110,111,
-116,32,115,116,111,114,101,32,115,105,122,101,115,32,108,97,
-114,103,101,114,32,116,104,97,110,32,49,54,51,56,51,32,
-112,120,0,84,104,101,32,99,117,114,114,101,110,116,32,108,
-97,121,101,114,32,105,115,32,97,32,102,111,108,100,101,114,
-0,84,104,101,32,99,117,114,114,101,110,116,32,108,97,121,
-101,114,32,105,115,32,97,32,116,101,120,116,32,108,97,121,
-101,114,0,76,97,121,101,114,32,105,115,32,100,114,97,119,
-105,110,103,32,108,111,99,107,101,100,0,84,104,101,32,99,
-117,114,114,101,110,116,32,108,97,121,101,114,32,105,115,32,
-104,105,100,100,101,110,0,67,97,110,110,111,116,32,100,114,
-97,119,32,119,104,105,108,101,32,112,97,115,116,105,110,103,
-32,97,110,100,32,109,111,118,105,110,103,0,79,75,0,67,
+105,112,108,101,41,32,109,117,108,116,105,112,108,121,32,97,
+108,108,32,118,97,108,117,101,115,0,40,115,105,110,103,108,
+101,41,32,115,101,116,32,114,101,118,101,114,115,101,32,98,
+114,105,103,104,116,110,101,115,115,32,111,102,32,99,104,101,
+99,107,101,100,32,108,97,121,101,114,0,40,115,105,110,103,
+108,101,41,32,115,101,116,32,98,114,105,103,104,116,110,101,
+115,115,32,111,102,32,99,104,101,99,107,101,100,32,108,97,
+121,101,114,0,83,101,116,32,98,114,105,103,104,116,110,101,
+115,115,32,114,101,118,101,114,115,101,100,0,83,101,116,32,
+102,114,111,109,32,98,114,105,103,104,116,110,101,115,115,0,
+65,108,108,32,111,112,97,113,117,101,32,116,111,32,109,97,
+120,32,111,112,97,113,117,101,0,84,101,120,116,117,114,101,
+32,97,112,112,108,105,99,97,116,105,111,110,0,67,114,101,
+97,116,101,32,103,114,97,121,115,99,97,108,101,32,102,114,
+111,109,32,97,108,112,104,97,32,118,97,108,117,101,0,66,
+108,117,114,46,46,46,0,71,97,117,115,115,32,98,108,117,
+114,46,46,46,0,77,111,116,105,111,110,32,98,108,117,114,
+46,46,46,0,82,97,100,105,97,108,32,98,108,117,114,46,
+46,46,0,76,101,110,115,32,98,108,117,114,46,46,46,0,
+67,108,111,117,100,115,46,46,46,0,68,111,116,32,112,97,
+116,116,101,114,110,46,46,46,0,82,97,110,100,111,109,32,
+112,111,105,110,116,32,100,114,97,119,46,46,46,0,68,114,
+97,119,32,112,111,105,110,116,115,32,97,108,111,110,103,32,
+116,104,101,32,114,105,109,46,46,46,0,66,111,114,100,101,
+114,46,46,46,0,72,111,114,105,122,111,110,116,97,108,32,
+97,110,100,32,118,101,114,116,105,99,97,108,32,108,105,110,
+101,115,46,46,46,0,80,108,97,105,100,46,46,46,0,68,
+111,116,32,112,97,116,116,101,114,110,32,103,101,110,101,114,
+97,116,105,111,110,46,46,46,0,84,111,32,100,111,116,32,
+112,97,116,116,101,114,110,46,46,46,0,84,111,32,115,97,
+110,100,32,116,111,110,101,46,46,46,0,67,111,110,99,101,
+110,116,114,97,116,105,111,110,32,108,105,110,101,46,46,46,
+0,70,108,97,115,104,32,40,114,105,110,103,32,111,102,32,
+102,105,114,101,41,46,46,46,0,83,111,108,105,100,32,102,
+108,97,115,104,32,40,115,117,110,41,46,46,46,0,85,110,
+105,32,102,108,97,115,104,46,46,46,0,85,110,105,32,102,
+108,97,115,104,32,40,119,97,118,101,41,46,46,46,0,77,
+111,115,97,105,99,46,46,46,0,67,114,121,115,116,97,108,
+46,46,46,0,72,97,108,102,32,116,111,110,101,46,46,46,
+0,83,104,97,114,112,46,46,46,0,85,110,115,104,97,114,
+112,32,109,97,115,107,46,46,46,0,67,111,110,116,111,117,
+114,32,101,120,116,114,97,99,116,105,111,110,32,40,83,111,
+98,101,108,41,0,67,111,110,116,111,117,114,32,101,120,116,
+114,97,99,116,105,111,110,32,40,76,97,112,108,97,99,105,
+97,110,41,0,72,105,103,104,45,112,97,115,115,46,46,46,
+0,71,108,111,119,46,46,46,0,82,71,66,32,111,102,102,
+115,101,116,46,46,46,0,79,105,108,32,112,97,105,110,116,
+105,110,103,46,46,46,0,69,109,98,111,115,115,46,46,46,
+0,78,111,105,115,101,46,46,46,0,69,102,102,117,115,105,
+111,110,46,46,46,0,83,99,114,97,116,99,104,46,46,46,
+0,77,101,100,105,97,110,46,46,46,0,66,108,117,114,46,
+46,46,0,87,97,118,101,46,46,46,0,82,105,112,112,108,
+101,46,46,46,0,80,111,108,97,114,32,99,111,111,114,100,
+105,110,97,116,101,115,46,46,46,0,82,97,100,105,97,108,
+32,111,102,102,115,101,116,46,46,46,0,83,112,105,114,97,
+108,46,46,46,0,69,120,116,114,97,99,116,105,111,110,32,
+111,102,32,108,105,110,101,32,100,114,97,119,105,110,103,0,
+49,112,120,32,100,111,116,32,108,105,110,101,32,99,111,114,
+114,101,99,116,105,111,110,0,65,110,116,105,45,97,108,105,
+97,115,105,110,103,46,46,46,0,69,100,103,105,110,103,46,
+46,46,0,84,104,114,101,101,45,100,105,109,101,110,115,105,
+111,110,97,108,32,102,114,97,109,101,46,46,46,0,83,104,
+105,102,116,46,46,46,0,67,111,110,102,105,114,109,0,68,
+101,108,101,116,101,46,10,84,104,105,115,32,112,114,111,99,
+101,115,115,32,105,115,32,105,114,114,101,118,101,114,115,105,
+98,108,101,46,32,73,115,32,105,116,32,79,75,63,0,70,
+97,105,108,101,100,32,116,111,32,114,101,97,100,0,70,97,
+105,108,101,100,32,116,111,32,115,97,118,101,0,84,104,101,
+32,102,105,108,101,32,100,111,101,115,32,110,111,116,32,101,
+120,105,115,116,46,10,68,101,108,101,116,101,32,102,114,111,
+109,32,104,105,115,116,111,114,121,46,0,70,97,105,108,101,
+100,32,116,111,32,99,114,101,97,116,101,32,116,104,101,32,
+119,111,114,107,105,110,103,32,100,105,114,101,99,116,111,114,
+121,46,10,85,110,100,111,32,100,111,101,115,32,110,111,116,
+32,119,111,114,107,32,112,114,111,112,101,114,108,121,46,0,
+68,111,32,121,111,117,32,119,97,110,116,32,116,111,32,111,
+118,101,114,119,114,105,116,101,32,105,116,63,0,73,32,97,
+109,32,116,114,121,105,110,103,32,116,111,32,111,118,101,114,
+119,114,105,116,101,32,97,110,100,32,115,97,118,101,32,105,
+110,32,97,32,102,111,114,109,97,116,32,111,116,104,101,114,
+32,116,104,97,110,32,65,80,68,46,10,68,111,32,121,111,
+117,32,119,97,110,116,32,116,111,32,111,118,101,114,119,114,
+105,116,101,32,97,110,100,32,115,97,118,101,32,97,115,32,
+105,116,32,105,115,63,0,84,104,101,32,105,109,97,103,101,
+32,104,97,115,32,99,104,97,110,103,101,100,46,10,68,111,
+32,121,111,117,32,119,97,110,116,32,116,111,32,115,97,118,
+101,32,105,116,63,0,84,104,101,32,111,108,100,32,118,101,
+114,115,105,111,110,32,111,102,32,116,104,101,32,115,101,116,
+116,105,110,103,115,32,100,105,114,101,99,116,111,114,121,32,
+101,120,105,115,116,115,46,10,68,111,32,121,111,117,32,119,
+97,110,116,32,116,111,32,99,111,110,118,101,114,116,32,116,
+104,101,32,118,101,114,32,50,32,99,111,110,102,105,103,117,
+114,97,116,105,111,110,32,102,105,108,101,63,10,40,66,114,
+117,115,104,47,67,111,108,111,114,32,112,97,108,101,116,116,
+101,47,71,114,97,100,105,101,110,116,32,111,110,108,121,41,
+0,78,111,32,116,101,120,116,32,105,115,32,97,100,100,101,
+100,32,98,101,99,97,117,115,101,32,116,104,101,114,101,32,
+105,115,32,110,111,32,100,114,97,119,105,110,103,32,114,97,
+110,103,101,0,65,112,112,108,121,105,110,103,32,97,32,102,
+105,108,116,101,114,32,104,97,115,32,110,111,32,101,102,102,
+101,99,116,10,97,115,32,116,104,101,114,101,32,97,114,101,
+32,110,111,32,99,111,108,111,114,32,118,97,108,117,101,115,
+32,105,110,32,116,104,101,32,99,117,114,114,101,110,116,32,
+108,97,121,101,114,0,80,108,101,97,115,101,32,115,101,116,
+32,97,32,99,104,101,99,107,32,102,111,114,32,116,104,101,
+32,116,97,114,103,101,116,32,108,97,121,101,114,0,83,101,
+116,32,116,104,101,32,116,101,120,116,117,114,101,32,105,110,
+32,116,104,101,32,111,112,116,105,111,110,115,32,112,97,110,
+101,108,0,69,114,114,111,114,0,70,97,105,108,101,100,32,
+116,111,32,97,108,108,111,99,97,116,101,32,109,101,109,111,
+114,121,0,73,109,97,103,101,32,115,105,122,101,32,101,120,
+99,101,101,100,115,32,108,105,109,105,116,0,85,110,115,117,
+112,112,111,114,116,101,100,32,102,111,114,109,97,116,0,84,
+104,101,32,102,105,108,101,32,105,115,32,99,111,114,114,117,
+112,116,101,100,0,73,102,32,116,104,101,32,71,73,70,32,
+101,120,99,101,101,100,115,32,50,53,54,32,99,111,108,111,
+114,115,44,32,105,116,32,99,97,110,110,111,116,32,98,101,
+32,115,97,118,101,100,0,87,69,66,80,32,99,97,110,110,
+111,116,32,115,116,111,114,101,32,115,105,122,101,115,32,108,
+97,114,103,101,114,32,116,104,97,110,32,49,54,51,56,51,
+32,112,120,0,84,104,101,32,99,117,114,114,101,110,116,32,
+108,97,121,101,114,32,105,115,32,97,32,102,111,108,100,101,
+114,0,84,104,101,32,99,117,114,114,101,110,116,32,108,97,
+121,101,114,32,105,115,32,97,32,116,101,120,116,32,108,97,
+121,101,114,0,76,97,121,101,114,32,105,115,32,100,114,97,
+119,105,110,103,32,108,111,99,107,101,100,0,84,104,101,32,
+99,117,114,114,101,110,116,32,108,97,121,101,114,32,105,115,
+32,104,105,100,100,101,110,0,67,97,110,110,111,116,32,100,
+114,97,119,32,119,104,105,108,101,32,112,97,115,116,105,110,
+103,32,97,110,100,32,109,111,118,105,110,103,0,70,97,105,
+108,101,100,32,116,111,32,108,111,97,100,32,116,104,101,32,
+108,97,121,101,114,32,105,109,97,103,101,0,79,75,0,67,
 97,110,99,101,108,0,89,101,115,0,78,111,0,83,97,118,
 101,0,68,111,110,39,116,32,83,97,118,101,0,65,98,111,
 114,116,0,68,111,110,39,116,32,115,104,111,119,32,116,104,
@@ -21,9 +21,13 @@ $*/
  * AppDraw: イメージ関連
  *****************************************/
 
+#include <math.h>
+
 #include "mlk_gui.h"
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
+#include "mlk_list.h"
+#include "mlk_thread.h"
 
 #include "def_macro.h"
 #include "def_config.h"
@@ -32,6 +36,7 @@ $*/
 
 #include "imagecanvas.h"
 #include "imagematerial.h"
+#include "def_tileimage.h"
 #include "tileimage.h"
 #include "layerlist.h"
 #include "layeritem.h"
@@ -264,9 +269,16 @@ mlkbool drawImage_newCanvas(AppDraw *p,NewCanvasValue *val)
 mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog)
 {
 	int bits;
+	mlkerr ret = MLKERR_OK;
 
 	bits = (p->imgbits == 8)? 16: 8;
 
+	//未展開のイメージを展開
+	// :展開されないまま変換すると、後で元のビット数のデータが展開される
+
+	if(prog && !LayerList_loadPendingImage_all(p->layerlist))
+		return MLKERR_ALLOC;
+
 	//キャンバスイメージ
 	// :失敗時は元に戻す
 
@@ -289,7 +301,8 @@ mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog)
 
 		mPopupProgressThreadSetMax(prog, LayerList_getNormalLayerNum(p->layerlist) * 5);
 
-		LayerList_convertImageBits(p->layerlist, bits, prog);
+		if(!LayerList_convertImageBits(p->layerlist, bits, prog))
+			ret = MLKERR_ALLOC;
 	}
 
 	//トーン化テーブル
@@ -302,7 +315,7 @@ mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog)
 
 	TileImage_global_setImageBits(p->imgbits);
 
-	return MLKERR_OK;
+	return ret;
 }
 
 /* スレッド */
@@ -418,6 +431,11 @@ mlkbool drawImage_resizeCanvas(AppDraw *p,int w,int h,int movx,int movy,int fcro
 	sw = p->imgw;
 	sh = p->imgh;
 
+	//切り取る場合、未展開のイメージを展開
+
+	if(fcrop && !LayerList_loadPendingImage_all(p->layerlist))
+		return FALSE;
+
 	//サイズ変更
 
 	if(!drawImage_changeImageSize(p, w, h))
@@ -513,6 +531,11 @@ mlkbool drawImage_scaleCanvas(AppDraw *p,int w,int h,int dpi,int method)
 	LayerItem *item;
 	int ret;
 
+	//すべてのレイヤがクリアされるので、未展開のイメージを展開
+
+	if(!LayerList_loadPendingImage_all(p->layerlist))
+		return FALSE;
+
 	//統合後のイメージを作成
 
 	img = TileImage_new(TILEIMAGE_COLTYPE_RGBA, w, h);
@@ -580,14 +603,329 @@ mlkbool drawImage_scaleCanvas(AppDraw *p,int w,int h,int dpi,int method)
 
 
 
+//============================
+// レイヤを維持して拡大縮小
+//============================
+
+
+//同時に処理するレイヤの作業用メモリの上限 (目安)
+#define _SCALE_LAYER_MEMSIZE  ((int64_t)512 * 1024 * 1024)
+
+typedef struct
+{
+	LayerItem **items;	//処理するレイヤ
+	TileImage **imgs;	//拡大縮小後のイメージ
+	mPopupProgress *prog;
+	int num,
+		srcw,srch,w,h,
+		method,bits,
+		resize_thread;	//1レイヤのリサイズで使うスレッド数
+}_thdata_scalelayer;
+
+
+/* [スレッド] 1つのレイヤを拡大縮小 */
+
+static int _scale_layer_job(int no,void *param)
+{
+	_thdata_scalelayer *p = (_thdata_scalelayer *)param;
+	LayerItem *item;
+	ImageCanvas *canvas;
+	TileImage *img;
+
+	item = p->items[no];
+
+	//キャンバス範囲を RGBA で取得 (アルファ値乗算済み)
+
+	canvas = ImageCanvas_new(p->srcw, p->srch, p->bits);
+	if(!canvas) return 1;
+
+	TileImage_getCanvasImage_premult(item->img, canvas);
+
+	//リサイズ (元イメージは解放される)
+
+	canvas = ImageCanvas_resize_rgba(canvas, p->w, p->h, p->method, NULL, 0, p->resize_thread);
+	if(!canvas) return 1;
+
+	//元のカラータイプでセット
+
+	img = TileImage_new(item->img->type, p->w, p->h);
+
+	if(img && !TileImage_setCanvasImage_premult(img, canvas))
+	{
+		TileImage_free(img);
+		img = NULL;
+	}
+
+	ImageCanvas_free(canvas);
+
+	if(!img) return 1;
+
+	p->imgs[no] = img;
+
+	mPopupProgressThreadIncPos(p->prog);
+
+	return 0;
+}
+
+/* [スレッド] 各レイヤを並列で処理
+ *
+ * 同時に処理するレイヤ数は、作業用メモリの量で制限する。 */
+
+static int _thread_scale_layer(mPopupProgress *prog,void *data)
+{
+	_thdata_scalelayer *p = (_thdata_scalelayer *)data;
+	int64_t size;
+	int maxnum;
+
+	p->prog = prog;
+
+	mPopupProgressThreadSetMax(prog, p->num);
+
+	//1レイヤあたりの作業用サイズ (元イメージ + 水平リサイズ後 + 結果)
+
+	size = ((int64_t)p->srcw * p->srch + (int64_t)p->w * p->srch + (int64_t)p->w * p->h)
+		* 4 * (p->bits / 8);
+
+	maxnum = _SCALE_LAYER_MEMSIZE / size;
+	if(maxnum > p->num) maxnum = p->num;
+	if(maxnum < 1) maxnum = 1;
+
+	//同時に処理するレイヤ数が少ない場合は、リサイズ自体を並列化する
+
+	p->resize_thread = mThreadGetProcessorNum() / maxnum;
+	if(p->resize_thread < 1) p->resize_thread = 1;
+
+	return mThreadRunParallel_max(p->num, maxnum, _scale_layer_job, p);
+}
+
+/* テキストの各サイズを拡大縮小
+ *
+ * pt 単位の値は、拡大縮小前後の DPI の違いも考慮する。
+ * % 単位の値は、フォントサイズに対する値なので、そのまま。
+ *
+ * scale: 倍率
+ * srcdpi: 拡大縮小前のイメージの DPI */
+
+static void _scale_text_size(AppDraw *p,DrawTextData *dt,double scale,int srcdpi)
+{
+	double dpt;
+
+	//pt 単位の倍率
+
+	if(dt->flags & DRAWTEXT_F_ENABLE_DPI)
+		dpt = scale;
+	else
+		dpt = scale * srcdpi / p->imgdpi;
+
+	//フォントサイズ
+
+	if(dt->unit_fontsize == DRAWTEXT_UNIT_FONTSIZE_PT)
+		dt->fontsize = (int)(dt->fontsize * dpt + 0.5);
+	else
+		dt->fontsize = (int)(dt->fontsize * scale + 0.5);
+
+	if(dt->fontsize < 1) dt->fontsize = 1;
+
+	//ルビサイズ
+
+	if(dt->unit_rubysize == DRAWTEXT_UNIT_RUBYSIZE_PT)
+		dt->rubysize = (int)(dt->rubysize * dpt + 0.5);
+	else if(dt->unit_rubysize == DRAWTEXT_UNIT_RUBYSIZE_PX)
+		dt->rubysize = (int)(dt->rubysize * scale + 0.5);
+
+	if(dt->rubysize < 1) dt->rubysize = 1;
+
+	//字間、行間、ルビ位置 (px 単位時)
+
+	if(dt->unit_char_space)
+		dt->char_space = (int)floor(dt->char_space * scale + 0.5);
+
+	if(dt->unit_line_space)
+		dt->line_space = (int)floor(dt->line_space * scale + 0.5);
+
+	if(dt->unit_ruby_pos)
+		dt->ruby_pos = (int)floor(dt->ruby_pos * scale + 0.5);
+}
+
+/* テキストレイヤを、新しいサイズと DPI で再描画
+ *
+ * 位置と各サイズを変換する。
+ * 縦横の倍率が異なる場合、文字のサイズは縦横の倍率の相乗平均で変換する。 */
+
+static void _scale_text_layers(AppDraw *p,double scalex,double scaley,int srcdpi)
+{
+	LayerItem *pi;
+	LayerTextItem *ti,*next;
+	TileImage *img;
+	DrawTextData dt;
+	mPoint pt;
+	mRect rc;
+	double scale;
+
+	scale = sqrt(scalex * scaley);
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = LayerItem_getNext(pi))
+	{
+		if(!LAYERITEM_IS_TEXT(pi)) continue;
+
+		img = TileImage_new(pi->img->type, p->imgw, p->imgh);
+		if(!img) continue;
+
+		LayerItem_replaceImage(pi, img, -1);
+		LayerItem_setLayerColor(pi, pi->col);
+
+		//変換して描画
+
+		for(ti = (LayerTextItem *)pi->list_text.top; ti; ti = next)
+		{
+			next = (LayerTextItem *)ti->i.next;
+
+			mMemset0(&dt, sizeof(DrawTextData));
+
+			LayerTextItem_getDrawData(ti, &dt);
+
+			_scale_text_size(p, &dt, scale, srcdpi);
+
+			pt.x = (int)floor(ti->x * scalex + 0.5);
+			pt.y = (int)floor(ti->y * scaley + 0.5);
+			rc = ti->rcdraw;
+
+			ti = LayerItem_replaceText(pi, ti, &dt, &pt, &rc);
+
+			if(ti)
+				drawText_drawLayerText(p, ti, pi->img, &ti->rcdraw);
+
+			DrawTextData_free(&dt);
+		}
+	}
+}
+
+/** レイヤを維持して拡大縮小
+ *
+ * 各レイヤのキャンバス範囲のイメージを、それぞれ拡大縮小する。
+ * テキストレイヤは、新しいサイズと DPI で再描画する。 */
+
+mlkbool drawImage_scaleCanvas_layer(AppDraw *p,int w,int h,int dpi,int method)
+{
+	_thdata_scalelayer dat;
+	LayerItem *pi;
+	ImageCanvas *canvas;
+	double scalex,scaley;
+	int i,num,srcdpi;
+
+	//未展開のイメージを展開
+
+	if(!LayerList_loadPendingImage_all(p->layerlist))
+		return FALSE;
+
+	//対象レイヤ数 (テキストレイヤ以外のイメージ)
+
+	num = 0;
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = LayerItem_getNext(pi))
+	{
+		if(LAYERITEM_IS_IMAGE(pi) && !LAYERITEM_IS_TEXT(pi))
+			num++;
+	}
+
+	//データ
+
+	mMemset0(&dat, sizeof(_thdata_scalelayer));
+
+	if(num)
+	{
+		dat.items = (LayerItem **)mMalloc0(sizeof(void *) * num * 2);
+		if(!dat.items) return FALSE;
+
+		dat.imgs = (TileImage **)(dat.items + num);
+	}
+
+	num = 0;
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = LayerItem_getNext(pi))
+	{
+		if(LAYERITEM_IS_IMAGE(pi) && !LAYERITEM_IS_TEXT(pi))
+			dat.items[num++] = pi;
+	}
+
+	dat.num = num;
+	dat.srcw = p->imgw;
+	dat.srch = p->imgh;
+	dat.w = w;
+	dat.h = h;
+	dat.method = method;
+	dat.bits = p->imgbits;
+
+	//新しいキャンバスイメージ
+
+	canvas = ImageCanvas_new(w, h, p->imgbits);
+
+	//スレッド
+
+	if(!canvas
+		|| (num && PopupThread_run(&dat, _thread_scale_layer)))
+	{
+		for(i = 0; i < num; i++)
+			TileImage_free(dat.imgs[i]);
+
+		mFree(dat.items);
+		ImageCanvas_free(canvas);
+		
+		return FALSE;
+	}
+
+	//undo
+
+	Undo_addScaleCanvas_layer();
+
+	//イメージ置き換え
+
+	for(i = 0; i < num; i++)
+	{
+		pi = dat.items[i];
+
+		LayerItem_replaceImage(pi, dat.imgs[i], -1);
+		LayerItem_setLayerColor(pi, pi->col);
+	}
+
+	mFree(dat.items);
+
+	//サイズ変更
+
+	scalex = (double)w / p->imgw;
+	scaley = (double)h / p->imgh;
+	srcdpi = p->imgdpi;
+
+	ImageCanvas_free(p->imgcanvas);
+	p->imgcanvas = canvas;
+
+	p->imgw = w;
+	p->imgh = h;
+
+	_change_imagesize(p);
+
+	//DPI 変更
+
+	if(dpi != -1)
+		drawImage_changeDPI(p, dpi);
+
+	//テキストレイヤ
+
+	_scale_text_layers(p, scalex, scaley, srcdpi);
+
+	return TRUE;
+}
+
 //=============================
 // レイヤ合成イメージ
 //=============================
 
 
-/* 変換テーブルを作成 (16bit 時) */
+/** 変換テーブルを作成 (16bit 時)
+ *
+ * 8bit イメージ時は、どちらも NULL となる。 */
 
-static mlkbool _create_colconv_table(int dstbits,uint8_t **ppdst8,uint16_t **ppdst16)
+mlkbool drawImage_createColConvTable(int dstbits,uint8_t **ppdst8,uint16_t **ppdst16)
 {
 	*ppdst8 = NULL;
 	*ppdst16 = NULL;
@@ -609,60 +947,49 @@ static mlkbool _create_colconv_table(int dstbits,uint8_t **ppdst8,uint16_t **ppd
 	return TRUE;
 }
 
-/** アルファなしでレイヤ合成 (現在のビット値で) */
+/* 指定範囲のレイヤを合成 (現在のビット値で)
+ *
+ * dst: box の範囲のバッファがあること */
 
-void drawImage_blendImageReal_curbits(AppDraw *p,mPopupProgress *prog,int stepnum)
+static void _blend_layers_box(AppDraw *p,ImageCanvas *dst,const mBox *box,mPopupProgress *prog)
 {
 	LayerItem *pi;
-	mBox box;
 	TileImageBlendSrcInfo info;
 
-	box.x = box.y = 0;
-	box.w = p->imgw, box.h = p->imgh;
-
 	//背景色でクリア
 
-	ImageCanvas_fill(p->imgcanvas, &p->imgbkcol);
+	ImageCanvas_fillBox(dst, box, &p->imgbkcol);
 
 	//レイヤ合成
 
-	mPopupProgressThreadSubStep_begin(prog, stepnum, LayerList_getBlendLayerNum(p->layerlist));
-
 	pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
 
 	for(; pi; pi = LayerItem_getPrevVisibleImage(pi))
 	{
 		drawUpdate_setCanvasBlendInfo(pi, &info);
 
-		TileImage_blendToCanvas(pi->img, p->imgcanvas, &box, &info);
+		TileImage_blendToCanvas(pi->img, dst, box, &info);
 
 		mPopupProgressThreadSubStep_inc(prog);
 	}
 }
 
-/** アルファ無しで合成 (画像保存用)
+/* 合成後のイメージを、保存用のアルファなしイメージに変換
  *
- * R,G,B 順で、アルファ値はない。 */
+ * R,G,B 順で、アルファ値を詰める。 */
 
-mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+static void _convert_rows_normal(AppDraw *p,uint8_t **ppbuf,int height,int dstbits,
+	uint8_t *table8,uint16_t *table16)
 {
-	uint8_t **ppbuf,*pd,*ps,*table8;
-	uint16_t *table16,*ps16,*pd16;
+	uint8_t *pd,*ps;
+	uint16_t *ps16,*pd16;
 	int ix,iy,i;
 
-	//現在のビット値で合成
-	
-	drawImage_blendImageReal_curbits(p, prog, stepnum);
-
-	//変換
-
-	ppbuf = p->imgcanvas->ppbuf;
-
 	if(p->imgbits == 8)
 	{
 		//----- 8bit: アルファ値を詰める
 
-		for(iy = p->imgh; iy; iy--)
+		for(iy = height; iy; iy--)
 		{
 			pd = *(ppbuf++);
 			ps = pd;
@@ -679,10 +1006,7 @@ mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *pr
 	{
 		//---- 16bit: 値を変換 & アルファ値詰める
 
-		if(!_create_colconv_table(dstbits, &table8, &table16))
-			return MLKERR_ALLOC;
-
-		for(iy = p->imgh; iy; iy--)
+		for(iy = height; iy; iy--)
 		{
 			pd = *(ppbuf++);
 			pd16 = (uint16_t *)pd;
@@ -706,139 +1030,142 @@ mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *pr
 				}
 			}
 		}
-
-		mFree(table8);
-		mFree(table16);
 	}
-
-	return MLKERR_OK;
 }
 
-/** アルファ付きで合成
- *
- * - 合成モードはすべて「通常」とする。
- * - トーンレイヤはトーン処理なし。
- *
- * dstbits: 出力ビット数 */
+/* アルファ付きで Y1行を合成 */
 
-mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+static void _blend_row_alpha(AppDraw *p,int iy,uint8_t *pd,int dstbits,
+	uint8_t *table8,uint16_t *table16,TileImagePixelColorFunc func_blend)
 {
 	LayerItem *pi;
-	uint8_t **ppbuf,*pd,*table8;
-	uint16_t *pd16,*ps16,*table16;
-	int w,h,ix,iy,i,bits,a;
+	uint16_t *pd16,*ps16;
+	int ix,i,bits,a;
 	uint64_t colres,colsrc;
-	TileImagePixelColorFunc func_blend;
 
-	ppbuf = p->imgcanvas->ppbuf;
-	w = p->imgw;
-	h = p->imgh;
 	bits = p->imgbits;
 
-	func_blend = TileImage_global_getPixelColorFunc(TILEIMAGE_PIXELCOL_NORMAL);
-
-	//変換テーブル
+	for(ix = 0; ix < p->imgw; ix++)
+	{
+		colres = 0;
 
-	if(!_create_colconv_table(dstbits, &table8, &table16))
-		return MLKERR_ALLOC;
+		//各レイヤ合成
 
-	//
+		pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
 
-	mPopupProgressThreadSubStep_begin(prog, stepnum, h);
-
-	for(iy = 0; iy < h; iy++)
-	{
-		pd = *(ppbuf++);
-		
-		for(ix = 0; ix < w; ix++)
+		for( ; pi; pi = LayerItem_getPrevVisibleImage(pi))
 		{
-			colres = 0;
-
-			//各レイヤ合成
+			TileImage_getPixel(pi->img, ix, iy, &colsrc);
 
-			pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
+			if(bits == 8)
+				a = *((uint8_t *)&colsrc + 3);
+			else
+				a = *((uint16_t *)&colsrc + 3);
 
-			for( ; pi; pi = LayerItem_getPrevVisibleImage(pi))
+			if(a)
 			{
-				TileImage_getPixel(pi->img, ix, iy, &colsrc);
+				//テクスチャ
+				
+				if(pi->img_texture)
+					a = a * ImageMaterial_getPixel_forTexture(pi->img_texture, ix, iy) / 255;
 
-				if(bits == 8)
-					a = *((uint8_t *)&colsrc + 3);
-				else
-					a = *((uint16_t *)&colsrc + 3);
+				//レイヤ不透明度
+
+				a = a * LayerItem_getOpacity_real(pi) >> 7;
+
+				//アルファ合成 (res + src -> res)
 
 				if(a)
 				{
-					//テクスチャ
-					
-					if(pi->img_texture)
-						a = a * ImageMaterial_getPixel_forTexture(pi->img_texture, ix, iy) / 255;
-
-					//レイヤ不透明度
-
-					a = a * LayerItem_getOpacity_real(pi) >> 7;
-
-					//アルファ合成 (res + src -> res)
-
-					if(a)
-					{
-						if(bits == 8)
-							*((uint8_t *)&colsrc + 3) = a;
-						else
-							*((uint16_t *)&colsrc + 3) = a;
-					
-						(func_blend)(pi->img, &colres, &colsrc, NULL);
-					}
+					if(bits == 8)
+						*((uint8_t *)&colsrc + 3) = a;
+					else
+						*((uint16_t *)&colsrc + 3) = a;
+				
+					(func_blend)(pi->img, &colres, &colsrc, NULL);
 				}
 			}
+		}
 
-			//セット
+		//セット
 
-			if(bits == 8)
-			{
-				//8bit は常に 8bit
+		if(bits == 8)
+		{
+			//8bit は常に 8bit
 
-				*((uint32_t *)pd) = *((uint32_t *)&colres);
+			*((uint32_t *)pd) = *((uint32_t *)&colres);
 
-				pd += 4;
-			}
-			else if(dstbits == 8)
-			{
-				//16bit -> 8bit
-
-				if(colres == 0)
-					*((uint32_t *)pd) = 0;
-				else
-				{
-					ps16 = (uint16_t *)&colres;
-					
-					for(i = 0; i < 4; i++)
-						pd[i] = table8[ps16[i]];
-				}
+			pd += 4;
+		}
+		else if(dstbits == 8)
+		{
+			//16bit -> 8bit
 
-				pd += 4;
-			}
-			else if(dstbits == 16)
+			if(colres == 0)
+				*((uint32_t *)pd) = 0;
+			else
 			{
-				//16bit(fix15bit) -> 16bit
+				ps16 = (uint16_t *)&colres;
+				
+				for(i = 0; i < 4; i++)
+					pd[i] = table8[ps16[i]];
+			}
 
-				if(colres == 0)
-					*((uint64_t *)pd) = 0;
-				else
-				{
-					pd16 = (uint16_t *)pd;
-					ps16 = (uint16_t *)&colres;
+			pd += 4;
+		}
+		else if(dstbits == 16)
+		{
+			//16bit(fix15bit) -> 16bit
 
-					for(i = 0; i < 4; i++)
-						pd16[i] = table16[ps16[i]];
-				}
+			if(colres == 0)
+				*((uint64_t *)pd) = 0;
+			else
+			{
+				pd16 = (uint16_t *)pd;
+				ps16 = (uint16_t *)&colres;
 
-				pd += 8;
+				for(i = 0; i < 4; i++)
+					pd16[i] = table16[ps16[i]];
 			}
-		}
 
-		mPopupProgressThreadSubStep_inc(prog);
+			pd += 8;
+		}
 	}
+}
+
+/** アルファなしでレイヤ合成 (現在のビット値で) */
+
+void drawImage_blendImageReal_curbits(AppDraw *p,mPopupProgress *prog,int stepnum)
+{
+	mBox box;
+
+	box.x = box.y = 0;
+	box.w = p->imgw, box.h = p->imgh;
+
+	mPopupProgressThreadSubStep_begin(prog, stepnum, LayerList_getBlendLayerNum(p->layerlist));
+
+	_blend_layers_box(p, p->imgcanvas, &box, prog);
+}
+
+/** アルファ無しで合成 (画像保存用)
+ *
+ * R,G,B 順で、アルファ値はない。 */
+
+mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+{
+	uint8_t *table8;
+	uint16_t *table16;
+
+	//現在のビット値で合成
+	
+	drawImage_blendImageReal_curbits(p, prog, stepnum);
+
+	//変換
+
+	if(!drawImage_createColConvTable(dstbits, &table8, &table16))
+		return MLKERR_ALLOC;
+
+	_convert_rows_normal(p, p->imgcanvas->ppbuf, p->imgh, dstbits, table8, table16);
 
 	mFree(table8);
 	mFree(table16);
@@ -846,3 +1173,46 @@ mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *pro
 	return MLKERR_OK;
 }
 
+/** Y帯単位で合成 (画像保存用)
+ *
+ * dst のY帯の位置を y にセットし、その範囲を合成して保存用のイメージに変換する。
+ * キャンバスイメージ (imgcanvas) は使わない。
+ *
+ * dst: ImageCanvas_newStrip() で作成したイメージ
+ * y: Y帯の先頭位置
+ * falpha: TRUE でアルファ付き。
+ *  合成モードはすべて「通常」とし、トーンレイヤはトーン処理なし。
+ *  FALSE でアルファなし (drawImage_blendImageReal_normal と同じ)
+ * table8,table16: drawImage_createColConvTable() で作成したテーブル */
+
+void drawImage_blendImageReal_strip(AppDraw *p,ImageCanvas *dst,int y,int dstbits,
+	mlkbool falpha,uint8_t *table8,uint16_t *table16)
+{
+	mBox box;
+	int i;
+	TileImagePixelColorFunc func_blend;
+
+	ImageCanvas_setStripPos(dst, y);
+
+	box.x = 0;
+	box.y = y;
+	box.w = p->imgw;
+	box.h = p->imgh - y;
+
+	if(box.h > dst->strip_height) box.h = dst->strip_height;
+
+	if(falpha)
+	{
+		func_blend = TileImage_global_getPixelColorFunc(TILEIMAGE_PIXELCOL_NORMAL);
+
+		for(i = 0; i < box.h; i++)
+			_blend_row_alpha(p, y + i, dst->ppbuf[y + i], dstbits, table8, table16, func_blend);
+	}
+	else
+	{
+		_blend_layers_box(p, dst, &box, NULL);
+
+		_convert_rows_normal(p, dst->ppbuf + y, box.h, dstbits, table8, table16);
+	}
+}
+
@@ -43,6 +43,7 @@ $*/
 #include "imagecanvas.h"
 #include "undo.h"
 #include "apd_v4_format.h"
+#include "layerswap.h"
 
 #include "draw_main.h"
 
@@ -557,6 +558,12 @@ void drawLayer_editImage_full(AppDraw *p,int type)
 	if(!LayerItem_isHave_editImageFull(p->curlayer))
 		return;
 
+	//下位の未展開のイメージを展開
+	// :アンドゥ時は、すべてのレイヤが処理済みとして扱われるため、先に展開しておく。
+
+	if(!LayerItem_loadPendingImage_tree(p->curlayer))
+		return;
+
 	//
 
 	Undo_addLayerEditFull(type);
@@ -593,9 +600,30 @@ typedef struct
 static int _thread_combine(mPopupProgress *prog,void *data)
 {
 	_thdata_combine *p = (_thdata_combine *)data;
+	TileImageCombineInfo info;
+	TileImageBlendSrcInfo dstinfo;
+
+	info.img = p->item_src->img;
+	info.rc = p->rcarea;
+	info.opacity_dst = p->opacity_dst;
+
+	drawUpdate_setCanvasBlendInfo(p->item_src, &info.blend);
+
+	info.blend.opacity = p->item_src->opacity;
+
+	//結合先がトーン化される場合、結合元のトーン化は行わない。
+	//結合先にテクスチャがある場合、結合元のテクスチャは適用しない。
+	// :結合後のイメージに、結合先のトーン化/テクスチャが適用されるため。
+
+	drawUpdate_setCanvasBlendInfo(p->item_dst, &dstinfo);
+
+	if(dstinfo.tone_lines)
+		info.blend.tone_lines = 0;
 
-	TileImage_combine(p->item_dst->img, p->item_src->img, &p->rcarea,
-		p->item_src->opacity, p->opacity_dst, p->item_src->blendmode, prog);
+	if(dstinfo.img_texture)
+		info.blend.img_texture = NULL;
+
+	TileImage_combine(p->item_dst->img, &info, 1, prog);
 
 	return 1;
 }
@@ -624,6 +652,8 @@ void drawLayer_combine(AppDraw *p,mlkbool drop)
 		if(!LayerItem_isEnableUnderCombine(item_src)) return;
 	}
 
+	if(!LayerItem_loadPendingImage(item_dst)) return;
+
 	//イメージ範囲
 
 	TileImage_getHaveImageRect_pixel(item_src->img, &rcsrc, NULL);
@@ -707,32 +737,45 @@ static int _thread_combine_multi(mPopupProgress *prog,void *data)
 {
 	_thdata_combinemulti *p = (_thdata_combinemulti *)data;
 	LayerItem *pi;
-	int num;
-	mRect rc;
+	TileImageCombineInfo *buf,*pinfo;
+	int num,ret;
 
 	//結合レイヤ数
 
 	for(pi = p->topitem, num = 0; pi; pi = pi->link, num++);
 
-	mPopupProgressThreadSetMax(prog, num);
+	//結合元の情報
+	// :イメージがないレイヤは除外。
 
-	//結合
+	buf = (TileImageCombineInfo *)mMalloc(sizeof(TileImageCombineInfo) * num);
+	if(!buf) return -1;
+
+	pinfo = buf;
 
 	for(pi = p->topitem; pi; pi = pi->link)
 	{
-		if(TileImage_getHaveImageRect_pixel(pi->img, &rc, NULL))
+		if(TileImage_getHaveImageRect_pixel(pi->img, &pinfo->rc, NULL))
 		{
-			TileImage_combine(p->imgdst, pi->img, &rc,
-				LayerItem_getOpacity_real(pi), LAYERITEM_OPACITY_MAX,
-				pi->blendmode, NULL);
+			pinfo->img = pi->img;
+			pinfo->opacity_dst = LAYERITEM_OPACITY_MAX;
 
-			mRectUnion(&p->rcupdate, &rc);
-		}
+			drawUpdate_setCanvasBlendInfo(pi, &pinfo->blend);
 
-		mPopupProgressThreadIncPos(prog);
+			mRectUnion(&p->rcupdate, &pinfo->rc);
+
+			pinfo++;
+		}
 	}
 
-	return 1;
+	//結合 (タイルごとに、すべてのレイヤをまとめて処理)
+
+	mPopupProgressThreadSetMax(prog, 20);
+
+	ret = TileImage_combine(p->imgdst, buf, pinfo - buf, prog);
+
+	mFree(buf);
+
+	return (ret)? 1: -1;
 }
 
 /** 複数レイヤ結合 */
@@ -749,6 +792,18 @@ void drawLayer_combineMulti(AppDraw *p,int target,mlkbool newlayer,int type)
 
 	top = LayerList_setLink_combineMulti(p->layerlist, target, p->curlayer);
 
+	//未展開のイメージを展開 (非表示のチェックレイヤ)
+	// :すべてのレイヤをクリアする場合は、すべて展開しておく。
+
+	for(pi = top; pi; pi = pi->link)
+	{
+		if(!LayerItem_loadPendingImage(pi)) return;
+	}
+
+	if(target == 0 && !newlayer
+		&& !LayerList_loadPendingImage_all(p->layerlist))
+		return;
+
 	//結合用イメージ作成
 
 	img = TileImage_new(type, 1, 1);
@@ -873,6 +928,10 @@ void drawLayer_blendAll(AppDraw *p)
 	TileImage *img;
 	LayerItem *item;
 	int ret;
+
+	//すべてのレイヤがクリアされるので、未展開のイメージを展開
+
+	if(!LayerList_loadPendingImage_all(p->layerlist)) return;
 	
 	//統合後のイメージを作成
 
@@ -941,6 +1000,8 @@ mlkbool drawLayer_setCurrent(AppDraw *p,LayerItem *item)
 
 		p->curlayer = item;
 
+		LayerItem_loadPendingImage(item);
+
 		PanelLayer_update_layer(last);
 		PanelLayer_update_curlayer(TRUE);
 
@@ -1027,10 +1088,15 @@ void drawLayer_toggle_visible(AppDraw *p,LayerItem *item)
 		item->flags ^= LAYERITEM_F_VISIBLE;
 
 		drawUpdateRect_canvas_canvasview(p, &rc);
+
+		LayerSwap_check();
 	}
 	else
 	{
 		//非表示 => 表示
+		// :未展開 (遅延読み込み/スワップ) のイメージは空のため、範囲を取得する前に展開する。
+
+		LayerItem_loadPendingImage(item);
 
 		item->flags ^= LAYERITEM_F_VISIBLE;
 
@@ -1075,6 +1141,8 @@ void drawLayer_setLayerMask(AppDraw *p,LayerItem *item,int type)
 				if(p->masklayer) update_item = p->masklayer;
 				
 				p->masklayer = item;
+
+				LayerItem_loadPendingImage(item);
 			}
 			break;
 
@@ -94,6 +94,11 @@ mlkerr drawFile_save_apd_v4(AppDraw *p,const char *filename,mPopupProgress *prog
 		if(ret) goto ERR;
 	}
 
+	//タイルインデックス
+
+	ret = apd4save_writeChunk_tileindex(save);
+	if(ret) goto ERR;
+
 	//終了
 
 	ret = apd4save_writeChunk_end(save);
@@ -152,7 +157,7 @@ mlkerr drawFile_load_apd_v4(AppDraw *p,const char *filename,mPopupProgress *prog
 
 	//レイヤ
 
-	ret = apd4load_readLayers(load);
+	ret = apd4load_readLayers(load, ((APPCONF->foption & CONFIG_OPTF_LOAD_APD_LAZY) != 0));
 
 	//
 ERR:
@@ -31,6 +31,7 @@ $*/
 #include "mlk_list.h"
 #include "mlk_rectbox.h"
 #include "mlk_imagebuf.h"
+#include "mlk_thread.h"
 
 #include "def_macro.h"
 #include "def_config.h"
@@ -81,7 +82,9 @@ static const uint32_t g_blendmode[] = {
 //******************************
 
 
-/* レイヤ読み込み: チャンネルイメージ全体の読み込み */
+/* レイヤ読み込み: チャンネルイメージ全体の読み込み
+ *
+ * 行単位で並列に展開される。 */
 
 static mlkerr _load_layer_image_channel(mPSDLoad *psd,int layerno,int chid,
 	mBox *boximg,uint8_t **ppimg,mPopupProgress *prog)
@@ -89,9 +92,9 @@ static mlkerr _load_layer_image_channel(mPSDLoad *psd,int layerno,int chid,
 	int iy,n;
 	mlkerr ret;
 
-	//開始
+	//読み込み
 
-	ret = mPSDLoad_setLayerImageCh_id(psd, layerno, chid, NULL);
+	ret = mPSDLoad_readLayerImageCh_parallel(psd, layerno, chid, ppimg);
 
 	if(ret == -2)
 	{
@@ -114,17 +117,7 @@ static mlkerr _load_layer_image_channel(mPSDLoad *psd,int layerno,int chid,
 	else if(ret)
 		return ret;
 
-	//読み込み
-
-	mPopupProgressThreadSubStep_begin(prog, 10, boximg->h);
-
-	for(iy = boximg->h; iy; iy--, ppimg++)
-	{
-		ret = mPSDLoad_readLayerImageRowCh(psd, *ppimg);
-		if(ret) return ret;
-
-		mPopupProgressThreadSubStep_inc(prog);
-	}
+	mPopupProgressThreadAddPos(prog, 10);
 
 	return MLKERR_OK;
 }
@@ -900,6 +893,12 @@ static mlkerr _write_layer_info(AppDraw *p,mPSDSave *psd)
 			info.blendmode = g_blendmode[pi->blendmode];
 			info.param = pi;
 
+			if(!LayerItem_loadPendingImage(pi))
+			{
+				mPSDSave_exinfo_freeList(&list);
+				return MLKERR_ALLOC;
+			}
+
 			if(TileImage_getHaveImageRect_pixel(pi->img, &rc, NULL))
 				mBoxSetRect(&info.box_img, &rc);
 		}
@@ -916,92 +915,80 @@ static mlkerr _write_layer_info(AppDraw *p,mPSDSave *psd)
 	return mPSDSave_writeLayerInfo(psd);
 }
 
-/* レイヤイメージ書き込み (8bit->8bit) */
+/* レイヤイメージのチャンネル取得用データ */
 
-static mlkerr _write_layer_image_8bit(mPSDSave *psd,TileImage *img,uint8_t *rowbuf,int ch,mRect *rcsrc)
+typedef struct
 {
+	TileImage *img;
+	uint8_t **ppbuf;	//ppbuf[0] が Y = ytop の行
 	mRect rc;
-	int ix,iy;
-	mlkerr ret;
-	uint8_t *pd,col[4];
-
-	rc = *rcsrc;
-
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		pd = rowbuf;
-		
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			TileImage_getPixel(img, ix, iy, col);
+	int ch,
+		srcbits,
+		dstbits,
+		ytop,yend;	//バッファに取得する Y 範囲 (yend は含まない)
+}_getchdata;
 
-			*(pd++) = col[ch];
-		}
-
-		ret = mPSDSave_writeLayerImageRowCh(psd, rowbuf);
-		if(ret) return ret;
-	}
+#define _GETCH_ROWS  32	//1ジョブあたりの行数
 
-	return MLKERR_OK;
-}
 
-/* レイヤイメージ書き込み (16bit->8bit) */
+/* レイヤイメージのチャンネルをバッファに取得 (並列ジョブ) */
 
-static mlkerr _write_layer_image_16to8bit(mPSDSave *psd,TileImage *img,uint8_t *rowbuf,int ch,mRect *rcsrc)
+static int _get_layer_channel_job(int no,void *param)
 {
-	mRect rc;
-	int ix,iy;
-	mlkerr ret;
-	uint8_t *pd;
-	uint16_t col[4];
+	_getchdata *dat = (_getchdata *)param;
+	TileImage *img;
+	uint8_t *pd8,col8[4];
+	uint16_t *pd16,col16[4];
+	int ix,iy,yend,ch;
 
-	rc = *rcsrc;
+	img = dat->img;
+	ch = dat->ch;
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		pd = rowbuf;
-		
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			TileImage_getPixel(img, ix, iy, col);
+	iy = dat->ytop + no * _GETCH_ROWS;
+	yend = iy + _GETCH_ROWS;
+	if(yend > dat->yend) yend = dat->yend;
 
-			*(pd++) = (int)((double)col[ch] / 0x8000 * 255 + 0.5);
-		}
-
-		ret = mPSDSave_writeLayerImageRowCh(psd, rowbuf);
-		if(ret) return ret;
-	}
+	for(; iy < yend; iy++)
+	{
+		pd8 = dat->ppbuf[iy - dat->ytop];
+		pd16 = (uint16_t *)pd8;
 
-	return MLKERR_OK;
-}
+		if(dat->srcbits == 8)
+		{
+			//8bit->8bit
 
-/* レイヤイメージ書き込み (16bit(fix15)->16bit) */
+			for(ix = dat->rc.x1; ix <= dat->rc.x2; ix++)
+			{
+				TileImage_getPixel(img, ix, iy, col8);
 
-static mlkerr _write_layer_image_16bit(mPSDSave *psd,TileImage *img,uint8_t *rowbuf,int ch,mRect *rcsrc)
-{
-	mRect rc;
-	int ix,iy;
-	mlkerr ret;
-	uint16_t *pd,col[4];
+				*(pd8++) = col8[ch];
+			}
+		}
+		else if(dat->dstbits == 8)
+		{
+			//16bit->8bit
 
-	rc = *rcsrc;
+			for(ix = dat->rc.x1; ix <= dat->rc.x2; ix++)
+			{
+				TileImage_getPixel(img, ix, iy, col16);
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		pd = (uint16_t *)rowbuf;
-		
-		for(ix = rc.x1; ix <= rc.x2; ix++)
+				*(pd8++) = (int)((double)col16[ch] / 0x8000 * 255 + 0.5);
+			}
+		}
+		else
 		{
-			TileImage_getPixel(img, ix, iy, col);
+			//16bit(fix15)->16bit
 
-			*(pd++) = (int)((double)col[ch] / 0x8000 * 0xffff + 0.5);
-		}
+			for(ix = dat->rc.x1; ix <= dat->rc.x2; ix++)
+			{
+				TileImage_getPixel(img, ix, iy, col16);
 
-		ret = mPSDSave_writeLayerImageRowCh(psd, rowbuf);
-		if(ret) return ret;
+				*(pd16++) = (int)((double)col16[ch] / 0x8000 * 0xffff + 0.5);
+			}
+		}
 	}
 
-	return MLKERR_OK;
+	return 0;
 }
 
 /* レイヤ出力 (RGBA) */
@@ -1009,11 +996,11 @@ static mlkerr _write_layer_image_16bit(mPSDSave *psd,TileImage *img,uint8_t *row
 static mlkerr _write_layer(AppDraw *p,mPSDSave *psd,int layernum,int bits,mPopupProgress *prog)
 {
 	LayerItem *pi;
-	uint8_t *rowbuf;
+	mImageBuf2 *chimg;
 	mPSDLayer info;
 	mSize size;
-	mRect rc;
-	int ch,i,srcbits;
+	_getchdata dat;
+	int ch,i,bandh;
 	mlkerr ret;
 
 	//レイヤ開始
@@ -1026,16 +1013,26 @@ static mlkerr _write_layer(AppDraw *p,mPSDSave *psd,int layernum,int bits,mPopup
 	ret = _write_layer_info(p, psd);
 	if(ret) return ret;
 
-	//チャンネルバッファ
+	//チャンネルバッファ (最大幅 x bandh 行)
+	// :イメージ全体ではなく、複数行単位で取得・書き込みを行う。
+	// :行数は、全スレッドにジョブが行き渡る数にする。
 
 	mPSDSave_getLayerImageMaxSize(psd, &size);
 
-	rowbuf = (uint8_t *)mMalloc(size.w * (bits / 8));
-	if(!rowbuf) return MLKERR_ALLOC;
+	if(size.w == 0 || size.h == 0)
+		size.w = size.h = 1;
+
+	bandh = _GETCH_ROWS * mThreadGetProcessorNum() * 2;
+	if(bandh > size.h) bandh = size.h;
+
+	chimg = mImageBuf2_new(size.w, bandh, bits, -4);
+	if(!chimg) return MLKERR_ALLOC;
 
 	//レイヤイメージ
 
-	srcbits = p->imgbits;
+	dat.ppbuf = chimg->ppbuf;
+	dat.srcbits = p->imgbits;
+	dat.dstbits = bits;
 
 	for(i = 0; i < layernum; i++)
 	{
@@ -1053,7 +1050,7 @@ static mlkerr _write_layer(AppDraw *p,mPSDSave *psd,int layernum,int bits,mPopup
 
 		//イメージ範囲
 
-		mRectSetBox(&rc, &info.box_img);
+		mRectSetBox(&dat.rc, &info.box_img);
 
 		//各チャンネル
 
@@ -1066,20 +1063,24 @@ static mlkerr _write_layer(AppDraw *p,mPSDSave *psd,int layernum,int bits,mPopup
 
 			if(ret) goto ERR;
 			
-			//イメージ
+			//イメージ (bandh 行ずつ。取得・圧縮ともに行単位で並列処理)
 
-			if(pi)
+			if(pi && info.box_img.w && info.box_img.h)
 			{
-				if(srcbits == 8)
-					ret = _write_layer_image_8bit(psd, pi->img, rowbuf, ch, &rc);
-				else if(bits == 8)
-					//16->8bit
-					ret = _write_layer_image_16to8bit(psd, pi->img, rowbuf, ch, &rc);
-				else
-					//16bit
-					ret = _write_layer_image_16bit(psd, pi->img, rowbuf, ch, &rc);
+				dat.img = pi->img;
+				dat.ch = ch;
 
-				if(ret) goto ERR;
+				for(dat.ytop = dat.rc.y1; dat.ytop <= dat.rc.y2; dat.ytop = dat.yend)
+				{
+					dat.yend = dat.ytop + bandh;
+					if(dat.yend > dat.rc.y2 + 1) dat.yend = dat.rc.y2 + 1;
+
+					mThreadRunParallel((dat.yend - dat.ytop + _GETCH_ROWS - 1) / _GETCH_ROWS,
+						_get_layer_channel_job, &dat);
+
+					ret = mPSDSave_writeLayerImageRowsCh_parallel(psd, chimg->ppbuf, dat.yend - dat.ytop);
+					if(ret) goto ERR;
+				}
 			}
 
 			//チャンネル終了
@@ -1096,7 +1097,7 @@ static mlkerr _write_layer(AppDraw *p,mPSDSave *psd,int layernum,int bits,mPopup
 	}
 
 ERR:
-	mFree(rowbuf);
+	mImageBuf2_free(chimg);
 
 	if(ret == MLKERR_OK)
 		ret = mPSDSave_endLayer(psd);
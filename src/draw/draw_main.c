@@ -178,6 +178,7 @@ void AppDraw_free(void)
 	ImageMaterial_free(p->imgmat_opttex);
 
 	TileImage_free(p->sel.tileimg_copy);
+	TileImageSelEdge_free(p->sel.edge);
 
 	TileImage_free(p->tileimg_sel);
 	TileImage_free(p->tileimg_tmp_save);
@@ -137,6 +137,8 @@ void drawOp_setSelect(AppDraw *p,int type)
 		drawOpSub_freeFillPolygon(p);
 	}
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//-----
 
 	if(del)
@@ -211,6 +213,8 @@ static mlkbool _selfill_release(AppDraw *p)
 	DrawFill_run(draw, &p->w.drawcol);
 	DrawFill_free(draw);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//範囲を追加
 
 	mRectUnion(&p->sel.rcsel, &g_tileimage_dinfo.rcdraw);
@@ -52,6 +52,7 @@ $*/
 #include "fillpolygon.h"
 #include "pointbuf.h"
 #include "undo.h"
+#include "layerswap.h"
 
 #include "draw_main.h"
 #include "draw_calc.h"
@@ -107,7 +108,14 @@ int drawOpSub_canDrawLayer(AppDraw *p,uint32_t flags)
 
 	is_read = (flags & CANDRAWLAYER_F_ENABLE_READ);
 
-	if(LAYERITEM_IS_FOLDER(p->curlayer))
+	//未展開のイメージ (非表示時)
+
+	if(!LayerItem_loadPendingImage(p->curlayer))
+	{
+		//展開に失敗
+		return CANDRAWLAYER_LOAD_ERR;
+	}
+	else if(LAYERITEM_IS_FOLDER(p->curlayer))
 	{
 		//フォルダ
 		return CANDRAWLAYER_FOLDER;
@@ -402,6 +410,10 @@ void drawOpSub_endDraw(AppDraw *p,mRect *rcdraw)
 
 	TileImage_freeAllTiles(p->tileimg_tmp_save);
 	TileImage_freeAllTiles(p->tileimg_tmp_brush);
+
+	//メモリ量が多ければ、非表示レイヤを書き出す
+
+	LayerSwap_check();
 }
 
 /** 単体描画開始 (描画中は待ちカーソル表示) */
@@ -907,13 +919,15 @@ void drawOpSub_setDrawInfo_overwrite(void)
 	g_tileimage_dinfo.func_pixelcol = TileImage_global_getPixelColorFunc(TILEIMAGE_PIXELCOL_OVERWRITE);
 }
 
-/** テキストレイヤの描画用 */
+/** テキストレイヤの描画用
+ *
+ * img: 描画先のイメージ */
 
-void drawOpSub_setDrawInfo_textlayer(AppDraw *p,mlkbool erase)
+void drawOpSub_setDrawInfo_textlayer(AppDraw *p,TileImage *img,mlkbool erase)
 {
 	//アンドゥ用に、描画前の情報を取得しておく
 
-	TileImage_getInfo(p->curlayer->img, &g_tileimage_dinfo.tileimginfo);
+	TileImage_getInfo(img, &g_tileimage_dinfo.tileimginfo);
 
 	//
 
@@ -924,7 +938,7 @@ void drawOpSub_setDrawInfo_textlayer(AppDraw *p,mlkbool erase)
 	g_tileimage_dinfo.func_pixelcol = TileImage_global_getPixelColorFunc(
 		(erase)? TILEIMAGE_PIXELCOL_ERASE: TILEIMAGE_PIXELCOL_NORMAL);
 
-	p->w.dstimg = p->curlayer->img;
+	p->w.dstimg = img;
 	p->w.drawcol = (uint64_t)-1;
 }
 
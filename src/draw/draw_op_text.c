@@ -432,7 +432,7 @@ static void _drawtext_textlayer_dialog(AppDraw *p)
 
 	//描画準備
 
-	drawOpSub_setDrawInfo_textlayer(p, FALSE);
+	drawOpSub_setDrawInfo_textlayer(p, p->curlayer->img, FALSE);
 
 	fdi.setpix_mono = _setpixel_draw_mono;
 	fdi.setpix_gray = _setpixel_draw_gray;
@@ -979,7 +979,7 @@ void drawText_clearItemRect(AppDraw *p,LayerItem *layer,LayerTextItem *item,mRec
 
 	//消去
 
-	drawOpSub_setDrawInfo_textlayer(p, TRUE);
+	drawOpSub_setDrawInfo_textlayer(p, layer->img, TRUE);
 
 	TileImage_drawFillBox(layer->img, rc.x1, rc.y1,
 		rc.x2 - rc.x1 + 1, rc.y2 - rc.y1 + 1,
@@ -993,7 +993,7 @@ void drawText_clearItemRect(AppDraw *p,LayerItem *layer,LayerTextItem *item,mRec
 	{
 		if(pi->tmp && pi != item)
 		{
-			drawText_drawLayerText(p, pi, NULL, &rc2);
+			drawText_drawLayerText(p, pi, layer->img, &rc2);
 
 			//すでに描画してある状態と、再描画時のフォントが異なる場合があるため、
 			//範囲は再セットする。
@@ -1020,9 +1020,7 @@ void drawText_drawLayerText(AppDraw *p,LayerTextItem *pi,TileImage *imgdraw,mRec
 
 	//描画準備
 
-	drawOpSub_setDrawInfo_textlayer(p, FALSE);
-
-	if(imgdraw) p->w.dstimg = imgdraw;
+	drawOpSub_setDrawInfo_textlayer(p, (imgdraw)? imgdraw: p->curlayer->img, FALSE);
 
 	fdi.setpix_mono = _setpixel_draw_mono;
 	fdi.setpix_gray = _setpixel_draw_gray;
@@ -126,6 +126,66 @@ static void _common_rect_point(AppDraw *p,int x,int y,uint32_t state)
 }
 
 
+//=============================
+// XOR 用イメージへの線の追加
+//=============================
+/*
+  - 多角形/投げ縄で確定した線は、XOR 用イメージ (tileimg_tmp) に追加していく。
+  - 追加時は、新しく点がセットされた位置のみキャンバスに XOR 描画する。
+    (以前のように、範囲全体を XOR で消去 → 再描画しない)
+  - キャンバス上の表示は、常に tileimg_tmp の点を XOR したものと同じになるので、
+    終了時は tileimg_tmp 全体を XOR して消去できる。
+*/
+
+
+static mPixbuf *g_xoradd_pixbuf = NULL;
+
+
+/* 点のセット関数
+ *
+ * すでに点がある位置は何もしない (線が重なる部分が消えないように) */
+
+static void _xoradd_setpixel(TileImage *p,int x,int y,void *pix)
+{
+	if(!TileImage_isPixel_opaque(p, x, y))
+	{
+		TileImage_setPixel_new(p, x, y, pix);
+
+		mPixbufSetPixel(g_xoradd_pixbuf, x, y, 0);
+	}
+}
+
+/* XOR 用イメージに直線を追加して、キャンバスに XOR 描画
+ *
+ * 更新範囲は、線の範囲のみ。 */
+
+static void _xoradd_line(AppDraw *p,mPoint *pt1,mPoint *pt2)
+{
+	mPixbuf *pixbuf;
+	mBox box;
+	mRect rc;
+
+	mRectSetPoint_minmax(&rc, pt1, pt2);
+
+	if(!drawCalc_clipCanvas_toBox(p, &box, &rc))
+		return;
+
+	if((pixbuf = drawOpSub_beginCanvasDraw()))
+	{
+		g_xoradd_pixbuf = pixbuf;
+		g_tileimage_dinfo.func_setpixel = _xoradd_setpixel;
+
+		TileImage_drawLineB(p->tileimg_tmp,
+			pt1->x, pt1->y, pt2->x, pt2->y, &p->w.drawcol, FALSE);
+
+		g_tileimage_dinfo.func_setpixel = TileImage_setPixel_new;
+		g_xoradd_pixbuf = NULL;
+
+		drawOpSub_endCanvasDraw(pixbuf, &box);
+	}
+}
+
+
 //=============================
 // XOR直線
 //=============================
@@ -594,16 +654,11 @@ static void _xorpolygon_press_in_grab(AppDraw *p,uint32_t state)
 
 	FillPolygon_addPoint(p->w.fillpolygon, pt.x, pt.y);
 
-	//XOR
+	//XOR (確定した線を追加)
 
 	drawOpXor_drawline(p);
-	drawOpXor_drawPolygon(p);
 
-	TileImage_drawLineB(p->tileimg_tmp,
-		p->w.pttmp[0].x, p->w.pttmp[0].y,
-		p->w.pttmp[1].x, p->w.pttmp[1].y, &p->w.drawcol, FALSE);
-
-	drawOpXor_drawPolygon(p);
+	_xoradd_line(p, p->w.pttmp, p->w.pttmp + 1);
 
 	p->w.pttmp[0] = p->w.pttmp[1];
 	
@@ -998,37 +1053,22 @@ void drawOpXor_drawLasso(AppDraw *p,mlkbool erase)
 {
 	mPixbuf *pixbuf;
 	mBox box;
-	mRect rc;
 
-	if((pixbuf = drawOpSub_beginCanvasDraw()))
+	if(!erase)
 	{
-		if(erase)
-		{
-			//消去
-
-			box.x = box.y = 0;
-			box.w = p->canvas_size.w;
-			box.h = p->canvas_size.h;
-
-			TileImage_blendXor_pixbuf(p->tileimg_tmp, pixbuf, &box);
-		}
-		else
-		{
-			//新しい線描画
+		//新しい線を追加
 
-			mRectSetPoint_minmax(&rc, p->w.pttmp, p->w.pttmp + 1);
-
-			if(drawCalc_clipCanvas_toBox(p, &box, &rc))
-			{
-				TileImage_blendXor_pixbuf(p->tileimg_tmp, pixbuf, &box);
+		_xoradd_line(p, p->w.pttmp + 1, p->w.pttmp);
+	}
+	else if((pixbuf = drawOpSub_beginCanvasDraw()))
+	{
+		//消去
 
-				TileImage_drawLineB(p->tileimg_tmp,
-					p->w.pttmp[1].x, p->w.pttmp[1].y,
-					p->w.pttmp[0].x, p->w.pttmp[0].y, &p->w.drawcol, FALSE);
+		box.x = box.y = 0;
+		box.w = p->canvas_size.w;
+		box.h = p->canvas_size.h;
 
-				TileImage_blendXor_pixbuf(p->tileimg_tmp, pixbuf, &box);
-			}
-		}
+		TileImage_blendXor_pixbuf(p->tileimg_tmp, pixbuf, &box);
 
 		drawOpSub_endCanvasDraw(pixbuf, &box);
 	}
@@ -36,9 +36,24 @@ $*/
 #include "imagecanvas.h"
 #include "fileformat.h"
 
+#include "draw_main.h"
+
 
 //---------------
 
+typedef struct
+{
+	mSaveImage i;
+
+	ImageCanvas *strip;	//Y帯イメージ (NULL で imgcanvas を使う)
+	uint8_t *table8;
+	uint16_t *table16;
+	int dstbits,
+		falpha;
+}_saveimage;
+
+#define _STRIP_HEIGHT  64
+
 //TIFF:圧縮タイプ
 static const uint16_t g_tiff_comptype[] = {
 	MSAVEOPT_TIFF_COMPRESSION_NONE,
@@ -49,15 +64,32 @@ static const uint16_t g_tiff_comptype[] = {
 //---------------
 
 
-/* Y1行を送る */
+/* Y位置のラインバッファを取得
+ *
+ * Y帯イメージの場合、範囲外なら合成する。 */
 
-static mlkerr _save_setrow(mSaveImage *p,int y,uint8_t *buf,int line_bytes)
+static uint8_t *_get_rowbuf(_saveimage *p,int y)
 {
-	uint8_t **ppbuf;
+	ImageCanvas *strip = p->strip;
 
-	ppbuf = (uint8_t **)p->param1;
+	if(!strip)
+		return APPDRAW->imgcanvas->ppbuf[y];
 
-	memcpy(buf, ppbuf[y], line_bytes);
+	if(strip->strip_top < 0
+		|| y < strip->strip_top || y >= strip->strip_top + strip->strip_height)
+	{
+		drawImage_blendImageReal_strip(APPDRAW, strip, y - y % _STRIP_HEIGHT,
+			p->dstbits, p->falpha, p->table8, p->table16);
+	}
+
+	return strip->ppbuf[y];
+}
+
+/* Y1行を送る */
+
+static mlkerr _save_setrow(mSaveImage *p,int y,uint8_t *buf,int line_bytes)
+{
+	memcpy(buf, _get_rowbuf((_saveimage *)p, y), line_bytes);
 
 	return MLKERR_OK;
 }
@@ -71,7 +103,7 @@ static void _save_progress(mSaveImage *p,int percent)
 
 /* PNG 透過色をセット */
 
-static void _set_png_transparent(mSaveImageOpt *p,int dstbits,int samples)
+static void _set_png_transparent(_saveimage *si,mSaveImageOpt *p,int dstbits,int samples)
 {
 	int x,y;
 	uint8_t *buf;
@@ -92,7 +124,7 @@ static void _set_png_transparent(mSaveImageOpt *p,int dstbits,int samples)
 
 		//
 
-		buf = APPDRAW->imgcanvas->ppbuf[y];
+		buf = _get_rowbuf(si, y);
 
 		if(dstbits == 8)
 		{
@@ -137,6 +169,8 @@ static mlkerr _set_gif_info(AppDraw *p,mSaveImage *si,mSaveImageOpt *opt)
 			//256色を超えた
 
 			mFree(si->palette_buf);
+			si->palette_buf = NULL;
+			
 			return -100;
 		}
 	}
@@ -164,13 +198,17 @@ static mlkerr _set_gif_info(AppDraw *p,mSaveImage *si,mSaveImageOpt *opt)
 }
 
 /** 画像ファイルに保存
+ *
+ * GIF 以外は、保存時に Y帯単位で合成するため、事前の合成は必要ない。
+ * GIF の場合は、imgcanvas に保存用の合成イメージがセットされていること。
  *
  * return: [-100] GIF で 257 色以上 */
 
 mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 	uint32_t format,int dstbits,int falpha,mPopupProgress *prog)
 {
-	mSaveImage si;
+	_saveimage dat;
+	mSaveImage *si;
 	mSaveImageOpt opt;
 	mFuncSaveImage func;
 	mlkerr ret;
@@ -179,22 +217,42 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 
 	//情報
 
-	mSaveImage_init(&si);
-
-	si.open.type = MSAVEIMAGE_OPEN_FILENAME;
-	si.open.filename = filename;
-	si.coltype = MSAVEIMAGE_COLTYPE_RGB;
-	si.width = p->imgw;
-	si.height = p->imgh;
-	si.bits_per_sample = dstbits;
-	si.samples_per_pixel = (falpha)? 4: 3;
-	si.reso_unit = MSAVEIMAGE_RESOUNIT_DPI;
-	si.reso_horz = p->imgdpi;
-	si.reso_vert = p->imgdpi;
-	si.progress = _save_progress;
-	si.setrow = _save_setrow;
-	si.param1 = p->imgcanvas->ppbuf;
-	si.param2 = prog;
+	mMemset0(&dat, sizeof(_saveimage));
+
+	si = &dat.i;
+
+	mSaveImage_init(si);
+
+	si->open.type = MSAVEIMAGE_OPEN_FILENAME;
+	si->open.filename = filename;
+	si->coltype = MSAVEIMAGE_COLTYPE_RGB;
+	si->width = p->imgw;
+	si->height = p->imgh;
+	si->bits_per_sample = dstbits;
+	si->samples_per_pixel = (falpha)? 4: 3;
+	si->reso_unit = MSAVEIMAGE_RESOUNIT_DPI;
+	si->reso_horz = p->imgdpi;
+	si->reso_vert = p->imgdpi;
+	si->progress = _save_progress;
+	si->setrow = _save_setrow;
+	si->param2 = prog;
+
+	dat.dstbits = dstbits;
+	dat.falpha = falpha;
+
+	//Y帯イメージ (GIF 以外)
+
+	if(!(format & FILEFORMAT_GIF))
+	{
+		dat.strip = ImageCanvas_newStrip(p->imgw, p->imgh, p->imgbits, _STRIP_HEIGHT);
+
+		if(!dat.strip
+			|| !drawImage_createColConvTable(dstbits, &dat.table8, &dat.table16))
+		{
+			ret = MLKERR_ALLOC;
+			goto END;
+		}
+	}
 
 	//保存関数,設定
 
@@ -209,7 +267,7 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 		opt.png.mask = MSAVEOPT_PNG_MASK_COMP_LEVEL;
 		opt.png.comp_level = SAVEOPT_PNG_GET_LEVEL(APPCONF->save.png);
 
-		_set_png_transparent(&opt, dstbits, si.samples_per_pixel);
+		_set_png_transparent(&dat, &opt, dstbits, si->samples_per_pixel);
 	}
 	else if(format & FILEFORMAT_JPEG)
 	{
@@ -238,8 +296,8 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 		
 		func = mSaveImageGIF;
 
-		ret = _set_gif_info(p, &si, &opt);
-		if(ret) return ret;
+		ret = _set_gif_info(p, si, &opt);
+		if(ret) goto END;
 	}
 	else if(format & FILEFORMAT_TIFF)
 	{
@@ -266,16 +324,24 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 		opt.webp.quality = SAVEOPT_WEBP_GET_QUALITY(val);
 	}
 	else
-		return MLKERR_UNSUPPORTED;
+	{
+		ret = MLKERR_UNSUPPORTED;
+		goto END;
+	}
 	
 	//保存
 
 	mPopupProgressThreadSetMax(prog, 100);
 	mPopupProgressThreadSetPos(prog, 0);
 
-	ret = (func)(&si, &opt);
+	ret = (func)(si, &opt);
+
+END:
+	mFree(si->palette_buf);
 
-	mFree(si.palette_buf);
+	ImageCanvas_free(dat.strip);
+	mFree(dat.table8);
+	mFree(dat.table16);
 
 	return ret;
 }
@@ -94,6 +94,8 @@ static mlkbool _selimg_recreate(AppDraw *p,const mRect *rc)
 
 	mRectEmpty(&p->sel.rcsel);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	return (p->tileimg_sel != NULL);
 }
 
@@ -157,6 +159,8 @@ void drawSel_release(AppDraw *p,mlkbool update)
 		TileImage_free(p->tileimg_sel);
 		p->tileimg_sel = NULL;
 
+		TileImageSelEdge_clear(p->sel.edge);
+
 		//更新
 
 		if(update)
@@ -178,6 +182,8 @@ void drawSel_inverse(AppDraw *p)
 
 	TileImage_inverseSelect(p->tileimg_sel);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//透明部分を解放
 
 	drawSel_selImage_freeEmpty(p);
@@ -214,6 +220,8 @@ void drawSel_all(AppDraw *p)
 	TileImage_drawFillBox(p->tileimg_sel, rc.x1, rc.y1,
 		rc.x2 - rc.x1 + 1, rc.y2 - rc.y1 + 1, &p->w.drawcol);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//範囲セット
 
 	p->sel.rcsel = rc;
@@ -242,6 +250,8 @@ void drawSel_expand(AppDraw *p,int cnt)
 
 	PopupThread_run(&cnt, _thread_expand);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//
 
 	if(cnt > 0)
@@ -422,6 +432,8 @@ void drawSel_fromLayer(AppDraw *p,int type)
 		//描画色部分
 		TileImage_drawPixels_fromImage_color(p->tileimg_sel, p->curlayer->img, &p->col.drawcol, &rc);
 
+	TileImageSelEdge_clear(p->sel.edge);
+
 	//セット
 
 	rc = g_tileimage_dinfo.rcdraw;
@@ -478,6 +490,8 @@ mlkbool drawSel_selImage_create(AppDraw *p)
 
 		mRectEmpty(&p->sel.rcsel);
 
+		TileImageSelEdge_clear(p->sel.edge);
+
 		return (p->tileimg_sel != NULL);
 	}
 }
@@ -497,6 +511,8 @@ void drawSel_selImage_freeEmpty(AppDraw *p)
 			
 			TileImage_free(p->tileimg_sel);
 			p->tileimg_sel = NULL;
+
+			TileImageSelEdge_clear(p->sel.edge);
 		}
 		else
 		{
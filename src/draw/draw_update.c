@@ -40,6 +40,7 @@ $*/
 #include "draw_main.h"
 #include "draw_calc.h"
 #include "draw_rule.h"
+#include "apptrace.h"
 
 
 
@@ -51,8 +52,10 @@ void drawUpdate_setCanvasBlendInfo(LayerItem *pi,TileImageBlendSrcInfo *info)
 	info->blendmode = pi->blendmode;
 	info->img_texture = pi->img_texture;
 	info->tone_lines = 0;
+	info->tone_cache = NULL;
 
 	//トーン化
+	// :キャッシュはトーン化が有効な間のみ保持する
 
 	if((pi->flags & LAYERITEM_F_TONE)
 		&& (pi->type == LAYERTYPE_GRAY || pi->type == LAYERTYPE_ALPHA1BIT))
@@ -61,6 +64,16 @@ void drawUpdate_setCanvasBlendInfo(LayerItem *pi,TileImageBlendSrcInfo *info)
 		info->tone_angle = pi->tone_angle;
 		info->tone_density = pi->tone_density;
 		info->ftone_white = (LAYERITEM_IS_TONE_WHITE(pi) != 0);
+
+		if(!pi->tone_cache)
+			pi->tone_cache = TileImageToneCache_new();
+
+		info->tone_cache = pi->tone_cache;
+	}
+	else if(pi->tone_cache)
+	{
+		TileImageToneCache_free(pi->tone_cache);
+		pi->tone_cache = NULL;
 	}
 }
 
@@ -72,6 +85,7 @@ static void _setcanvasblendinfo_normal(TileImageBlendSrcInfo *info)
 	info->blendmode = 0;
 	info->img_texture = NULL;
 	info->tone_lines = 0;
+	info->tone_cache = NULL;
 }
 
 
@@ -118,8 +132,11 @@ void drawUpdate_all_layer(void)
 
 void drawUpdate_blendImage_full(AppDraw *p,const mBox *box)
 {
+	AppTraceScope trace;
 	mBox box1;
 
+	AppTrace_begin(&trace, APPTRACE_COMPOSITE);
+
 	if(!box)
 	{
 		box1.x = box1.y = 0;
@@ -149,6 +166,8 @@ void drawUpdate_blendImage_full(AppDraw *p,const mBox *box)
 	//レイヤ合成
 
 	drawUpdate_blendImage_layer(p, box);
+
+	AppTrace_end(&trace);
 }
 
 /** レイヤイメージを ImageCanvas に合成
@@ -197,9 +216,14 @@ void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
 			TileImage_blendToCanvas(pi->img, p->imgcanvas, box, &info);
 
 			//カレントの上に、同じレイヤパラメータで挿入
+			// :トーン化のキャッシュはレイヤのイメージ用なので、使わない
 
 			if(pi == current)
+			{
+				info.tone_cache = NULL;
+
 				TileImage_blendToCanvas(img_insert, p->imgcanvas, box, &info);
+			}
 		}
 	}
 	else
@@ -240,9 +264,31 @@ void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
 void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box)
 {
 	CanvasDrawInfo di;
+	AppTraceScope trace;
+	mFont *font;
 	mBox boximg;
 	int n;
 
+	//計測のオーバーレイ
+	// :オーバーレイ内のみの場合 (表示の更新時) は、キャンバスは描画しない
+
+	if(AppTrace_isOverlay())
+	{
+		font = mWidgetGetFont(MLK_WIDGET(APPWIDGET->canvaspage));
+
+		AppTrace_getOverlayBox(&boximg, font);
+
+		if(box->x >= boximg.x && box->y >= boximg.y
+			&& box->x + box->w <= boximg.x + boximg.w
+			&& box->y + box->h <= boximg.y + boximg.h)
+		{
+			AppTrace_drawOverlay(pixbuf, font);
+			return;
+		}
+	}
+
+	AppTrace_begin(&trace, APPTRACE_DISPLAY);
+
 	//描画情報
 
 	di.boxdst = *box;
@@ -312,7 +358,13 @@ void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box)
 		//選択範囲
 
 		if(p->tileimg_sel && !mRectIsEmpty(&p->sel.rcsel) && !p->sel.is_hide)
-			TileImage_drawSelectEdge(p->tileimg_sel, pixbuf, &di, &boximg);
+		{
+			if(!p->sel.edge)
+				p->sel.edge = TileImageSelEdge_new();
+
+			if(p->sel.edge)
+				TileImageSelEdge_draw(p->sel.edge, p->tileimg_sel, pixbuf, &di, &boximg);
+		}
 	}
 
 	//矩形編集枠
@@ -335,6 +387,13 @@ void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box)
 		drawpixbuf_rectframe(pixbuf, &p->w.rctmp[0], &di,
 			(p->canvas_angle == 0), 0x80ffa200);
 	}
+
+	AppTrace_end(&trace);
+
+	//計測のオーバーレイ
+
+	if(AppTrace_isOverlay())
+		AppTrace_drawOverlay(pixbuf, mWidgetGetFont(MLK_WIDGET(APPWIDGET->canvaspage)));
 }
 
 
@@ -34,433 +34,205 @@ $*/
 #include "pv_filter_sub.h"
 
 
-//========================
-// 網トーン生成
-//========================
-
-
-/* 8bit */
+/* 白色をセット */
 
-static mlkbool _proc_amitone_create8(FilterDrawInfo *info)
+static void _set_white(FilterDrawInfo *info,uint64_t *dst)
 {
-	uint8_t *tblbuf;
-	double dinc_cos,dinc_sin,dcell,dyx,dyy,dxx,dxy,dx,dy;
-	int ix,iy,n,density,cx,cy,tsize,tmask;
-	mlkbool fwhite;
-	RGBA8 coldraw,col;
-	TileImageSetPixelFunc setpix;
-
-	dcell = FilterSub_getImageDPI() / (info->val_bar[0] * 0.1);
-
-	tsize = (dcell < 60)? 256: 512;
-	tmask = tsize - 1;
-
-	//テーブル
-
-	tblbuf = (uint8_t *)mMalloc(tsize * tsize);
-	if(!tblbuf) return FALSE;
-
-	ToneTable_setData(tblbuf, tsize, 8);
-
-	//
-
-	density = (100 - info->val_bar[1]) * 255 / 100;
-
-	n = info->val_bar[2] * 512 / 360;
-
-	dinc_cos = 1.0 / round(dcell / TABLEDATA_GET_COS(n));
-	dinc_sin = 1.0 / round(dcell / TABLEDATA_GET_SIN(n));
-
-	FilterSub_getPixelFunc(&setpix);
-
-	fwhite = info->val_ckbtt[0];
-
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
-
-	//(0,0) の位置が基準になるように
-
-	dyx = 0.5 + info->rc.x1 * dinc_cos - info->rc.y1 * dinc_sin;
-	dyy = 0.7 + info->rc.x1 * dinc_sin + info->rc.y1 * dinc_cos;
-
-	//
-
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	if(info->bits == 8)
+		((RGBA8 *)dst)->v32 = 0xffffffff;
+	else
 	{
-		dxx = dyx;
-		dxy = dyy;
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
-		{
-			dx = dxx;
-			dy = dxy;
-			
-			if(density < 128)
-				dx += 0.5, dy += 0.5;
-
-			cx = round(dx * tsize);
-			cy = round(dy * tsize);
+		RGBA16 *pc = (RGBA16 *)dst;
 
-			cx &= tmask;
-			cy &= tmask;
-
-			n = tblbuf[cy * tsize + cx];
-
-			if(density < 128)
-				n = (density < 255 - n);
-			else
-				n = (density < n);
-
-			if(n)
-				col = coldraw;
-			else
-			{
-				if(fwhite)
-					col.v32 = 0xffffffff;
-				else
-					col.v32 = 0;
-			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
-
-			//
-
-			dxx += dinc_cos;
-			dxy += dinc_sin;
-		}
-
-		dyx -= dinc_sin;
-		dyy += dinc_cos;
-
-		FilterSub_prog_substep_inc(info);
+		pc->r = pc->g = pc->b = pc->a = COLVAL_16BIT;
 	}
-	
-	mFree(tblbuf);
-
-	return TRUE;
 }
 
-/* 16bit */
-
-static mlkbool _proc_amitone_create16(FilterDrawInfo *info)
-{
-	uint16_t *tblbuf;
-	double dinc_cos,dinc_sin,dcell,dyx,dyy,dxx,dxy,dx,dy;
-	int ix,iy,n,density,cx,cy,tsize,tmask;
-	mlkbool fwhite;
-	RGBA16 col,coldraw;
-	TileImageSetPixelFunc setpix;
-
-	dcell = FilterSub_getImageDPI() / (info->val_bar[0] * 0.1);
-
-	tsize = (dcell < 60)? 256: 512;
-	tmask = tsize - 1;
-
-	//テーブル
-
-	tblbuf = (uint16_t *)mMalloc(tsize * tsize * 2);
-	if(!tblbuf) return FALSE;
-
-	ToneTable_setData((uint8_t *)tblbuf, tsize, 16);
-
-	//
 
-	density = ((100 - info->val_bar[1]) << 15) / 100;
+//========================
+// 網トーン
+//========================
+/*
+  - 網トーン生成/網トーン化の共通処理。
+  - テーブル上の位置は、固定小数点 (_FIX_BIT) で、X 方向に増加量を加算していく。
+    各行の先頭位置は、行の Y 位置から直接求める。
+*/
 
-	n = info->val_bar[2] * 512 / 360;
+#define _FIX_BIT  32
+#define _FIX_HALF ((int64_t)1 << (_FIX_BIT - 1))
 
-	dinc_cos = 1.0 / round(dcell / TABLEDATA_GET_COS(n));
-	dinc_sin = 1.0 / round(dcell / TABLEDATA_GET_SIN(n));
+typedef struct
+{
+	void *tblbuf;		//トーンテーブル (8bit or 16bit)
+	uint64_t coldraw,	//点の色
+		colbk;			//点以外の色
+	int64_t org_x,org_y,	//(0,0) の位置
+		inc_cos,inc_sin,	//1px ごとの増加量
+		add_half;			//濃度が 50% 未満の時に加算する値 (0.5)
+	int tsize,
+		density;	//濃度 (負の値で、ソース画像の輝度)
+}_amitonedat;
 
-	FilterSub_getPixelFunc(&setpix);
 
-	fwhite = info->val_ckbtt[0];
+/* 1行の色 */
 
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
+static void _amitone_line(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param)
+{
+	_amitonedat *p = (_amitonedat *)param;
+	int64_t fx,fy,add;
+	uint64_t col;
+	int ix,n,cval,cx,cy,tsize,tmask,maxval,half,bits;
 
-	//(0,0) の位置が基準になるように
+	bits = info->bits;
+	tsize = p->tsize;
+	tmask = tsize - 1;
 
-	dyx = 0.5 + info->rc.x1 * dinc_cos - info->rc.y1 * dinc_sin;
-	dyy = 0.7 + info->rc.x1 * dinc_sin + info->rc.y1 * dinc_cos;
+	if(bits == 8)
+		maxval = 255, half = 128;
+	else
+		maxval = COLVAL_16BIT, half = 0x4000;
 
-	//
+	fx = p->org_x + info->rc.x1 * p->inc_cos - y * p->inc_sin;
+	fy = p->org_y + info->rc.x1 * p->inc_sin + y * p->inc_cos;
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	for(ix = info->rc.x1; ix <= info->rc.x2; ix++, dst++, fx += p->inc_cos, fy += p->inc_sin)
 	{
-		dxx = dyx;
-		dxy = dyy;
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		//濃度
+
+		if(p->density >= 0)
+			cval = p->density;
+		else
 		{
-			dx = dxx;
-			dy = dxy;
+			col = 0;
 			
-			if(density < 0x4000)
-				dx += 0.5, dy += 0.5;
-
-			cx = round(dx * tsize);
-			cy = round(dy * tsize);
-
-			cx &= tmask;
-			cy &= tmask;
+			TileImage_getPixel(info->imgsrc, ix, y, &col);
 
-			n = tblbuf[cy * tsize + cx];
+			if(bits == 8)
+			{
+				RGBA8 *pc = (RGBA8 *)&col;
 
-			if(density < 0x4000)
-				n = (density < COLVAL_16BIT - n);
-			else
-				n = (density < n);
+				if(!pc->a)
+				{
+					*dst = FILTERSUB_BAND_SKIP;
+					continue;
+				}
 
-			if(n)
-				col = coldraw;
+				cval = RGB_TO_LUM(pc->r, pc->g, pc->b);
+			}
 			else
 			{
-				if(fwhite)
-					col.r = col.g = col.b = col.a = COLVAL_16BIT;
-				else
-					col.v64 = 0;
-			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
+				RGBA16 *pc = (RGBA16 *)&col;
 
-			//
+				if(!pc->a)
+				{
+					*dst = FILTERSUB_BAND_SKIP;
+					continue;
+				}
 
-			dxx += dinc_cos;
-			dxy += dinc_sin;
+				cval = RGB_TO_LUM(pc->r, pc->g, pc->b);
+			}
 		}
 
-		dyx -= dinc_sin;
-		dyy += dinc_cos;
+		//テーブル値
 
-		FilterSub_prog_substep_inc(info);
-	}
-	
-	mFree(tblbuf);
-
-	return TRUE;
-}
+		add = (cval < half)? _FIX_HALF + p->add_half: _FIX_HALF;
 
-/** 網トーン生成 */
-
-mlkbool FilterDraw_comic_amitone_create(FilterDrawInfo *info)
-{
-	if(info->bits == 8)
-		return _proc_amitone_create8(info);
-	else
-		return _proc_amitone_create16(info);
-}
+		cx = (int)((fx + add) >> _FIX_BIT) & tmask;
+		cy = (int)((fy + add) >> _FIX_BIT) & tmask;
 
+		if(bits == 8)
+			n = *((uint8_t *)p->tblbuf + cy * tsize + cx);
+		else
+			n = *((uint16_t *)p->tblbuf + cy * tsize + cx);
 
-//========================
-// 網トーン化
-//========================
+		if(cval < half)
+			n = (cval < maxval - n);
+		else
+			n = (cval < n);
 
+		*dst = (n)? p->coldraw: p->colbk;
+	}
+}
 
-/* 8bit */
+/* 網トーン処理
+ *
+ * angle: 角度のバーの値
+ * density: 負の値でソース画像の輝度 */
 
-static mlkbool _proc_to_amitone8(FilterDrawInfo *info)
+static mlkbool _proc_amitone(FilterDrawInfo *info,int angle,int density)
 {
-	uint8_t *tblbuf;
-	double dinc_cos,dinc_sin,dcell,dyx,dyy,dxx,dxy,dx,dy;
-	int ix,iy,n,cval,cx,cy,tsize,tmask;
-	mlkbool fwhite;
-	RGBA8 col,coldraw;
-	TileImageSetPixelFunc setpix;
+	_amitonedat dat;
+	double dinc_cos,dinc_sin,dcell,dmul;
+	int n;
+	mlkbool ret;
 
 	dcell = FilterSub_getImageDPI() / (info->val_bar[0] * 0.1);
 
-	tsize = (dcell < 60)? 256: 512;
-	tmask = tsize - 1;
+	dat.tsize = (dcell < 60)? 256: 512;
+	dat.density = density;
 
 	//テーブル
 
-	tblbuf = (uint8_t *)mMalloc(tsize * tsize);
-	if(!tblbuf) return FALSE;
+	dat.tblbuf = mMalloc(dat.tsize * dat.tsize * ((info->bits == 8)? 1: 2));
+	if(!dat.tblbuf) return FALSE;
 
-	ToneTable_setData(tblbuf, tsize, 8);
+	ToneTable_setData((uint8_t *)dat.tblbuf, dat.tsize, info->bits);
 
-	//
+	//増加量
 
-	n = info->val_bar[1] * 512 / 360;
+	n = angle * 512 / 360;
 
 	dinc_cos = 1.0 / round(dcell / TABLEDATA_GET_COS(n));
 	dinc_sin = 1.0 / round(dcell / TABLEDATA_GET_SIN(n));
 
-	FilterSub_getPixelFunc(&setpix);
-
-	fwhite = info->val_ckbtt[0];
+	dmul = (double)dat.tsize * ((int64_t)1 << _FIX_BIT);
 
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
+	dat.inc_cos = (int64_t)round(dinc_cos * dmul);
+	dat.inc_sin = (int64_t)round(dinc_sin * dmul);
 
 	//(0,0) の位置が基準になるように
 
-	dyx = 0.5 + info->rc.x1 * dinc_cos - info->rc.y1 * dinc_sin;
-	dyy = 0.7 + info->rc.x1 * dinc_sin + info->rc.y1 * dinc_cos;
-
-	//
-
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
-	{
-		dxx = dyx;
-		dxy = dyy;
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++, dxx += dinc_cos, dxy += dinc_sin)
-		{
-			TileImage_getPixel(info->imgsrc, ix, iy, &col);
-
-			if(!col.a) continue;
-			
-			dx = dxx;
-			dy = dxy;
-
-			cval = RGB_TO_LUM(col.r, col.g, col.b);
+	dat.org_x = (int64_t)round(0.5 * dmul);
+	dat.org_y = (int64_t)round(0.7 * dmul);
+	dat.add_half = (int64_t)round(0.5 * dmul);
 
-			if(cval < 128)
-				dx += 0.5, dy += 0.5;
+	//色
 
-			cx = round(dx * tsize);
-			cy = round(dy * tsize);
+	dat.coldraw = dat.colbk = 0;
 
-			cx &= tmask;
-			cy &= tmask;
+	FilterSub_getDrawColor_type(info, info->val_combo[0], &dat.coldraw);
 
-			n = tblbuf[cy * tsize + cx];
+	if(info->val_ckbtt[0])
+		_set_white(info, &dat.colbk);
 
-			if(cval < 128)
-				n = (cval < 255 - n);
-			else
-				n = (cval < n);
-
-			if(n)
-				col = coldraw;
-			else
-			{
-				if(fwhite)
-					col.v32 = 0xffffffff;
-				else
-					col.v32 = 0;
-			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
-		}
-
-		dyx -= dinc_sin;
-		dyy += dinc_cos;
+	//
 
-		FilterSub_prog_substep_inc(info);
-	}
+	ret = FilterSub_proc_band(info, _amitone_line, &dat);
 	
-	mFree(tblbuf);
+	mFree(dat.tblbuf);
 
-	return TRUE;
+	return ret;
 }
 
-/* 16bit */
+/** 網トーン生成 */
 
-static mlkbool _proc_to_amitone16(FilterDrawInfo *info)
+mlkbool FilterDraw_comic_amitone_create(FilterDrawInfo *info)
 {
-	uint16_t *tblbuf;
-	double dinc_cos,dinc_sin,dcell,dyx,dyy,dxx,dxy,dx,dy;
-	int ix,iy,n,cval,cx,cy,tsize,tmask;
-	mlkbool fwhite;
-	RGBA16 col,coldraw;
-	TileImageSetPixelFunc setpix;
-
-	dcell = FilterSub_getImageDPI() / (info->val_bar[0] * 0.1);
-
-	tsize = (dcell < 60)? 256: 512;
-	tmask = tsize - 1;
-
-	//テーブル
-
-	tblbuf = (uint16_t *)mMalloc(tsize * tsize * 2);
-	if(!tblbuf) return FALSE;
-
-	ToneTable_setData((uint8_t *)tblbuf, tsize, 16);
-
-	//
-
-	n = info->val_bar[1] * 512 / 360;
-
-	dinc_cos = 1.0 / round(dcell / TABLEDATA_GET_COS(n));
-	dinc_sin = 1.0 / round(dcell / TABLEDATA_GET_SIN(n));
-
-	FilterSub_getPixelFunc(&setpix);
-
-	fwhite = info->val_ckbtt[0];
-
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
-
-	//(0,0) の位置が基準になるように
-
-	dyx = 0.5 + info->rc.x1 * dinc_cos - info->rc.y1 * dinc_sin;
-	dyy = 0.7 + info->rc.x1 * dinc_sin + info->rc.y1 * dinc_cos;
-
-	//
-
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
-	{
-		dxx = dyx;
-		dxy = dyy;
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++, dxx += dinc_cos, dxy += dinc_sin)
-		{
-			TileImage_getPixel(info->imgsrc, ix, iy, &col);
-
-			if(!col.a) continue;
-			
-			dx = dxx;
-			dy = dxy;
-
-			cval = RGB_TO_LUM(col.r, col.g, col.b);
-
-			if(cval < 0x4000)
-				dx += 0.5, dy += 0.5;
-
-			cx = round(dx * tsize);
-			cy = round(dy * tsize);
-
-			cx &= tmask;
-			cy &= tmask;
-
-			n = tblbuf[cy * tsize + cx];
-
-			if(cval < 0x4000)
-				n = (cval < COLVAL_16BIT - n);
-			else
-				n = (cval < n);
-
-			if(n)
-				col = coldraw;
-			else
-			{
-				if(fwhite)
-					col.r = col.g = col.b = col.a = COLVAL_16BIT;
-				else
-					col.v64 = 0;
-			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
-		}
-
-		dyx -= dinc_sin;
-		dyy += dinc_cos;
+	int density;
 
-		FilterSub_prog_substep_inc(info);
-	}
-	
-	mFree(tblbuf);
+	if(info->bits == 8)
+		density = (100 - info->val_bar[1]) * 255 / 100;
+	else
+		density = ((100 - info->val_bar[1]) << 15) / 100;
 
-	return TRUE;
+	return _proc_amitone(info, info->val_bar[2], density);
 }
 
 /** 網トーン化 */
 
 mlkbool FilterDraw_comic_to_amitone(FilterDrawInfo *info)
 {
-	if(info->bits == 8)
-		return _proc_to_amitone8(info);
-	else
-		return _proc_to_amitone16(info);
+	return _proc_amitone(info, info->val_bar[1], -1);
 }
 
 
@@ -469,155 +241,132 @@ mlkbool FilterDraw_comic_to_amitone(FilterDrawInfo *info)
 //========================
 
 
-/* 8bit */
-
-static mlkbool _proc_sandtone8(FilterDrawInfo *info)
+typedef struct
 {
 	PerlinNoise *noise;
-	int ix,iy,n,density;
-	mlkbool fwhite,ffix;
-	RGBA8 col,coldraw;
-	TileImageSetPixelFunc setpix;
+	double *buf;	//ノイズ値 (FILTERSUB_BAND_HEIGHT 行分)
+	uint64_t coldraw,colbk;
+	int density,	//濃度 (負の値で、ソース画像の輝度)
+		width;
+}_sandtonedat;
 
-	//PerlinNoise 初期化
 
-	noise = PerlinNoise_new(info->val_bar[0] / 400.0, 0.15, info->rand);
-	if(!noise) return FALSE;
+/* 1行の色 */
 
-	//
+static void _sandtone_line(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param)
+{
+	_sandtonedat *p = (_sandtonedat *)param;
+	double *pnoise;
+	uint64_t col;
+	int ix,n,density,maxval;
+
+	maxval = (info->bits == 8)? 255: COLVAL_16BIT;
+	density = p->density;
 
-	density = (100 - info->val_bar[1]) * 255 / 100;
-	ffix = info->val_ckbtt[0];
-	fwhite = info->val_ckbtt[1];
+	//ノイズ値 (固定濃度で、すべて同じ色になる場合は除く)
 
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
+	pnoise = p->buf + no * p->width;
 
-	FilterSub_getPixelFunc(&setpix);
+	if(density < 0 || (density != 0 && density != maxval))
+		PerlinNoise_getNoiseLine(p->noise, pnoise, info->rc.x1, y, p->width);
 
 	//
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	for(ix = info->rc.x1; ix <= info->rc.x2; ix++, dst++, pnoise++)
 	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		if(p->density < 0)
 		{
-			if(!ffix)
+			col = 0;
+			
+			TileImage_getPixel(info->imgsrc, ix, y, &col);
+
+			if(info->bits == 8)
 			{
-				TileImage_getPixel(info->imgsrc, ix, iy, &col);
+				RGBA8 *pc = (RGBA8 *)&col;
 
-				if(!col.a) continue;
+				if(!pc->a)
+				{
+					*dst = FILTERSUB_BAND_SKIP;
+					continue;
+				}
 
-				density = RGB_TO_LUM(col.r, col.g, col.b);
+				density = RGB_TO_LUM(pc->r, pc->g, pc->b);
 			}
-
-			if(density == 0 || density == 255)
-				n = (density != 0);
 			else
 			{
-				n = (int)(PerlinNoise_getNoise(noise, ix, iy) * 1500 + 128);
-				n = (n < density);
-			}
+				RGBA16 *pc = (RGBA16 *)&col;
 
-			//
+				if(!pc->a)
+				{
+					*dst = FILTERSUB_BAND_SKIP;
+					continue;
+				}
 
-			if(!n)
-				col = coldraw;
-			else
-			{
-				if(fwhite)
-					col.v32 = 0xffffffff;
-				else
-					col.v32 = 0;
+				density = RGB_TO_LUM(pc->r, pc->g, pc->b);
 			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
 		}
 
-		FilterSub_prog_substep_inc(info);
-	}
+		if(density == 0 || density == maxval)
+			n = (density != 0);
+		else
+		{
+			if(info->bits == 8)
+				n = (int)(*pnoise * 1500 + 128);
+			else
+				n = (int)(*pnoise * 192752 + 0x4000);
 
-	PerlinNoise_free(noise);
+			n = (n < density);
+		}
 
-	return TRUE;
+		*dst = (n)? p->colbk: p->coldraw;
+	}
 }
 
-/* 16bit */
+/** 砂目トーン化 */
 
-static mlkbool _proc_sandtone16(FilterDrawInfo *info)
+mlkbool FilterDraw_comic_sand_tone(FilterDrawInfo *info)
 {
-	PerlinNoise *noise;
-	int ix,iy,n,density;
-	mlkbool fwhite,ffix;
-	RGBA16 col,coldraw;
-	TileImageSetPixelFunc setpix;
+	_sandtonedat dat;
+	mlkbool ret;
 
 	//PerlinNoise 初期化
 
-	noise = PerlinNoise_new(info->val_bar[0] / 400.0, 0.15, info->rand);
-	if(!noise) return FALSE;
-
-	//
-
-	density = ((100 - info->val_bar[1]) << 15) / 100;
-	ffix = info->val_ckbtt[0];
-	fwhite = info->val_ckbtt[1];
+	dat.noise = PerlinNoise_new(info->val_bar[0] / 400.0, 0.15, info->rand);
+	if(!dat.noise) return FALSE;
 
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &coldraw);
+	dat.width = info->rc.x2 - info->rc.x1 + 1;
 
-	FilterSub_getPixelFunc(&setpix);
-
-	//
-
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	dat.buf = (double *)mMalloc(sizeof(double) * dat.width * FILTERSUB_BAND_HEIGHT);
+	if(!dat.buf)
 	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
-		{
-			if(!ffix)
-			{
-				TileImage_getPixel(info->imgsrc, ix, iy, &col);
+		PerlinNoise_free(dat.noise);
+		return FALSE;
+	}
 
-				if(!col.a) continue;
+	//濃度
 
-				density = RGB_TO_LUM(col.r, col.g, col.b);
-			}
+	if(!info->val_ckbtt[0])
+		dat.density = -1;
+	else if(info->bits == 8)
+		dat.density = (100 - info->val_bar[1]) * 255 / 100;
+	else
+		dat.density = ((100 - info->val_bar[1]) << 15) / 100;
 
-			if(density == 0 || density == COLVAL_16BIT)
-				n = (density != 0);
-			else
-			{
-				n = (int)(PerlinNoise_getNoise(noise, ix, iy) * 192752 + 0x4000);
-				n = (n < density);
-			}
+	//色
 
-			//
+	dat.coldraw = dat.colbk = 0;
 
-			if(!n)
-				col = coldraw;
-			else
-			{
-				if(fwhite)
-					col.r = col.g = col.b = col.a = COLVAL_16BIT;
-				else
-					col.v64 = 0;
-			}
+	FilterSub_getDrawColor_type(info, info->val_combo[0], &dat.coldraw);
 
-			(setpix)(info->imgdst, ix, iy, &col);
-		}
+	if(info->val_ckbtt[1])
+		_set_white(info, &dat.colbk);
 
-		FilterSub_prog_substep_inc(info);
-	}
+	//
 
-	PerlinNoise_free(noise);
+	ret = FilterSub_proc_band(info, _sandtone_line, &dat);
 
-	return TRUE;
-}
+	PerlinNoise_free(dat.noise);
+	mFree(dat.buf);
 
-/** 砂目トーン化 */
-
-mlkbool FilterDraw_comic_sand_tone(FilterDrawInfo *info)
-{
-	if(info->bits == 8)
-		return _proc_sandtone8(info);
-	else
-		return _proc_sandtone16(info);
+	return ret;
 }
-
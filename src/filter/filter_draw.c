@@ -39,170 +39,152 @@ $*/
 //===========================
 
 
-/* 8bit */
-
-static mlkbool _proc_cloud_8bit(FilterDrawInfo *info)
+typedef struct
 {
 	PerlinNoise *perlin;
-	int i,ix,iy,xx,yy,n;
-	double resmul;
+	double *buf,	//ノイズ値 (FILTERSUB_BAND_HEIGHT 行分)
+		resmul;
+	int offset,maxval,width;
 	mlkbool to_alpha;
-	RGB8 col1,col2;
-	RGBA8 col;
-	TileImageSetPixelFunc setpix;
+	int col1[3],col2[3];
+}_clouddat;
 
-	FilterSub_getPixelFunc(&setpix);
 
-	//PerlinNoise 初期化
+/* 1行の色 */
 
-	perlin = PerlinNoise_new(info->val_bar[0] / 400.0, info->val_bar[1] * 0.01, info->rand);
-	if(!perlin) return FALSE;
+static void _cloud_line(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param)
+{
+	_clouddat *p = (_clouddat *)param;
+	double *ps,resmul;
+	int ix,i,n,offset,maxval;
+	uint64_t col;
+	uint8_t *pd8 = (uint8_t *)&col;
+	uint16_t *pd16 = (uint16_t *)&col;
 
-	//
+	ps = p->buf + no * p->width;
 
-	resmul = info->val_bar[2] * 5 + 38;
+	PerlinNoise_getNoiseLine(p->perlin, ps, 0, y - info->rc.y1, p->width);
 
-	//色
+	resmul = p->resmul;
+	offset = p->offset;
+	maxval = p->maxval;
 
-	to_alpha = FALSE;
+	col = 0;
 
-	switch(info->val_combo[0])
+	for(ix = p->width; ix > 0; ix--)
 	{
-		//黒/白
-		case 0:
-			col1.r = col1.g = col1.b = 0;
-			col2.r = col2.g = col2.b = 255;
-			break;
-		//描画色/背景色
-		case 1:
-			col1 = info->rgb_drawcol.c8;
-			col2 = info->rgb_bkgnd.c8;
-			break;
-		//黒+アルファ値
-		default:
-			col.v32 = 0;
-			to_alpha = TRUE;
-			break;
-	}
+		n = (int)(*(ps++) * resmul + offset);
 
-	//
+		if(n < 0) n = 0;
+		else if(n > maxval) n = maxval;
 
-	col.a = 255;
-
-	for(iy = info->rc.y1, yy = 0; iy <= info->rc.y2; iy++, yy++)
-	{
-		for(ix = info->rc.x1, xx = 0; ix <= info->rc.x2; ix++, xx++)
+		if(info->bits == 8)
 		{
-			n = (int)(PerlinNoise_getNoise(perlin, xx, yy) * resmul + 128);
-
-			if(n < 0) n = 0;
-			else if(n > 255) n = 255;
-
-			if(to_alpha)
-				col.a = n;
+			if(p->to_alpha)
+				pd8[3] = n;
 			else
 			{
 				for(i = 0; i < 3; i++)
-					col.ar[i] = (col2.ar[i] - col1.ar[i]) * n / 255 + col1.ar[i];
+					pd8[i] = (p->col2[i] - p->col1[i]) * n / 255 + p->col1[i];
+
+				pd8[3] = 255;
 			}
+		}
+		else
+		{
+			if(p->to_alpha)
+				pd16[3] = n;
+			else
+			{
+				for(i = 0; i < 3; i++)
+					pd16[i] = ((p->col2[i] - p->col1[i]) * n >> 15) + p->col1[i];
 
-			(setpix)(info->imgdst, ix, iy, &col);
+				pd16[3] = COLVAL_16BIT;
+			}
 		}
 
-		FilterSub_prog_substep_inc(info);
+		*(dst++) = col;
 	}
-	
-	PerlinNoise_free(perlin);
-
-	return TRUE;
 }
 
-/* 16bit */
+/** 雲模様 */
 
-static mlkbool _proc_cloud_16bit(FilterDrawInfo *info)
+mlkbool FilterDraw_draw_cloud(FilterDrawInfo *info)
 {
-	PerlinNoise *perlin;
-	int i,ix,iy,xx,yy,n;
-	double resmul;
-	mlkbool to_alpha;
-	RGB16 col1,col2;
-	RGBA16 col;
-	TileImageSetPixelFunc setpix;
+	_clouddat dat;
+	int i;
+	mlkbool ret;
 
-	FilterSub_getPixelFunc(&setpix);
+	mMemset0(&dat, sizeof(_clouddat));
 
 	//PerlinNoise 初期化
 
-	perlin = PerlinNoise_new(info->val_bar[0] / 400.0, info->val_bar[1] * 0.01, info->rand);
-	if(!perlin) return FALSE;
+	dat.perlin = PerlinNoise_new(info->val_bar[0] / 400.0, info->val_bar[1] * 0.01, info->rand);
+	if(!dat.perlin) return FALSE;
+
+	dat.width = info->rc.x2 - info->rc.x1 + 1;
+
+	dat.buf = (double *)mMalloc(sizeof(double) * dat.width * FILTERSUB_BAND_HEIGHT);
+	if(!dat.buf)
+	{
+		PerlinNoise_free(dat.perlin);
+		return FALSE;
+	}
 
 	//
 
-	resmul = info->val_bar[2] * 600 + 5000;
+	if(info->bits == 8)
+	{
+		dat.resmul = info->val_bar[2] * 5 + 38;
+		dat.offset = 128;
+		dat.maxval = 255;
+	}
+	else
+	{
+		dat.resmul = info->val_bar[2] * 600 + 5000;
+		dat.offset = 0x4000;
+		dat.maxval = COLVAL_16BIT;
+	}
 
 	//色
 
-	to_alpha = FALSE;
-
 	switch(info->val_combo[0])
 	{
 		//黒/白
 		case 0:
-			col1.r = col1.g = col1.b = 0;
-			col2.r = col2.g = col2.b = COLVAL_16BIT;
+			for(i = 0; i < 3; i++)
+				dat.col2[i] = dat.maxval;
 			break;
 		//描画色/背景色
 		case 1:
-			col1 = info->rgb_drawcol.c16;
-			col2 = info->rgb_bkgnd.c16;
+			for(i = 0; i < 3; i++)
+			{
+				if(info->bits == 8)
+				{
+					dat.col1[i] = info->rgb_drawcol.c8.ar[i];
+					dat.col2[i] = info->rgb_bkgnd.c8.ar[i];
+				}
+				else
+				{
+					dat.col1[i] = info->rgb_drawcol.c16.ar[i];
+					dat.col2[i] = info->rgb_bkgnd.c16.ar[i];
+				}
+			}
 			break;
 		//黒+アルファ値
 		default:
-			col.v64 = 0;
-			to_alpha = TRUE;
+			dat.to_alpha = TRUE;
 			break;
 	}
 
 	//
 
-	col.a = COLVAL_16BIT;
-
-	for(iy = info->rc.y1, yy = 0; iy <= info->rc.y2; iy++, yy++)
-	{
-		for(ix = info->rc.x1, xx = 0; ix <= info->rc.x2; ix++, xx++)
-		{
-			n = (int)(PerlinNoise_getNoise(perlin, xx, yy) * resmul + 0x4000);
-
-			if(n < 0) n = 0;
-			else if(n > COLVAL_16BIT) n = COLVAL_16BIT;
-
-			if(to_alpha)
-				col.a = n;
-			else
-			{
-				for(i = 0; i < 3; i++)
-					col.ar[i] = ((col2.ar[i] - col1.ar[i]) * n >> 15) + col1.ar[i];
-			}
-
-			(setpix)(info->imgdst, ix, iy, &col);
-		}
-
-		FilterSub_prog_substep_inc(info);
-	}
+	ret = FilterSub_proc_band(info, _cloud_line, &dat);
 	
-	PerlinNoise_free(perlin);
+	PerlinNoise_free(dat.perlin);
+	mFree(dat.buf);
 
-	return TRUE;
-}
-
-/** 雲模様 */
-
-mlkbool FilterDraw_draw_cloud(FilterDrawInfo *info)
-{
-	if(info->bits == 8)
-		return _proc_cloud_8bit(info);
-	else
-		return _proc_cloud_16bit(info);
+	return ret;
 }
 
 
@@ -211,115 +193,129 @@ mlkbool FilterDraw_draw_cloud(FilterDrawInfo *info)
 //===========================
 
 
-/** アミトーン描画 */
-
-mlkbool FilterDraw_draw_amitone(FilterDrawInfo *info)
+typedef struct
 {
-	int density,c,ix,iy,ixx,iyy,fantialias,bits,maxval;
-	double rr,dcos,dsin,len,len_half,dsx,dsy,xx,yy,cx,cy,dyy;
 	uint64_t col;
-	TileImageSetPixelFunc setpix;
-
-	//val_bar: [0] サイズ [1] 濃度 [2] 角度
+	double dcos,dsin,len,len_half,rr;
+	int density,fantialias,maxval;
+}_amitonedat;
 
-	FilterSub_getPixelFunc(&setpix);
-
-	FilterSub_getDrawColor_type(info, info->val_combo[0], &col);
 
-	bits = info->bits;
-	maxval = (bits == 8)? 255: COLVAL_16BIT;
-	len = info->val_bar[0] * 0.1;
-	density = info->val_bar[1];
-	fantialias = info->val_ckbtt[0];
+/* アミトーン: 1行の色 */
 
-	rr = info->val_bar[2] / 180.0 * MLK_MATH_PI;
-	dcos = cos(rr);
-	dsin = sin(rr);
+static void _amitone_line(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param)
+{
+	_amitonedat *p = (_amitonedat *)param;
+	int ix,iyy,ixx,c;
+	double xx,yy,cx,cy,dsx,dsy,dyy,len,len_half,rr;
+	uint64_t col;
 
-	c = (density > 50)? 100 - density: density;		//濃度 50% 以上は反転
-	rr = sqrt(len * len * (c * 0.01) / MLK_MATH_PI);	//点の半径
-	rr *= rr;
+	len = p->len;
+	len_half = p->len_half;
+	rr = p->rr;
+	col = p->col;
 
-	len_half = len * 0.5;
+	dsx = info->rc.x1;
+	dsy = y;
 
-	//--------
+	xx = dsx * p->dcos - dsy * p->dsin;
+	yy = dsx * p->dsin + dsy * p->dcos;
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
 	{
-		dsx = info->rc.x1;
-		dsy = iy;
+		//ボックスの中心位置
 
-		xx = dsx * dcos - dsy * dsin;
-		yy = dsx * dsin + dsy * dcos;
+		cx = floor(xx / len) * len + len_half;
+		cy = floor(yy / len) * len + len_half;
 
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
-		{
-			//ボックスの中心位置
+		//
 
-			cx = floor(xx / len) * len + len_half;
-			cy = floor(yy / len) * len + len_half;
+		if(p->fantialias)
+		{
+			//アンチエイリアス (5x5)
 
-			//
+			c = 0;
 
-			if(fantialias)
+			for(iyy = 0, dsy = yy - cy; iyy < 5; iyy++, dsy += 0.2)
 			{
-				//アンチエイリアス (5x5)
-
-				c = 0;
-
-				for(iyy = 0, dsy = yy - cy; iyy < 5; iyy++, dsy += 0.2)
+				dyy = dsy * dsy;
+			
+				for(ixx = 0, dsx = xx - cx; ixx < 5; ixx++, dsx += 0.2)
 				{
-					dyy = dsy * dsy;
-				
-					for(ixx = 0, dsx = xx - cx; ixx < 5; ixx++, dsx += 0.2)
-					{
-						if(dsx * dsx + dyy < rr)
-							c++;
-					}
+					if(dsx * dsx + dyy < rr)
+						c++;
 				}
-
-				if(bits == 8)
-					c = c * 255 / 25;
-				else
-					c = (c << 15) / 25;
 			}
-			else
-			{
-				//非アンチエイリアス
 
-				dsx = xx - cx;
-				dsy = yy - cy;
+			if(info->bits == 8)
+				c = c * 255 / 25;
+			else
+				c = (c << 15) / 25;
+		}
+		else
+		{
+			//非アンチエイリアス
 
-				if(dsx * dsx + dsy * dsy < rr)
-					c = maxval;
-				else
-					c = 0;
-			}
+			dsx = xx - cx;
+			dsy = yy - cy;
 
-			//50% 以上は反転
+			if(dsx * dsx + dsy * dsy < rr)
+				c = p->maxval;
+			else
+				c = 0;
+		}
 
-			if(density > 50)
-				c = maxval - c;
+		//50% 以上は反転
 
-			//
+		if(p->density > 50)
+			c = p->maxval - c;
 
-			if(bits == 8)
-				*((uint8_t *)&col + 3) = c;
-			else
-				*((uint16_t *)&col + 3) = c;
+		//
 
-			(setpix)(info->imgdst, ix, iy, &col);
+		if(info->bits == 8)
+			*((uint8_t *)&col + 3) = c;
+		else
+			*((uint16_t *)&col + 3) = c;
 
-			//
+		*(dst++) = col;
 
-			xx += dcos;
-			yy += dsin;
-		}
+		//
 
-		FilterSub_prog_substep_inc(info);
+		xx += p->dcos;
+		yy += p->dsin;
 	}
+}
 
-	return TRUE;
+/** アミトーン描画 */
+
+mlkbool FilterDraw_draw_amitone(FilterDrawInfo *info)
+{
+	_amitonedat dat;
+	int c;
+	double rr;
+
+	//val_bar: [0] サイズ [1] 濃度 [2] 角度
+
+	dat.col = 0;
+
+	FilterSub_getDrawColor_type(info, info->val_combo[0], &dat.col);
+
+	dat.maxval = (info->bits == 8)? 255: COLVAL_16BIT;
+	dat.len = info->val_bar[0] * 0.1;
+	dat.density = info->val_bar[1];
+	dat.fantialias = info->val_ckbtt[0];
+
+	rr = info->val_bar[2] / 180.0 * MLK_MATH_PI;
+	dat.dcos = cos(rr);
+	dat.dsin = sin(rr);
+
+	c = (dat.density > 50)? 100 - dat.density: dat.density;		//濃度 50% 以上は反転
+	rr = sqrt(dat.len * dat.len * (c * 0.01) / MLK_MATH_PI);	//点の半径
+	dat.rr = rr * rr;
+
+	dat.len_half = dat.len * 0.5;
+
+	return FilterSub_proc_band(info, _amitone_line, &dat);
 }
 
 /** ランダムに点描画 */
@@ -502,7 +498,7 @@ mlkbool FilterDraw_draw_frame(FilterDrawInfo *info)
 
 mlkbool FilterDraw_draw_horzvertLine(FilterDrawInfo *info)
 {
-	int min_w,min_it,len_w,len_it,pos,w,ix,iy;
+	int min_w,min_it,len_w,len_it,pos,w,ix,iy,i,num,*buf;
 	mRect rc;
 	uint64_t col;
 	TileImageSetPixelFunc setpix;
@@ -554,9 +550,14 @@ mlkbool FilterDraw_draw_horzvertLine(FilterDrawInfo *info)
 	FilterSub_prog_inc(info);
 	
 	//縦線
+	// :位置と太さを先に決めてから、タイルの並び順に合わせて、行単位でセットする
 
 	if(info->val_ckbtt[1])
 	{
+		buf = (int *)mMalloc(sizeof(int) * 2 * (rc.x2 - rc.x1 + 1));
+		if(!buf) return FALSE;
+
+		num = 0;
 		pos = rc.x1;
 
 		while(pos <= rc.x2)
@@ -566,18 +567,32 @@ mlkbool FilterDraw_draw_horzvertLine(FilterDrawInfo *info)
 			w = mRandSFMT_getIntRange(rand, 0, len_w) + min_w;
 			if(pos + w > rc.x2) w = rc.x2 - pos + 1;
 
-			//描画
-
-			for(iy = rc.y1; iy <= rc.y2; iy++)
+			if(w > 0)
 			{
-				for(ix = 0; ix < w; ix++)
-					(setpix)(info->imgdst, pos + ix, iy, &col);
+				buf[num * 2] = pos;
+				buf[num * 2 + 1] = w;
+				num++;
 			}
 
 			//次の位置
 
 			pos += mRandSFMT_getIntRange(rand, 0, len_it) + min_it + w;
 		}
+
+		//描画
+
+		for(iy = rc.y1; iy <= rc.y2; iy++)
+		{
+			for(i = 0; i < num; i++)
+			{
+				pos = buf[i * 2];
+				
+				for(ix = buf[i * 2 + 1]; ix > 0; ix--, pos++)
+					(setpix)(info->imgdst, pos, iy, &col);
+			}
+		}
+
+		mFree(buf);
 	}
 
 	FilterSub_prog_inc(info);
@@ -589,7 +604,7 @@ mlkbool FilterDraw_draw_horzvertLine(FilterDrawInfo *info)
 
 mlkbool FilterDraw_draw_plaid(FilterDrawInfo *info)
 {
-	int colw,roww,colmod,rowmod,ix,iy,xf,yf;
+	int colw,roww,colmod,rowmod,ix,iy,yf,pos,len;
 	uint64_t col;
 	TileImageSetPixelFunc setpix;
 
@@ -606,18 +621,31 @@ mlkbool FilterDraw_draw_plaid(FilterDrawInfo *info)
 	colmod = colw << 1;
 	rowmod = roww << 1;
 
-	//
+	//列は、同じ値が続く範囲ごとに処理
 
 	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
 	{
 		yf = (iy % rowmod) / roww;
+
+		ix = info->rc.x1;
+		pos = ix % colmod;
 	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		while(ix <= info->rc.x2)
 		{
-			xf = (ix % colmod) / colw;
+			//pos から同じ値が続く長さ
+			
+			len = colw - pos % colw;
+			if(ix + len > info->rc.x2) len = info->rc.x2 - ix + 1;
 
-			if((xf ^ yf) == 0)
-				(setpix)(info->imgdst, ix, iy, &col);
+			if(pos / colw == yf)
+			{
+				for(; len > 0; len--, ix++)
+					(setpix)(info->imgdst, ix, iy, &col);
+			}
+			else
+				ix += len;
+
+			pos = ix % colmod;
 		}
 
 		FilterSub_prog_substep_inc(info);
@@ -625,4 +653,3 @@ mlkbool FilterDraw_draw_plaid(FilterDrawInfo *info)
 	
 	return TRUE;
 }
-
@@ -253,205 +253,252 @@ mlkbool FilterDraw_crystal(FilterDrawInfo *info)
 //======================
 
 
-/** ハーフトーン */
+/* ハーフトーンのデータ */
 
-mlkbool FilterDraw_halftone(FilterDrawInfo *info)
+typedef struct
 {
-	int i,c,ix,iy,ixx,iyy,bits,colmax,cval[3];
+	double len,len_div,len_half,rrdiv,
+		dcos[3],dsin[3];
+	int colmax;
 	mlkbool fgray,fantialias;
-	double len,len_div,len_half,rr,rrdiv,dcos[3],dsin[3],dx,dy,xx[3],yy[3],dx2,dy2,dyy;
-	uint64_t col;
-	TileImageSetPixelFunc setpix;
-	RGBA8 *pcol8;
-	RGBA16 *pcol16;
+}_halftonedat;
 
-	//val_bar: [0] サイズ [1-3] 角度
 
-	FilterSub_getPixelFunc(&setpix);
+/* ハーフトーン: アンチエイリアス時の値を取得
+ *
+ * dx,dy: ボックスの中心からの距離 */
 
-	bits = info->bits;
-	len = info->val_bar[0] * 0.1;
-	fantialias = info->val_ckbtt[1];
-	fgray = info->val_ckbtt[2];
+static int _halftone_get_aa(_halftonedat *p,double dx,double dy,double rr)
+{
+	double dx2,dy2,dyy,d1,d2,len,len_half;
+	int ix,iy,c;
+
+	len = p->len;
+	len_half = p->len_half;
+
+	//5x5 のサンプルが、すべて同じボックス内にある場合、
+	//範囲の最小/最大距離から、すべて内側/外側かを判定する
 
-	if(bits == 8)
+	if(dx + 0.81 < len_half && dy + 0.81 < len_half)
 	{
-		pcol8 = (RGBA8 *)&col;
-		colmax = 255;
+		//最小距離
+
+		dx2 = (dx > 0)? dx: ((dx + 0.81 < 0)? -(dx + 0.81): 0);
+		dy2 = (dy > 0)? dy: ((dy + 0.81 < 0)? -(dy + 0.81): 0);
+		d1 = dx2 * dx2 + dy2 * dy2;
+
+		//最大距離
+
+		dx2 = fabs(dx); if(fabs(dx + 0.81) > dx2) dx2 = fabs(dx + 0.81);
+		dy2 = fabs(dy); if(fabs(dy + 0.81) > dy2) dy2 = fabs(dy + 0.81);
+		d2 = dx2 * dx2 + dy2 * dy2;
+
+		if(d1 > rr * 1.000001 + 1e-9)
+			return 0;
+		else if(d2 < rr * 0.999999 - 1e-9)
+			return p->colmax;
 	}
-	else
+
+	//サブピクセルごと
+	// :サブピクセルごとに計算しないと、
+	// :次のボックスにまたがっている部分が問題になる
+
+	c = 0;
+
+	for(iy = 0, dy2 = dy; iy < 5; iy++, dy2 += 0.2)
 	{
-		pcol16 = (RGBA16 *)&col;
-		colmax = 0x8000;
+		if(dy2 >= len_half) dy2 -= len;
+		dyy = dy2 * dy2;
+
+		for(ix = 0, dx2 = dx; ix < 5; ix++, dx2 += 0.2)
+		{
+			if(dx2 >= len_half) dx2 -= len;
+
+			c += (dx2 * dx2 + dyy < rr);
+		}
 	}
 
-	len_div = 1.0 / len;
-	len_half = len * 0.5;
-	rrdiv = len * len / MLK_MATH_PI / colmax;
+	return c * p->colmax / 25;
+}
 
-	//RGB 各角度の sin,cos 値
+/* ハーフトーン: 1行の色 */
 
-	for(i = 0; i < 3; i++)
-	{
-		c = info->val_bar[1 + i];
+static void _halftone_line(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param)
+{
+	_halftonedat *p = (_halftonedat *)param;
+	int i,c,ix,colmax,cval[3];
+	double len,len_div,len_half,rr,dx,dy,xx[3],yy[3];
+	uint64_t col;
+	RGBA8 *pcol8;
+	RGBA16 *pcol16;
 
-		//G,B を R と同じ角度に
-		if(i && info->val_ckbtt[0])
-			c = info->val_bar[1];
+	pcol8 = (RGBA8 *)&col;
+	pcol16 = (RGBA16 *)&col;
 
-		rr = c / 180.0 * MLK_MATH_PI;
-		dcos[i] = cos(rr);
-		dsin[i] = sin(rr);
+	len = p->len;
+	len_div = p->len_div;
+	len_half = p->len_half;
+	colmax = p->colmax;
+
+	//左端における各位置
+
+	dx = info->rc.x1;
+	dy = y;
+
+	for(i = 0; i < 3; i++)
+	{
+		xx[i] = dx * p->dcos[i] - dy * p->dsin[i];
+		yy[i] = dx * p->dsin[i] + dy * p->dcos[i];
 	}
 
 	//
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	for(ix = info->rc.x1; ix <= info->rc.x2; ix++, dst++)
 	{
-		//左端における各位置
-	
-		dx = info->rc.x1;
-		dy = iy;
+		col = 0;
+		
+		TileImage_getPixel(info->imgsrc, ix, y, &col);
 
-		for(i = 0; i < 3; i++)
-		{
-			xx[i] = dx * dcos[i] - dy * dsin[i];
-			yy[i] = dx * dsin[i] + dy * dcos[i];
-		}
+		//色
 
-		//
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		if(info->bits == 8)
 		{
-			TileImage_getPixel(info->imgsrc, ix, iy, &col);
+			c = pcol8->a;
 
-			//色
-
-			if(bits == 8)
+			if(c)
 			{
-				c = pcol8->a;
-
-				if(c)
+				if(p->fgray)
+					cval[0] = cval[1] = cval[2] = RGB_TO_LUM(pcol8->r, pcol8->g, pcol8->b);
+				else
 				{
-					if(fgray)
-						cval[0] = cval[1] = cval[2] = RGB_TO_LUM(pcol8->r, pcol8->g, pcol8->b);
-					else
-					{
-						cval[0] = pcol8->r;
-						cval[1] = pcol8->g;
-						cval[2] = pcol8->b;
-					}
+					cval[0] = pcol8->r;
+					cval[1] = pcol8->g;
+					cval[2] = pcol8->b;
 				}
 			}
-			else
-			{
-				c = pcol16->a;
+		}
+		else
+		{
+			c = pcol16->a;
 
-				if(c)
+			if(c)
+			{
+				if(p->fgray)
+					cval[0] = cval[1] = cval[2] = RGB_TO_LUM(pcol16->r, pcol16->g, pcol16->b);
+				else
 				{
-					if(fgray)
-						cval[0] = cval[1] = cval[2] = RGB_TO_LUM(pcol16->r, pcol16->g, pcol16->b);
-					else
-					{
-						cval[0] = pcol16->r;
-						cval[1] = pcol16->g;
-						cval[2] = pcol16->b;
-					}
+					cval[0] = pcol16->r;
+					cval[1] = pcol16->g;
+					cval[2] = pcol16->b;
 				}
 			}
+		}
 
-			//透明の場合はスキップ
+		//透明の場合はスキップ
 
-			if(!c)
+		if(!c)
+		{
+			for(i = 0; i < 3; i++)
 			{
-				for(i = 0; i < 3; i++)
-				{
-					xx[i] += dcos[i];
-					yy[i] += dsin[i];
-				}
-				continue;
+				xx[i] += p->dcos[i];
+				yy[i] += p->dsin[i];
 			}
 
-			//RGB
+			*dst = FILTERSUB_BAND_SKIP;
+			continue;
+		}
 
-			for(i = 0; i < 3; i++)
-			{
-				//ボックスの中心からの距離
+		//RGB
 
-				dx = xx[i] - (floor(xx[i] * len_div) * len + len_half);
-				dy = yy[i] - (floor(yy[i] * len_div) * len + len_half);
+		for(i = 0; i < 3; i++)
+		{
+			//ボックスの中心からの距離
 
-				//RGB 値から半径取得
+			dx = xx[i] - (floor(xx[i] * len_div) * len + len_half);
+			dy = yy[i] - (floor(yy[i] * len_div) * len + len_half);
 
-				rr = sqrt(cval[i] * rrdiv);
-				rr *= rr;
+			//RGB 値から半径取得
 
-				//色取得
+			rr = sqrt(cval[i] * p->rrdiv);
+			rr *= rr;
 
-				if(cval[i] == colmax)
-					c = colmax;
-				else if(fantialias)
-				{
-					//アンチエイリアス
-					// :サブピクセルごとに計算しないと、
-					// :次のボックスにまたがっている部分が問題になる
+			//色取得
 
+			if(cval[i] == colmax)
+				c = colmax;
+			else if(p->fantialias)
+				c = _halftone_get_aa(p, dx, dy, rr);
+			else
+			{
+				//非アンチエイリアス
+
+				if(dx * dx + dy * dy < rr)
+					c = colmax;
+				else
 					c = 0;
+			}
 
-					for(iyy = 0, dy2 = dy; iyy < 5; iyy++, dy2 += 0.2)
-					{
-						if(dy2 >= len_half) dy2 -= len;
-						dyy = dy2 * dy2;
+			cval[i] = c;
 
-						for(ixx = 0, dx2 = dx; ixx < 5; ixx++, dx2 += 0.2)
-						{
-							if(dx2 >= len_half) dx2 -= len;
+			//次の位置
 
-							if(dx2 * dx2 + dyy < rr) c += colmax;
-						}
-					}
+			xx[i] += p->dcos[i];
+			yy[i] += p->dsin[i];
+		}
 
-					c /= 25;
-				}
-				else
-				{
-					//非アンチエイリアス
+		//セット
 
-					if(dx * dx + dy * dy < rr)
-						c = colmax;
-					else
-						c = 0;
-				}
+		if(info->bits == 8)
+		{
+			pcol8->r = cval[0];
+			pcol8->g = cval[1];
+			pcol8->b = cval[2];
+		}
+		else
+		{
+			pcol16->r = cval[0];
+			pcol16->g = cval[1];
+			pcol16->b = cval[2];
+		}
 
-				cval[i] = c;
+		*dst = col;
+	}
+}
 
-				//次の位置
+/** ハーフトーン */
 
-				xx[i] += dcos[i];
-				yy[i] += dsin[i];
-			}
+mlkbool FilterDraw_halftone(FilterDrawInfo *info)
+{
+	_halftonedat dat;
+	int i,c;
+	double rr;
 
-			//セット
+	//val_bar: [0] サイズ [1-3] 角度
 
-			if(bits == 8)
-			{
-				pcol8->r = cval[0];
-				pcol8->g = cval[1];
-				pcol8->b = cval[2];
-			}
-			else
-			{
-				pcol16->r = cval[0];
-				pcol16->g = cval[1];
-				pcol16->b = cval[2];
-			}
+	dat.len = info->val_bar[0] * 0.1;
+	dat.fantialias = info->val_ckbtt[1];
+	dat.fgray = info->val_ckbtt[2];
+	dat.colmax = (info->bits == 8)? 255: 0x8000;
 
-			(setpix)(info->imgdst, ix, iy, &col);
-		}
+	dat.len_div = 1.0 / dat.len;
+	dat.len_half = dat.len * 0.5;
+	dat.rrdiv = dat.len * dat.len / MLK_MATH_PI / dat.colmax;
 
-		FilterSub_prog_substep_inc(info);
+	//RGB 各角度の sin,cos 値
+
+	for(i = 0; i < 3; i++)
+	{
+		c = info->val_bar[1 + i];
+
+		//G,B を R と同じ角度に
+		if(i && info->val_ckbtt[0])
+			c = info->val_bar[1];
+
+		rr = c / 180.0 * MLK_MATH_PI;
+		dat.dcos[i] = cos(rr);
+		dat.dsin[i] = sin(rr);
 	}
 
-	return TRUE;
+	return FilterSub_proc_band(info, _halftone_line, &dat);
 }
 
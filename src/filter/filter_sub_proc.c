@@ -24,6 +24,7 @@ $*/
 #include <math.h>
 
 #include "mlk.h"
+#include "mlk_thread.h"
 
 #include "tileimage.h"
 
@@ -79,6 +80,96 @@ mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,
 }
 
 
+//============================
+// 行単位の並列処理
+//============================
+/*
+  - 範囲を FILTERSUB_BAND_HEIGHT 行ずつに分け、各行の色の計算をスレッドで並列に行う。
+  - ピクセルのセットは、マスクなどの処理があるため、呼び出し元のスレッドで順に行う。
+  - 各行の計算は、位置とソース画像のみから行うこと。
+    (スレッド数に関係なく、同じ結果になるように)
+*/
+
+
+typedef struct
+{
+	FilterDrawInfo *info;
+	uint64_t *buf;	//1バンド分の色
+	int y,			//バンドの先頭 Y
+		width;
+	FilterSubFunc_band func;
+	void *param;
+}_banddat;
+
+
+/* スレッド関数 (1行) */
+
+static int _band_thread(int no,void *param)
+{
+	_banddat *p = (_banddat *)param;
+
+	(p->func)(p->info, p->buf + no * p->width, p->y + no, no, p->param);
+
+	return 0;
+}
+
+/** 行単位で色を計算して、描画
+ *
+ * func: 1行分の色を dst にセットする。x は rc.x1 から。
+ *  8bit 時は、0 で初期化した uint64_t に RGBA8 をセットすること。
+ *  FILTERSUB_BAND_SKIP の場合、その点は描画しない。
+ *  no は、バンド内の行番号 (0〜FILTERSUB_BAND_HEIGHT - 1)。 */
+
+mlkbool FilterSub_proc_band(FilterDrawInfo *info,FilterSubFunc_band func,void *param)
+{
+	_banddat dat;
+	TileImageSetPixelFunc setpix;
+	uint64_t *ps;
+	int ix,iy,i,h;
+
+	FilterSub_getPixelFunc(&setpix);
+
+	dat.info = info;
+	dat.func = func;
+	dat.param = param;
+	dat.width = info->rc.x2 - info->rc.x1 + 1;
+
+	dat.buf = (uint64_t *)mMalloc(8 * dat.width * FILTERSUB_BAND_HEIGHT);
+	if(!dat.buf) return FALSE;
+
+	for(iy = info->rc.y1; iy <= info->rc.y2; iy += FILTERSUB_BAND_HEIGHT)
+	{
+		h = info->rc.y2 - iy + 1;
+		if(h > FILTERSUB_BAND_HEIGHT) h = FILTERSUB_BAND_HEIGHT;
+
+		//色を計算
+
+		dat.y = iy;
+
+		mThreadRunParallel(h, _band_thread, &dat);
+
+		//セット
+
+		ps = dat.buf;
+
+		for(i = 0; i < h; i++)
+		{
+			for(ix = info->rc.x1; ix <= info->rc.x2; ix++, ps++)
+			{
+				if(*ps != FILTERSUB_BAND_SKIP)
+					(setpix)(info->imgdst, ix, iy + i, ps);
+			}
+
+			FilterSub_prog_substep_inc(info);
+		}
+	}
+
+	mFree(dat.buf);
+
+	return TRUE;
+}
+
+
 //============================
 // 3x3 フィルタ
 //============================
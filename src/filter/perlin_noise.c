@@ -20,22 +20,45 @@ $*/
 /**************************************
  * PerlinNoise
  **************************************/
+/*
+ - PerlinNoise_getNoiseLine() は、水平方向に並んだ複数の点を一度に計算する。
+   結果は PerlinNoise_getNoise() と同じ。
+   バッファは読み込みのみなので、複数スレッドから同時に呼び出せる。
+*/
 
 #include <string.h>
 #include <math.h>
 
 #include "mlk.h"
 #include "mlk_rand.h"
+#include "mlk_simd.h"
 
 
 //------------------
 
+#define _SIMD_ON  1
+
 typedef struct
 {
 	uint8_t *buf;
 	double freq,persis;
 }PerlinNoise;
 
+/* 1行の計算時の、セルごとの勾配
+ *
+ * [0] 左上 [1] 右上 [2] 左下 [3] 右下。
+ * 勾配値 = gx * x + cy (cy は、行ごとに固定の y の項) */
+
+typedef struct
+{
+	double gx[4],cy[4];
+}_cell;
+
+//hash & 15 ごとの、x,y の係数 (_grad() と同じ)
+
+static const double g_grad_x[16] = {1,-1,1,-1, 1,-1,1,-1, 0,0,0,0, 1,0,-1,0},
+	g_grad_y[16] = {1,1,-1,-1, 0,0,0,0, 1,-1,1,-1, 1,-1,1,-1};
+
 //------------------
 
 
@@ -93,6 +116,169 @@ static double _noise(uint8_t *buf,double x,double y)
 }
 
 
+//=========================
+// 1行の計算
+//=========================
+
+
+/* 行のセルの勾配をセット
+ *
+ * nx から num 個 (最大 256)。 */
+
+static void _set_cells(_cell *cell,uint8_t *buf,int nx,int num,int ny,double y)
+{
+	_cell *pc;
+	int i,n,a,b,h[4];
+
+	if(num > 256) num = 256;
+
+	for(; num > 0; num--, nx++)
+	{
+		n = nx & 255;
+		pc = cell + n;
+
+		a = buf[n] + ny;
+		b = buf[n + 1] + ny;
+
+		h[0] = buf[buf[a]] & 15;
+		h[1] = buf[buf[b]] & 15;
+		h[2] = buf[buf[a + 1]] & 15;
+		h[3] = buf[buf[b + 1]] & 15;
+
+		for(i = 0; i < 4; i++)
+		{
+			pc->gx[i] = g_grad_x[h[i]];
+			pc->cy[i] = g_grad_y[h[i]] * ((i < 2)? y: y - 1);
+		}
+	}
+}
+
+/* 整数位置へ切り捨て */
+
+static inline int _floor_int(double x)
+{
+	int n = (int)x;
+
+	if(n > x) n--;
+
+	return n;
+}
+
+/* 1点を計算して加算 */
+
+static inline void _add_noise(double *dst,const _cell *pc,double x,double v,double amp)
+{
+	double u,d1,d2,g1,g2,x1;
+
+	u = x * x * (3 - 2 * x);
+	x1 = x - 1;
+
+	g1 = pc->gx[0] * x + pc->cy[0];
+	g2 = pc->gx[1] * x1 + pc->cy[1];
+	d1 = g1 + u * (g2 - g1);
+
+	g1 = pc->gx[2] * x + pc->cy[2];
+	g2 = pc->gx[3] * x1 + pc->cy[3];
+	d2 = g1 + u * (g2 - g1);
+
+	*dst += (d1 + v * (d2 - d1)) * amp;
+}
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+/* 2点を計算して加算 (SSE2) */
+
+static inline void _add_noise2(double *dst,const _cell *pc1,const _cell *pc2,
+	__m128d x,__m128d v,__m128d amp)
+{
+	__m128d u,x1,d1,d2,g1,g2;
+
+	u = _mm_mul_pd(_mm_mul_pd(x, x),
+		_mm_sub_pd(_mm_set1_pd(3), _mm_mul_pd(_mm_set1_pd(2), x)));
+
+	x1 = _mm_sub_pd(x, _mm_set1_pd(1));
+
+	g1 = _mm_add_pd(_mm_mul_pd(_mm_set_pd(pc2->gx[0], pc1->gx[0]), x),
+		_mm_set_pd(pc2->cy[0], pc1->cy[0]));
+	g2 = _mm_add_pd(_mm_mul_pd(_mm_set_pd(pc2->gx[1], pc1->gx[1]), x1),
+		_mm_set_pd(pc2->cy[1], pc1->cy[1]));
+	d1 = _mm_add_pd(g1, _mm_mul_pd(u, _mm_sub_pd(g2, g1)));
+
+	g1 = _mm_add_pd(_mm_mul_pd(_mm_set_pd(pc2->gx[2], pc1->gx[2]), x),
+		_mm_set_pd(pc2->cy[2], pc1->cy[2]));
+	g2 = _mm_add_pd(_mm_mul_pd(_mm_set_pd(pc2->gx[3], pc1->gx[3]), x1),
+		_mm_set_pd(pc2->cy[3], pc1->cy[3]));
+	d2 = _mm_add_pd(g1, _mm_mul_pd(u, _mm_sub_pd(g2, g1)));
+
+	d1 = _mm_add_pd(d1, _mm_mul_pd(v, _mm_sub_pd(d2, d1)));
+
+	_mm_storeu_pd(dst, _mm_add_pd(_mm_loadu_pd(dst), _mm_mul_pd(d1, amp)));
+}
+
+#endif
+
+/* 1オクターブ分を加算
+ *
+ * x: 先頭の位置 (整数)
+ * freq: 周波数 x 倍率 */
+
+static void _add_octave(double *dst,_cell *cell,uint8_t *buf,
+	int x,int num,double freq,double y,double amp)
+{
+	const _cell *pc[4];
+	double dx[4],fx,v;
+	int i,j,n,ny;
+
+	//y
+
+	y *= freq;
+
+	n = _floor_int(y);
+	ny = n & 255;
+	y -= n;
+
+	v = y * y * (3 - 2 * y);
+
+	//範囲内のセルの勾配
+
+	n = _floor_int(x * freq);
+
+	_set_cells(cell, buf, n, _floor_int((x + num - 1) * freq) - n + 1, ny, y);
+
+	//4点ずつ
+
+	for(i = 0; i + 4 <= num; i += 4)
+	{
+		for(j = 0; j < 4; j++)
+		{
+			fx = (x + i + j) * freq;
+			n = _floor_int(fx);
+
+			dx[j] = fx - n;
+			pc[j] = cell + (n & 255);
+		}
+
+	#if MLK_ENABLE_SSE2 && _SIMD_ON
+		_add_noise2(dst + i, pc[0], pc[1], _mm_loadu_pd(dx), _mm_set1_pd(v), _mm_set1_pd(amp));
+		_add_noise2(dst + i + 2, pc[2], pc[3], _mm_loadu_pd(dx + 2), _mm_set1_pd(v), _mm_set1_pd(amp));
+	#else
+		for(j = 0; j < 4; j++)
+			_add_noise(dst + i + j, pc[j], dx[j], v, amp);
+	#endif
+	}
+
+	//残り
+
+	for(; i < num; i++)
+	{
+		fx = (x + i) * freq;
+		n = _floor_int(fx);
+
+		_add_noise(dst + i, cell + (n & 255), fx - n, v, amp);
+	}
+}
+
+
 //=========================
 // main
 //=========================
@@ -184,3 +370,29 @@ double PerlinNoise_getNoise(PerlinNoise *p,double x,double y)
 	return total;
 }
 
+/** 水平方向の複数の点を取得
+ *
+ * (x + i, y) の値を dst[i] にセット。 */
+
+void PerlinNoise_getNoiseLine(PerlinNoise *p,double *dst,int x,int y,int num)
+{
+	_cell cell[256];
+	double amp,persis,freq;
+	int i;
+
+	if(num <= 0) return;
+
+	memset(dst, 0, sizeof(double) * num);
+
+	persis = amp = p->persis;
+	freq = p->freq;
+
+	for(i = 0; i < 8; i++)
+	{
+		_add_octave(dst, cell, p->buf, x, num, freq, y, amp);
+
+		freq *= 2;
+		amp *= persis;
+	}
+}
+
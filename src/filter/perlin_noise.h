@@ -27,4 +27,5 @@ PerlinNoise *PerlinNoise_new(double freq,double persis,mRandSFMT *rand);
 void PerlinNoise_free(PerlinNoise *p);
 
 double PerlinNoise_getNoise(PerlinNoise *p,double x,double y);
+void PerlinNoise_getNoiseLine(PerlinNoise *p,double *dst,int x,int y,int num);
 
@@ -24,6 +24,9 @@ $*/
 #define COLVAL_16BIT  0x8000
 #define RGB_TO_LUM(r,g,b)  (((r) * 77 + (g) * 150 + (b) * 29) >> 8)
 
+#define FILTERSUB_BAND_HEIGHT  64				//行単位の並列処理時の、一度に計算する行数
+#define FILTERSUB_BAND_SKIP    ((uint64_t)-1)	//行単位の並列処理時、描画しない点
+
 /* 点描画の情報 */
 
 typedef struct
@@ -73,6 +76,8 @@ typedef void (*FilterSubFunc_gaussblur_setsrc)(void *buf,int pixnum,FilterDrawIn
 
 typedef void (*FilterSubFunc_drawpoint_setpix)(int x,int y,FilterDrawPointInfo *dat);
 
+typedef void (*FilterSubFunc_band)(FilterDrawInfo *info,uint64_t *dst,int y,int no,void *param);
+
 /* sub */
 
 void FilterSub_getPixelFunc(TileImageSetPixelFunc *func);
@@ -115,6 +120,7 @@ void FilterSub_getLinerColor_bkgnd(TileImage *img,double dx,double dy,int x,int
 
 mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,FilterSubFunc_pixel8 func8,FilterSubFunc_pixel16 func16);
 mlkbool FilterSub_proc_3x3(FilterDrawInfo *info,Filter3x3Info *dat);
+mlkbool FilterSub_proc_band(FilterDrawInfo *info,FilterSubFunc_band func,void *param);
 
 double *FilterSub_createGaussTable(int radius,int range,double *dst_weight);
 
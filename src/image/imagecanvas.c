@@ -37,6 +37,11 @@ $*/
  * - 8bit で 4byte、16bit で 8byte。
  * - R-G-B-X 順に並ぶ。
  * - 各Y行のバッファは 16byte 境界。
+ *
+ * [Y帯イメージ]
+ * - ppbuf は高さ分の配列だが、strip_top から strip_height 行のみバッファがセットされ、
+ *   それ以外は NULL となる。
+ * - 実際に確保されたバッファは ppstrip。
  */
 
 
@@ -49,7 +54,19 @@ void ImageCanvas_free(ImageCanvas *p)
 
 	if(p)
 	{
-		if(p->ppbuf)
+		if(p->ppstrip)
+		{
+			//Y帯イメージ
+			
+			ppbuf = p->ppstrip;
+			
+			for(i = p->strip_height; i; i--, ppbuf++)
+				mFree(*ppbuf);
+
+			mFree(p->ppstrip);
+			mFree(p->ppbuf);
+		}
+		else if(p->ppbuf)
 		{
 			ppbuf = p->ppbuf;
 			
@@ -100,6 +117,86 @@ ERR:
 	return NULL;
 }
 
+/** Y帯イメージを作成
+ *
+ * 全体のサイズを width x height とし、Y は strip_height 行分のみ確保する。
+ * 作成後は、ImageCanvas_setStripPos() で位置をセットすること。 */
+
+ImageCanvas *ImageCanvas_newStrip(int width,int height,int bits,int strip_height)
+{
+	ImageCanvas *p;
+	uint8_t **ppbuf;
+	int i,pitch,bpp;
+
+	if(strip_height > height) strip_height = height;
+
+	p = (ImageCanvas *)mMalloc0(sizeof(ImageCanvas));
+	if(!p) return NULL;
+
+	bpp = (bits == 8)? 4: 8;
+	pitch = (width * bpp + 15) & ~15; //16byte単位
+
+	p->width = width;
+	p->height = height;
+	p->bits = bits;
+	p->line_bytes = pitch;
+	p->strip_top = -1;
+	p->strip_height = strip_height;
+
+	//Y位置の配列
+
+	p->ppbuf = (uint8_t **)mMalloc0(sizeof(void*) * height);
+	if(!p->ppbuf) goto ERR;
+
+	//バッファ
+
+	p->ppstrip = ppbuf = (uint8_t **)mMalloc0(sizeof(void*) * strip_height);
+	if(!ppbuf) goto ERR;
+
+	for(i = strip_height; i; i--, ppbuf++)
+	{
+		*ppbuf = (uint8_t *)mMallocAlign(pitch, 16);
+		if(!(*ppbuf)) goto ERR;
+	}
+
+	return p;
+
+ERR:
+	ImageCanvas_free(p);
+	return NULL;
+}
+
+/** Y帯イメージの位置をセット
+ *
+ * y から strip_height 行分 (イメージ範囲内) の ppbuf にバッファがセットされる。 */
+
+void ImageCanvas_setStripPos(ImageCanvas *p,int y)
+{
+	int i,h;
+
+	if(y == p->strip_top) return;
+
+	//前回の位置をクリア
+
+	if(p->strip_top >= 0)
+	{
+		h = p->height - p->strip_top;
+		if(h > p->strip_height) h = p->strip_height;
+	
+		memset(p->ppbuf + p->strip_top, 0, sizeof(void*) * h);
+	}
+
+	//セット
+
+	h = p->height - y;
+	if(h > p->strip_height) h = p->strip_height;
+
+	for(i = 0; i < h; i++)
+		p->ppbuf[y + i] = p->ppstrip[i];
+
+	p->strip_top = y;
+}
+
 /** 指定位置のバッファを取得 (範囲チェックなし) */
 
 uint8_t *ImageCanvas_getBufPt(ImageCanvas *p,int x,int y)
@@ -215,6 +312,19 @@ void ImageCanvas_setAlphaMax(ImageCanvas *p)
 		ImageCanvas_16bit_setAlphaMax(p);
 }
 
+/** 縮小イメージをセット
+ *
+ * src を 1/div に縮小 (div x div の平均) して、dst にセットする。
+ * box: dst の範囲 (dst 内に収まっていること) */
+
+void ImageCanvas_setReduceImage(ImageCanvas *dst,ImageCanvas *src,int div,const mBox *box)
+{
+	if(src->bits == 8)
+		ImageCanvas_8bit_setReduceImage(dst, src, div, box);
+	else
+		ImageCanvas_16bit_setReduceImage(dst, src, div, box);
+}
+
 
 //===========================
 // サムネイル画像
@@ -215,6 +215,52 @@ void ImageCanvas_16bit_setAlphaMax(ImageCanvas *p)
 	}
 }
 
+/** 縮小イメージをセット (div x div の平均) */
+
+void ImageCanvas_16bit_setReduceImage(ImageCanvas *dst,ImageCanvas *src,int div,const mBox *box)
+{
+	uint16_t *pd,*ps;
+	int ix,iy,jx,jy,sx,sy,sw,sh;
+	int64_t n,r,g,b;
+
+	for(iy = 0; iy < box->h; iy++)
+	{
+		sy = (box->y + iy) * div;
+		sh = src->height - sy;
+		if(sh > div) sh = div;
+
+		pd = (uint16_t *)(dst->ppbuf[box->y + iy] + (box->x << 3));
+		sx = box->x * div;
+
+		for(ix = box->w; ix; ix--, pd += 4, sx += div)
+		{
+			sw = src->width - sx;
+			if(sw > div) sw = div;
+
+			r = g = b = 0;
+
+			for(jy = 0; jy < sh; jy++)
+			{
+				ps = (uint16_t *)(src->ppbuf[sy + jy] + (sx << 3));
+
+				for(jx = sw; jx; jx--, ps += 4)
+				{
+					r += ps[0];
+					g += ps[1];
+					b += ps[2];
+				}
+			}
+
+			n = (int64_t)sw * sh;
+
+			pd[0] = (r + n / 2) / n;
+			pd[1] = (g + n / 2) / n;
+			pd[2] = (b + n / 2) / n;
+			pd[3] = 0x8000;
+		}
+	}
+}
+
 /** キャンバス描画 (ニアレストネイバー) */
 
 void ImageCanvas_16bit_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info)
@@ -26,12 +26,22 @@ $*/
 #include "mlk_gui.h"
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
+#include "mlk_thread.h"
+#include "mlk_simd.h"
 
 #include "imagecanvas.h"
 
 
 //----------------
 
+#define _SIMD_ON  1
+
+#define _FIX_BIT   14	//8bit 時の重みの固定小数点ビット数
+#define _FIX_ONE   (1 << _FIX_BIT)
+#define _MID_BIT   7	//8bit 時の中間値の小数点ビット数
+#define _MID_MAX   (255 << _MID_BIT)
+#define _BAND_HEIGHT  32	//スレッドごとに処理する行数
+
 typedef double (*weightfunc)(double);
 
 enum
@@ -47,15 +57,34 @@ enum
 	METHOD_BLACKMAN3
 };
 
-/* リサイズ用パラメータ */
+/* リサイズ用パラメータ
+ *
+ * 重みは、8bit 時は固定小数点 (合計が _FIX_ONE)、16bit 時は float。
+ * tap は、SIMD で2つずつ処理するため偶数に揃える (余りは重み 0)。 */
 
 typedef struct
 {
-	double *pweight; //重み
+	double *pweight; //重み (作成時の作業用)
+	int16_t *pweight_fix;	//8bit 用
+	float *pweight_flt;		//16bit 用
 	uint16_t *pindex;
-	int tap;
+	int tap,
+		chnum,	//処理するチャンネル数 (3=RGB, 4=RGBA)
+		srcw,dstw; //パラメータ作成時のサイズ
 }_param;
 
+/* スレッド用データ */
+
+typedef void (*resizefunc)(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,int y,int h,mPopupProgress *prog);
+
+typedef struct
+{
+	_param *param;
+	ImageCanvas *src,*dst;
+	mPopupProgress *prog;
+	resizefunc func;
+}_thdata;
+
 //----------------
 
 
@@ -199,24 +228,49 @@ static const weightfunc g_weightfuncs[] = {
 static void _param_free(_param *p)
 {
 	mFree(p->pweight);
+	mFree(p->pweight_fix);
+	mFree(p->pweight_flt);
 	mFree(p->pindex);
 
 	p->pweight = NULL;
+	p->pweight_fix = NULL;
+	p->pweight_flt = NULL;
 	p->pindex = NULL;
 }
 
 /* パラメータバッファ確保
  *
+ * tap: 実際の tap 数。偶数に揃えて確保する。
  * return: 0 以外でエラー */
 
-static int _param_alloc(_param *p,int dstw)
+static int _param_alloc(_param *p,int dstw,int tap)
 {
+	p->tap = (tap + 1) & (~1);
+
 	p->pweight = (double *)mMalloc(sizeof(double) * dstw * p->tap);
 	p->pindex = (uint16_t *)mMalloc(2 * dstw * p->tap);
 
 	return (!p->pweight || !p->pindex);
 }
 
+/* 1px 分の重みを正規化してセット
+ *
+ * 偶数に揃えた分は、重み 0 で最後の位置を参照する。 */
+
+static void _param_set_weight(_param *p,double *pw,uint16_t *pi,double *dwork,int tap,double dsum)
+{
+	int j;
+
+	for(j = 0; j < tap; j++)
+		pw[j] = dwork[j] / dsum;
+
+	for(; j < p->tap; j++)
+	{
+		pw[j] = 0;
+		pi[j] = pi[tap - 1];
+	}
+}
+
 /* 縮小パラメータセット
  *
  * return: 0 以外でエラー */
@@ -229,11 +283,11 @@ static int _set_param_down(_param *p,int srcw,int dstw,int range,weightfunc wfun
 
 	//1px あたりの処理ピクセル
 
-	tap = p->tap = (int)((double)srcw / dstw * range * 2 + 0.5);
+	tap = (int)((double)srcw / dstw * range * 2 + 0.5);
 
 	//バッファ確保
 
-	if(_param_alloc(p, dstw)) return 1;
+	if(_param_alloc(p, dstw, tap)) return 1;
 
 	//作業用バッファ
 
@@ -257,14 +311,14 @@ static int _set_param_down(_param *p,int srcw,int dstw,int range,weightfunc wfun
 		pos = floor((i - range + 0.5) * dscale_rev + 0.5);
 		dsum = 0;
 
-		for(j = 0; j < tap; j++, pi++)
+		for(j = 0; j < tap; j++)
 		{
 			if(pos < 0)
-				*pi = 0;
+				pi[j] = 0;
 			else if(pos >= srcw)
-				*pi = srcw - 1;
+				pi[j] = srcw - 1;
 			else
-				*pi = pos;
+				pi[j] = pos;
 
 			d = fabs((pos + 0.5) * dscale - (i + 0.5));
 
@@ -274,8 +328,10 @@ static int _set_param_down(_param *p,int srcw,int dstw,int range,weightfunc wfun
 			pos++;
 		}
 
-		for(j = 0; j < tap; j++)
-			*(pw++) = dwork[j] / dsum;
+		_param_set_weight(p, pw, pi, dwork, tap, dsum);
+
+		pw += p->tap;
+		pi += p->tap;
 	}
 
 	mFree(dwork);
@@ -291,11 +347,11 @@ static int _set_param_up(_param *p,int srcw,int dstw,int range,weightfunc wfunc)
 	double *dwork,*pw,dsum,dscale,dpos,dmid;
 	uint16_t *pi;
 
-	tap = p->tap = range * 2;
+	tap = range * 2;
 
 	//バッファ確保
 
-	if(_param_alloc(p, dstw)) return 1;
+	if(_param_alloc(p, dstw, tap)) return 1;
 
 	//作業用バッファ
 
@@ -322,14 +378,14 @@ static int _set_param_up(_param *p,int srcw,int dstw,int range,weightfunc wfunc)
 
 		dsum = 0;
 
-		for(j = 0; j < tap; j++, pi++)
+		for(j = 0; j < tap; j++)
 		{
 			if(npos < 0)
-				*pi = 0;
+				pi[j] = 0;
 			else if(npos >= srcw)
-				*pi = srcw - 1;
+				pi[j] = srcw - 1;
 			else
-				*pi = npos;
+				pi[j] = npos;
 
 			dwork[j] = (wfunc)(fabs(dpos));
 
@@ -338,8 +394,10 @@ static int _set_param_up(_param *p,int srcw,int dstw,int range,weightfunc wfunc)
 			npos++;
 		}
 
-		for(j = 0; j < tap; j++)
-			*(pw++) = dwork[j] / dsum;
+		_param_set_weight(p, pw, pi, dwork, tap, dsum);
+
+		pw += p->tap;
+		pi += p->tap;
 	}
 
 	mFree(dwork);
@@ -347,12 +405,80 @@ static int _set_param_up(_param *p,int srcw,int dstw,int range,weightfunc wfunc)
 	return 0;
 }
 
-/* パラメータセット */
+/* 8bit 用の固定小数点の重みに変換
+ *
+ * 丸め誤差は、1px ごとに絶対値が最大の重みで調整し、合計を _FIX_ONE にする。 */
 
-static int _set_param(_param *p,int srcw,int dstw,int method)
+static int _param_to_fix(_param *p,int dstw)
+{
+	int16_t *pd;
+	double *ps;
+	int i,j,n,sum,maxj,tap;
+
+	tap = p->tap;
+
+	pd = p->pweight_fix = (int16_t *)mMalloc(2 * dstw * tap);
+	if(!pd) return 1;
+
+	ps = p->pweight;
+
+	for(i = dstw; i; i--, ps += tap, pd += tap)
+	{
+		sum = 0;
+		maxj = 0;
+
+		for(j = 0; j < tap; j++)
+		{
+			n = lround(ps[j] * _FIX_ONE);
+
+			if(n < -32767) n = -32767;
+			else if(n > 32767) n = 32767;
+
+			pd[j] = n;
+			sum += n;
+
+			if(fabs(ps[j]) > fabs(ps[maxj])) maxj = j;
+		}
+
+		pd[maxj] += _FIX_ONE - sum;
+	}
+
+	return 0;
+}
+
+/* 16bit 用の float の重みに変換 */
+
+static int _param_to_float(_param *p,int dstw)
+{
+	float *pd;
+	double *ps;
+	int i;
+
+	pd = p->pweight_flt = (float *)mMalloc(sizeof(float) * dstw * p->tap);
+	if(!pd) return 1;
+
+	ps = p->pweight;
+
+	for(i = dstw * p->tap; i; i--)
+		*(pd++) = *(ps++);
+
+	return 0;
+}
+
+/* パラメータセット
+ *
+ * 前回と同じサイズの場合は、そのまま使う。
+ * return: 0 以外でエラー */
+
+static int _set_param(_param *p,int srcw,int dstw,int method,int bits)
 {
 	weightfunc func;
-	int range;
+	int range,ret;
+
+	if(p->pindex && p->srcw == srcw && p->dstw == dstw)
+		return 0;
+
+	_param_free(p);
 
 	//半径
 
@@ -368,234 +494,458 @@ static int _set_param(_param *p,int srcw,int dstw,int method)
 	func = g_weightfuncs[method - 1];
 
 	if(dstw < srcw)
-		return _set_param_down(p, srcw, dstw, range, func);
+		ret = _set_param_down(p, srcw, dstw, range, func);
 	else
-		return _set_param_up(p, srcw, dstw, range, func);
+		ret = _set_param_up(p, srcw, dstw, range, func);
+
+	if(ret) return 1;
+
+	//ビットごとの重みに変換
+
+	if(bits == 8)
+		ret = _param_to_fix(p, dstw);
+	else
+		ret = _param_to_float(p, dstw);
+
+	mFree(p->pweight);
+	p->pweight = NULL;
+
+	if(ret)
+	{
+		_param_free(p);
+		return 1;
+	}
+
+	p->srcw = srcw;
+	p->dstw = dstw;
+
+	return 0;
 }
 
 
 //===========================
-// リサイズ
+// 1px 計算
 //===========================
+/* 8bit は固定小数点の整数、16bit は float で積和を行う。
+ *
+ * 水平方向の結果は、丸めずに中間値として保持し、垂直方向の最後で一度だけ丸める。
+ * 中間値は、8bit 時は小数点以下 _MID_BIT ビットの int16、16bit 時は float。 */
 
 
-/* (8bit) 水平リサイズ */
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+/* (8bit) 2つの重みを、madd 用の値にする */
 
-static void _8bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+static inline __m128i _8bit_weight2(const int16_t *pw)
 {
-	uint8_t **ppsrc,**ppdst,*pd,*ps,*psY;
-	int ix,iy,i,n,tap,dstw;
-	uint16_t *pi;
-	double *pw,c[3],dw;
+	return _mm_set1_epi32((uint16_t)pw[0] | ((uint32_t)(uint16_t)pw[1] << 16));
+}
 
-	ppsrc = imgsrc->ppbuf;
-	ppdst = imgdst->ppbuf;
-	dstw = imgdst->width;
-	tap = p->tap;
+/* (16bit) RGBA 値を float で取得 */
+
+static inline __m128 _16bit_load(const uint16_t *ps)
+{
+	return _mm_cvtepi32_ps(
+		_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)ps), _mm_setzero_si128()));
+}
+
+/* (16bit) float の RGBA 値を 0-0x8000 に収める */
+
+static inline __m128 _16bit_clamp(__m128 acc)
+{
+	return _mm_min_ps(_mm_max_ps(acc, _mm_setzero_ps()), _mm_set1_ps(0x8000));
+}
+
+/* (16bit) float の RGBA 値を丸めてセット
+ *
+ * 符号付きで pack するため、0x8000 を引いた値で処理する。 */
+
+static inline void _16bit_store(uint16_t *pd,__m128 acc)
+{
+	__m128i v;
+
+	v = _mm_sub_epi32(_mm_cvtps_epi32(_16bit_clamp(acc)), _mm_set1_epi32(0x8000));
+	v = _mm_add_epi16(_mm_packs_epi32(v, v), _mm_set1_epi16((short)0x8000));
+
+	_mm_storel_epi64((__m128i *)pd, v);
+}
+
+#endif
+
+
+/* (8bit) 水平方向の 1px
+ *
+ * pd: 中間値 (0-255 を小数点以下 _MID_BIT ビットで) */
+
+static void _8bit_pixel_horz(const uint8_t *psY,const uint16_t *pi,const int16_t *pw,int tap,int16_t *pd)
+{
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i acc,v;
+
+	acc = _mm_setzero_si128();
 
-	for(iy = imgdst->height; iy; iy--)
+	for(; tap > 0; tap -= 2, pw += 2, pi += 2)
 	{
-		pd = *(ppdst++);
-		psY = *(ppsrc++);
-		pw = p->pweight;
-		pi = p->pindex;
+		v = _mm_unpacklo_epi8(
+			_mm_cvtsi32_si128(*((const uint32_t *)(psY + (pi[0] << 2)))),
+			_mm_cvtsi32_si128(*((const uint32_t *)(psY + (pi[1] << 2)))));
 
-		for(ix = dstw; ix; ix--, pd += 4)
-		{
-			c[0] = c[1] = c[2] = 0;
+		v = _mm_unpacklo_epi8(v, _mm_setzero_si128());
 
-			for(i = tap; i; i--, pw++, pi++)
-			{
-				ps = psY + (*pi << 2);
-				dw = *pw;
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(v, _8bit_weight2(pw)));
+	}
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+	acc = _mm_srai_epi32(
+		_mm_add_epi32(acc, _mm_set1_epi32(1 << (_FIX_BIT - _MID_BIT - 1))),
+		_FIX_BIT - _MID_BIT);
 
-			//
+	acc = _mm_packs_epi32(acc, acc);
+	acc = _mm_max_epi16(acc, _mm_setzero_si128());
+	acc = _mm_min_epi16(acc, _mm_set1_epi16(_MID_MAX));
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 255) n = 255;
+	_mm_storel_epi64((__m128i *)pd, acc);
 
-				pd[i] = n;
-			}
-		}
+#else
 
-		mPopupProgressThreadSubStep_inc(prog);
+	const uint8_t *ps;
+	int c[4],i,n;
+
+	c[0] = c[1] = c[2] = c[3] = 0;
+
+	for(; tap > 0; tap--, pw++, pi++)
+	{
+		ps = psY + (*pi << 2);
+
+		c[0] += ps[0] * *pw;
+		c[1] += ps[1] * *pw;
+		c[2] += ps[2] * *pw;
+		c[3] += ps[3] * *pw;
 	}
+
+	for(i = 0; i < 4; i++)
+	{
+		n = (c[i] + (1 << (_FIX_BIT - _MID_BIT - 1))) >> (_FIX_BIT - _MID_BIT);
+
+		if(n < 0) n = 0;
+		else if(n > _MID_MAX) n = _MID_MAX;
+
+		pd[i] = n;
+	}
+
+#endif
 }
 
-/* (8bit) 垂直リサイズ */
+/* (8bit) 垂直方向の 1px
+ *
+ * ppsrc: 中間値のイメージ */
 
-static void _8bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+static void _8bit_pixel_vert(int16_t **ppsrc,const uint16_t *pi,const int16_t *pw,int tap,int xpos,uint8_t *pd)
 {
-	uint8_t **ppdst,**ppsrc,*pd,*ps;
-	int ix,iy,i,n,tap,xpos,dstw;
-	uint16_t *pi;
-	double *pw,c[3],dw;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
 
-	ppsrc = imgsrc->ppbuf;
-	ppdst = imgdst->ppbuf;
-	dstw = imgdst->width;
+	__m128i acc,v;
 
-	pw = p->pweight;
-	pi = p->pindex;
-	tap = p->tap;
+	acc = _mm_setzero_si128();
 
-	for(iy = imgdst->height; iy; iy--)
+	for(; tap > 0; tap -= 2, pw += 2, pi += 2)
 	{
-		pd = *(ppdst++);
-		xpos = 0;
-	
-		for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
-		{
-			c[0] = c[1] = c[2] = 0;
+		v = _mm_unpacklo_epi16(
+			_mm_loadl_epi64((const __m128i *)(ppsrc[pi[0]] + xpos)),
+			_mm_loadl_epi64((const __m128i *)(ppsrc[pi[1]] + xpos)));
 
-			for(i = 0; i < tap; i++)
-			{
-				ps = ppsrc[pi[i]] + xpos;
-				dw = pw[i];
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(v, _8bit_weight2(pw)));
+	}
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+	acc = _mm_srai_epi32(
+		_mm_add_epi32(acc, _mm_set1_epi32(1 << (_FIX_BIT + _MID_BIT - 1))),
+		_FIX_BIT + _MID_BIT);
 
-			//
+	acc = _mm_packs_epi32(acc, acc);
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 255) n = 255;
+	*((uint32_t *)pd) = _mm_cvtsi128_si32(_mm_packus_epi16(acc, acc));
 
-				pd[i] = n;
-			}
-		}
+#else
 
-		pw += tap;
-		pi += tap;
+	const int16_t *ps;
+	int c[4],i,n;
 
-		mPopupProgressThreadSubStep_inc(prog);
+	c[0] = c[1] = c[2] = c[3] = 0;
+
+	for(; tap > 0; tap--, pw++, pi++)
+	{
+		ps = ppsrc[*pi] + xpos;
+
+		c[0] += ps[0] * *pw;
+		c[1] += ps[1] * *pw;
+		c[2] += ps[2] * *pw;
+		c[3] += ps[3] * *pw;
+	}
+
+	for(i = 0; i < 4; i++)
+	{
+		n = (c[i] + (1 << (_FIX_BIT + _MID_BIT - 1))) >> (_FIX_BIT + _MID_BIT);
+
+		if(n < 0) n = 0;
+		else if(n > 255) n = 255;
+
+		pd[i] = n;
 	}
+
+#endif
 }
 
-/* (16bit) 水平リサイズ */
+/* (16bit) 水平方向の 1px
+ *
+ * pd: 中間値 (0-0x8000 の float) */
+
+static void _16bit_pixel_horz(const uint16_t *psY,const uint16_t *pi,const float *pw,int tap,float *pd)
+{
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128 acc;
+
+	acc = _mm_setzero_ps();
+
+	for(; tap > 0; tap--, pw++, pi++)
+		acc = _mm_add_ps(acc, _mm_mul_ps(_16bit_load(psY + (*pi << 2)), _mm_set1_ps(*pw)));
+
+	_mm_store_ps(pd, _16bit_clamp(acc));
+
+#else
+
+	const uint16_t *ps;
+	float c[4];
+	int i;
+
+	c[0] = c[1] = c[2] = c[3] = 0;
+
+	for(; tap > 0; tap--, pw++, pi++)
+	{
+		ps = psY + (*pi << 2);
+
+		c[0] += ps[0] * *pw;
+		c[1] += ps[1] * *pw;
+		c[2] += ps[2] * *pw;
+		c[3] += ps[3] * *pw;
+	}
+
+	for(i = 0; i < 4; i++)
+	{
+		if(c[i] < 0) c[i] = 0;
+		else if(c[i] > 0x8000) c[i] = 0x8000;
+
+		pd[i] = c[i];
+	}
+
+#endif
+}
 
-static void _16bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+/* (16bit) 垂直方向の 1px
+ *
+ * ppsrc: 中間値のイメージ */
+
+static void _16bit_pixel_vert(float **ppsrc,const uint16_t *pi,const float *pw,int tap,int xpos,uint16_t *pd)
 {
-	uint16_t **ppsrc,**ppdst,*pd,*ps,*psY;
-	int ix,iy,i,tap,dstw,n;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128 acc;
+
+	acc = _mm_setzero_ps();
+
+	for(; tap > 0; tap--, pw++, pi++)
+		acc = _mm_add_ps(acc, _mm_mul_ps(_mm_load_ps(ppsrc[*pi] + xpos), _mm_set1_ps(*pw)));
+
+	_16bit_store(pd, acc);
+
+#else
+
+	const float *ps;
+	float c[4];
+	int i,n;
+
+	c[0] = c[1] = c[2] = c[3] = 0;
+
+	for(; tap > 0; tap--, pw++, pi++)
+	{
+		ps = ppsrc[*pi] + xpos;
+
+		c[0] += ps[0] * *pw;
+		c[1] += ps[1] * *pw;
+		c[2] += ps[2] * *pw;
+		c[3] += ps[3] * *pw;
+	}
+
+	for(i = 0; i < 4; i++)
+	{
+		n = lroundf(c[i]);
+
+		if(n < 0) n = 0;
+		else if(n > 0x8000) n = 0x8000;
+
+		pd[i] = n;
+	}
+
+#endif
+}
+
+
+//===========================
+// リサイズ
+//===========================
+/* y から h 行分を処理する。
+ * 水平リサイズの出力先は中間値のイメージ (_proc_resize を参照)。 */
+
+
+/* (8bit) 水平リサイズ */
+
+static void _8bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,int y,int h,mPopupProgress *prog)
+{
+	uint8_t **ppsrc,**ppdst,*psY;
+	int16_t *pd,*pw;
+	int ix,tap,dstw;
 	uint16_t *pi;
-	double *pw,c[3],dw;
 
-	ppsrc = (uint16_t **)imgsrc->ppbuf;
-	ppdst = (uint16_t **)imgdst->ppbuf;
-	dstw = imgdst->width;
+	ppsrc = imgsrc->ppbuf + y;
+	ppdst = imgdst->ppbuf + y;
+	dstw = p->dstw;
 	tap = p->tap;
 
-	for(iy = imgdst->height; iy; iy--)
+	for(; h > 0; h--)
 	{
-		pd = *(ppdst++);
+		pd = (int16_t *)*(ppdst++);
 		psY = *(ppsrc++);
-		pw = p->pweight;
+		pw = p->pweight_fix;
 		pi = p->pindex;
 
-		for(ix = dstw; ix; ix--, pd += 4)
-		{
-			c[0] = c[1] = c[2] = 0;
+		for(ix = dstw; ix; ix--, pd += 4, pw += tap, pi += tap)
+			_8bit_pixel_horz(psY, pi, pw, tap, pd);
 
-			for(i = tap; i; i--, pw++, pi++)
-			{
-				ps = psY + (*pi << 2);
-				dw = *pw;
+		mPopupProgressThreadSubStep_inc(prog);
+	}
+}
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+/* (8bit) 垂直リサイズ */
 
-			//
+static void _8bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,int y,int h,mPopupProgress *prog)
+{
+	int16_t **ppsrc,*pw;
+	uint8_t *pd;
+	int ix,tap,dstw;
+	uint16_t *pi;
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 0x8000) n = 0x8000;
+	ppsrc = (int16_t **)imgsrc->ppbuf;
+	dstw = imgdst->width;
+	tap = p->tap;
 
-				pd[i] = n;
-			}
-		}
+	for(; h > 0; h--, y++)
+	{
+		pd = imgdst->ppbuf[y];
+		pw = p->pweight_fix + y * tap;
+		pi = p->pindex + y * tap;
+
+		for(ix = 0; ix < dstw; ix++, pd += 4)
+			_8bit_pixel_vert(ppsrc, pi, pw, tap, ix << 2, pd);
 
 		mPopupProgressThreadSubStep_inc(prog);
 	}
 }
 
-/* (16bit) 垂直リサイズ */
+/* (16bit) 水平リサイズ */
 
-static void _16bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+static void _16bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,int y,int h,mPopupProgress *prog)
 {
-	uint16_t **ppdst,**ppsrc,*pd,*ps;
-	int ix,iy,i,n,tap,xpos,dstw;
+	uint16_t **ppsrc,*psY;
+	uint8_t **ppdst;
+	int ix,tap,dstw;
 	uint16_t *pi;
-	double *pw,c[3],dw;
-
-	ppsrc = (uint16_t **)imgsrc->ppbuf;
-	ppdst = (uint16_t **)imgdst->ppbuf;
-	dstw = imgdst->width;
+	float *pd,*pw;
 
-	pw = p->pweight;
-	pi = p->pindex;
+	ppsrc = (uint16_t **)imgsrc->ppbuf + y;
+	ppdst = imgdst->ppbuf + y;
+	dstw = p->dstw;
 	tap = p->tap;
 
-	for(iy = imgdst->height; iy; iy--)
+	for(; h > 0; h--)
 	{
-		pd = *(ppdst++);
-		xpos = 0;
-	
-		for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
-		{
-			c[0] = c[1] = c[2] = 0;
+		pd = (float *)*(ppdst++);
+		psY = *(ppsrc++);
+		pw = p->pweight_flt;
+		pi = p->pindex;
 
-			for(i = 0; i < tap; i++)
-			{
-				ps = ppsrc[pi[i]] + xpos;
-				dw = pw[i];
+		for(ix = dstw; ix; ix--, pd += 4, pw += tap, pi += tap)
+			_16bit_pixel_horz(psY, pi, pw, tap, pd);
+
+		mPopupProgressThreadSubStep_inc(prog);
+	}
+}
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+/* (16bit) 垂直リサイズ */
 
-			//
+static void _16bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,int y,int h,mPopupProgress *prog)
+{
+	float **ppsrc,*pw;
+	uint16_t *pd;
+	int ix,tap,dstw;
+	uint16_t *pi;
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 0x8000) n = 0x8000;
+	ppsrc = (float **)imgsrc->ppbuf;
+	dstw = imgdst->width;
+	tap = p->tap;
 
-				pd[i] = n;
-			}
-		}
+	for(; h > 0; h--, y++)
+	{
+		pd = (uint16_t *)imgdst->ppbuf[y];
+		pw = p->pweight_flt + y * tap;
+		pi = p->pindex + y * tap;
 
-		pw += tap;
-		pi += tap;
+		for(ix = 0; ix < dstw; ix++, pd += 4)
+			_16bit_pixel_vert(ppsrc, pi, pw, tap, ix << 2, pd);
 
 		mPopupProgressThreadSubStep_inc(prog);
 	}
 }
 
 
+//===========================
+// スレッド
+//===========================
+
+
+/* [スレッド] 1つの帯を処理 */
+
+static int _resize_job(int no,void *param)
+{
+	_thdata *p = (_thdata *)param;
+	int y,h;
+
+	y = no * _BAND_HEIGHT;
+	h = p->dst->height - y;
+	if(h > _BAND_HEIGHT) h = _BAND_HEIGHT;
+
+	(p->func)(p->param, p->src, p->dst, y, h, p->prog);
+
+	return 0;
+}
+
+/* 出力イメージを Y 方向の帯に分割して、並列処理 */
+
+static void _run_resize(resizefunc func,_param *param,ImageCanvas *src,ImageCanvas *dst,
+	mPopupProgress *prog,int maxthread)
+{
+	_thdata dat;
+
+	dat.param = param;
+	dat.src = src;
+	dat.dst = dst;
+	dat.prog = prog;
+	dat.func = func;
+
+	mThreadRunParallel_max((dst->height + _BAND_HEIGHT - 1) / _BAND_HEIGHT, maxthread,
+		_resize_job, &dat);
+}
+
+
 //===========================
 // ニアレストネイバー
 //===========================
@@ -691,21 +1041,18 @@ ImageCanvas *_proc_nearest(ImageCanvas *src,int neww,int newh,mPopupProgress *pr
 
 	return dst;
 }
-
-
 //===========================
 // main
 //===========================
 
 
-/** リサイズ
- *
- * src は常に解放される。
+/* リサイズ処理
  *
- * return: メモリが足りない場合 NULL */
+ * RGBA すべて処理される。
+ * maxthread: 最大スレッド数 (0 以下で CPU 数) */
 
-ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
-	mPopupProgress *prog,int stepnum)
+static ImageCanvas *_proc_resize(ImageCanvas *src,int neww,int newh,int method,
+	mPopupProgress *prog,int stepnum,int maxthread)
 {
 	ImageCanvas *dst,*tmp;
 	_param param;
@@ -725,21 +1072,19 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 
 	mPopupProgressThreadSubStep_begin(prog, stepnum, src->height + newh);
 
-	//水平リサイズ結果用イメージ
+	//水平リサイズ結果用イメージ (中間値)
+	// :8bit 時は int16 x 4 (16bit のイメージと同じサイズ)。
+	// :16bit 時は float x 4 (幅 2 倍の 16bit イメージとして確保)。
 
-	tmp = ImageCanvas_new(neww, src->height, bits);
+	tmp = ImageCanvas_new((bits == 8)? neww: neww * 2, src->height, 16);
 	if(!tmp) goto ERR;
 
 	//水平リサイズ
 
-	if(_set_param(&param, src->width, neww, method)) goto ERR;
-
-	if(bits == 8)
-		_8bit_resize_horz(&param, src, tmp, prog);
-	else
-		_16bit_resize_horz(&param, src, tmp, prog);
+	if(_set_param(&param, src->width, neww, method, bits)) goto ERR;
 
-	_param_free(&param);
+	_run_resize((bits == 8)? _8bit_resize_horz: _16bit_resize_horz,
+		&param, src, tmp, prog, maxthread);
 
 	//src を解放
 
@@ -752,21 +1097,19 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 	if(!dst) goto ERR;
 
 	//垂直リサイズ
+	// :水平と同じ倍率の場合は、パラメータをそのまま使う
 
-	if(_set_param(&param, tmp->height, newh, method)) goto ERR;
+	if(_set_param(&param, tmp->height, newh, method, bits)) goto ERR;
 
-	if(bits == 8)
-		_8bit_resize_vert(&param, tmp, dst, prog);
-	else
-		_16bit_resize_vert(&param, tmp, dst, prog);
-
-	_param_free(&param);
+	_run_resize((bits == 8)? _8bit_resize_vert: _16bit_resize_vert,
+		&param, tmp, dst, prog, maxthread);
 
 	//---------
 
 	err = 0;
 	
 ERR:
+	_param_free(&param);
 	ImageCanvas_free(src);
 	ImageCanvas_free(tmp);
 
@@ -779,3 +1122,31 @@ ERR:
 	return dst;
 }
 
+/** リサイズ
+ *
+ * RGB のみ処理される (アルファ値は不定)。
+ * src は常に解放される。
+ *
+ * return: メモリが足りない場合 NULL */
+
+ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
+	mPopupProgress *prog,int stepnum)
+{
+	return _proc_resize(src, neww, newh, method, prog, stepnum, 0);
+}
+
+/** リサイズ (RGBA)
+ *
+ * アルファ値も含めて処理する。
+ * 色は、アルファ値を乗算済みであること。
+ * src は常に解放される。
+ *
+ * maxthread: 最大スレッド数 (0 以下で CPU 数)。
+ *  複数のイメージを並列で処理する場合に、スレッド数を制限する。
+ * return: メモリが足りない場合 NULL */
+
+ImageCanvas *ImageCanvas_resize_rgba(ImageCanvas *src,int neww,int newh,int method,
+	mPopupProgress *prog,int stepnum,int maxthread)
+{
+	return _proc_resize(src, neww, newh, method, prog, stepnum, maxthread);
+}
@@ -94,18 +94,46 @@ void ImageMaterial_clear(ImageMaterial *p)
 
 uint8_t ImageMaterial_getPixel_forTexture(ImageMaterial *p,int x,int y)
 {
-	int w,h;
+	x %= p->width;
+	if(x < 0) x += p->width;
 
-	w = p->width;
-	h = p->height;
+	y %= p->height;
+	if(y < 0) y += p->height;
 
-	if(x < 0)
-		x += (-x / w + 1) * w;
+	return *(p->buf + y * p->pitch + x);
+}
+
+/** テクスチャ画像 (8bit) として、水平方向に連続した色を取得
+ *
+ * 画像の端で折り返しながら、(x,y) から w 個の値を dst にセットする。
+ * 剰余は最初の1回のみで、あとはコピーで済む。 */
+
+void ImageMaterial_getRow_forTexture(ImageMaterial *p,uint8_t *dst,int x,int y,int w)
+{
+	uint8_t *ps;
+	int tw,n;
+
+	tw = p->width;
 
-	if(y < 0)
-		y += (-y / h + 1) * h;
+	x %= tw;
+	if(x < 0) x += tw;
 
-	return *(p->buf + (y % h) * p->pitch + (x % w));
+	y %= p->height;
+	if(y < 0) y += p->height;
+
+	ps = p->buf + y * p->pitch;
+
+	while(w > 0)
+	{
+		n = tw - x;
+		if(n > w) n = w;
+
+		memcpy(dst, ps + x, n);
+
+		dst += n;
+		w -= n;
+		x = 0;
+	}
 }
 
 /* Image32 からグレイスケール濃度画像セット
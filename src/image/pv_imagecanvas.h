@@ -42,6 +42,7 @@ void ImageCanvas_8bit_fill(ImageCanvas *p,RGBcombo *col);
 void ImageCanvas_8bit_fillBox(ImageCanvas *p,const mBox *box,RGBcombo *col);
 void ImageCanvas_8bit_fillPlaidBox(ImageCanvas *p,const mBox *box,RGBcombo *col1,RGBcombo *col2);
 void ImageCanvas_8bit_setAlphaMax(ImageCanvas *p);
+void ImageCanvas_8bit_setReduceImage(ImageCanvas *dst,ImageCanvas *src,int div,const mBox *box);
 void ImageCanvas_8bit_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_8bit_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_8bit_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
@@ -53,6 +54,7 @@ void ImageCanvas_16bit_fill(ImageCanvas *p,RGBcombo *col);
 void ImageCanvas_16bit_fillBox(ImageCanvas *p,const mBox *box,RGBcombo *col);
 void ImageCanvas_16bit_fillPlaidBox(ImageCanvas *p,const mBox *box,RGBcombo *col1,RGBcombo *col2);
 void ImageCanvas_16bit_setAlphaMax(ImageCanvas *p);
+void ImageCanvas_16bit_setReduceImage(ImageCanvas *dst,ImageCanvas *src,int div,const mBox *box);
 void ImageCanvas_16bit_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_16bit_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_16bit_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
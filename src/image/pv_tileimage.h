@@ -62,6 +62,7 @@ struct _TileImageBlendInfo
 		is_tone_bkgnd_tp;	//トーン:背景は透明
 	int64_t tone_fx,tone_fy,	//タイル開始位置でのセル位置
 		tone_fcos,tone_fsin;
+	const uint8_t *tone_mask;	//トーン:タイル全体の 1bit マスク (1 = 黒。キャンバス合成時)
 	BlendColorFunc func_blend;
 };
 
@@ -171,10 +172,28 @@ mlkbool __TileImage_resizeTileBuf(TileImage *p,int movx,int movy,int neww,int ne
 mlkbool __TileImage_resizeTileBuf_clone(TileImage *p,TileImage *src);
 
 void __TileImage_setBlendInfo(TileImageBlendInfo *info,int px,int py,const mRect *rcclip);
+void __TileImage_getTexAlphaRow_8bit(uint8_t *dst,const uint8_t *ps,int step,
+	const uint8_t *tex,int opacity,int w);
+void __TileImage_getTexAlphaRow_16bit(uint16_t *dst,const uint16_t *ps,int step,
+	const uint8_t *tex,int opacity,int w);
+void __TileImage_setBlendInfo_tone(TileImageBlendInfo *dst,const TileImageBlendSrcInfo *sinfo);
 
 int __TileImage_density_to_colval(int v,mlkbool rev);
 void __TileImage_getRotateRect(mRect *rcdst,int width,int height,double dcos,double dsin);
 
+/* tileimage_tilemem.c */
+
+mlkbool __TileImage_tilemem_init(void);
+void __TileImage_tilemem_finish(void);
+uint8_t *__TileImage_tilemem_alloc(int size);
+void __TileImage_tilemem_free(uint8_t *buf);
+
+/* tileimage_tonecache.c */
+
+void __TileImageToneCache_setKey(TileImageToneCache *p,TileImage *img,const TileImageBlendInfo *info);
+const uint8_t *__TileImageToneCache_getMask(TileImageToneCache *p,TileImage *img,
+	const TileImageBlendInfo *info,int index,const uint8_t *tile,int64_t fx,int64_t fy,uint8_t *buf);
+
 /* tileimage_pixel.c */
 
 uint8_t *__TileImage_getPixelBuf_new(TileImage *p,int x,int y);
@@ -100,6 +100,10 @@ mlkbool TileImage_init(void)
 
 	g_tileimg_work = p;
 
+	//タイルメモリ
+
+	if(!__TileImage_tilemem_init()) return FALSE;
+
 	//指先用バッファ
 
 	p->finger_buf = (uint8_t *)mMalloc(101 * 101 * 8);
@@ -131,6 +135,8 @@ void TileImage_finish(void)
 		mFree(p->finger_buf);
 		mFree(p);
 	}
+
+	__TileImage_tilemem_finish();
 }
 
 /** イメージのビット数をセット */
@@ -319,7 +325,7 @@ void TileImage_free(TileImage *p)
 			for(i = p->tilew * p->tileh; i; i--, pp++)
 			{
 				if(*pp && *pp != TILEIMAGE_TILE_EMPTY)
-					mFree(*pp);
+					__TileImage_tilemem_free(*pp);
 			}
 
 			mFree(p->ppbuf);
@@ -336,7 +342,7 @@ void TileImage_freeTile(uint8_t **pptile)
 	if(*pptile)
 	{
 		if(*pptile != TILEIMAGE_TILE_EMPTY)
-			mFree(*pptile);
+			__TileImage_tilemem_free(*pptile);
 
 		*pptile = NULL;
 	}
@@ -851,7 +857,7 @@ mlkbool TileImage_resizeTileBuf_forUndo(TileImage *p,TileImageInfo *info)
 
 uint8_t *TileImage_allocTile(TileImage *p)
 {
-	return (uint8_t *)mMallocAlign(p->tilesize, 16);
+	return __TileImage_tilemem_alloc(p->tilesize);
 }
 
 /** タイルを確保してクリア */
@@ -860,7 +866,7 @@ uint8_t *TileImage_allocTile_clear(TileImage *p)
 {
 	uint8_t *buf;
 
-	buf = (uint8_t *)mMallocAlign(p->tilesize, 16);
+	buf = __TileImage_tilemem_alloc(p->tilesize);
 	if(!buf) return NULL;
 
 	TileImage_clearTile(p, buf);
@@ -1296,36 +1302,6 @@ mlkbool TileImage_clipCanDrawRect(TileImage *p,mRect *rc)
 //=============================
 
 
-/* ImageCanvas 合成: トーン化の情報セット */
-
-static void _blendcanvas_set_tone_info(TileImageBlendInfo *dst,const TileImageBlendSrcInfo *sinfo)
-{
-	int n;
-	double dcell,dcos,dsin;
-
-	//固定濃度 (0 でなし)
-
-	if(sinfo->tone_density)
-		dst->tone_density = __TileImage_density_to_colval(sinfo->tone_density, FALSE);
-
-	//セル幅 (px)
-
-	dcell = TILEIMGWORK->dpi / (sinfo->tone_lines * 0.1);
-
-	//sin/cos
-	
-	n = sinfo->tone_angle * 512 / 360;
-
-	dcos = TABLEDATA_GET_COS(n);
-	dsin = TABLEDATA_GET_SIN(n);
-
-	//1px進むごとに加算する値
-	// :本来は dcos / dcell だが、モアレ防止の為、セル1周期がピクセル単位になるように調整。
-
-	dst->tone_fcos = (int64_t)round(1.0 / round(dcell / dcos) * TILEIMG_TONE_FIX_VAL);
-	dst->tone_fsin = (int64_t)round(1.0 / round(dcell / dsin) * TILEIMG_TONE_FIX_VAL);
-}
-
 /** ImageCanvas に合成
  *
  * - トーン化レイヤ対象外のカラータイプでは、トーン化は常に OFF に指定されていること。
@@ -1337,7 +1313,7 @@ void TileImage_blendToCanvas(TileImage *p,ImageCanvas *dst,
 {
 	TileImageTileRectInfo info;
 	TileImageBlendInfo binfo;
-	uint8_t **pptile;
+	uint8_t **pptile,maskbuf[64 * 64 / 8];
 	int ix,iy,px,py;
 	int64_t fxx,fxy,fyx,fyy,fsin64,fcos64;
 	TileImageColFunc_blendTile func;
@@ -1397,7 +1373,10 @@ void TileImage_blendToCanvas(TileImage *p,ImageCanvas *dst,
 
 		//情報セット
 
-		_blendcanvas_set_tone_info(&binfo, sinfo);
+		__TileImage_setBlendInfo_tone(&binfo, sinfo);
+
+		if(sinfo->tone_cache)
+			__TileImageToneCache_setKey(sinfo->tone_cache, p, &binfo);
 
 		//イメージ (0,0) 時点での初期位置
 		// :位置によって微妙に形が変わるので、適当な値でずらす。
@@ -1431,16 +1410,11 @@ void TileImage_blendToCanvas(TileImage *p,ImageCanvas *dst,
 
 					binfo.tile = *pptile;
 					binfo.dstbuf = dst->ppbuf + binfo.dy;
-					binfo.tone_fx = fxx;
-					binfo.tone_fy = fxy;
 
-					//タイル内の開始位置を加算
+					//トーンのマスク
 
-					if(binfo.sx || binfo.sy)
-					{
-						binfo.tone_fx += binfo.sx * binfo.tone_fcos - binfo.sy * binfo.tone_fsin;
-						binfo.tone_fy += binfo.sx * binfo.tone_fsin + binfo.sy * binfo.tone_fcos;
-					}
+					binfo.tone_mask = __TileImageToneCache_getMask(sinfo->tone_cache, p, &binfo,
+						pptile - p->ppbuf, *pptile, fxx, fxy, maskbuf);
 
 					(func)(p, &binfo);
 				}
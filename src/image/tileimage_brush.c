@@ -35,6 +35,7 @@ $*/
 #include "def_brushdraw.h"
 #include "table_data.h"
 #include "imagematerial.h"
+#include "apptrace.h"
 
 
 //-----------------
@@ -431,6 +432,9 @@ static void _drawbrush_free_curve(TileImage *p,int no,double x,double y,double p
 void TileImage_drawBrushFree(TileImage *p,int no,double x,double y,double pressure)
 {
 	TileImageBrushWorkData *pw = &TILEIMGWORK->brush;
+	AppTraceScope trace;
+
+	AppTrace_begin(&trace, APPTRACE_STROKE);
 
 	if(_BRUSHDP->flags & BRUSHDP_F_CURVE)
 	{
@@ -453,6 +457,8 @@ void TileImage_drawBrushFree(TileImage *p,int no,double x,double y,double pressu
 		ppt->y = y;
 		ppt->pressure = pressure;
 	}
+
+	AppTrace_end(&trace);
 }
 
 /** ブラシ:自由線描画 最後の線を描画 (曲線時) */
@@ -461,13 +467,18 @@ void TileImage_drawBrushFree_finish(TileImage *p,int no)
 {
 	int i;
 	TileImageCurvePoint pt;
+	AppTraceScope trace;
 
 	if(_BRUSHDP->flags & BRUSHDP_F_CURVE)
 	{
+		AppTrace_begin(&trace, APPTRACE_STROKE);
+
 		pt = TILEIMGWORK->brush.curve_pt[no][3];
 	
 		for(i = 0; i < 3; i++)
 			_drawbrush_free_curve(p, no, pt.x, pt.y, pt.pressure);
+
+		AppTrace_end(&trace);
 	}
 }
 
@@ -616,9 +627,12 @@ double TileImage_drawBrushLine(TileImage *p,
 void TileImage_drawBrushLine_headtail(TileImage *p,
 	double x1,double y1,double x2,double y2,uint32_t headtail)
 {
+	AppTraceScope trace;
 	int head,tail;
 	double t,dx,dy,d,xx,yy,xx2,yy2;
 
+	AppTrace_begin(&trace, APPTRACE_STROKE);
+
 	head = headtail >> 16;
 	tail = headtail & 0xffff;
 
@@ -665,6 +679,8 @@ void TileImage_drawBrushLine_headtail(TileImage *p,
 		if(tail)
 			TileImage_drawBrushLine(p, xx, yy, x2, y2, 1, 0, t);
 	}
+
+	AppTrace_end(&trace);
 }
 
 /** 四角形描画 */
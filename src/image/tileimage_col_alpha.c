@@ -91,6 +91,7 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64];
 	uint8_t **ppdst,*ps,*pd;
 	int pitchs,ix,iy,dx,dy,a,dstx;
 	int32_t src[3],dst[3],r,g,b;
@@ -110,6 +111,14 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_8bit(texbuf, ps, 1, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
 		
 		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps++, pd += 4)
@@ -118,9 +127,9 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			if(!a) continue;
 
 			if(info.imgtex)
-				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
-
-			a = a * info.opacity >> 7;
+				a = texbuf[dx - info.dx];
+			else
+				a = a * info.opacity >> 7;
 			if(!a) continue;
 
 			//色合成
@@ -343,6 +352,8 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64];
+	uint16_t abuf[64];
 	uint16_t **ppdst,*ps,*pd;
 	int pitchs,ix,iy,dx,dy,a,dstx;
 	int32_t src[3],dst[3],r,g,b;
@@ -362,6 +373,14 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_16bit(abuf, ps, 1, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
 		
 		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps++, pd += 4)
@@ -370,9 +389,9 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			if(!a) continue;
 
 			if(info.imgtex)
-				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
-
-			a = a * info.opacity >> 7;
+				a = abuf[dx - info.dx];
+			else
+				a = a * info.opacity >> 7;
 
 			if(!a) continue;
 
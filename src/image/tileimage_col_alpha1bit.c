@@ -235,10 +235,10 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64],amax = 255;
 	uint8_t **ppdst,*ps,*psY,*pd,fleft,f,fval;
-	int ix,iy,dx,dy,a,dstx,c,cx,cy,thval;
+	int ix,iy,dx,dy,a,dstx,mx,mrow;
 	int32_t src[3],dst[3],r,g,b;
-	int64_t fxx,fxy;
 
 	info = *infosrc;
 
@@ -254,17 +254,25 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	//
 
+	mrow = info.sy << 3;
+
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_8bit(texbuf, &amax, 0, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
 		ps = psY;
 		f = fleft;
 		fval = *(ps++);
-		fxx = info.tone_fx;
-		fxy = info.tone_fy;
 	
-		for(ix = info.w, dx = info.dx; ix;
-			ix--, dx++, pd += 4, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, dx = info.dx, mx = info.sx; ix;
+			ix--, dx++, mx++, pd += 4, f >>= 1)
 		{
 			if(!f)
 				f = 0x80, fval = *(ps++);
@@ -274,11 +282,9 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			//
 
 			if(info.imgtex)
-				a = ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy);
+				a = texbuf[dx - info.dx];
 			else
-				a = 255;
-
-			a = a * info.opacity >> 7;
+				a = 255 * info.opacity >> 7;
 
 			if(!a) continue;
 
@@ -301,24 +307,9 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			}
 			else
 			{
-				//固定濃度でなければ、色は常に黒
-				c = (info.tone_density)? 255 - info.tone_density: 0;
-
-				cx = fxx >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-				cy = fxy >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-
-				if(c < 128)
-				{
-					cx += TABLEDATA_TONE_WIDTH / 2;
-					cy += TABLEDATA_TONE_WIDTH / 2;
-				}
-
-				thval = TABLEDATA_TONE_GETVAL8(cx, cy);
+				//トーン表示
 
-				if(c < 128)
-					thval = 255 - thval;
-				
-				if(c > thval)
+				if(!(info.tone_mask[mrow + (mx >> 3)] & (0x80 >> (mx & 7))))
 				{
 					//透明 or 白
 
@@ -359,8 +350,7 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 		psY += 8;
 		ppdst++;
 
-		info.tone_fx -= info.tone_fsin;
-		info.tone_fy += info.tone_fcos;
+		mrow += 8;
 	}
 }
 
@@ -463,11 +453,12 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64];
+	uint16_t abuf[64],amax = 0x8000;
 	uint8_t *ps,*psY,fleft,f,fval;
 	uint16_t **ppdst,*pd;
-	int ix,iy,dx,dy,a,dstx,c,cx,cy,thval;
+	int ix,iy,dx,dy,a,dstx,mx,mrow;
 	int32_t src[3],dst[3],r,g,b;
-	int64_t fxx,fxy;
 
 	info = *infosrc;
 
@@ -483,17 +474,25 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	//
 
+	mrow = info.sy << 3;
+
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_16bit(abuf, &amax, 0, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
 		ps = psY;
 		f = fleft;
 		fval = *(ps++);
-		fxx = info.tone_fx;
-		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix;
-			ix--, dx++, pd += 4, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, dx = info.dx, mx = info.sx; ix;
+			ix--, dx++, mx++, pd += 4, f >>= 1)
 		{
 			if(!f)
 				f = 0x80, fval = *(ps++);
@@ -503,11 +502,9 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			//
 
 			if(info.imgtex)
-				a = (ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) << 15) / 255;
+				a = abuf[dx - info.dx];
 			else
-				a = 0x8000;
-
-			a = a * info.opacity >> 7;
+				a = 0x8000 * info.opacity >> 7;
 
 			if(!a) continue;
 
@@ -530,24 +527,9 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			}
 			else
 			{
-				//固定濃度でなければ、色は常に黒
-				c = (info.tone_density)? 0x8000 - info.tone_density: 0;
-
-				cx = fxx >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-				cy = fxy >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-
-				if(c < 0x4000)
-				{
-					cx += TABLEDATA_TONE_WIDTH / 2;
-					cy += TABLEDATA_TONE_WIDTH / 2;
-				}
-
-				thval = TABLEDATA_TONE_GETVAL16(cx, cy);
+				//トーン表示
 
-				if(c < 0x4000)
-					thval = 0x8000 - thval;
-				
-				if(c > thval)
+				if(!(info.tone_mask[mrow + (mx >> 3)] & (0x80 >> (mx & 7))))
 				{
 					//透明 or 白
 
@@ -588,8 +570,7 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 		psY += 8;
 		ppdst++;
 
-		info.tone_fx -= info.tone_fsin;
-		info.tone_fy += info.tone_fcos;
+		mrow += 8;
 	}
 }
 
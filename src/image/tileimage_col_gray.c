@@ -164,10 +164,10 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64];
 	uint8_t **ppdst,*ps,*pd,r,g,b;
-	int pitchs,ix,iy,dx,dy,a,c,dstx,cx,cy,thval;
+	int pitchs,ix,iy,dx,dy,a,c,dstx,mx,mrow;
 	int32_t src[3],dst[3];
-	int64_t fxx,fxy;
 
 	info = *infosrc;
 
@@ -182,22 +182,29 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	//
 
+	mrow = info.sy << 3;
+
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_8bit(texbuf, ps + 1, 2, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
-		fxx = info.tone_fx;
-		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 2, pd += 4,
-				fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, dx = info.dx, mx = info.sx; ix; ix--, dx++, mx++, ps += 2, pd += 4)
 		{
 			a = ps[1];
 			if(!a) continue;
 
 			if(info.imgtex)
-				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
-
-			a = a * info.opacity >> 7;
+				a = texbuf[dx - info.dx];
+			else
+				a = a * info.opacity >> 7;
 
 			if(!a) continue;
 
@@ -218,23 +225,7 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			{
 				//トーン表示
 				
-				c = (info.tone_density)? 255 - info.tone_density: ps[0];
-
-				cx = fxx >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-				cy = fxy >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-
-				if(c < 128)
-				{
-					cx += TABLEDATA_TONE_WIDTH / 2;
-					cy += TABLEDATA_TONE_WIDTH / 2;
-				}
-
-				thval = TABLEDATA_TONE_GETVAL8(cx, cy);
-
-				if(c < 128)
-					thval = 255 - thval;
-				
-				if(c > thval)
+				if(!(info.tone_mask[mrow + (mx >> 3)] & (0x80 >> (mx & 7))))
 				{
 					//透明 or 白
 
@@ -277,8 +268,7 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 		ps += pitchs;
 		ppdst++;
 
-		info.tone_fx -= info.tone_fsin;
-		info.tone_fy += info.tone_fcos;
+		mrow += 8;
 	}
 }
 
@@ -552,10 +542,11 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	uint8_t texbuf[64];
+	uint16_t abuf[64];
 	uint16_t **ppdst,*ps,*pd,r,g,b;
-	int pitchs,ix,iy,dx,dy,a,c,dstx,cx,cy,thval;
+	int pitchs,ix,iy,dx,dy,a,c,dstx,mx,mrow;
 	int32_t src[3],dst[3];
-	int64_t fxx,fxy;
 
 	info = *infosrc;
 
@@ -570,22 +561,29 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	//
 
+	mrow = info.sy << 3;
+
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
+		//テクスチャ (1行分のアルファ値)
+
+		if(info.imgtex)
+		{
+			ImageMaterial_getRow_forTexture(info.imgtex, texbuf, info.dx, dy, info.w);
+			__TileImage_getTexAlphaRow_16bit(abuf, ps + 1, 2, texbuf, info.opacity, info.w);
+		}
+
 		pd = *ppdst + dstx;
-		fxx = info.tone_fx;
-		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 2, pd += 4,
-				fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, dx = info.dx, mx = info.sx; ix; ix--, dx++, mx++, ps += 2, pd += 4)
 		{
 			a = ps[1];
 			if(!a) continue;
 
 			if(info.imgtex)
-				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
-
-			a = a * info.opacity >> 7;
+				a = abuf[dx - info.dx];
+			else
+				a = a * info.opacity >> 7;
 
 			if(!a) continue;
 
@@ -604,23 +602,7 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 			{
 				//トーン表示
 				
-				c = (info.tone_density)? 0x8000 - info.tone_density: ps[0];
-
-				cx = fxx >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-				cy = fxy >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
-
-				if(c < 0x4000)
-				{
-					cx += TABLEDATA_TONE_WIDTH / 2;
-					cy += TABLEDATA_TONE_WIDTH / 2;
-				}
-
-				thval = TABLEDATA_TONE_GETVAL16(cx, cy);
-
-				if(c < 0x4000)
-					thval = 0x8000 - thval;
-				
-				if(c > thval)
+				if(!(info.tone_mask[mrow + (mx >> 3)] & (0x80 >> (mx & 7))))
 				{
 					//透明 or 白
 
@@ -661,8 +643,7 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 		ps += pitchs;
 		ppdst++;
 
-		info.tone_fx -= info.tone_fsin;
-		info.tone_fy += info.tone_fcos;
+		mrow += 8;
 	}
 }
 
@@ -27,6 +27,7 @@ $*/
 
 #include "mlk.h"
 #include "mlk_rectbox.h"
+#include "mlk_thread.h"
 
 #include "tileimage.h"
 #include "def_tileimage.h"
@@ -670,27 +671,181 @@ void TileImage_drawFillBox(TileImage *p,int x,int y,int w,int h,void *col)
 	}
 }
 
+/* 濃度バッファから、1行分を描画 (アンチエイリアス時)
+ *
+ * 濃度が最大の範囲は、描画色のままセットする。
+ *
+ * buf: x の位置の濃度 (0〜255)
+ * col: 描画色 (アルファ値は変更される)
+ * srca: 描画色のアルファ値 */
+
+static void _fill_coverage_line(TileImage *p,int x,int y,const uint8_t *buf,int num,
+	void *drawcol,RGBAcombo *col,int srca,TileImageSetPixelFunc setpix)
+{
+	int c,bits;
+
+	bits = TILEIMGWORK->bits;
+
+	while(num > 0)
+	{
+		c = *buf;
+
+		if(c == 255)
+		{
+			//濃度最大が続く範囲
+
+			for(; num > 0 && *buf == 255; num--, buf++, x++)
+				(setpix)(p, x, y, drawcol);
+		}
+		else
+		{
+			if(c)
+			{
+				//濃度を適用
+
+				if(bits == 8)
+				{
+					col->c8.a = srca * c / 255;
+					(setpix)(p, x, y, &col->c8);
+				}
+				else
+				{
+					col->c16.a = srca * c / 255;
+					(setpix)(p, x, y, &col->c16);
+				}
+			}
+
+			num--, buf++, x++;
+		}
+	}
+}
+
+/* 多角形を描画 (アンチエイリアス)
+ *
+ * rc: 描画可能な範囲 */
+
+static void _fillpolygon_aa(TileImage *p,FillPolygon *fillpolygon,
+	void *drawcol,const mRect *rc,int ymin,int ymax)
+{
+	uint8_t *buf;
+	int y,x1,x2,srca;
+	TileImageSetPixelFunc setpix;
+	RGBAcombo col;
+
+	setpix = g_tileimage_dinfo.func_setpixel;
+
+	bitcol_to_RGBAcombo(&col, drawcol, TILEIMGWORK->bits);
+
+	srca = (TILEIMGWORK->bits == 8)? col.c8.a: col.c16.a;
+
+	for(y = ymin; y <= ymax; y++)
+	{
+		buf = FillPolygon_getCoverage_AA(fillpolygon, y, &x1, &x2);
+		if(!buf) continue;
+
+		//描画可能な X 範囲に調整
+
+		if(x1 < rc->x1)
+		{
+			buf += rc->x1 - x1;
+			x1 = rc->x1;
+		}
+
+		if(x2 > rc->x2) x2 = rc->x2;
+
+		if(x1 <= x2)
+			_fill_coverage_line(p, x1, y, buf, x2 - x1 + 1, drawcol, &col, srca, setpix);
+	}
+}
+
+/* 楕円塗りつぶし (アンチエイリアス)
+ *
+ * 楕円を多角形に変換して描画する。
+ * 弦による誤差が 1/32 px 程度以下になるように分割する。 */
+
+static void _fillellipse_aa(TileImage *p,
+	double cx,double cy,double xr,double yr,void *drawcol,
+	CanvasViewParam *param,mlkbool mirror)
+{
+	FillPolygon *fillpolygon;
+	mRect rc;
+	double r,t,step,u,v,x,y,dcos,dsin;
+	int i,num,ymin,ymax;
+
+	//分割数
+
+	r = (xr > yr)? xr: yr;
+
+	num = (int)ceil(4 * MLK_MATH_PI * sqrt(r));
+
+	if(num < 16) num = 16;
+	else if(num > 8192) num = 8192;
+
+	//頂点
+
+	fillpolygon = FillPolygon_new();
+	if(!fillpolygon) return;
+
+	dcos = param->cos;
+	dsin = param->sin;
+	step = 2 * MLK_MATH_PI / num;
+
+	for(i = 0; i < num; i++)
+	{
+		t = i * step;
+		u = xr * cos(t);
+		v = yr * sin(t);
+
+		x = u * dcos + v * dsin;
+		y = v * dcos - u * dsin;
+
+		if(mirror) x = -x;
+
+		FillPolygon_addPoint(fillpolygon, cx + x, cy + y);
+	}
+
+	//描画
+
+	if(FillPolygon_closePoint(fillpolygon))
+	{
+		TileImage_getCanDrawRect_pixel(p, &rc);
+
+		FillPolygon_getMinMaxY(fillpolygon, &ymin, &ymax);
+
+		if(ymin < rc.y1) ymin = rc.y1;
+		if(ymax > rc.y2) ymax = rc.y2;
+
+		if(ymin <= ymax && FillPolygon_beginDraw(fillpolygon, TRUE))
+			_fillpolygon_aa(p, fillpolygon, drawcol, &rc, ymin, ymax);
+	}
+
+	FillPolygon_free(fillpolygon);
+}
+
 /** 楕円塗りつぶし (キャンバスに対する) */
 
 void TileImage_drawFillEllipse(TileImage *p,
 	double cx,double cy,double xr,double yr,void *drawcol,mlkbool antialias,
 	CanvasViewParam *param,mlkbool mirror)
 {
-	int nx,ny,i,j,c,flag,srca,bits;
-	double xx,yy,rr,x1,y1,mx,my,xx2,yy2,xt,dcos,dsin;
-	mDoublePoint pt[4];
+	int nx,ny,i;
+	double xx,yy,rr,x1,y1,mx,my,xt,dcos,dsin;
 	mRect rc;
-	RGBAcombo col;
 	TileImageSetPixelFunc setpix = g_tileimage_dinfo.func_setpixel;
 
-	if(!antialias)
+	if(antialias)
 	{
-		cx = floor(cx) + 0.5;
-		cy = floor(cy) + 0.5;
-		xr = round(xr);
-		yr = round(yr);
+		_fillellipse_aa(p, cx, cy, xr, yr, drawcol, param, mirror);
+		return;
 	}
 
+	//---- 非アンチエイリアス
+
+	cx = floor(cx) + 0.5;
+	cy = floor(cy) + 0.5;
+	xr = round(xr);
+	yr = round(yr);
+
 	//--------- 描画範囲計算 (10度単位)
 
 	dcos = param->cosrev;
@@ -742,12 +897,6 @@ void TileImage_drawFillEllipse(TileImage *p,
 
 	//--------- 描画
 
-	bits = TILEIMGWORK->bits;
-
-	bitcol_to_RGBAcombo(&col, drawcol, bits);
-
-	srca = (bits == 8)? col.c8.a: col.c16.a;
-
 	dcos = param->cos;
 	dsin = param->sin;
 
@@ -759,87 +908,14 @@ void TileImage_drawFillEllipse(TileImage *p,
 
 		for(nx = rc.x1; nx <= rc.x2; nx++, xx += 1.0)
 		{
-			if(antialias)
-			{
-				//-------- アンチエイリアス (5x5)
-
-				//内外判定
-
-				pt[0].x = pt[3].x = xx;
-				pt[0].y = pt[1].y = yy;
-				pt[1].x = pt[2].x = xx + 1;
-				pt[2].y = pt[3].y = yy + 1;
-
-				for(i = 0, flag = 0; i < 4; i++)
-				{
-					xt = pt[i].x;
-					if(mirror) xt = -xt;
-
-					x1 = (xt * dcos - pt[i].y * dsin) * mx;
-					y1 = (xt * dsin + pt[i].y * dcos) * my;
-
-					if(x1 * x1 + y1 * y1 <= rr)
-						flag |= (1 << i);
-				}
-
-				if(flag == 0)
-					//円の範囲外
-					continue;
-				else if(flag == 15)
-				{
-					//四隅すべて範囲内 = 濃度最大
-					(setpix)(p, nx, ny, drawcol);
-					continue;
-				}
-
-				//5x5 平均
-
-				c = 0;
-
-				for(i = 0, yy2 = yy; i < 5; i++, yy2 += 0.2)
-				{
-					for(j = 0, xx2 = xx; j < 5; j++, xx2 += 0.2)
-					{
-						xt = xx2;
-						if(mirror) xt = -xt;
-
-						x1 = (xt * dcos - yy2 * dsin) * mx;
-						y1 = (xt * dsin + yy2 * dcos) * my;
-
-						if(x1 * x1 + y1 * y1 < rr)
-							c++;
-					}
-				}
-
-				c = srca * c / 25;
-
-				if(c)
-				{
-					if(bits == 8)
-					{
-						col.c8.a = c;
-						(setpix)(p, nx, ny, &col.c8);
-					}
-					else
-					{
-						col.c16.a = c;
-						(setpix)(p, nx, ny, &col.c16);
-					}
-				}
-			}
-			else
-			{
-				//--------- 非アンチエイリアス
-
-				xt = xx;
-				if(mirror) xt = -xt;
+			xt = xx;
+			if(mirror) xt = -xt;
 
-				x1 = (xt * dcos - yy * dsin) * mx;
-				y1 = (xt * dsin + yy * dcos) * my;
+			x1 = (xt * dcos - yy * dsin) * mx;
+			y1 = (xt * dsin + yy * dcos) * my;
 
-				if(x1 * x1 + y1 * y1 < rr)
-					(setpix)(p, nx, ny, drawcol);
-			}
+			if(x1 * x1 + y1 * y1 < rr)
+				(setpix)(p, nx, ny, drawcol);
 		}
 	}
 }
@@ -926,10 +1002,8 @@ mlkbool TileImage_drawFillPolygon(TileImage *p,FillPolygon *fillpolygon,
 	void *drawcol,mlkbool antialias)
 {
 	mRect rc;
-	int x,y,ymin,ymax,x1,x2,xmin,width,bits,srca;
-	uint16_t *aabuf,*ps;
+	int x,y,ymin,ymax,x1,x2;
 	TileImageSetPixelFunc setpix;
-	RGBAcombo col;
 
 	//描画する y の範囲
 	// :描画可能な Y 範囲内のみ
@@ -948,62 +1022,27 @@ mlkbool TileImage_drawFillPolygon(TileImage *p,FillPolygon *fillpolygon,
 	if(!FillPolygon_beginDraw(fillpolygon, antialias))
 		return FALSE;
 
+	//アンチエイリアス
+
 	if(antialias)
-		aabuf = FillPolygon_getAABuf(fillpolygon, &xmin, &width);
+	{
+		_fillpolygon_aa(p, fillpolygon, drawcol, &rc, ymin, ymax);
+		return TRUE;
+	}
 
-	//交点間描画
+	//非アンチエイリアス (交点間描画)
 
-	bits = TILEIMGWORK->bits;
 	setpix = g_tileimage_dinfo.func_setpixel;
 
-	bitcol_to_RGBAcombo(&col, drawcol, bits);
-
-	srca = (bits == 8)? col.c8.a: col.c16.a;
-
 	for(y = ymin; y <= ymax; y++)
 	{
-		if(antialias)
-		{
-			//アンチエイリアス
-
-			if(!FillPolygon_setXBuf_AA(fillpolygon, y))
-				continue;
+		if(!FillPolygon_getIntersection_noAA(fillpolygon, y))
+			continue;
 
-			for(x = 0, ps = aabuf; x < width; x++, ps++)
-			{
-				x1 = (*ps) >> 3; //Y オーバーサンプリング分を割る
-
-				if(x1 == 255)
-					(setpix)(p, xmin + x, y, drawcol);
-				else if(x1)
-				{
-					//濃度を適用
-					
-					if(bits == 8)
-					{
-						col.c8.a = srca * x1 / 255;
-						(setpix)(p, xmin + x, y, &col.c8);
-					}
-					else
-					{
-						col.c16.a = srca * x1 / 255;
-						(setpix)(p, xmin + x, y, &col.c16);
-					}
-				}
-			}
-		}
-		else
+		while(FillPolygon_getNextLine_noAA(fillpolygon, &x1, &x2))
 		{
-			//非アンチエイリアス
-
-			if(!FillPolygon_getIntersection_noAA(fillpolygon, y))
-				continue;
-
-			while(FillPolygon_getNextLine_noAA(fillpolygon, &x1, &x2))
-			{
-				for(x = x1; x <= x2; x++)
-					(setpix)(p, x, y, drawcol);
-			}
+			for(x = x1; x <= x2; x++)
+				(setpix)(p, x, y, drawcol);
 		}
 	}
 
@@ -1133,20 +1172,14 @@ static void _grad_getcolor_16bit(uint16_t *dst,const TileImageDrawGradInfo *info
 	dst[3] = n1 * info->density >> 8;
 }
 
-/** グラデーションの色取得
- *
- * [!] フィルタのグラデーションマップでも使う。
- *
- * pos: 0.0〜1.0 (範囲外の場合もあり) */
+/* 位置 [0.0-1.0] => 15bit 固定少数 (0〜32768) */
 
-void TileImage_getGradationColor(void *dstcol,double pos,const TileImageDrawGradInfo *info)
+static int _grad_pos_to_npos(double pos,int flags)
 {
 	double dtmp;
 	int npos;
 
-	//位置 [0.0-1.0] => 15bit 固定少数
-
-	if(info->flags & TILEIMAGE_DRAWGRAD_F_LOOP)
+	if(flags & TILEIMAGE_DRAWGRAD_F_LOOP)
 	{
 		//繰り返し
 		
@@ -1165,10 +1198,23 @@ void TileImage_getGradationColor(void *dstcol,double pos,const TileImageDrawGrad
 
 	//位置反転
 
-	if(info->flags & TILEIMAGE_DRAWGRAD_F_REVERSE)
+	if(flags & TILEIMAGE_DRAWGRAD_F_REVERSE)
 		npos = (1<<15) - npos;
 
-	//色取得
+	return npos;
+}
+
+/** グラデーションの色取得
+ *
+ * [!] フィルタのグラデーションマップでも使う。
+ *
+ * pos: 0.0〜1.0 (範囲外の場合もあり) */
+
+void TileImage_getGradationColor(void *dstcol,double pos,const TileImageDrawGradInfo *info)
+{
+	int npos;
+
+	npos = _grad_pos_to_npos(pos, info->flags);
 
 	if(TILEIMGWORK->bits == 8)
 		_grad_getcolor_8bit((uint8_t *)dstcol, info, npos);
@@ -1176,15 +1222,252 @@ void TileImage_getGradationColor(void *dstcol,double pos,const TileImageDrawGrad
 		_grad_getcolor_16bit((uint16_t *)dstcol, info, npos);
 }
 
-/* 色をセット */
 
-static void _grad_setpixel(TileImage *p,int x,int y,double pos,const TileImageDrawGradInfo *info)
+//---------------------
+// 描画
+//---------------------
+/*
+ - 位置 (15bit) ごとの色を、先にテーブル (LUT) として作成しておく。
+ - タイル単位で、1行ごとに位置をまとめて計算し、テーブルから色を取得してセットする。
+ - タイルの各行をジョブとして、並列処理する。
+   描画先のタイル配列は、先にキャンバス全体を含むようにリサイズしておく。
+*/
+
+#define _GRAD_LUT_NUM  ((1<<15) + 1)
+
+typedef struct _thdata_grad _thdata_grad;
+
+/* 1行分の位置 (15bit) を取得する関数 */
+typedef void (*_grad_spanfunc)(_thdata_grad *p,int x,int y,int w,int *dst);
+
+struct _thdata_grad
 {
-	uint64_t col;
+	TileImage *img;
+	uint8_t *lut;		//位置ごとの色
+	mRect rc,			//描画範囲 (px)
+		rctile,			//描画範囲 (タイル)
+		*rcjob;			//各ジョブで描画された範囲
+	_grad_spanfunc func;
+	int x1,y1,x2,y2,
+		flags,
+		colsize;		//LUT の1色のバイト数
+	double d[3];		//形状ごとのパラメータ
+};
+
+
+/* 色のテーブルを作成 */
+
+static uint8_t *_grad_create_lut(const TileImageDrawGradInfo *info,int *colsize)
+{
+	uint8_t *buf,*pd;
+	int i,size;
+
+	size = (TILEIMGWORK->bits == 8)? 4: 8;
+
+	buf = (uint8_t *)mMalloc(size * _GRAD_LUT_NUM);
+	if(!buf) return NULL;
+
+	pd = buf;
+
+	for(i = 0; i < _GRAD_LUT_NUM; i++, pd += size)
+	{
+		if(size == 4)
+			_grad_getcolor_8bit(pd, info, i);
+		else
+			_grad_getcolor_16bit((uint16_t *)pd, info, i);
+	}
+
+	*colsize = size;
+
+	return buf;
+}
+
+/* スレッド: タイル1行分を描画 */
+
+static int _grad_job(int no,void *param)
+{
+	_thdata_grad *p = (_thdata_grad *)param;
+	TileImage *img = p->img;
+	mRect rc,*rcdraw;
+	int tx,ty,x,y,w,i,npos[64];
+	uint8_t *lut;
+
+	ty = p->rctile.y1 + no;
+	rcdraw = p->rcjob + no;
+	lut = p->lut;
+
+	mRectEmpty(rcdraw);
+
+	for(tx = p->rctile.x1; tx <= p->rctile.x2; tx++)
+	{
+		//タイルの範囲 (px)
+		
+		TileImage_tile_to_pixel(img, tx, ty, &rc.x1, &rc.y1);
+
+		rc.x2 = rc.x1 + 63;
+		rc.y2 = rc.y1 + 63;
+
+		if(!mRectClipRect(&rc, &p->rc)) continue;
+
+		w = rc.x2 - rc.x1 + 1;
+
+		//各行
+		
+		for(y = rc.y1; y <= rc.y2; y++)
+		{
+			(p->func)(p, rc.x1, y, w, npos);
+
+			for(i = 0, x = rc.x1; i < w; i++, x++)
+			{
+				TileImage_setPixel_draw_direct_parallel(img, x, y,
+					lut + npos[i] * p->colsize, rcdraw);
+			}
+		}
+	}
+
+	return 0;
+}
+
+/* 描画 (共通) */
+
+static void _grad_draw(_thdata_grad *dat,TileImage *p,int x1,int y1,int x2,int y2,
+	const mRect *rcdraw,const TileImageDrawGradInfo *info)
+{
+	int i,num;
+
+	dat->img = p;
+	dat->rc = *rcdraw;
+	dat->x1 = x1;
+	dat->y1 = y1;
+	dat->x2 = x2;
+	dat->y2 = y2;
+	dat->flags = info->flags;
+
+	if(mRectIsEmpty(&dat->rc)) return;
+
+	//色テーブル
+
+	dat->lut = _grad_create_lut(info, &dat->colsize);
+	if(!dat->lut) return;
+
+	//描画先のタイル配列をリサイズ
+
+	if(!TileImage_setPixel_draw_beginParallel(p)) goto END;
+
+	//描画範囲のタイル
+
+	dat->rctile = dat->rc;
+
+	TileImage_pixel_to_tile_rect(p, &dat->rctile);
+
+	if(!mRectClipBox_d(&dat->rctile, 0, 0, p->tilew, p->tileh))
+		goto END;
+
+	num = dat->rctile.y2 - dat->rctile.y1 + 1;
+
+	dat->rcjob = (mRect *)mMalloc(sizeof(mRect) * num);
+	if(!dat->rcjob) goto END;
+
+	//描画
+
+	mThreadRunParallel(num, _grad_job, dat);
+
+	for(i = 0; i < num; i++)
+		mRectUnion(&g_tileimage_dinfo.rcdraw, dat->rcjob + i);
+
+	mFree(dat->rcjob);
+
+END:
+	mFree(dat->lut);
+}
+
+/* 1行の位置: 線形 */
+
+static void _grad_span_line(_thdata_grad *p,int x,int y,int w,int *dst)
+{
+	double abx,abab,abap;
+
+	abx = p->d[0];
+	abab = p->d[2];
+
+	//整数値なので、加算しても誤差は出ない
+
+	abap = abx * (x - p->x1) + p->d[1] * (y - p->y1);
+
+	for(; w > 0; w--, abap += abx)
+		*(dst++) = _grad_pos_to_npos(abap / abab, p->flags);
+}
+
+/* 1行の位置: 円形 */
+
+static void _grad_span_circle(_thdata_grad *p,int x,int y,int w,int *dst)
+{
+	double dx,dy,len;
+
+	len = p->d[0];
+
+	dy = y - p->y1;
+	dy *= dy;
 
-	TileImage_getGradationColor(&col, pos, info);
+	for(dx = x - p->x1; w > 0; w--, dx += 1)
+		*(dst++) = _grad_pos_to_npos(sqrt(dx * dx + dy) / len, p->flags);
+}
+
+/* 1行の位置: 矩形 */
+
+static void _grad_span_box(_thdata_grad *p,int x,int y,int w,int *dst)
+{
+	int x1,abs_y;
+	double xx,yy,dx,dy,len,tmpx,tmp;
+
+	dx = p->d[0];
+	dy = p->d[1];
+	len = p->d[2];
+	x1 = p->x1;
+
+	abs_y = (p->y1 < y)? y - p->y1: p->y1 - y;
+	tmpx = abs_y * dx;
+
+	for(; w > 0; w--, x++)
+	{
+		xx = (x1 < x)? x - x1: x1 - x;
+		yy = abs_y;
+
+		if(p->y1 == p->y2)
+			yy = 0;
+		else if(xx < tmpx)
+			xx = tmpx;
+
+		if(x1 == p->x2)
+			xx = 0;
+		else
+		{
+			tmp = xx * dy;
+			if(yy < tmp) yy = tmp;
+		}
+
+		*(dst++) = _grad_pos_to_npos(sqrt(xx * xx + yy * yy) / len, p->flags);
+	}
+}
+
+/* 1行の位置: 放射状 */
+
+static void _grad_span_radial(_thdata_grad *p,int x,int y,int w,int *dst)
+{
+	double dy,top,pos,tmp,dx;
+
+	top = p->d[0];
+	dy = y - p->y1;
 
-	TileImage_setPixel_draw_direct(p, x, y, &col);
+	for(dx = x - p->x1; w > 0; w--, dx += 1)
+	{
+		pos = (-atan2(dy, dx) - top) * 0.5 / MLK_MATH_PI;
+		pos = modf(pos, &tmp);
+
+		if(pos < 0) pos += 1.0;
+	
+		*(dst++) = _grad_pos_to_npos(pos, p->flags);
+	}
 }
 
 /** グラデーション:線形
@@ -1194,29 +1477,20 @@ static void _grad_setpixel(TileImage *p,int x,int y,double pos,const TileImageDr
 void TileImage_drawGradation_line(TileImage *p,
 	int x1,int y1,int x2,int y2,const mRect *rcdraw,const TileImageDrawGradInfo *info)
 {
-	double abx,aby,abab,abap,yy;
-	int ix,iy;
-	mRect rc;
+	_thdata_grad dat;
+	double abx,aby;
 
 	if(x1 == x2 && y1 == y2) return;
 
-	rc = *rcdraw;
-
 	abx = x2 - x1;
 	aby = y2 - y1;
-	abab = abx * abx + aby * aby;
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		yy = aby * (iy - y1);
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			abap = abx * (ix - x1) + yy;
-		
-			_grad_setpixel(p, ix, iy, abap / abab, info);
-		}
-	}
+	dat.func = _grad_span_line;
+	dat.d[0] = abx;
+	dat.d[1] = aby;
+	dat.d[2] = abx * abx + aby * aby;
+
+	_grad_draw(&dat, p, x1, y1, x2, y2, rcdraw, info);
 }
 
 /** グラデーション:円形 */
@@ -1224,31 +1498,18 @@ void TileImage_drawGradation_line(TileImage *p,
 void TileImage_drawGradation_circle(TileImage *p,
 	int x1,int y1,int x2,int y2,const mRect *rcdraw,const TileImageDrawGradInfo *info)
 {
-	int ix,iy;
-	double dx,dy,len;
-	mRect rc;
+	_thdata_grad dat;
+	double dx,dy;
 
 	if(x1 == x2 && y1 == y2) return;
 
-	rc = *rcdraw;
-
 	dx = x2 - x1;
 	dy = y2 - y1;
-	
-	len = sqrt(dx * dx + dy * dy);
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		dy = iy - y1;
-		dy *= dy;
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			dx = ix - x1;
-		
-			_grad_setpixel(p, ix, iy, sqrt(dx * dx + dy) / len, info);
-		}
-	}
+	dat.func = _grad_span_circle;
+	dat.d[0] = sqrt(dx * dx + dy * dy);
+
+	_grad_draw(&dat, p, x1, y1, x2, y2, rcdraw, info);
 }
 
 /** グラデーション:矩形 */
@@ -1256,50 +1517,20 @@ void TileImage_drawGradation_circle(TileImage *p,
 void TileImage_drawGradation_box(TileImage *p,
 	int x1,int y1,int x2,int y2,const mRect *rcdraw,const TileImageDrawGradInfo *info)
 {
-	int ix,iy,abs_y;
-	double xx,yy,dx,dy,len,tmpx,tmp;
-	mRect rc;
+	_thdata_grad dat;
+	double xx,yy;
 
 	if(x1 == x2 && y1 == y2) return;
 
-	rc = *rcdraw;
-
 	xx = abs(x2 - x1);
 	yy = abs(y2 - y1);
 
-	len = sqrt(xx * xx + yy * yy);
+	dat.func = _grad_span_box;
+	dat.d[0] = (y1 == y2)? 0: xx / yy;
+	dat.d[1] = (x1 == x2)? 0: yy / xx;
+	dat.d[2] = sqrt(xx * xx + yy * yy);
 
-	dx = (y1 == y2)? 0: xx / yy;
-	dy = (x1 == x2)? 0: yy / xx;
-
-	//
-
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		abs_y = (y1 < iy)? iy - y1: y1 - iy;
-		tmpx = abs_y * dx;
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			xx = (x1 < ix)? ix - x1: x1 - ix;
-			yy = abs_y;
-
-			if(y1 == y2)
-				yy = 0;
-			else if(xx < tmpx)
-				xx = tmpx;
-
-			if(x1 == x2)
-				xx = 0;
-			else
-			{
-				tmp = xx * dy;
-				if(yy < tmp) yy = tmp;
-			}
-		
-			_grad_setpixel(p, ix, iy, sqrt(xx * xx + yy * yy) / len, info);
-		}
-	}
+	_grad_draw(&dat, p, x1, y1, x2, y2, rcdraw, info);
 }
 
 /** グラデーション:放射状 */
@@ -1307,30 +1538,14 @@ void TileImage_drawGradation_box(TileImage *p,
 void TileImage_drawGradation_radial(TileImage *p,
 	int x1,int y1,int x2,int y2,const mRect *rcdraw,const TileImageDrawGradInfo *info)
 {
-	int ix,iy;
-	double dy,top,pos,tmp;
-	mRect rc;
+	_thdata_grad dat;
 
 	if(x1 == x2 && y1 == y2) return;
 
-	rc = *rcdraw;
-
-	top = -atan2(y2 - y1, x2 - x1);
+	dat.func = _grad_span_radial;
+	dat.d[0] = -atan2(y2 - y1, x2 - x1);
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		dy = iy - y1;
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			pos = (-atan2(dy, ix - x1) - top) * 0.5 / MLK_MATH_PI;
-			pos = modf(pos, &tmp);
-
-			if(pos < 0) pos += 1.0;
-		
-			_grad_setpixel(p, ix, iy, pos, info);
-		}
-	}
+	_grad_draw(&dat, p, x1, y1, x2, y2, rcdraw, info);
 }
 
 
@@ -26,6 +26,8 @@ $*/
 #include "mlk_pixbuf.h"
 #include "mlk_popup_progress.h"
 #include "mlk_rectbox.h"
+#include "mlk_thread.h"
+#include "mlk_simd.h"
 
 #include "def_tileimage.h"
 #include "tileimage.h"
@@ -33,17 +35,68 @@ $*/
 #include "pv_tileimage.h"
 
 #include "canvasinfo.h"
+#include "imagematerial.h"
+#include "table_data.h"
 
 
-/** カラータイプ変換
- *
- * lum_to_alpha: 色の輝度をアルファ値へ変換 */
+//----------------
 
-void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
+#define _CONVERT_JOB_TILES  64	//変換時、1つのジョブで処理するタイル数
+
+/* カラータイプ変換用 */
+
+typedef struct
+{
+	TileImage *img;
+	int srctype;
+	mlkbool lum_to_alpha;
+}_thdata_coltype;
+
+/* ビット数変換用 */
+
+typedef struct
+{
+	TileImage **imgs;
+	uint32_t *jobtop;	//各イメージの先頭のジョブ番号 (num + 1 個)
+	void *tblbuf;
+	mPopupProgress *prog;
+	int num,bits;
+}_thdata_bits;
+
+//----------------
+
+
+/* ジョブ番号から、処理するタイルの範囲を取得 */
+
+static uint8_t **_get_job_tiles(TileImage *p,int no,uint32_t *num)
+{
+	uint32_t top,n;
+
+	top = (uint32_t)no * _CONVERT_JOB_TILES;
+	n = p->tilew * p->tileh - top;
+
+	if(n > _CONVERT_JOB_TILES) n = _CONVERT_JOB_TILES;
+
+	*num = n;
+
+	return p->ppbuf + top;
+}
+
+/* イメージのジョブ数 */
+
+static uint32_t _get_job_num(TileImage *p)
+{
+	return (p->tilew * p->tileh + _CONVERT_JOB_TILES - 1) / _CONVERT_JOB_TILES;
+}
+
+/* [スレッド] カラータイプ変換 */
+
+static int _convert_coltype_job(int no,void *param)
 {
+	_thdata_coltype *dat = (_thdata_coltype *)param;
+	TileImage *p = dat->img;
 	uint8_t *tilebuf,**pp;
 	uint32_t i;
-	int srctype;
 	TileImageColFunc_getTileRGBA func_gettile;
 	TileImageColFunc_setTileRGBA func_settile;
 	TileImageColFunc_isTransparentTile func_is_trans;
@@ -51,27 +104,19 @@ void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
 	//作業用タイルバッファ (RGBA 分)
 
 	tilebuf = TileImage_global_allocTileBitMax();
-	if(!tilebuf) return;
-
-	//タイプ変更
-
-	srctype = p->type;
-
-	p->type = newtype;
-
-	__TileImage_setTileSize(p);
+	if(!tilebuf) return 1;
 
 	//関数
 
-	func_gettile = TILEIMGWORK->colfunc[srctype].gettile_rgba;
-	func_settile = TILEIMGWORK->colfunc[newtype].settile_rgba;
-	func_is_trans = TILEIMGWORK->colfunc[newtype].is_transparent_tile;
+	func_gettile = TILEIMGWORK->colfunc[dat->srctype].gettile_rgba;
+	func_settile = TILEIMGWORK->colfunc[p->type].settile_rgba;
+	func_is_trans = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
 
 	//タイル変換
 
-	pp = p->ppbuf;
+	pp = _get_job_tiles(p, no, &i);
 
-	for(i = p->tilew * p->tileh; i; i--, pp++)
+	for(; i; i--, pp++)
 	{
 		if(!(*pp)) continue;
 		
@@ -81,18 +126,18 @@ void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
 
 		//タイル再確保
 
-		mFree(*pp);
+		TileImage_freeTile(pp);
 
 		*pp = TileImage_allocTile(p);
 		if(!(*pp))
 		{
 			mFree(tilebuf);
-			return;
+			return 1;
 		}
 
 		//RGBA タイルからセット
 
-		(func_settile)(*pp, tilebuf, lum_to_alpha);
+		(func_settile)(*pp, tilebuf, dat->lum_to_alpha);
 
 		//すべて透明なら解放
 
@@ -101,11 +146,39 @@ void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
 	}
 
 	mFree(tilebuf);
+
+	return 0;
+}
+
+/** カラータイプ変換
+ *
+ * タイル単位で並列処理する。
+ *
+ * lum_to_alpha: 色の輝度をアルファ値へ変換 */
+
+void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
+{
+	_thdata_coltype dat;
+
+	dat.img = p;
+	dat.srctype = p->type;
+	dat.lum_to_alpha = lum_to_alpha;
+
+	//タイプ変更
+
+	p->type = newtype;
+
+	__TileImage_setTileSize(p);
+
+	//タイル変換
+
+	mThreadRunParallel(_get_job_num(p), _convert_coltype_job, &dat);
 }
 
 /** タイルを指定ビット数に変換してコピー
  *
- * tilesize は新しいビット数の値になっていること。 */
+ * tilesize は新しいビット数の値になっていること。
+ * SIMD 有効時は、テーブルと同じ値を計算で求める。 */
 
 void TileImage_copyTile_convert(TileImage *p,uint8_t *dst,uint8_t *src,void *tblbuf,int bits)
 {
@@ -118,9 +191,50 @@ void TileImage_copyTile_convert(TileImage *p,uint8_t *dst,uint8_t *src,void *tbl
 	if(bits == 8)
 	{
 		//16->8bit
+		// :(v * 255 + 0x4000) >> 15
 		
 		ps16 = (uint16_t *)src;
 		pd8 = dst;
+
+	#if MLK_ENABLE_AVX2 && _TILEIMG_SIMD_ON
+		__m256i v256,c256;
+		__m128i v1,v2;
+
+		c256 = _mm256_set1_epi32(0x4000);
+
+		for(; i >= 16; i -= 16, ps16 += 16, pd8 += 16)
+		{
+			v256 = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i *)ps16));
+			v256 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(v256, 8), v256), c256), 15);
+			v1 = _mm_packs_epi32(_mm256_castsi256_si128(v256), _mm256_extracti128_si256(v256, 1));
+
+			v256 = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i *)(ps16 + 8)));
+			v256 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(v256, 8), v256), c256), 15);
+			v2 = _mm_packs_epi32(_mm256_castsi256_si128(v256), _mm256_extracti128_si256(v256, 1));
+
+			_mm_storeu_si128((__m128i *)pd8, _mm_packus_epi16(v1, v2));
+		}
+	#elif MLK_ENABLE_SSE2 && _TILEIMG_SIMD_ON
+		__m128i v,v1,v2,c,zero;
+
+		c = _mm_set1_epi32(0x4000);
+		zero = _mm_setzero_si128();
+
+		for(; i >= 8; i -= 8, ps16 += 8, pd8 += 8)
+		{
+			v = _mm_loadu_si128((__m128i *)ps16);
+
+			v1 = _mm_unpacklo_epi16(v, zero);
+			v1 = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(v1, 8), v1), c), 15);
+
+			v2 = _mm_unpackhi_epi16(v, zero);
+			v2 = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(v2, 8), v2), c), 15);
+
+			v = _mm_packs_epi32(v1, v2);
+
+			_mm_storel_epi64((__m128i *)pd8, _mm_packus_epi16(v, v));
+		}
+	#endif
 		
 		for(; i; i--, ps16++)
 			*(pd8++) = *((uint8_t *)tblbuf + *ps16);
@@ -128,44 +242,87 @@ void TileImage_copyTile_convert(TileImage *p,uint8_t *dst,uint8_t *src,void *tbl
 	else
 	{
 		//8->16bit
+		// :x = v * 128, x + (x + 127) / 255
+		// :(x / 255 は、(x + 1 + (x >> 8)) >> 8 で求める)
 		
 		ps8 = src;
 		pd16 = (uint16_t *)dst;
+		i >>= 1;
+
+	#if MLK_ENABLE_AVX2 && _TILEIMG_SIMD_ON
+		__m256i x,y,c127,c1;
+
+		c127 = _mm256_set1_epi16(127);
+		c1 = _mm256_set1_epi16(1);
+
+		for(; i >= 16; i -= 16, ps8 += 16, pd16 += 16)
+		{
+			x = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)ps8)), 7);
+			y = _mm256_add_epi16(x, c127);
+			y = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(y, c1), _mm256_srli_epi16(y, 8)), 8);
+
+			_mm256_storeu_si256((__m256i *)pd16, _mm256_add_epi16(x, y));
+		}
+	#elif MLK_ENABLE_SSE2 && _TILEIMG_SIMD_ON
+		__m128i v,x,y,c127,c1,zero;
+		int j;
+
+		c127 = _mm_set1_epi16(127);
+		c1 = _mm_set1_epi16(1);
+		zero = _mm_setzero_si128();
+
+		for(; i >= 16; i -= 16, ps8 += 16)
+		{
+			v = _mm_loadu_si128((__m128i *)ps8);
+
+			for(j = 0; j < 2; j++, pd16 += 8)
+			{
+				x = (j == 0)? _mm_unpacklo_epi8(v, zero): _mm_unpackhi_epi8(v, zero);
+				x = _mm_slli_epi16(x, 7);
+				y = _mm_add_epi16(x, c127);
+				y = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(y, c1), _mm_srli_epi16(y, 8)), 8);
+
+				_mm_storeu_si128((__m128i *)pd16, _mm_add_epi16(x, y));
+			}
+		}
+	#endif
 		
-		for(i >>= 1; i; i--, ps8++)
+		for(; i; i--, ps8++)
 			*(pd16++) = *((uint16_t *)tblbuf + *ps8);
 	}
 }
 
-/** ビット数の変換 (8bit <-> 16bit)
- *
- * bits: 変換後のビット数
- * tblbuf: 変換用テーブル */
+/* [スレッド] ビット数変換 */
 
-void TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *prog)
+static int _convert_bits_job(int no,void *param)
 {
+	_thdata_bits *dat = (_thdata_bits *)param;
+	TileImage *p;
 	uint8_t **pptile,*newbuf;
 	uint32_t i;
+	int low,high,mid;
 
-	//A1bit はそのまま
-	
-	if(p->type == TILEIMAGE_COLTYPE_ALPHA1BIT)
+	//ジョブ番号から、イメージを検索
+
+	low = 0, high = dat->num - 1;
+
+	while(low < high)
 	{
-		mPopupProgressThreadAddPos(prog, 5);
-		return;
-	}
+		mid = (low + high + 1) / 2;
 
-	//タイルサイズ変更 (タイル確保前に行うこと)
+		if(dat->jobtop[mid] <= (uint32_t)no)
+			low = mid;
+		else
+			high = mid - 1;
+	}
 
-	p->tilesize = TileImage_global_getTileSize(p->type, bits);
+	p = dat->imgs[low];
 
 	//タイル変換
 
-	mPopupProgressThreadSubStep_begin(prog, 5, p->tilew * p->tileh);
-
-	pptile = p->ppbuf;
+	pptile = _get_job_tiles(p, no - dat->jobtop[low], &i);
 
-	for(i = p->tilew * p->tileh; i; i--, pptile++)
+	for(; i; i--, pptile++)
 	{
 		if(*pptile)
 		{
@@ -176,17 +333,100 @@ void TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *pr
 			//変換
 
 			if(newbuf)
-				TileImage_copyTile_convert(p, newbuf, *pptile, tblbuf, bits);
+				TileImage_copyTile_convert(p, newbuf, *pptile, dat->tblbuf, dat->bits);
 
 			//置き換え (NULL の場合も常に)
 
-			mFree(*pptile);
+			TileImage_freeTile(pptile);
 
 			*pptile = newbuf;
 		}
+	}
 
-		mPopupProgressThreadSubStep_inc(prog);
+	mPopupProgressThreadSubStep_inc(dat->prog);
+
+	return 0;
+}
+
+/** 複数イメージのビット数をまとめて変換 (8bit <-> 16bit)
+ *
+ * すべてのイメージのタイルを、並列で処理する。
+ * 進捗は、1イメージにつき 5 ステップ。
+ *
+ * bits: 変換後のビット数
+ * tblbuf: 変換用テーブル
+ * return: FALSE でメモリ不足 (何も変換されていない) */
+
+mlkbool TileImage_convertBits_multi(TileImage **imgs,int num,int bits,void *tblbuf,mPopupProgress *prog)
+{
+	_thdata_bits dat;
+	TileImage *p;
+	uint32_t *jobtop,jobtop1[2],jobnum;
+	int i;
+
+	//イメージが1つの場合は確保しない (メモリ不足時に1つずつ変換する場合)
+
+	if(num == 1)
+		jobtop = jobtop1;
+	else
+	{
+		jobtop = (uint32_t *)mMalloc(sizeof(uint32_t) * (num + 1));
+		if(!jobtop) return FALSE;
+	}
+
+	//タイルサイズ変更 (タイル確保前に行うこと) と、ジョブ数
+	//(A1bit はそのまま)
+
+	jobnum = 0;
+
+	for(i = 0; i < num; i++)
+	{
+		p = imgs[i];
+		jobtop[i] = jobnum;
+
+		if(p->type != TILEIMAGE_COLTYPE_ALPHA1BIT)
+		{
+			p->tilesize = TileImage_global_getTileSize(p->type, bits);
+
+			jobnum += _get_job_num(p);
+		}
+	}
+
+	jobtop[num] = jobnum;
+
+	//変換
+
+	if(!jobnum)
+		mPopupProgressThreadAddPos(prog, num * 5);
+	else
+	{
+		mPopupProgressThreadSubStep_begin(prog, num * 5, jobnum);
+
+		dat.imgs = imgs;
+		dat.jobtop = jobtop;
+		dat.tblbuf = tblbuf;
+		dat.prog = prog;
+		dat.num = num;
+		dat.bits = bits;
+
+		mThreadRunParallel(jobnum, _convert_bits_job, &dat);
 	}
+
+	if(jobtop != jobtop1)
+		mFree(jobtop);
+
+	return TRUE;
+}
+
+/** ビット数の変換 (8bit <-> 16bit)
+ *
+ * bits: 変換後のビット数
+ * tblbuf: 変換用テーブル
+ * return: FALSE でメモリ不足 (変換されていない) */
+
+mlkbool TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *prog)
+{
+	return TileImage_convertBits_multi(&p, 1, bits, tblbuf, prog);
 }
 
 /** src のイメージを dst の同じ位置にコピー
@@ -302,202 +542,520 @@ void TileImage_replaceColor_col_to_col(TileImage *p,void *srccol,void *dstcol)
 //===============================
 // イメージ結合
 //===============================
+/*
+ * - dst のタイルごとにジョブを分け、各 px で、すべての結合元を順に合成する。
+ * - 結合先が RGBA タイプの場合、合成途中の色は保持しておき、タイルへは最後に一度だけセットする。
+ *   (他のタイプでは、タイプ変換後の色で次の結合元を合成するため、毎回セットする)
+ */
+
+
+typedef struct
+{
+	TileImage *dst;
+	const TileImageCombineInfo *info;
+	TileImageBlendInfo *binfo;	//各結合元の合成情報 (num 個)
+	mRect rc;		//全体の処理範囲 (px)
+	int num,
+		tx,ty,tw,	//処理するタイル範囲 (dst)
+		keep_color;	//結合先の色を保持して処理するか
+	mPopupProgress *prog;
+}_thdata_combine;
 
 
-/* イメージ結合: 8bit */
+/* 結合元の色を取得 (8bit)
+ *
+ * テクスチャ、トーン化、不透明度を適用する。 */
 
-static void _combine_8bit(TileImage *dst,TileImage *src,mRect *rc,int opasrc,int opadst,
-	int blendmode,mPopupProgress *prog)
+static void _combine_get_srccol_8bit(TileImage *img,const TileImageBlendInfo *info,int x,int y,RGBA8 *dst)
 {
-	int ix,iy,dst_rawa,ret;
-	int32_t csrc[3],cdst[3];
-	RGBA8 colsrc,coldst;
-	BlendColorFunc func_blend;
-	TileImagePixelColorFunc func_pix;
+	int a,c,cx,cy,thval;
 
-	func_blend = TILEIMGWORK->blendfunc[blendmode];
-	func_pix = TILEIMGWORK->pixcolfunc[TILEIMAGE_PIXELCOL_NORMAL];
+	TileImage_getPixel(img, x, y, dst);
 
-	for(iy = rc->y1; iy <= rc->y2; iy++)
+	a = dst->a;
+	if(!a) return;
+
+	if(info->imgtex)
+		a = a * ImageMaterial_getPixel_forTexture(info->imgtex, x, y) / 255;
+
+	a = a * info->opacity >> 7;
+
+	//トーン化
+
+	if(a && info->is_tone)
 	{
-		for(ix = rc->x1; ix <= rc->x2; ix++)
+		if(info->tone_density)
+			c = 255 - info->tone_density;
+		else if(img->type == TILEIMAGE_COLTYPE_ALPHA1BIT)
+			c = 0;
+		else
+			c = dst->r;
+
+		cx = (info->tone_fx + x * info->tone_fcos - y * info->tone_fsin) >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
+		cy = (info->tone_fy + x * info->tone_fsin + y * info->tone_fcos) >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
+
+		if(c < 128)
 		{
-			//----- src 色
-			
-			TileImage_getPixel(src, ix, iy, &colsrc);
+			cx += TABLEDATA_TONE_WIDTH / 2;
+			cy += TABLEDATA_TONE_WIDTH / 2;
+		}
 
-			colsrc.a = colsrc.a * opasrc >> 7;
+		thval = TABLEDATA_TONE_GETVAL8(cx, cy);
 
-			//------ dst
+		if(c < 128)
+			thval = 255 - thval;
 
-			TileImage_getPixel(dst, ix, iy, &coldst);
+		if(c > thval)
+		{
+			//透明 or 白
 
-			//両方透明なら処理なし
-			
-			if(colsrc.a == 0 && coldst.a == 0) continue;
+			if(info->is_tone_bkgnd_tp)
+				a = 0;
+			else
+				dst->r = dst->g = dst->b = 255;
+		}
+		else
+		{
+			dst->r = img->col.c8.r;
+			dst->g = img->col.c8.g;
+			dst->b = img->col.c8.b;
+		}
+	}
+
+	dst->a = a;
+}
 
-			dst_rawa = coldst.a;
+/* 結合元の色を取得 (16bit) */
 
-			coldst.a = coldst.a * opadst >> 7;
+static void _combine_get_srccol_16bit(TileImage *img,const TileImageBlendInfo *info,int x,int y,RGBA16 *dst)
+{
+	int a,c,cx,cy,thval;
 
-			//色合成 (colsrc にセット)
-			// ret = アルファ合成を行うか
+	TileImage_getPixel(img, x, y, dst);
 
-			if(blendmode == 0)
-				ret = TRUE;
-			else
-			{
-				csrc[0] = colsrc.r;
-				csrc[1] = colsrc.g;
-				csrc[2] = colsrc.b;
-				
-				if(coldst.a == 0)
-					cdst[0] = cdst[1] = cdst[2] = 255;
-				else
-				{
-					cdst[0] = coldst.r;
-					cdst[1] = coldst.g;
-					cdst[2] = coldst.b;
-				}
+	a = dst->a;
+	if(!a) return;
 
-				ret = (func_blend)(csrc, cdst, colsrc.a);
+	if(info->imgtex)
+		a = a * ImageMaterial_getPixel_forTexture(info->imgtex, x, y) / 255;
 
-				colsrc.r = csrc[0];
-				colsrc.g = csrc[1];
-				colsrc.b = csrc[2];
-			}
+	a = a * info->opacity >> 7;
+
+	//トーン化
+
+	if(a && info->is_tone)
+	{
+		if(info->tone_density)
+			c = 0x8000 - info->tone_density;
+		else if(img->type == TILEIMAGE_COLTYPE_ALPHA1BIT)
+			c = 0;
+		else
+			c = dst->r;
 
-			//coldst に結果
+		cx = (info->tone_fx + x * info->tone_fcos - y * info->tone_fsin) >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
+		cy = (info->tone_fy + x * info->tone_fsin + y * info->tone_fcos) >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
 
-			if(ret)
-				//アルファ合成
-				(func_pix)(dst, &coldst, &colsrc, NULL);
+		if(c < 0x4000)
+		{
+			cx += TABLEDATA_TONE_WIDTH / 2;
+			cy += TABLEDATA_TONE_WIDTH / 2;
+		}
+
+		thval = TABLEDATA_TONE_GETVAL16(cx, cy);
+
+		if(c < 0x4000)
+			thval = 0x8000 - thval;
+
+		if(c > thval)
+		{
+			if(info->is_tone_bkgnd_tp)
+				a = 0;
 			else
-			{
-				coldst.r = csrc[0];
-				coldst.g = csrc[1];
-				coldst.b = csrc[2];
-			}
+				dst->r = dst->g = dst->b = 0x8000;
+		}
+		else
+		{
+			dst->r = img->col.c16.r;
+			dst->g = img->col.c16.g;
+			dst->b = img->col.c16.b;
+		}
+	}
 
-			//色をセット
-			// :結合前の dst-A と結合後の dst-A が両方透明なら、何もしない。
-			// :opadst の値によっては、結合後の dst-A が透明になる場合があるので、
-			// :[結合前=不透明、結合後=透明] なら、色をセットしなければならない。
+	dst->a = a;
+}
 
-			if(coldst.a || dst_rawa)
-				TileImage_setPixel_new(dst, ix, iy, &coldst);
+/* 1px を合成 (8bit)
+ *
+ * coldst: 合成前の dst 色。結果が入る。
+ * return: 色をセットするか */
+
+static mlkbool _combine_pixel_8bit(TileImage *dst,const TileImageBlendInfo *info,int opadst,
+	RGBA8 colsrc,RGBA8 *coldst)
+{
+	RGBA8 col;
+	int32_t csrc[3],cdst[3];
+	int dst_rawa,ret;
+
+	col = *coldst;
+
+	//両方透明なら処理なし
+
+	if(colsrc.a == 0 && col.a == 0) return FALSE;
+
+	dst_rawa = col.a;
+
+	col.a = col.a * opadst >> 7;
+
+	//色合成 (colsrc にセット)
+	// ret = アルファ合成を行うか
+
+	if(!info->func_blend)
+		ret = TRUE;
+	else
+	{
+		csrc[0] = colsrc.r;
+		csrc[1] = colsrc.g;
+		csrc[2] = colsrc.b;
+
+		if(col.a == 0)
+			cdst[0] = cdst[1] = cdst[2] = 255;
+		else
+		{
+			cdst[0] = col.r;
+			cdst[1] = col.g;
+			cdst[2] = col.b;
 		}
 
-		mPopupProgressThreadSubStep_inc(prog);
+		ret = (info->func_blend)(csrc, cdst, colsrc.a);
+
+		colsrc.r = csrc[0];
+		colsrc.g = csrc[1];
+		colsrc.b = csrc[2];
 	}
+
+	//col に結果
+
+	if(ret)
+		//アルファ合成
+		(TILEIMGWORK->pixcolfunc[TILEIMAGE_PIXELCOL_NORMAL])(dst, &col, &colsrc, NULL);
+	else
+	{
+		col.r = csrc[0];
+		col.g = csrc[1];
+		col.b = csrc[2];
+	}
+
+	//結合前の dst-A と結合後の dst-A が両方透明なら、何もしない。
+	// :opadst の値によっては、結合後の dst-A が透明になる場合があるので、
+	// :[結合前=不透明、結合後=透明] なら、色をセットしなければならない。
+
+	if(!col.a && !dst_rawa) return FALSE;
+
+	*coldst = col;
+
+	return TRUE;
 }
 
-/* イメージ結合: 16bit */
+/* 1px を合成 (16bit) */
 
-static void _combine_16bit(TileImage *dst,TileImage *src,mRect *rc,int opasrc,int opadst,
-	int blendmode,mPopupProgress *prog)
+static mlkbool _combine_pixel_16bit(TileImage *dst,const TileImageBlendInfo *info,int opadst,
+	RGBA16 colsrc,RGBA16 *coldst)
 {
-	int ix,iy,dst_rawa,ret;
+	RGBA16 col;
 	int32_t csrc[3],cdst[3];
-	RGBA16 colsrc,coldst;
-	BlendColorFunc func_blend;
-	TileImagePixelColorFunc func_pix;
+	int dst_rawa,ret;
 
-	func_blend = TILEIMGWORK->blendfunc[blendmode];
-	func_pix = TILEIMGWORK->pixcolfunc[TILEIMAGE_PIXELCOL_NORMAL];
+	col = *coldst;
 
-	for(iy = rc->y1; iy <= rc->y2; iy++)
+	if(colsrc.a == 0 && col.a == 0) return FALSE;
+
+	dst_rawa = col.a;
+
+	col.a = col.a * opadst >> 7;
+
+	//色合成
+
+	if(!info->func_blend)
+		ret = TRUE;
+	else
 	{
-		for(ix = rc->x1; ix <= rc->x2; ix++)
+		csrc[0] = colsrc.r;
+		csrc[1] = colsrc.g;
+		csrc[2] = colsrc.b;
+
+		if(col.a == 0)
+			cdst[0] = cdst[1] = cdst[2] = 0x8000;
+		else
 		{
-			//----- src 色
-			
-			TileImage_getPixel(src, ix, iy, &colsrc);
+			cdst[0] = col.r;
+			cdst[1] = col.g;
+			cdst[2] = col.b;
+		}
 
-			colsrc.a = colsrc.a * opasrc >> 7;
+		ret = (info->func_blend)(csrc, cdst, colsrc.a);
 
-			//------ dst
+		colsrc.r = csrc[0];
+		colsrc.g = csrc[1];
+		colsrc.b = csrc[2];
+	}
 
-			TileImage_getPixel(dst, ix, iy, &coldst);
+	//col に結果
 
-			//両方透明なら処理なし
-			
-			if(colsrc.a == 0 && coldst.a == 0) continue;
+	if(ret)
+		(TILEIMGWORK->pixcolfunc[TILEIMAGE_PIXELCOL_NORMAL])(dst, &col, &colsrc, NULL);
+	else
+	{
+		col.r = csrc[0];
+		col.g = csrc[1];
+		col.b = csrc[2];
+	}
 
-			dst_rawa = coldst.a;
+	if(!col.a && !dst_rawa) return FALSE;
 
-			coldst.a = coldst.a * opadst >> 7;
+	*coldst = col;
 
-			//色合成 (colsrc にセット)
-			// ret = アルファ合成を行うか
+	return TRUE;
+}
 
-			if(blendmode == 0)
-				ret = TRUE;
-			else
+/* タイル内を結合 (8bit)
+ *
+ * index: 処理する結合元のインデックス
+ * rc: 処理範囲 (px) */
+
+static void _combine_tile_8bit(_thdata_combine *p,const int *index,int num,const mRect *rc)
+{
+	TileImage *dst = p->dst;
+	const TileImageCombineInfo *info;
+	RGBA8 colsrc,coldst;
+	int ix,iy,i,fset;
+
+	for(iy = rc->y1; iy <= rc->y2; iy++)
+	{
+		for(ix = rc->x1; ix <= rc->x2; ix++)
+		{
+			TileImage_getPixel(dst, ix, iy, &coldst);
+
+			fset = FALSE;
+
+			for(i = 0; i < num; i++)
 			{
-				csrc[0] = colsrc.r;
-				csrc[1] = colsrc.g;
-				csrc[2] = colsrc.b;
-				
-				if(coldst.a == 0)
-					cdst[0] = cdst[1] = cdst[2] = 0x8000;
-				else
+				info = p->info + index[i];
+
+				if(ix < info->rc.x1 || ix > info->rc.x2
+					|| iy < info->rc.y1 || iy > info->rc.y2)
+					continue;
+
+				_combine_get_srccol_8bit(info->img, p->binfo + index[i], ix, iy, &colsrc);
+
+				if(_combine_pixel_8bit(dst, p->binfo + index[i], info->opacity_dst, colsrc, &coldst))
 				{
-					cdst[0] = coldst.r;
-					cdst[1] = coldst.g;
-					cdst[2] = coldst.b;
+					if(p->keep_color)
+						fset = TRUE;
+					else
+					{
+						TileImage_setPixel_new(dst, ix, iy, &coldst);
+						TileImage_getPixel(dst, ix, iy, &coldst);
+					}
 				}
+			}
 
-				ret = (func_blend)(csrc, cdst, colsrc.a);
+			if(fset)
+				TileImage_setPixel_new(dst, ix, iy, &coldst);
+		}
+	}
+}
 
-				colsrc.r = csrc[0];
-				colsrc.g = csrc[1];
-				colsrc.b = csrc[2];
-			}
+/* タイル内を結合 (16bit) */
 
-			//coldst に結果
+static void _combine_tile_16bit(_thdata_combine *p,const int *index,int num,const mRect *rc)
+{
+	TileImage *dst = p->dst;
+	const TileImageCombineInfo *info;
+	RGBA16 colsrc,coldst;
+	int ix,iy,i,fset;
 
-			if(ret)
-				//アルファ合成
-				(func_pix)(dst, &coldst, &colsrc, NULL);
-			else
+	for(iy = rc->y1; iy <= rc->y2; iy++)
+	{
+		for(ix = rc->x1; ix <= rc->x2; ix++)
+		{
+			TileImage_getPixel(dst, ix, iy, &coldst);
+
+			fset = FALSE;
+
+			for(i = 0; i < num; i++)
 			{
-				coldst.r = csrc[0];
-				coldst.g = csrc[1];
-				coldst.b = csrc[2];
-			}
+				info = p->info + index[i];
+
+				if(ix < info->rc.x1 || ix > info->rc.x2
+					|| iy < info->rc.y1 || iy > info->rc.y2)
+					continue;
+
+				_combine_get_srccol_16bit(info->img, p->binfo + index[i], ix, iy, &colsrc);
 
-			//色をセット
+				if(_combine_pixel_16bit(dst, p->binfo + index[i], info->opacity_dst, colsrc, &coldst))
+				{
+					if(p->keep_color)
+						fset = TRUE;
+					else
+					{
+						TileImage_setPixel_new(dst, ix, iy, &coldst);
+						TileImage_getPixel(dst, ix, iy, &coldst);
+					}
+				}
+			}
 
-			if(coldst.a || dst_rawa)
+			if(fset)
 				TileImage_setPixel_new(dst, ix, iy, &coldst);
 		}
+	}
+}
 
-		mPopupProgressThreadSubStep_inc(prog);
+/* [ジョブ] dst の1タイル分を結合 */
+
+static int _combine_job(int no,void *param)
+{
+	_thdata_combine *p = (_thdata_combine *)param;
+	const TileImageCombineInfo *info;
+	mRect rc;
+	int *index,i,num;
+
+	//タイルの px 範囲 (全体の範囲内)
+
+	rc.x1 = p->dst->offx + (p->tx + no % p->tw) * 64;
+	rc.y1 = p->dst->offy + (p->ty + no / p->tw) * 64;
+	rc.x2 = rc.x1 + 63;
+	rc.y2 = rc.y1 + 63;
+
+	if(!mRectClipRect(&rc, &p->rc)) goto END;
+
+	//タイルと重なる結合元
+
+	index = (int *)mMalloc(sizeof(int) * p->num);
+	if(!index) return 1;
+
+	info = p->info;
+
+	for(i = num = 0; i < p->num; i++, info++)
+	{
+		if(!(info->rc.x2 < rc.x1 || info->rc.x1 > rc.x2
+			|| info->rc.y2 < rc.y1 || info->rc.y1 > rc.y2))
+			index[num++] = i;
+	}
+
+	//結合
+
+	if(num)
+	{
+		if(TILEIMGWORK->bits == 8)
+			_combine_tile_8bit(p, index, num, &rc);
+		else
+			_combine_tile_16bit(p, index, num, &rc);
 	}
+
+	mFree(index);
+
+END:
+	mPopupProgressThreadSubStep_inc(p->prog);
+
+	return 0;
 }
 
-/** イメージ結合 */
+/** イメージ結合
+ *
+ * - dst の各タイルごとに、すべての結合元を下から順に合成する (並列処理)。
+ * - 結合元のトーン化/テクスチャは、合成済みの色として適用される。
+ *
+ * info: 結合元の情報 (num 個、下のレイヤから順)
+ * return: FALSE でエラー */
 
-void TileImage_combine(TileImage *dst,TileImage *src,mRect *rc,int opasrc,int opadst,
-	int blendmode,mPopupProgress *prog)
+mlkbool TileImage_combine(TileImage *dst,const TileImageCombineInfo *info,int num,mPopupProgress *prog)
 {
-	//配列リサイズ
+	_thdata_combine dat;
+	TileImageBlendInfo *binfo;
+	const TileImageBlendSrcInfo *sinfo;
+	mRect rc;
+	int i,tx1,ty1,tx2,ty2;
 
-	if(!TileImage_resizeTileBuf_combine(dst, src)) return;
+	if(num <= 0) return TRUE;
 
-	mPopupProgressThreadSubStep_begin_onestep(prog, 20, rc->y2 - rc->y1 + 1);
+	//配列リサイズ & 全体の範囲
 
-	//
+	mRectEmpty(&dat.rc);
 
-	if(TILEIMGWORK->bits == 8)
-		_combine_8bit(dst, src, rc, opasrc, opadst, blendmode, prog);
-	else
-		_combine_16bit(dst, src, rc, opasrc, opadst, blendmode, prog);
+	for(i = 0; i < num; i++)
+	{
+		if(!TileImage_resizeTileBuf_combine(dst, info[i].img))
+			return FALSE;
+
+		mRectUnion(&dat.rc, &info[i].rc);
+	}
+
+	if(mRectIsEmpty(&dat.rc)) return TRUE;
+
+	//各結合元の合成情報
+
+	binfo = (TileImageBlendInfo *)mMalloc0(sizeof(TileImageBlendInfo) * num);
+	if(!binfo) return FALSE;
+
+	for(i = 0; i < num; i++)
+	{
+		sinfo = &info[i].blend;
+	
+		binfo[i].opacity = sinfo->opacity;
+		binfo[i].imgtex = sinfo->img_texture;
+		binfo[i].func_blend = (sinfo->blendmode)? TILEIMGWORK->blendfunc[sinfo->blendmode]: NULL;
+
+		if(sinfo->tone_lines)
+		{
+			binfo[i].is_tone = TRUE;
+			binfo[i].is_tone_bkgnd_tp = !(sinfo->ftone_white);
+			binfo[i].tone_fx = (int64_t)(0.5 * TILEIMG_TONE_FIX_VAL);
+			binfo[i].tone_fy = (int64_t)(0.7 * TILEIMG_TONE_FIX_VAL);
+
+			__TileImage_setBlendInfo_tone(binfo + i, sinfo);
+		}
+	}
+
+	//処理するタイル範囲
+
+	rc = dat.rc;
+
+	TileImage_pixel_to_tile_nojudge(dst, rc.x1, rc.y1, &tx1, &ty1);
+	TileImage_pixel_to_tile_nojudge(dst, rc.x2, rc.y2, &tx2, &ty2);
+
+	if(tx1 < 0) tx1 = 0;
+	if(ty1 < 0) ty1 = 0;
+	if(tx2 >= dst->tilew) tx2 = dst->tilew - 1;
+	if(ty2 >= dst->tileh) ty2 = dst->tileh - 1;
+
+	//結合
+
+	if(tx1 <= tx2 && ty1 <= ty2)
+	{
+		dat.dst = dst;
+		dat.info = info;
+		dat.binfo = binfo;
+		dat.num = num;
+		dat.tx = tx1;
+		dat.ty = ty1;
+		dat.tw = tx2 - tx1 + 1;
+		dat.keep_color = (dst->type == TILEIMAGE_COLTYPE_RGBA);
+		dat.prog = prog;
+
+		i = dat.tw * (ty2 - ty1 + 1);
+
+		mPopupProgressThreadSubStep_begin_onestep(prog, 20, i);
+
+		mThreadRunParallel(i, _combine_job, &dat);
+	}
+
+	mFree(binfo);
 
 	//透明タイルを解放
 
 	TileImage_freeEmptyTiles(dst);
+
+	return TRUE;
 }
 
 
@@ -589,7 +1147,7 @@ void TileImage_flipHorz_full(TileImage *p)
 		}
 	}
 
-	mFree(ptmp);
+	TileImage_freeTile(&ptmp);
 
 	//タイル配列のポインタを左右反転
 
@@ -642,7 +1200,7 @@ void TileImage_flipVert_full(TileImage *p)
 		}
 	}
 
-	mFree(ptmp);
+	TileImage_freeTile(&ptmp);
 
 	//タイル配列を上下反転
 
@@ -681,7 +1239,7 @@ void TileImage_rotateLeft_full(TileImage *p)
 	ppnew = __TileImage_allocTileBuf_new(p->tileh, p->tilew);
 	if(!ppnew)
 	{
-		mFree(tilebuf);
+		TileImage_freeTile(&tilebuf);
 		return;
 	}
 
@@ -709,7 +1267,7 @@ void TileImage_rotateLeft_full(TileImage *p)
 		}
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile(&tilebuf);
 
 	//配列を回転して配置
 
@@ -752,7 +1310,7 @@ void TileImage_rotateRight_full(TileImage *p)
 	ppnew = __TileImage_allocTileBuf_new(p->tileh, p->tilew);
 	if(!ppnew)
 	{
-		mFree(tilebuf);
+		TileImage_freeTile(&tilebuf);
 		return;
 	}
 
@@ -780,7 +1338,7 @@ void TileImage_rotateRight_full(TileImage *p)
 		}
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile(&tilebuf);
 
 	//配列を回転して配置
 
@@ -141,14 +141,12 @@ static void _loadimgbuf_convert_8bit(uint8_t **ppbuf,int width,int height)
 
 /* 8bit -> 16bit 処理 */
 
-static void _loadimgbuf_convert_8to16(uint8_t **ppbuf,int width,int height,mlkbool ignore_alpha)
+static void _loadimgbuf_convert_8to16(uint8_t **ppbuf,int width,int height,
+	mlkbool ignore_alpha,uint16_t *tbl)
 {
 	int ix,iy,right;
 	uint8_t *pd8;
-	uint16_t *pd16,*tbl,c[4];
-
-	tbl = TileImage_create8to16fix_table();
-	if(!tbl) return;
+	uint16_t *pd16,c[4];
 
 	right = (width - 1) * 4;
 
@@ -168,19 +166,15 @@ static void _loadimgbuf_convert_8to16(uint8_t **ppbuf,int width,int height,mlkbo
 			*((uint64_t *)pd16) = *((uint64_t *)c);
 		}
 	}
-
-	mFree(tbl);
 }
 
 /* 16bit -> 16bit(固定小数15bit) 処理 */
 
-static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,mlkbool ignore_alpha)
+static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,
+	mlkbool ignore_alpha,uint16_t *tbl)
 {
 	int ix,iy;
-	uint16_t *pd,*tbl;
-
-	tbl = TileImage_create16to16fix_table();
-	if(!tbl) return;
+	uint16_t *pd;
 
 	for(iy = height; iy; iy--, ppbuf++)
 	{
@@ -194,8 +188,43 @@ static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,mlkb
 			pd[3] = tbl[(ignore_alpha)? 0xffff: pd[3]];
 		}
 	}
+}
 
-	mFree(tbl);
+/* イメージバッファ変換用のテーブルを作成
+ *
+ * return: NULL でテーブルなし (8bit 時) */
+
+static uint16_t *_loadimgbuf_create_table(int srcbits)
+{
+	if(TILEIMGWORK->bits == 8)
+		return NULL;
+	else if(srcbits == 8)
+		return TileImage_create8to16fix_table();
+	else
+		return TileImage_create16to16fix_table();
+}
+
+/* イメージバッファの変換 (テーブル指定) */
+
+static void _loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
+	int srcbits,mlkbool ignore_alpha,uint16_t *tbl)
+{
+	if(TILEIMGWORK->bits == 8)
+	{
+		//8bit: "アルファ値無効"なしの場合は、何もしない
+
+		if(ignore_alpha)
+			_loadimgbuf_convert_8bit(ppbuf, width, height);
+	}
+	else if(tbl)
+	{
+		if(srcbits == 8)
+			//8bit -> 16bit(15fix)
+			_loadimgbuf_convert_8to16(ppbuf, width, height, ignore_alpha, tbl);
+		else
+			//16bit -> 16bit(15fix)
+			_loadimgbuf_convert_16to16(ppbuf, width, height, ignore_alpha, tbl);
+	}
 }
 
 /** 読み込まれた画像イメージの変換処理 (RGBA)
@@ -210,20 +239,13 @@ static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,mlkb
 void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
 	int srcbits,mlkbool ignore_alpha)
 {
-	if(TILEIMGWORK->bits == 8)
-	{
-		//8bit: "アルファ値無効"なしの場合は、何もしない
+	uint16_t *tbl;
 
-		if(!ignore_alpha) return;
+	tbl = _loadimgbuf_create_table(srcbits);
 
-		_loadimgbuf_convert_8bit(ppbuf, width, height);
-	}
-	else if(srcbits == 8)
-		//8bit -> 16bit(15fix)
-		_loadimgbuf_convert_8to16(ppbuf, width, height, ignore_alpha);
-	else
-		//16bit -> 16bit(15fix)
-		_loadimgbuf_convert_16to16(ppbuf, width, height, ignore_alpha);
+	_loadimgbuf_convert(ppbuf, width, height, srcbits, ignore_alpha, tbl);
+
+	mFree(tbl);
 }
 
 
@@ -232,6 +254,48 @@ void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
 //===========================================
 
 
+/* Y1行分のタイルを変換
+ *
+ * ppsrc: タイル行の先頭位置のイメージ
+ * ppdst: タイル行の先頭のタイルポインタ
+ * h: ソースの高さ (64 以下) */
+
+static void _convert_from_image_tilerow(TileImage *p,uint8_t **ppsrc,uint8_t **ppdst,
+	uint8_t *tilebuf,int srcw,int h,mPopupProgress *prog)
+{
+	int ix,xx,w;
+	TileImageColFunc_RGBAtoTile func_conv;
+	TileImageColFunc_isTransparentTile func_isempty;
+
+	func_conv = TILEIMGWORK->colfunc[p->type].rgba_to_tile;
+	func_isempty = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
+
+	for(ix = p->tilew, xx = 0; ix; ix--, xx += 64, ppdst++)
+	{
+		w = 64;
+		if(xx + 64 > srcw) w = srcw - xx;
+
+		//64x64 でなければクリア
+
+		if(w != 64 || h != 64)
+			TileImage_clearTile(p, tilebuf);
+
+		//tilebuf に変換
+
+		(func_conv)(tilebuf, ppsrc, xx, w, h);
+
+		//すべて透明でなければ、確保してコピー
+
+		if(!(func_isempty)(tilebuf))
+		{
+			if(TileImage_allocTile_atptr(p, ppdst))
+				TileImage_copyTile(p, *ppdst, tilebuf);
+		}
+
+		mPopupProgressThreadSubStep_inc(prog);
+	}
+}
+
 /** イメージバッファから TileImage に変換 (RGBA)
  *
  * - RGBA -> TileImage の現在のタイプに変換される (RGBA/GRAY のみ)。
@@ -243,9 +307,7 @@ void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,
 	mPopupProgress *prog,int prog_subnum)
 {
 	uint8_t **ppdst,*tilebuf;
-	int ix,iy,xx,yy,w,h;
-	TileImageColFunc_RGBAtoTile func_conv;
-	TileImageColFunc_isTransparentTile func_isempty;
+	int iy,yy,h;
 
 	//作業用タイル
 
@@ -256,63 +318,267 @@ void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,
 
 	ppdst = p->ppbuf;
 
-	func_conv = TILEIMGWORK->colfunc[p->type].rgba_to_tile;
-	func_isempty = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
-
 	mPopupProgressThreadSubStep_begin(prog, prog_subnum, p->tilew * p->tileh);
 
-	//
-
 	for(iy = p->tileh, yy = 0; iy; iy--, yy += 64)
 	{
 		h = 64;
 		if(yy + 64 > srch) h = srch - yy;
-	
-		for(ix = p->tilew, xx = 0; ix; ix--, xx += 64, ppdst++)
+
+		_convert_from_image_tilerow(p, ppsrc, ppdst, tilebuf, srcw, h, prog);
+
+		ppsrc += 64;
+		ppdst += p->tilew;
+	}
+
+	TileImage_freeTile(&tilebuf);
+}
+
+/** ImageCanvas のバッファから TileImage に変換 (RGBA) */
+
+void TileImage_convertFromCanvas(TileImage *p,ImageCanvas *src,mPopupProgress *prog,int prog_subnum)
+{
+	TileImage_convertFromImage(p, src->ppbuf, src->width, src->height,
+		prog, prog_subnum);
+}
+
+
+//===============================
+// 拡大縮小用
+//===============================
+
+
+/** キャンバス範囲のイメージを、ImageCanvas に RGBA (アルファ値乗算済み) でセット
+ *
+ * dst: キャンバスと同じサイズで、現在のビット数であること */
+
+void TileImage_getCanvasImage_premult(TileImage *p,ImageCanvas *dst)
+{
+	uint8_t **pptile,*tilebuf,*ps8,*pd8;
+	uint16_t *ps16,*pd16;
+	int ix,iy,px,py,x1,y1,x2,y2,xx,yy,a;
+	TileImageColFunc_getTileRGBA func;
+
+	//クリア
+
+	for(iy = 0; iy < dst->height; iy++)
+		mMemset0(dst->ppbuf[iy], dst->line_bytes);
+
+	//作業用タイル (RGBA)
+
+	tilebuf = TileImage_global_allocTileBitMax();
+	if(!tilebuf) return;
+
+	func = TILEIMGWORK->colfunc[p->type].gettile_rgba;
+
+	pptile = p->ppbuf;
+
+	for(iy = 0; iy < p->tileh; iy++)
+	{
+		for(ix = 0; ix < p->tilew; ix++, pptile++)
 		{
-			w = 64;
-			if(xx + 64 > srcw) w = srcw - xx;
+			if(!(*pptile)) continue;
 
-			//64x64 でなければクリア
+			//タイル内のキャンバス範囲
 
-			if(w != 64 || h != 64)
-				TileImage_clearTile(p, tilebuf);
+			TileImage_tile_to_pixel(p, ix, iy, &px, &py);
+
+			x1 = (px < 0)? -px: 0;
+			y1 = (py < 0)? -py: 0;
+			x2 = (px + 64 > dst->width)? dst->width - px: 64;
+			y2 = (py + 64 > dst->height)? dst->height - py: 64;
+
+			if(x1 >= x2 || y1 >= y2) continue;
 
-			//tilebuf に変換
+			//RGBA タイルとして取得
 
-			(func_conv)(tilebuf, ppsrc, xx, w, h);
+			(func)(p, tilebuf, *pptile);
 
-			//すべて透明でなければ、確保してコピー
+			//アルファ値を乗算してセット
 
-			if(!(func_isempty)(tilebuf))
+			for(yy = y1; yy < y2; yy++)
 			{
-				if(TileImage_allocTile_atptr(p, ppdst))
-					TileImage_copyTile(p, *ppdst, tilebuf);
+				if(dst->bits == 8)
+				{
+					ps8 = tilebuf + ((yy << 6) + x1) * 4;
+					pd8 = dst->ppbuf[py + yy] + (px + x1) * 4;
+
+					for(xx = x2 - x1; xx; xx--, ps8 += 4, pd8 += 4)
+					{
+						a = ps8[3];
+						
+						pd8[0] = (ps8[0] * a + 127) / 255;
+						pd8[1] = (ps8[1] * a + 127) / 255;
+						pd8[2] = (ps8[2] * a + 127) / 255;
+						pd8[3] = a;
+					}
+				}
+				else
+				{
+					ps16 = (uint16_t *)tilebuf + ((yy << 6) + x1) * 4;
+					pd16 = (uint16_t *)dst->ppbuf[py + yy] + (px + x1) * 4;
+
+					for(xx = x2 - x1; xx; xx--, ps16 += 4, pd16 += 4)
+					{
+						a = ps16[3];
+
+						pd16[0] = (ps16[0] * a + 0x4000) >> 15;
+						pd16[1] = (ps16[1] * a + 0x4000) >> 15;
+						pd16[2] = (ps16[2] * a + 0x4000) >> 15;
+						pd16[3] = a;
+					}
+				}
 			}
-
-			mPopupProgressThreadSubStep_inc(prog);
 		}
-
-		ppsrc += 64;
 	}
 
 	mFree(tilebuf);
 }
 
-/** ImageCanvas のバッファから TileImage に変換 (RGBA) */
+/* RGBA タイルに、アルファ値乗算済みの色を戻してセット
+ *
+ * return: 不透明なピクセルがあるか */
 
-void TileImage_convertFromCanvas(TileImage *p,ImageCanvas *src,mPopupProgress *prog,int prog_subnum)
+static mlkbool _set_tile_unpremult(uint8_t *tilebuf,ImageCanvas *src,int sx,int sy,int w,int h)
 {
-	TileImage_convertFromImage(p, src->ppbuf, src->width, src->height,
-		prog, prog_subnum);
+	uint8_t *ps8,*pd8;
+	uint16_t *ps16,*pd16;
+	int ix,iy,i,a,n;
+	mlkbool have = FALSE;
+
+	for(iy = 0; iy < h; iy++)
+	{
+		if(src->bits == 8)
+		{
+			ps8 = src->ppbuf[sy + iy] + sx * 4;
+			pd8 = tilebuf + (iy << 6) * 4;
+
+			for(ix = w; ix; ix--, ps8 += 4, pd8 += 4)
+			{
+				a = ps8[3];
+
+				if(!a)
+					*((uint32_t *)pd8) = 0;
+				else
+				{
+					for(i = 0; i < 3; i++)
+					{
+						n = (ps8[i] * 255 + (a >> 1)) / a;
+						pd8[i] = (n > 255)? 255: n;
+					}
+
+					pd8[3] = a;
+					have = TRUE;
+				}
+			}
+		}
+		else
+		{
+			ps16 = (uint16_t *)src->ppbuf[sy + iy] + sx * 4;
+			pd16 = (uint16_t *)tilebuf + (iy << 6) * 4;
+
+			for(ix = w; ix; ix--, ps16 += 4, pd16 += 4)
+			{
+				a = ps16[3];
+
+				if(!a)
+					*((uint64_t *)pd16) = 0;
+				else
+				{
+					for(i = 0; i < 3; i++)
+					{
+						n = ((ps16[i] << 15) + (a >> 1)) / a;
+						pd16[i] = (n > 0x8000)? 0x8000: n;
+					}
+
+					pd16[3] = a;
+					have = TRUE;
+				}
+			}
+		}
+	}
+
+	return have;
 }
 
+/** ImageCanvas (RGBA, アルファ値乗算済み) からイメージをセット
+ *
+ * p: src と同じサイズで作成された、空のイメージ
+ * return: FALSE でメモリが足りない */
+
+mlkbool TileImage_setCanvasImage_premult(TileImage *p,ImageCanvas *src)
+{
+	uint8_t **pptile,*tilebuf;
+	int ix,iy,xx,yy,w,h,tilesize;
+	TileImageColFunc_setTileRGBA func_set;
+	TileImageColFunc_isTransparentTile func_isempty;
+
+	//作業用タイル (RGBA)
+
+	tilebuf = TileImage_global_allocTileBitMax();
+	if(!tilebuf) return FALSE;
+
+	tilesize = 64 * 64 * 4 * (src->bits / 8);
+
+	func_set = TILEIMGWORK->colfunc[p->type].settile_rgba;
+	func_isempty = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
+
+	pptile = p->ppbuf;
+
+	for(iy = p->tileh, yy = 0; iy; iy--, yy += 64)
+	{
+		h = (yy + 64 > src->height)? src->height - yy: 64;
+	
+		for(ix = p->tilew, xx = 0; ix; ix--, xx += 64, pptile++)
+		{
+			w = (xx + 64 > src->width)? src->width - xx: 64;
+
+			if(w <= 0 || h <= 0) continue;
+
+			//RGBA タイルにセット
+
+			if(w != 64 || h != 64)
+				mMemset0(tilebuf, tilesize);
+
+			if(!_set_tile_unpremult(tilebuf, src, xx, yy, w, h))
+				continue;
+
+			//タイルにセット
+
+			*pptile = TileImage_allocTile(p);
+			if(!(*pptile))
+			{
+				mFree(tilebuf);
+				return FALSE;
+			}
+
+			(func_set)(*pptile, tilebuf, FALSE);
+
+			if((func_isempty)(*pptile))
+				TileImage_freeTile(pptile);
+		}
+	}
+
+	mFree(tilebuf);
+
+	return TRUE;
+}
 
 //===============================
 // 画像読み込み
 //===============================
 
 
+typedef struct
+{
+	mLoadImage li;
+
+	TileImage *img;
+	uint8_t *tilebuf;
+	uint16_t *table;
+}_loadimage_tile;
+
+
 /* mLoadImage 用進捗 (0-100) */
 
 static void _loadimg_progress(mLoadImage *p,int prog)
@@ -320,33 +586,85 @@ static void _loadimg_progress(mLoadImage *p,int prog)
 	mPopupProgressThreadSetPos((mPopupProgress *)p->param, prog);
 }
 
+/* ストリップ出力で読み込むか */
+
+static mlkbool _is_load_strip(uint32_t format)
+{
+	return ((format & (FILEFORMAT_PNG | FILEFORMAT_JPEG | FILEFORMAT_GIF
+		| FILEFORMAT_BMP | FILEFORMAT_TIFF | FILEFORMAT_WEBP)) != 0);
+}
+
+/* ストリップ出力時: Y64行分のイメージを受け取る
+ *
+ * y は常に64の倍数となるので、タイル1行分として変換する。 */
+
+static mlkerr _loadimg_setstrip(mLoadImage *li,int y,int height)
+{
+	_loadimage_tile *p = (_loadimage_tile *)li;
+
+	//ビット数変換用テーブル (最初のストリップ時に作成)
+
+	if(!p->table && TILEIMGWORK->bits == 16)
+	{
+		p->table = _loadimgbuf_create_table(li->bits_per_sample);
+		if(!p->table) return MLKERR_ALLOC;
+	}
+
+	_loadimgbuf_convert(li->imgbuf, li->width, height,
+		li->bits_per_sample, FALSE, p->table);
+
+	//タイルに変換
+
+	_convert_from_image_tilerow(p->img, li->imgbuf,
+		p->img->ppbuf + (y >> 6) * p->img->tilew,
+		p->tilebuf, li->width, height, NULL);
+
+	return MLKERR_OK;
+}
+
 /** ファイルから画像読み込み
+ *
+ * PSD 以外は、Y64行単位でデコードしながらタイルに変換するため、
+ * 画像全体のバッファは確保しない。
  *
  * dst_size: NULL 以外で、画像のサイズが入る */
 
 mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format,
 	mSize *dst_size,mPopupProgress *prog)
 {
-	mLoadImage li;
+	_loadimage_tile dat;
+	mLoadImage *li;
 	mLoadImageType tp;
-	TileImage *img;
+	TileImage *img = NULL;
+	mlkbool fstrip;
 	mlkerr ret;
 
+	mMemset0(&dat, sizeof(_loadimage_tile));
+
+	li = &dat.li;
+	fstrip = _is_load_strip(format);
+
 	//mLoadImage
 	// :キャンバスが8bitなら、常に8bitイメージ。
 	// :16bitの場合は、8bit or 16bit。
 
-	mLoadImage_init(&li);
+	mLoadImage_init(li);
 
-	li.open.type = MLOADIMAGE_OPEN_FILENAME;
-	li.open.filename = filename;
-	li.convert_type = MLOADIMAGE_CONVERT_TYPE_RGBA;
-	li.flags = MLOADIMAGE_FLAGS_TRANSPARENT_TO_ALPHA;
-	li.progress = _loadimg_progress;
-	li.param = prog;
+	li->open.type = MLOADIMAGE_OPEN_FILENAME;
+	li->open.filename = filename;
+	li->convert_type = MLOADIMAGE_CONVERT_TYPE_RGBA;
+	li->flags = MLOADIMAGE_FLAGS_TRANSPARENT_TO_ALPHA;
+	li->progress = _loadimg_progress;
+	li->param = prog;
 
 	if(TILEIMGWORK->bits == 16)
-		li.flags |= MLOADIMAGE_FLAGS_ALLOW_16BIT;
+		li->flags |= MLOADIMAGE_FLAGS_ALLOW_16BIT;
+
+	if(fstrip)
+	{
+		li->setstrip = _loadimg_setstrip;
+		li->strip_height = 64;
+	}
 
 	//フォーマット
 
@@ -354,14 +672,14 @@ mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format
 
 	//開く
 
-	ret = (tp.open)(&li);
+	ret = (tp.open)(li);
 	if(ret) goto ERR;
 
-	mPopupProgressThreadSetMax(prog, 100 + 10);
+	mPopupProgressThreadSetMax(prog, (fstrip)? 100: 100 + 10);
 
 	//イメージ作成
 
-	img = TileImage_new(TILEIMAGE_COLTYPE_RGBA, li.width, li.height);
+	img = TileImage_new(TILEIMAGE_COLTYPE_RGBA, li->width, li->height);
 	if(!img)
 	{
 		ret = MLKERR_ALLOC;
@@ -370,44 +688,67 @@ mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format
 
 	//読み込み用バッファ
 	// :キャンバスのビットに合わせる。
+	// :ストリップ時は64行分のみ。
 
-	if(!mLoadImage_allocImage(&li, li.width * (TILEIMGWORK->bits / 8) * 4))
+	if(!mLoadImage_allocImage(li, li->width * (TILEIMGWORK->bits / 8) * 4))
 	{
 		ret = MLKERR_ALLOC;
 		goto ERR;
 	}
 
+	if(fstrip)
+	{
+		dat.img = img;
+		dat.tilebuf = TileImage_allocTile(img);
+
+		if(!dat.tilebuf)
+		{
+			ret = MLKERR_ALLOC;
+			goto ERR;
+		}
+	}
+
 	//読み込み
+	// :ストリップ時は、ここでタイルに変換される。
 
-	ret = (tp.getimage)(&li);
+	ret = (tp.getimage)(li);
 	if(ret) goto ERR;
 
-	//イメージの処理
+	if(!fstrip)
+	{
+		//イメージの処理
 
-	TileImage_loadimgbuf_convert(li.imgbuf, li.width, li.height,
-		li.bits_per_sample, FALSE);
+		TileImage_loadimgbuf_convert(li->imgbuf, li->width, li->height,
+			li->bits_per_sample, FALSE);
 
-	//タイルイメージに変換
+		//タイルイメージに変換
 
-	TileImage_convertFromImage(img,
-		li.imgbuf, li.width, li.height, prog, 10);
+		TileImage_convertFromImage(img,
+			li->imgbuf, li->width, li->height, prog, 10);
+	}
 
 	//
 
 	*ppdst = img;
+	img = NULL;
 
 	if(dst_size)
 	{
-		dst_size->w = li.width;
-		dst_size->h = li.height;
+		dst_size->w = li->width;
+		dst_size->h = li->height;
 	}
 	
 	ret = MLKERR_OK;
 
 ERR:
-	(tp.close)(&li);
+	(tp.close)(li);
+
+	mLoadImage_freeImage(li);
+
+	TileImage_freeTile(&dat.tilebuf);
+	mFree(dat.table);
 
-	mLoadImage_freeImage(&li);
+	TileImage_free(img);
 
 	return ret;
 }
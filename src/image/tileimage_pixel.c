@@ -366,10 +366,11 @@ static mlkbool _setpixeldraw_tile(TileImage *p,int x,int y,_setpixelinfo *info)
 
 /* 結果の色をセット
  *
+ * rcdraw: 描画範囲の追加先
  * return: [0] OK [1] 色が変化しない [-1] エラー(タイル配列やタイルの確保失敗) */
 
-static int _setpixeldraw_setcolor(TileImage *p,int x,int y,
-	void *colres,_setpixelinfo *info)
+static int _setpixeldraw_setcolor_rect(TileImage *p,int x,int y,
+	void *colres,_setpixelinfo *info,mRect *rcdraw)
 {
 	uint8_t *buf,colbuf[8];
 	int n;
@@ -428,11 +429,19 @@ static int _setpixeldraw_setcolor(TileImage *p,int x,int y,
 
 	//描画範囲に追加
 
-	mRectIncPoint(&g_tileimage_dinfo.rcdraw, x, y);
+	mRectIncPoint(rcdraw, x, y);
 
 	return 0;
 }
 
+/* 結果の色をセット (TileImageDrawInfo::rcdraw に追加) */
+
+static int _setpixeldraw_setcolor(TileImage *p,int x,int y,
+	void *colres,_setpixelinfo *info)
+{
+	return _setpixeldraw_setcolor_rect(p, x, y, colres, info, &g_tileimage_dinfo.rcdraw);
+}
+
 
 //================================
 // ドットペン
@@ -687,6 +696,59 @@ void TileImage_setPixel_draw_direct(TileImage *p,int x,int y,void *colbuf)
 	_setpixeldraw_setcolor(p, x, y, &colres, &info);
 }
 
+/** タイル単位の並列描画の前準備
+ *
+ * 描画先と保存イメージのタイル配列を、キャンバス全体を含むようにリサイズする。
+ * 以降、キャンバス範囲内の点は、常にタイル配列の範囲内となる。
+ *
+ * return: FALSE で確保エラー */
+
+mlkbool TileImage_setPixel_draw_beginParallel(TileImage *p)
+{
+	if(!TileImage_resizeTileBuf_includeCanvas(p)
+		|| !__TileImage_resizeTileBuf_clone(g_tileimage_dinfo.img_save, p)
+		|| (g_tileimage_dinfo.img_brush_stroke
+			&& !__TileImage_resizeTileBuf_clone(g_tileimage_dinfo.img_brush_stroke, p)))
+	{
+		g_tileimage_dinfo.err = MLKERR_ALLOC;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/** 直接描画で色セット (タイル単位の並列描画用)
+ *
+ * TileImage_setPixel_draw_direct() と同じ処理だが、
+ * 異なるタイルに対してであれば、複数のスレッドから同時に呼べる。
+ * 先に TileImage_setPixel_draw_beginParallel() を実行しておくこと。
+ *
+ * rcdraw: 描画した範囲が追加される (スレッドごと) */
+
+void TileImage_setPixel_draw_direct_parallel(TileImage *p,int x,int y,void *colbuf,mRect *rcdraw)
+{
+	uint64_t colres,colsrc;
+	_setpixelinfo info;
+
+	(TILEIMGWORK->copy_color)(&colsrc, colbuf);
+
+	//描画先の情報取得 + マスク処理
+	//(タイル配列の範囲外は、キャンバス範囲外なので描画されない)
+
+	if(_setpixeldraw_dstpixel(p, x, y, &colsrc, &info))
+		return;
+
+	//色処理 (dst + src -> res)
+
+	(TILEIMGWORK->copy_color)(&colres, &info.coldst);
+
+	(g_tileimage_dinfo.func_pixelcol)(p, &colres, &colsrc, NULL);
+
+	//色セット
+
+	_setpixeldraw_setcolor_rect(p, x, y, &colres, &info, rcdraw);
+}
+
 /** ストローク重ね塗り描画 (ドット用)
  *
  * ドット描画時は描画濃度が一定なので、作業用イメージは必要ない。 */
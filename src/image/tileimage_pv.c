@@ -32,6 +32,8 @@ $*/
 
 #include "pv_tileimage.h"
 
+#include "table_data.h"
+
 
 //---------------
 
@@ -221,6 +223,149 @@ void __TileImage_setBlendInfo(TileImageBlendInfo *info,int px,int py,const mRect
 	info->dx = dx, info->dy = dy;
 }
 
+/** テクスチャ適用時の、1行分のアルファ値を取得 (8bit)
+ *
+ * dst[i] = ps[i * step] * tex[i] / 255 * opacity >> 7
+ * (合成時に 1px ずつ計算した場合と同じ値になる)
+ *
+ * ps: アルファ値の先頭。step バイトごとに並んでいる (0 で常に同じ値)。
+ * dst: tex と同じバッファでもよい。 */
+
+void __TileImage_getTexAlphaRow_8bit(uint8_t *dst,const uint8_t *ps,int step,
+	const uint8_t *tex,int opacity,int w)
+{
+	int a;
+
+#if MLK_ENABLE_SSE2 && _TILEIMG_SIMD_ON
+
+	uint16_t buf[8];
+	__m128i v,vopa,vone,vzero;
+	int i;
+
+	vopa = _mm_set1_epi16(opacity);
+	vone = _mm_set1_epi16(1);
+	vzero = _mm_setzero_si128();
+
+	for(; w >= 8; w -= 8, ps += step * 8, tex += 8, dst += 8)
+	{
+		for(i = 0; i < 8; i++)
+			buf[i] = ps[i * step];
+
+		//a * tex / 255
+		// :x / 255 = (x + 1 + (x >> 8)) >> 8 (x <= 255 * 255)
+
+		v = _mm_mullo_epi16(_mm_loadu_si128((__m128i *)buf),
+			_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)tex), vzero));
+
+		v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, vone), _mm_srli_epi16(v, 8)), 8);
+
+		//* opacity >> 7
+
+		v = _mm_srli_epi16(_mm_mullo_epi16(v, vopa), 7);
+
+		_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(v, v));
+	}
+
+#endif
+
+	//残り
+
+	for(; w > 0; w--, ps += step)
+	{
+		a = *ps * *(tex++) / 255;
+
+		*(dst++) = a * opacity >> 7;
+	}
+}
+
+/** テクスチャ適用時の、1行分のアルファ値を取得 (16bit)
+ *
+ * dst[i] = ps[i * step] * tex[i] / 255 * opacity >> 7
+ *
+ * ps: アルファ値の先頭。step 個ごとに並んでいる (0 で常に同じ値)。 */
+
+void __TileImage_getTexAlphaRow_16bit(uint16_t *dst,const uint16_t *ps,int step,
+	const uint8_t *tex,int opacity,int w)
+{
+	int a;
+
+#if MLK_ENABLE_SSE2 && _TILEIMG_SIMD_ON
+
+	__m128 v,vopa,v255;
+	__m128i vi;
+
+	vopa = _mm_set1_ps(opacity / 128.0f);
+	v255 = _mm_set1_ps(255);
+
+	for(; w >= 4; w -= 4, ps += step * 4, tex += 4, dst += 4)
+	{
+		//a * tex / 255
+		// :積は 2^24 未満なので float で正確。
+		// :商は整数でなければ整数から 1/255 以上離れるため、切り捨ての結果は正確。
+
+		v = _mm_mul_ps(
+			_mm_cvtepi32_ps(_mm_set_epi32(ps[step * 3], ps[step * 2], ps[step], ps[0])),
+			_mm_cvtepi32_ps(_mm_set_epi32(tex[3], tex[2], tex[1], tex[0])));
+
+		vi = _mm_cvttps_epi32(_mm_div_ps(v, v255));
+
+		//* opacity >> 7 (opacity / 128 の積は正確)
+
+		vi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(vi), vopa));
+
+		//0-0x8000 を符号付きで pack するため、0x8000 を引く
+
+		vi = _mm_sub_epi32(vi, _mm_set1_epi32(0x8000));
+		vi = _mm_add_epi16(_mm_packs_epi32(vi, vi), _mm_set1_epi16((short)0x8000));
+
+		_mm_storel_epi64((__m128i *)dst, vi);
+	}
+
+#endif
+
+	//残り
+
+	for(; w > 0; w--, ps += step)
+	{
+		a = *ps * *(tex++) / 255;
+
+		*(dst++) = a * opacity >> 7;
+	}
+}
+
+
+/** 合成時用の情報に、トーン化の値をセット
+ *
+ * sinfo->tone_lines が 0 以外であること。 */
+
+void __TileImage_setBlendInfo_tone(TileImageBlendInfo *dst,const TileImageBlendSrcInfo *sinfo)
+{
+	int n;
+	double dcell,dcos,dsin;
+
+	//固定濃度 (0 でなし)
+
+	if(sinfo->tone_density)
+		dst->tone_density = __TileImage_density_to_colval(sinfo->tone_density, FALSE);
+
+	//セル幅 (px)
+
+	dcell = TILEIMGWORK->dpi / (sinfo->tone_lines * 0.1);
+
+	//sin/cos
+	
+	n = sinfo->tone_angle * 512 / 360;
+
+	dcos = TABLEDATA_GET_COS(n);
+	dsin = TABLEDATA_GET_SIN(n);
+
+	//1px進むごとに加算する値
+	// :本来は dcos / dcell だが、モアレ防止の為、セル1周期がピクセル単位になるように調整。
+
+	dst->tone_fcos = (int64_t)round(1.0 / round(dcell / dcos) * TILEIMG_TONE_FIX_VAL);
+	dst->tone_fsin = (int64_t)round(1.0 / round(dcell / dsin) * TILEIMG_TONE_FIX_VAL);
+}
+
 
 //==============================
 // ほか
@@ -36,8 +36,6 @@ $*/
 #include "tileimage_drawinfo.h"
 #include "pv_tileimage.h"
 
-#include "canvasinfo.h"
-#include "drawpixbuf.h"
 #include "table_data.h"
 
 
@@ -887,243 +885,3 @@ void TileImage_expandSelect(TileImage *p,int pxcnt,mPopupProgress *prog)
 	mFree(buf);
 }
 
-
-//=====================================
-// キャンバスに輪郭を描画
-//=====================================
-/*
-  作業用バッファは、64x64 + 周囲2px の 1bit データ。
-  左端は 2bit 分余白。
-  [2bit余白][一つ左2px]+[タイル64]+[一つ右2px][2bit余白] で、横は 10 byte。
-*/
-
-typedef struct
-{
-	CanvasDrawInfo *cdinfo;
-	mRect rcclip_img,	//クリッピング範囲 (イメージ)
-		rcclip_canv;	//クリッピング範囲 (キャンバス)
-	double dadd[4];
-	int fpixelbox;		//拡大表示時、ピクセルごとに枠を描画
-}_drawselinfo;
-
-
-
-/* 拡大表示時の1pxの輪郭描画 */
-
-static void _drawsel_drawedge_point(mPixbuf *pixbuf,
-	double dx,double dy,double *padd,int flags,const mRect *rcclip)
-{
-	dx += 0.5;
-	dy += 0.5;
-
-	if(flags & 1)
-		drawpixbuf_line_selectEdge(pixbuf, dx, dy, dx + padd[0], dy + padd[1], rcclip);
-
-	if(flags & 2)
-		drawpixbuf_line_selectEdge(pixbuf, dx + padd[2], dy + padd[3], dx + padd[0] + padd[2], dy + padd[1] + padd[3], rcclip);
-
-	if(flags & 4)
-		drawpixbuf_line_selectEdge(pixbuf, dx, dy, dx + padd[2], dy + padd[3], rcclip);
-
-	if(flags & 8)
-		drawpixbuf_line_selectEdge(pixbuf, dx + padd[0], dy + padd[1], dx + padd[0] + padd[2], dy + padd[1] + padd[3], rcclip);
-}
-
-/* 輪郭描画
- *
- * px,py: 描画先の px 位置 (実際のタイルの (-1,-1)) */
-
-static void _drawsel_drawedge(mPixbuf *pixbuf,uint8_t *tilebuf,int px,int py,_drawselinfo *info)
-{
-	int sx,sy,w,h,img_right,img_bottom,ix,iy,x,y;
-	uint8_t *ps,*psY,stf,f,flags,fpixelbox,flags_y,tmp;
-	double ddx,ddy,ddx2,ddy2,*dadd;
-	mRect rc;
-
-	//イメージ座標からクリッピング
-
-	rc = info->rcclip_img;	//x2,y2 は +1
-	sx = sy = 0;
-	w = h = 66;
-
-	if(px < rc.x1) w += px - rc.x1, sx += rc.x1 - px, px = rc.x1;
-	if(py < rc.y1) h += py - rc.y1, sy += rc.y1 - py, py = rc.y1;
-	if(px + w > rc.x2) w = rc.x2 - px;
-	if(py + h > rc.y2) h = rc.y2 - py;
-
-	if(w <= 0 || h <= 0) return;
-
-	//イメージの右端/下端
-
-	img_right = TILEIMGWORK->imgw - 1;
-	img_bottom = TILEIMGWORK->imgh - 1;
-
-	//タイルデータの開始位置
-	//(周囲1px分も描画するので、位置は -1)
-
-	sx--, sy--;
-
-	ps = tilebuf + _TILEEX2_BUFPOS(sx, sy);
-
-	stf = 1 << (7 - (sx & 7));
-
-	//
-
-	CanvasDrawInfo_image_to_canvas(info->cdinfo, px, py, &ddx2, &ddy2);
-
-	fpixelbox = info->fpixelbox;
-	dadd = info->dadd;
-
-	//---------
-
-	y = py;
-
-	for(iy = 0; iy < h; iy++, y++)
-	{
-		x = px;
-		f = stf;
-		psY = ps;
-
-		//上端/下端のフラグ
-		flags_y = (y == 0) | ((y == img_bottom) << 1);
-
-		ddx = ddx2;
-		ddy = ddy2;
-
-		for(ix = 0; ix < w; ix++, x++)
-		{
-			if(*ps & f)
-			{
-				//------- 点がある場合
-				
-				//端の位置かどうかのフラグ
-				// :イメージ全体の端だった場合は輪郭描画
-				
-				flags = flags_y | ((x == 0) << 2) | ((x == img_right) << 3);
-
-				//
-
-				if(flags)
-				{
-					if(fpixelbox)
-						_drawsel_drawedge_point(pixbuf, ddx, ddy, dadd, flags, &info->rcclip_canv);
-					else
-						drawpixbuf_setPixel_selectEdge(pixbuf, (int)(ddx + 0.5), (int)(ddy + 0.5), &info->rcclip_canv);
-				}
-			}
-			else
-			{
-				//------ 点がない場合、上下左右いずれかに点があれば輪郭描画
-
-				flags = 0;
-
-				//上
-
-				if(ps[-10] & f) flags |= 1;
-
-				//下
-
-				if(ps[10] & f) flags |= 2;
-
-				//左
-
-				tmp = (f == 0x80)? ps[-1] & 1: *ps & (f << 1);
-
-				if(tmp) flags |= 4;
-
-				//右
-
-				tmp = (f == 1)? ps[1] & 0x80: *ps & (f >> 1);
-
-				if(tmp) flags |= 8;
-
-				//描画
-
-				if(flags)
-				{
-					if(fpixelbox)
-						_drawsel_drawedge_point(pixbuf, ddx, ddy, dadd, flags, &info->rcclip_canv);
-					else
-						drawpixbuf_setPixel_selectEdge(pixbuf, (int)(ddx + 0.5), (int)(ddy + 0.5), &info->rcclip_canv);
-				}
-			}
-
-			f >>= 1;
-			if(!f) f = 0x80, ps++;
-
-			ddx += dadd[0];
-			ddy += dadd[1];
-		}
-
-		ps = psY + 10;
-
-		ddx2 += dadd[2];
-		ddy2 += dadd[3];
-	}
-}
-
-/** キャンバスに選択範囲の輪郭を描画
- *
- * cdinfo: キャンバスの描画情報
- * boximg: 描画するキャンバス範囲に相当するイメージ範囲 */
-
-void TileImage_drawSelectEdge(TileImage *p,mPixbuf *pixbuf,CanvasDrawInfo *cdinfo,const mBox *boximg)
-{
-	_drawselinfo info;
-	TileImageTileRectInfo tinfo;
-	uint8_t **pptile,*buf;
-	int ix,iy,px,py;
-
-	if(!p->ppbuf) return;
-
-	//イメージ範囲 -> タイル範囲
-
-	pptile = TileImage_getTileRectInfo(p, &tinfo, boximg);
-	if(!pptile) return;
-
-	//作業用バッファ
-
-	buf = (uint8_t *)mMalloc(10 * 68);
-	if(!buf) return;
-
-	//情報
-
-	info.cdinfo = cdinfo;
-	info.rcclip_img = tinfo.rcclip;
-
-	mRectSetBox(&info.rcclip_canv, &cdinfo->boxdst);
-
-	info.dadd[0] = cdinfo->param->scale * cdinfo->param->cos;
-	info.dadd[1] = cdinfo->param->scale * cdinfo->param->sin;
-	info.dadd[2] = -info.dadd[1];
-	info.dadd[3] = info.dadd[0];
-
-	if(cdinfo->mirror)
-	{
-		info.dadd[0] = -info.dadd[0];
-		info.dadd[1] = -info.dadd[1];
-	}
-
-	info.fpixelbox = (cdinfo->param->scale > 1);
-
-	//タイルごとに処理
-
-	for(iy = tinfo.rctile.y1, py = tinfo.pxtop.y; iy <= tinfo.rctile.y2; iy++, py += 64, pptile += tinfo.pitch_tile)
-	{
-		for(ix = tinfo.rctile.x1, px = tinfo.pxtop.x; ix <= tinfo.rctile.x2; ix++, px += 64, pptile++)
-		{
-			if(*pptile)
-			{
-				//一つも点がない場合は何もしない
-			
-				if(_get_tilebuf_ex2(p, buf, pptile, ix, iy))
-					_drawsel_drawedge(pixbuf, buf, px - 1, py - 1, &info);
-			}
-		}
-	}
-	
-	//
-
-	mFree(buf);
-}
-
@@ -0,0 +1,554 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/**********************************
+ * TileImage: 選択範囲の輪郭
+ **********************************/
+/*
+ * - 選択範囲 (A1) の輪郭となるピクセルを抽出して保持する。
+ *   位置は、オフセットからの相対位置 (タイル配列の左上が 0)。
+ *   キャンバス描画時は、表示範囲の Y に該当するデータのみを変換して描画する。
+ * - 輪郭のピクセル:
+ *   点がない位置で、上下左右いずれかに点があるもの。
+ *   フラグは、輪郭線を描画する辺 (1=上, 2=下, 4=左, 8=右)。
+ * - 同じ Y で、同じフラグのピクセルが並んでいる場合は、一つにまとめる。
+ *   データは Y -> X の順に並べる。
+ * - データはイメージ範囲に依存しないため、オフセット位置が変わった時 (移動中など) は
+ *   描画位置をずらすだけで良い。
+ *   イメージ範囲外の輪郭は描画時に除外し、イメージの端にある点の輪郭線は、描画時に直接判定する。
+ * - 選択範囲の内容が変わった時は、TileImageSelEdge_clear() で破棄すること。
+ *   イメージ/タイル配列が変わった場合は、自動で作成し直す。
+ */
+
+#include <stdlib.h>	//qsort
+
+#include "mlk.h"
+#include "mlk_pixbuf.h"
+#include "mlk_rectbox.h"
+#include "mlk_util.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+#include "pv_tileimage.h"
+
+#include "canvasinfo.h"
+#include "drawpixbuf.h"
+
+
+//----------------
+
+typedef struct
+{
+	int32_t x,y;
+	uint8_t len,	//ピクセル数 (1-64)
+		flags;		//輪郭線を描画する辺
+}_run;
+
+struct _TileImageSelEdge
+{
+	_run *buf;
+	int num,
+		alloc;
+	TileImage *img;	//作成時のイメージ (NULL で未作成)
+	uint8_t **ppbuf;	//作成時のタイル配列
+	int tilew,tileh;
+};
+
+//描画用の情報
+
+typedef struct
+{
+	mPixbuf *pixbuf;
+	CanvasDrawInfo *cdinfo;
+	mRect rcclip;
+	double dadd[4];
+	int fpixelbox,
+		lastx,lasty;
+}_drawinfo;
+
+#define _ALLOC_STEP  4096
+
+//----------------
+
+
+/** 作成 */
+
+TileImageSelEdge *TileImageSelEdge_new(void)
+{
+	return (TileImageSelEdge *)mMalloc0(sizeof(TileImageSelEdge));
+}
+
+/** 解放 */
+
+void TileImageSelEdge_free(TileImageSelEdge *p)
+{
+	if(p)
+	{
+		mFree(p->buf);
+		mFree(p);
+	}
+}
+
+/** データを破棄
+ *
+ * 選択範囲の内容が変わった時。次の描画時に作成し直す。 */
+
+void TileImageSelEdge_clear(TileImageSelEdge *p)
+{
+	if(p)
+	{
+		p->img = NULL;
+		p->num = 0;
+	}
+}
+
+
+//=========================
+// 作成
+//=========================
+
+
+/* タイルを取得 (範囲外の場合 NULL) */
+
+static uint8_t *_get_tile(TileImage *p,int tx,int ty)
+{
+	uint8_t *tile;
+
+	if(tx < 0 || ty < 0 || tx >= p->tilew || ty >= p->tileh)
+		return NULL;
+
+	tile = TILEIMAGE_GETTILE_PT(p, tx, ty);
+
+	return (tile == TILEIMAGE_TILE_EMPTY)? NULL: tile;
+}
+
+/* タイルの 1 行を取得 (最上位ビットが左端) */
+
+static uint64_t _get_row(uint8_t *tile,int y)
+{
+	if(!tile) return 0;
+
+	tile += y << 3;
+
+	return ((uint64_t)mGetBufBE32(tile) << 32) | mGetBufBE32(tile + 4);
+}
+
+/* データ追加 */
+
+static mlkbool _add_run(TileImageSelEdge *p,int x,int y,int len,int flags)
+{
+	_run *buf;
+
+	if(p->num == p->alloc)
+	{
+		buf = (_run *)mRealloc(p->buf, sizeof(_run) * (p->alloc + _ALLOC_STEP));
+		if(!buf) return FALSE;
+
+		p->buf = buf;
+		p->alloc += _ALLOC_STEP;
+	}
+
+	buf = p->buf + p->num;
+
+	buf->x = x;
+	buf->y = y;
+	buf->len = len;
+	buf->flags = flags;
+
+	p->num++;
+
+	return TRUE;
+}
+
+/* 1 行分のフラグから、データを追加 */
+
+static mlkbool _add_row(TileImageSelEdge *p,int px,int y,uint64_t *pflags)
+{
+	uint64_t f;
+	int x,flags,lastflags,start;
+
+	lastflags = start = 0;
+
+	for(x = 0; x <= 64; x++)
+	{
+		flags = 0;
+
+		if(x < 64)
+		{
+			f = (uint64_t)1 << (63 - x);
+
+			if(pflags[0] & f) flags |= 1;
+			if(pflags[1] & f) flags |= 2;
+			if(pflags[2] & f) flags |= 4;
+			if(pflags[3] & f) flags |= 8;
+		}
+
+		if(flags != lastflags)
+		{
+			if(lastflags && !_add_run(p, px + start, y, x - start, lastflags))
+				return FALSE;
+
+			start = x;
+			lastflags = flags;
+		}
+	}
+
+	return TRUE;
+}
+
+/* 1 タイル分の輪郭を追加
+ *
+ * タイルが存在しない位置でも、上下左右のタイルに点があれば輪郭となる。 */
+
+static mlkbool _add_tile(TileImageSelEdge *p,TileImage *img,int tx,int ty)
+{
+	uint8_t *tc,*tl,*tr,*tu,*td;
+	uint64_t cur,up,down,left,right,flags[4];
+	int px,py,y;
+
+	tc = _get_tile(img, tx, ty);
+	tl = _get_tile(img, tx - 1, ty);
+	tr = _get_tile(img, tx + 1, ty);
+	tu = _get_tile(img, tx, ty - 1);
+	td = _get_tile(img, tx, ty + 1);
+
+	if(!tc && !tl && !tr && !tu && !td) return TRUE;
+
+	//オフセットからの相対位置
+
+	px = tx << 6;
+	py = ty << 6;
+
+	for(y = 0; y < 64; y++)
+	{
+		cur = _get_row(tc, y);
+		up = (y == 0)? _get_row(tu, 63): _get_row(tc, y - 1);
+		down = (y == 63)? _get_row(td, 0): _get_row(tc, y + 1);
+		left = cur >> 1;
+		right = cur << 1;
+
+		if(tl && (tl[(y << 3) + 7] & 1)) left |= (uint64_t)1 << 63;
+		if(tr && (tr[y << 3] & 0x80)) right |= 1;
+
+		//点がない位置: 上下左右に点がある
+
+		flags[0] = ~cur & up;
+		flags[1] = ~cur & down;
+		flags[2] = ~cur & left;
+		flags[3] = ~cur & right;
+
+		if((flags[0] | flags[1] | flags[2] | flags[3])
+			&& !_add_row(p, px, py + y, flags))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* qsort 比較関数 (Y -> X) */
+
+static int _cmp_run(const void *p1,const void *p2)
+{
+	const _run *r1 = (const _run *)p1,
+		*r2 = (const _run *)p2;
+
+	if(r1->y != r2->y)
+		return (r1->y < r2->y)? -1: 1;
+	else if(r1->x != r2->x)
+		return (r1->x < r2->x)? -1: 1;
+	else
+		return 0;
+}
+
+/* 輪郭データを作成 */
+
+static mlkbool _create(TileImageSelEdge *p,TileImage *img)
+{
+	int tx,ty;
+
+	p->img = NULL;
+	p->num = 0;
+	p->ppbuf = img->ppbuf;
+	p->tilew = img->tilew;
+	p->tileh = img->tileh;
+
+	//タイル配列の外側 1 タイル分も含む
+
+	for(ty = -1; ty <= img->tileh; ty++)
+	{
+		for(tx = -1; tx <= img->tilew; tx++)
+		{
+			if(!_add_tile(p, img, tx, ty))
+			{
+				p->num = 0;
+				return FALSE;
+			}
+		}
+	}
+
+	qsort(p->buf, p->num, sizeof(_run), _cmp_run);
+
+	p->img = img;
+
+	return TRUE;
+}
+
+
+//=========================
+// 描画
+//=========================
+
+
+/* 拡大表示時、輪郭線を描画
+ *
+ * 上下の辺は、並んでいるピクセル分を一つの線で描画する。 */
+
+static void _draw_run_box(_drawinfo *info,double dx,double dy,int len,int flags)
+{
+	mPixbuf *pixbuf = info->pixbuf;
+	const double *dadd = info->dadd;
+	const mRect *rcclip = &info->rcclip;
+	double w,h;
+
+	dx += 0.5;
+	dy += 0.5;
+
+	w = dadd[0] * len;
+	h = dadd[1] * len;
+
+	if(flags & 1)
+		drawpixbuf_line_selectEdge(pixbuf, dx, dy, dx + w, dy + h, rcclip);
+
+	if(flags & 2)
+		drawpixbuf_line_selectEdge(pixbuf, dx + dadd[2], dy + dadd[3], dx + w + dadd[2], dy + h + dadd[3], rcclip);
+
+	if(!(flags & 12)) return;
+
+	for(; len > 0; len--)
+	{
+		if(flags & 4)
+			drawpixbuf_line_selectEdge(pixbuf, dx, dy, dx + dadd[2], dy + dadd[3], rcclip);
+
+		if(flags & 8)
+			drawpixbuf_line_selectEdge(pixbuf, dx + dadd[0], dy + dadd[1], dx + dadd[0] + dadd[2], dy + dadd[1] + dadd[3], rcclip);
+
+		dx += dadd[0];
+		dy += dadd[1];
+	}
+}
+
+/* 横に並んだピクセルの輪郭を描画 (イメージ座標) */
+
+static void _draw_run(_drawinfo *info,int x,int y,int len,int flags)
+{
+	double dx,dy;
+	int ix,iy;
+
+	CanvasDrawInfo_image_to_canvas(info->cdinfo, x, y, &dx, &dy);
+
+	if(info->fpixelbox)
+		_draw_run_box(info, dx, dy, len, flags);
+	else
+	{
+		//縮小時は、同じ位置が続く場合は描画しない
+
+		for(; len > 0; len--)
+		{
+			ix = (int)(dx + 0.5);
+			iy = (int)(dy + 0.5);
+
+			if(ix != info->lastx || iy != info->lasty)
+			{
+				drawpixbuf_setPixel_selectEdge(info->pixbuf, ix, iy, &info->rcclip);
+
+				info->lastx = ix;
+				info->lasty = iy;
+			}
+
+			dx += info->dadd[0];
+			dy += info->dadd[1];
+		}
+	}
+}
+
+/* 指定位置に点があるか */
+
+static mlkbool _is_point(TileImage *img,int x,int y)
+{
+	uint8_t *tile;
+	int tx,ty;
+
+	if(!TileImage_pixel_to_tile(img, x, y, &tx, &ty))
+		return FALSE;
+
+	tile = _get_tile(img, tx, ty);
+	if(!tile) return FALSE;
+
+	x = (x - img->offx) & 63;
+	y = (y - img->offy) & 63;
+
+	return ((tile[(y << 3) + (x >> 3)] & (0x80 >> (x & 7))) != 0);
+}
+
+/* イメージの上端/下端にある点の輪郭線を描画 */
+
+static void _draw_edge_horz(_drawinfo *info,TileImage *img,int x1,int x2,int y,int flags)
+{
+	int x,start = -1;
+
+	for(x = x1; x <= x2; x++)
+	{
+		if(x < x2 && _is_point(img, x, y))
+		{
+			if(start < 0) start = x;
+		}
+		else if(start >= 0)
+		{
+			_draw_run(info, start, y, x - start, flags);
+			start = -1;
+		}
+	}
+}
+
+/* イメージの左端/右端にある点の輪郭線を描画 */
+
+static void _draw_edge_vert(_drawinfo *info,TileImage *img,int x,int y1,int y2,int flags)
+{
+	for(; y1 < y2; y1++)
+	{
+		if(_is_point(img, x, y1))
+			_draw_run(info, x, y1, 1, flags);
+	}
+}
+
+/* Y 位置から、先頭のデータを検索 */
+
+static _run *_search_y(TileImageSelEdge *p,int y)
+{
+	int low,high,mid;
+
+	low = 0;
+	high = p->num;
+
+	while(low < high)
+	{
+		mid = (low + high) / 2;
+
+		if(p->buf[mid].y < y)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return p->buf + low;
+}
+
+/** キャンバスに選択範囲の輪郭を描画
+ *
+ * データが未作成の場合は、作成する。
+ *
+ * img: 選択範囲イメージ
+ * cdinfo: キャンバスの描画情報
+ * boximg: 描画するキャンバス範囲に相当するイメージ範囲 */
+
+void TileImageSelEdge_draw(TileImageSelEdge *p,TileImage *img,
+	mPixbuf *pixbuf,CanvasDrawInfo *cdinfo,const mBox *boximg)
+{
+	_run *pr,*prend;
+	_drawinfo info;
+	int x1,x2,y1,y2,rx1,rx2,imgw,imgh;
+
+	//作成
+	// :オフセット位置の変更では作成し直さない
+
+	if(p->img != img || p->ppbuf != img->ppbuf
+		|| p->tilew != img->tilew || p->tileh != img->tileh)
+	{
+		if(!_create(p, img)) return;
+	}
+
+	//描画範囲 (イメージ範囲内)
+
+	imgw = TILEIMGWORK->imgw;
+	imgh = TILEIMGWORK->imgh;
+
+	x1 = (boximg->x < 0)? 0: boximg->x;
+	y1 = (boximg->y < 0)? 0: boximg->y;
+	x2 = boximg->x + boximg->w;
+	y2 = boximg->y + boximg->h;
+
+	if(x2 > imgw) x2 = imgw;
+	if(y2 > imgh) y2 = imgh;
+
+	if(x1 >= x2 || y1 >= y2) return;
+
+	//情報
+
+	info.pixbuf = pixbuf;
+	info.cdinfo = cdinfo;
+
+	mRectSetBox(&info.rcclip, &cdinfo->boxdst);
+
+	info.dadd[0] = cdinfo->param->scale * cdinfo->param->cos;
+	info.dadd[1] = cdinfo->param->scale * cdinfo->param->sin;
+	info.dadd[2] = -info.dadd[1];
+	info.dadd[3] = info.dadd[0];
+
+	if(cdinfo->mirror)
+	{
+		info.dadd[0] = -info.dadd[0];
+		info.dadd[1] = -info.dadd[1];
+	}
+
+	info.fpixelbox = (cdinfo->param->scale > 1);
+	info.lastx = info.lasty = -1;
+
+	//表示範囲の Y のデータを描画
+	// :データはオフセットからの相対位置
+
+	prend = p->buf + p->num;
+
+	for(pr = _search_y(p, y1 - img->offy); pr < prend && pr->y + img->offy < y2; pr++)
+	{
+		//X クリッピング
+
+		rx1 = pr->x + img->offx;
+		rx2 = rx1 + pr->len;
+
+		if(rx1 < x1) rx1 = x1;
+		if(rx2 > x2) rx2 = x2;
+
+		if(rx1 < rx2)
+			_draw_run(&info, rx1, pr->y + img->offy, rx2 - rx1, pr->flags);
+	}
+
+	//イメージの端にある点
+
+	if(y1 == 0)
+		_draw_edge_horz(&info, img, x1, x2, 0, 1);
+
+	if(y2 == imgh)
+		_draw_edge_horz(&info, img, x1, x2, imgh - 1, 2);
+
+	if(x1 == 0)
+		_draw_edge_vert(&info, img, 0, y1, y2, 4);
+
+	if(x2 == imgw)
+		_draw_edge_vert(&info, img, imgw - 1, y1, y2, 8);
+}
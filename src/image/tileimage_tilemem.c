@@ -0,0 +1,563 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/**********************************
+ * TileImage: タイルメモリ管理
+ **********************************/
+/*
+ * - タイルサイズごとのクラスで、_SLAB_SIZE 単位のスラブ (mmap) から確保する。
+ * - スラブは _SLAB_SIZE 境界に配置されるので、ブロックのアドレスからスラブが求まる。
+ *   スラブの先頭ブロックは、ヘッダとして使う。
+ * - ブロックは、ブロックサイズ (512 以上) の境界に配置される。
+ * - スレッドごとのキャッシュを持ち、確保/解放の大半はロックなしで行う。
+ * - すべて空きになったスラブは、クラスごとに1つだけ残して、OS に返す。
+ */
+
+#include <sys/mman.h>
+
+#include "mlk.h"
+#include "mlk_thread.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+#include "pv_tileimage.h"
+
+
+//----------------
+
+#define _PUT_DEBUG  0
+
+#define _SLAB_SIZE   (1 << 20)	//スラブのサイズ (アライメントも同じ)
+#define _CLASS_NUM   5			//サイズクラスの数
+#define _CACHE_MAX   32			//スレッドキャッシュの最大ブロック数 (クラスごと)
+#define _CACHE_BATCH 16			//キャッシュとスラブ間で一度に移動するブロック数
+
+//サイズクラス (ブロックサイズ)
+static const int g_class_size[_CLASS_NUM] = {512, 64*64, 64*64*2, 64*64*4, 64*64*8};
+
+/* スラブ (先頭ブロックに配置) */
+
+typedef struct _slab
+{
+	struct _slab *prev,*next;
+	uint8_t *freelist;	//解放されたブロックのリスト
+	int cls,		//サイズクラス
+		used,		//使用中のブロック数
+		carve,		//まだ使われていない部分の、次のブロック番号
+		blocknum,	//ブロック数 (ヘッダ含む)
+		state;		//状態
+}_slab;
+
+enum
+{
+	_SLAB_STATE_FULL,		//空きなし (リストにない)
+	_SLAB_STATE_PARTIAL,	//空きあり
+	_SLAB_STATE_EMPTY		//すべて空き
+};
+
+/* サイズクラス */
+
+typedef struct
+{
+	_slab *partial,	//空きがあるスラブのリスト
+		*empty;		//すべて空きのスラブ (1つのみ保持)
+	uint32_t slabnum,	//スラブ数
+		used,			//スラブから出ているブロック数 (キャッシュ含む)
+		used_peak;
+}_class;
+
+/* スレッドキャッシュ */
+
+typedef struct _cache
+{
+	struct _cache *prev,*next;
+	int num[_CLASS_NUM];
+	uint8_t *blk[_CLASS_NUM][_CACHE_MAX];
+}_cache;
+
+/* 全体のデータ */
+
+typedef struct
+{
+	mThreadMutex mutex;
+	mThreadKey key;
+	_class cls[_CLASS_NUM];
+	_cache *cache_top;		//スレッドキャッシュのリスト
+	uint64_t reserved,		//スラブの合計サイズ
+		reserved_peak;
+}_tilemem;
+
+static _tilemem g_tilemem;
+
+#define _GET_SLAB(ptr)  ((_slab *)((uintptr_t)(ptr) & ~(uintptr_t)(_SLAB_SIZE - 1)))
+
+
+//==========================
+// スラブ
+//==========================
+
+
+/* スラブのリストに追加 */
+
+static void _slab_link(_class *pc,_slab *p)
+{
+	p->prev = NULL;
+	p->next = pc->partial;
+
+	if(pc->partial) pc->partial->prev = p;
+	pc->partial = p;
+
+	p->state = _SLAB_STATE_PARTIAL;
+}
+
+/* スラブのリストから外す */
+
+static void _slab_unlink(_class *pc,_slab *p)
+{
+	if(p->prev)
+		p->prev->next = p->next;
+	else
+		pc->partial = p->next;
+
+	if(p->next) p->next->prev = p->prev;
+
+	p->prev = p->next = NULL;
+}
+
+/* 新しいスラブを確保
+ *
+ * _SLAB_SIZE 境界に合わせるため、2倍の範囲を確保して前後を解放する。 */
+
+static _slab *_slab_new(int cls)
+{
+	uint8_t *buf,*top;
+	_slab *p;
+	uintptr_t n;
+
+	buf = (uint8_t *)mmap(NULL, _SLAB_SIZE * 2, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if(buf == MAP_FAILED) return NULL;
+
+	n = ((uintptr_t)buf + _SLAB_SIZE - 1) & ~(uintptr_t)(_SLAB_SIZE - 1);
+	top = (uint8_t *)n;
+
+	if(top != buf)
+		munmap(buf, top - buf);
+
+	munmap(top + _SLAB_SIZE, buf + _SLAB_SIZE * 2 - (top + _SLAB_SIZE));
+
+	//ヘッダ
+
+	p = (_slab *)top;
+
+	p->prev = p->next = NULL;
+	p->freelist = NULL;
+	p->cls = cls;
+	p->used = 0;
+	p->carve = 1;
+	p->blocknum = _SLAB_SIZE / g_class_size[cls];
+	p->state = _SLAB_STATE_FULL;
+
+	g_tilemem.cls[cls].slabnum++;
+
+	g_tilemem.reserved += _SLAB_SIZE;
+
+	if(g_tilemem.reserved > g_tilemem.reserved_peak)
+		g_tilemem.reserved_peak = g_tilemem.reserved;
+
+	return p;
+}
+
+/* スラブを解放 */
+
+static void _slab_free(_slab *p)
+{
+	g_tilemem.cls[p->cls].slabnum--;
+	g_tilemem.reserved -= _SLAB_SIZE;
+
+	munmap(p, _SLAB_SIZE);
+}
+
+/* スラブからブロックを一つ取得 (ロック中) */
+
+static uint8_t *_slab_get_block(int cls)
+{
+	_class *pc = g_tilemem.cls + cls;
+	_slab *p;
+	uint8_t *buf;
+
+	//空きのあるスラブ
+
+	p = pc->partial;
+
+	if(!p)
+	{
+		if(pc->empty)
+		{
+			p = pc->empty;
+			pc->empty = NULL;
+		}
+		else
+		{
+			p = _slab_new(cls);
+			if(!p) return NULL;
+		}
+
+		_slab_link(pc, p);
+	}
+
+	//ブロック
+
+	if(p->freelist)
+	{
+		buf = p->freelist;
+		p->freelist = *((uint8_t **)buf);
+	}
+	else
+		buf = (uint8_t *)p + (p->carve++) * g_class_size[cls];
+
+	p->used++;
+
+	//空きがなくなった
+
+	if(p->used == p->blocknum - 1)
+	{
+		_slab_unlink(pc, p);
+		p->state = _SLAB_STATE_FULL;
+	}
+
+	pc->used++;
+
+	if(pc->used > pc->used_peak)
+		pc->used_peak = pc->used;
+
+	return buf;
+}
+
+/* ブロックをスラブに戻す (ロック中) */
+
+static void _slab_put_block(uint8_t *buf)
+{
+	_slab *p = _GET_SLAB(buf);
+	_class *pc = g_tilemem.cls + p->cls;
+
+	*((uint8_t **)buf) = p->freelist;
+	p->freelist = buf;
+
+	p->used--;
+	pc->used--;
+
+	if(p->state == _SLAB_STATE_FULL)
+		_slab_link(pc, p);
+
+	//すべて空き: 1つは残し、それ以外は解放
+
+	if(p->used == 0)
+	{
+		_slab_unlink(pc, p);
+
+		if(pc->empty)
+			_slab_free(p);
+		else
+		{
+			//未使用状態に戻す
+
+			p->freelist = NULL;
+			p->carve = 1;
+			p->state = _SLAB_STATE_EMPTY;
+
+			pc->empty = p;
+		}
+	}
+}
+
+
+//==========================
+// スレッドキャッシュ
+//==========================
+
+
+/* キャッシュのブロックをすべてスラブに戻す (ロック中) */
+
+static void _cache_flush(_cache *p)
+{
+	int i,j;
+
+	for(i = 0; i < _CLASS_NUM; i++)
+	{
+		for(j = 0; j < p->num[i]; j++)
+			_slab_put_block(p->blk[i][j]);
+
+		p->num[i] = 0;
+	}
+}
+
+/* [スレッド終了時] キャッシュを削除 */
+
+static void _cache_destroy(void *ptr)
+{
+	_cache *p = (_cache *)ptr;
+
+	mThreadMutexLock(g_tilemem.mutex);
+
+	_cache_flush(p);
+
+	if(p->prev)
+		p->prev->next = p->next;
+	else
+		g_tilemem.cache_top = p->next;
+
+	if(p->next) p->next->prev = p->prev;
+
+	mThreadMutexUnlock(g_tilemem.mutex);
+
+	mFree(p);
+}
+
+/* 現在のスレッドのキャッシュを取得
+ *
+ * return: NULL で確保失敗 (キャッシュなしで処理する) */
+
+static _cache *_get_cache(void)
+{
+	_cache *p;
+
+	p = (_cache *)mThreadKeyGetValue(g_tilemem.key);
+
+	if(!p)
+	{
+		p = (_cache *)mMalloc0(sizeof(_cache));
+		if(!p) return NULL;
+
+		mThreadKeySetValue(g_tilemem.key, p);
+
+		//リストに追加
+
+		mThreadMutexLock(g_tilemem.mutex);
+
+		p->next = g_tilemem.cache_top;
+		if(p->next) p->next->prev = p;
+		g_tilemem.cache_top = p;
+
+		mThreadMutexUnlock(g_tilemem.mutex);
+	}
+
+	return p;
+}
+
+
+//==========================
+// main
+//==========================
+
+
+/* サイズからクラスを取得
+ *
+ * return: -1 で範囲外 */
+
+static int _get_class(int size)
+{
+	int i;
+
+	for(i = 0; i < _CLASS_NUM; i++)
+	{
+		if(size <= g_class_size[i]) return i;
+	}
+
+	return -1;
+}
+
+/** 初期化 */
+
+mlkbool __TileImage_tilemem_init(void)
+{
+	mMemset0(&g_tilemem, sizeof(_tilemem));
+
+	g_tilemem.mutex = mThreadMutexNew();
+	g_tilemem.key = mThreadKeyNew(_cache_destroy);
+
+	return (g_tilemem.mutex && g_tilemem.key);
+}
+
+/** 終了時
+ *
+ * - レイヤなどのタイルは、この後に解放される場合があるので、
+ *   メインスレッドのキャッシュを戻すのみ。 */
+
+void __TileImage_tilemem_finish(void)
+{
+	_cache *p;
+#if _PUT_DEBUG
+	TileImageTileMemInfo info;
+#endif
+
+	p = (_cache *)mThreadKeyGetValue(g_tilemem.key);
+
+	if(p)
+	{
+		mThreadMutexLock(g_tilemem.mutex);
+		_cache_flush(p);
+		mThreadMutexUnlock(g_tilemem.mutex);
+	}
+
+#if _PUT_DEBUG
+	TileImage_global_getTileMemInfo(&info);
+
+	mDebug("tilemem: tile %u (peak %u), slab %u, reserved %lu KB (peak %lu KB), frag %d.%d%%\n",
+		info.tilenum, info.tilenum_peak, info.slabnum,
+		(unsigned long)(info.reserved_size >> 10), (unsigned long)(info.reserved_peak >> 10),
+		info.fragment / 10, info.fragment % 10);
+#endif
+}
+
+/** ブロックを確保
+ *
+ * size: タイルサイズ (TileImage::tilesize) */
+
+uint8_t *__TileImage_tilemem_alloc(int size)
+{
+	_cache *cache;
+	uint8_t *buf;
+	int cls,i;
+
+	cls = _get_class(size);
+	if(cls == -1) return NULL;
+
+	cache = _get_cache();
+
+	//キャッシュから
+
+	if(cache && cache->num[cls])
+		return cache->blk[cls][--cache->num[cls]];
+
+	//スラブから (キャッシュにも補充)
+
+	mThreadMutexLock(g_tilemem.mutex);
+
+	buf = _slab_get_block(cls);
+
+	if(buf && cache)
+	{
+		for(i = 0; i < _CACHE_BATCH; i++)
+		{
+			cache->blk[cls][i] = _slab_get_block(cls);
+			if(!cache->blk[cls][i]) break;
+		}
+
+		cache->num[cls] = i;
+	}
+
+	mThreadMutexUnlock(g_tilemem.mutex);
+
+	return buf;
+}
+
+/** ブロックを解放 */
+
+void __TileImage_tilemem_free(uint8_t *buf)
+{
+	_cache *cache;
+	int cls,i,n;
+
+	if(!buf) return;
+
+	cls = _GET_SLAB(buf)->cls;
+
+	cache = _get_cache();
+
+	//キャッシュへ
+
+	if(cache && cache->num[cls] < _CACHE_MAX)
+	{
+		cache->blk[cls][cache->num[cls]++] = buf;
+		return;
+	}
+
+	//スラブへ (キャッシュからも戻す)
+
+	mThreadMutexLock(g_tilemem.mutex);
+
+	_slab_put_block(buf);
+
+	if(cache)
+	{
+		n = cache->num[cls];
+
+		for(i = _CACHE_BATCH; i > 0; i--)
+			_slab_put_block(cache->blk[cls][--n]);
+
+		cache->num[cls] = n;
+	}
+
+	mThreadMutexUnlock(g_tilemem.mutex);
+}
+
+
+//==========================
+// 情報
+//==========================
+
+
+/** タイルメモリの情報を取得
+ *
+ * - 他のスレッドのキャッシュ数は、ロックせずに参照するので、目安として扱う。 */
+
+void TileImage_global_getTileMemInfo(TileImageTileMemInfo *info)
+{
+	_class *pc;
+	_cache *cache;
+	uint64_t used;
+	uint32_t n,num,slabnum,peak;
+	int i;
+
+	mThreadMutexLock(g_tilemem.mutex);
+
+	used = 0;
+	num = slabnum = peak = 0;
+
+	for(i = 0, pc = g_tilemem.cls; i < _CLASS_NUM; i++, pc++)
+	{
+		n = pc->used;
+
+		for(cache = g_tilemem.cache_top; cache; cache = cache->next)
+			n -= cache->num[i];
+
+		num += n;
+		peak += pc->used_peak;
+		slabnum += pc->slabnum;
+		used += (uint64_t)n * g_class_size[i];
+	}
+
+	info->tilenum = num;
+	info->tilenum_peak = peak;
+	info->slabnum = slabnum;
+	info->used_size = used;
+	info->reserved_size = g_tilemem.reserved;
+	info->reserved_peak = g_tilemem.reserved_peak;
+
+	//断片化率 (確保済みのうち、タイルとして使われていない割合)
+
+	if(g_tilemem.reserved == 0)
+		info->fragment = 0;
+	else
+		info->fragment = (int)(1000 - used * 1000 / g_tilemem.reserved);
+
+	mThreadMutexUnlock(g_tilemem.mutex);
+}
@@ -0,0 +1,303 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/**********************************
+ * TileImage: トーン化のキャッシュ
+ **********************************/
+/*
+ * - トーン化レイヤ (GRAY/A1) のキャンバス合成時、各ピクセルが
+ *   トーンの黒 (レイヤ色) になるかどうかを、タイルごとに 1bit のマスクで保持する。
+ * - 線数/角度/濃度/DPI/ビット数/オフセットなどが変わった時は、すべて破棄する。
+ * - GRAY の場合、結果はタイルの内容に依存するため、タイルのハッシュ値を記録し、
+ *   内容が変わったタイルのみ作成し直す。
+ *   A1 の場合は位置のみに依存する。
+ * - キャンバス合成は同時に一つしか行われないため、ロックはしない。
+ */
+
+#include <string.h>
+
+#include "mlk.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+#include "pv_tileimage.h"
+#include "table_data.h"
+
+
+//----------------
+
+#define _MASK_SIZE  (64 * 64 / 8)
+
+/* タイルごとのデータ */
+
+typedef struct
+{
+	uint64_t hash;	//タイルのハッシュ値 (A1 の場合は 0)
+	uint8_t mask[_MASK_SIZE];	//1 = 黒
+}_tile;
+
+struct _TileImageToneCache
+{
+	_tile **buf;	//タイル配列と同じ並び (NULL でなし)
+	int tilew,tileh,
+		offx,offy,
+		type,bits,
+		density;
+	int64_t fcos,fsin;
+};
+
+//----------------
+
+
+/** 作成 */
+
+TileImageToneCache *TileImageToneCache_new(void)
+{
+	return (TileImageToneCache *)mMalloc0(sizeof(TileImageToneCache));
+}
+
+/* すべてのタイルデータを解放 */
+
+static void _free_tiles(TileImageToneCache *p)
+{
+	_tile **pp;
+	int i;
+
+	pp = p->buf;
+	if(!pp) return;
+
+	for(i = p->tilew * p->tileh; i; i--, pp++)
+		mFree(*pp);
+
+	mFree(p->buf);
+	p->buf = NULL;
+}
+
+/** 解放 */
+
+void TileImageToneCache_free(TileImageToneCache *p)
+{
+	if(p)
+	{
+		_free_tiles(p);
+		mFree(p);
+	}
+}
+
+/* タイルのハッシュ値 (FNV-1a を 64bit 単位で) */
+
+static uint64_t _get_hash(const uint8_t *tile,int size)
+{
+	const uint64_t *ps = (const uint64_t *)tile;
+	uint64_t h = 0xcbf29ce484222325ULL;
+
+	for(size >>= 3; size; size--)
+	{
+		h ^= *(ps++);
+		h *= 0x100000001b3ULL;
+		h ^= h >> 29;
+	}
+
+	return h;
+}
+
+/* マスクを作成 (タイル全体)
+ *
+ * fx,fy: タイル (0,0) 位置でのセル位置 */
+
+static void _create_mask(TileImage *img,const TileImageBlendInfo *info,
+	const uint8_t *tile,uint8_t *dst,int64_t fx,int64_t fy)
+{
+	int64_t fxx,fxy,fcos,fsin;
+	int ix,iy,c,cx,cy,thval,half,max,is_16bit,is_gray;
+	uint8_t f,val;
+
+	is_16bit = (TILEIMGWORK->bits == 16);
+	is_gray = (img->type == TILEIMAGE_COLTYPE_GRAY);
+
+	max = (is_16bit)? 0x8000: 255;
+	half = (is_16bit)? 0x4000: 128;
+
+	fcos = info->tone_fcos;
+	fsin = info->tone_fsin;
+
+	//固定濃度、または A1 の場合は一定 (A1 は黒)
+
+	if(info->tone_density)
+		c = max - info->tone_density;
+	else
+		c = 0;
+
+	for(iy = 0; iy < 64; iy++)
+	{
+		fxx = fx;
+		fxy = fy;
+		f = 0x80;
+		val = 0;
+
+		for(ix = 0; ix < 64; ix++, fxx += fcos, fxy += fsin)
+		{
+			//GRAY: 透明なら対象外
+
+			if(is_gray)
+			{
+				if(is_16bit)
+				{
+					if(!((uint16_t *)tile)[1]) goto NEXT;
+
+					if(!info->tone_density)
+						c = *((uint16_t *)tile);
+				}
+				else
+				{
+					if(!tile[1]) goto NEXT;
+
+					if(!info->tone_density)
+						c = *tile;
+				}
+			}
+
+			//しきい値
+
+			cx = fxx >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
+			cy = fxy >> (TILEIMG_TONE_FIX_BITS - TABLEDATA_TONE_BITS);
+
+			if(c < half)
+			{
+				cx += TABLEDATA_TONE_WIDTH / 2;
+				cy += TABLEDATA_TONE_WIDTH / 2;
+			}
+
+			if(is_16bit)
+				thval = TABLEDATA_TONE_GETVAL16(cx, cy);
+			else
+				thval = TABLEDATA_TONE_GETVAL8(cx, cy);
+
+			if(c < half)
+				thval = max - thval;
+
+			if(c <= thval)
+				val |= f;
+
+		NEXT:
+			if(is_gray)
+				tile += (is_16bit)? 4: 2;
+
+			f >>= 1;
+
+			if(!f)
+			{
+				*(dst++) = val;
+				f = 0x80;
+				val = 0;
+			}
+		}
+
+		fx -= fsin;
+		fy += fcos;
+	}
+}
+
+/** キャッシュのキーをセット (TileImage_blendToCanvas の開始時)
+ *
+ * 前回と異なる場合は、すべて破棄する。 */
+
+void __TileImageToneCache_setKey(TileImageToneCache *p,TileImage *img,const TileImageBlendInfo *info)
+{
+	if(p->buf
+		&& p->tilew == img->tilew && p->tileh == img->tileh
+		&& p->offx == img->offx && p->offy == img->offy
+		&& p->type == img->type && p->bits == TILEIMGWORK->bits
+		&& p->density == info->tone_density
+		&& p->fcos == info->tone_fcos && p->fsin == info->tone_fsin)
+		return;
+
+	_free_tiles(p);
+
+	p->tilew = img->tilew;
+	p->tileh = img->tileh;
+	p->offx = img->offx;
+	p->offy = img->offy;
+	p->type = img->type;
+	p->bits = TILEIMGWORK->bits;
+	p->density = info->tone_density;
+	p->fcos = info->tone_fcos;
+	p->fsin = info->tone_fsin;
+
+	//[!] 確保できなかった場合はキャッシュなし
+
+	p->buf = (_tile **)mMalloc0(sizeof(_tile *) * img->tilew * img->tileh);
+}
+
+/** タイルのマスクを取得
+ *
+ * p: NULL でキャッシュなし (buf に作成)
+ * index: タイル配列のインデックス
+ * fx,fy: タイル (0,0) 位置でのセル位置
+ * buf: キャッシュを使わない場合のバッファ (_MASK_SIZE)
+ * return: マスク (64x64, 1bit) */
+
+const uint8_t *__TileImageToneCache_getMask(TileImageToneCache *p,TileImage *img,
+	const TileImageBlendInfo *info,int index,const uint8_t *tile,int64_t fx,int64_t fy,uint8_t *buf)
+{
+	_tile *pt;
+	uint64_t hash;
+
+	//キャッシュなし
+
+	if(!p || !p->buf)
+	{
+		_create_mask(img, info, tile, buf, fx, fy);
+		return buf;
+	}
+
+	//A1 は内容に関係なく同じ
+
+	if(img->type == TILEIMAGE_COLTYPE_GRAY)
+		hash = _get_hash(tile, img->tilesize);
+	else
+		hash = 0;
+
+	pt = p->buf[index];
+
+	if(pt)
+	{
+		if(pt->hash == hash)
+			return pt->mask;
+	}
+	else
+	{
+		pt = (_tile *)mMalloc(sizeof(_tile));
+		if(!pt)
+		{
+			_create_mask(img, info, tile, buf, fx, fy);
+			return buf;
+		}
+
+		p->buf[index] = pt;
+	}
+
+	//作成
+
+	pt->hash = hash;
+
+	_create_mask(img, info, tile, pt->mask, fx, fy);
+
+	return pt->mask;
+}
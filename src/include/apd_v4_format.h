@@ -24,6 +24,7 @@ $*/
 typedef struct _apd4save apd4save;
 typedef struct _apd4load apd4load;
 typedef struct _LayerItem LayerItem;
+typedef struct _TileImage TileImage;
 
 typedef struct
 {
@@ -32,6 +33,7 @@ typedef struct
 }apd4info;
 
 #define APD4_CHUNK_ID_THUMBNAIL  MLK_MAKE32_4('t','h','u','m')
+#define APD4_CHUNK_ID_TILEINDEX  MLK_MAKE32_4('t','i','d','x')
 
 /* load */
 
@@ -45,8 +47,9 @@ mlkerr apd4load_skipChunk(apd4load *p);
 mlkerr apd4load_readChunk_thumbnail(apd4load *p,mSize *psize);
 mlkerr apd4load_readChunk_thumbnail_image(apd4load *p,uint8_t *dstbuf,int pxnum);
 
-mlkerr apd4load_readLayers(apd4load *p);
+mlkerr apd4load_readLayers(apd4load *p,mlkbool lazy);
 mlkerr apd4load_readLayer_append(apd4load *p,LayerItem **ppitem);
+mlkerr apd4load_readPendingImage(TileImage *img,uint8_t *dat);
 
 /* save */
 
@@ -59,8 +62,10 @@ mlkerr apd4save_writeHeadInfo(apd4save *p,int layernum);
 
 mlkerr apd4save_writeChunk_thumbnail(apd4save *p,uint8_t **ppbuf,int width,int height);
 mlkerr apd4save_writeChunk_picture(apd4save *p,uint8_t **ppbuf,int width,int height,int stepnum);
+mlkerr apd4save_writeChunk_tileindex(apd4save *p);
 mlkerr apd4save_writeChunk_end(apd4save *p);
 
 mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int stepnum);
 mlkerr apd4save_writeLayer_end(apd4save *p);
+mlkerr apd4save_writePendingImage(void *fp,TileImage *img,uint32_t tilenum,uint32_t *psize);
 
@@ -0,0 +1,59 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * 処理時間の計測
+ ************************************/
+
+#ifndef AZPT_APPTRACE_H
+#define AZPT_APPTRACE_H
+
+typedef struct
+{
+	uint64_t start;	//開始時間 (ns)。0 で計測しない
+	int type;
+}AppTraceScope;
+
+enum
+{
+	APPTRACE_COMPOSITE,	//キャンバスイメージの合成
+	APPTRACE_DISPLAY,	//キャンバスウィジェットへの描画
+	APPTRACE_RENDER,	//画面への転送
+	APPTRACE_INPUT,		//キャンバスの入力処理
+	APPTRACE_STROKE,	//ブラシの描画
+	APPTRACE_UNDO,		//アンドゥ
+	APPTRACE_TIMER,		//タイマー処理
+
+	APPTRACE_NUM
+};
+
+mlkbool AppTrace_start(mlkbool overlay,const char *filename);
+void AppTrace_finish(void);
+mlkbool AppTrace_isOverlay(void);
+
+void AppTrace_begin(AppTraceScope *p,int type);
+void AppTrace_end(AppTraceScope *p);
+
+void AppTrace_getOverlayBox(mBox *box,mFont *font);
+mlkbool AppTrace_checkOverlayUpdate(void);
+void AppTrace_drawOverlay(mPixbuf *pixbuf,mFont *font);
+
+mlkbool AppTrace_writeChromeTrace(const char *filename);
+
+#endif
@@ -191,7 +191,8 @@ typedef struct _AppConfig
 	int textdlg_toph;		//上部の高さ
 
 	int savedup_type,		//複製保存時の保存形式 (0 で現在のファイルと同じ)
-		undo_maxbufsize;	//アンドゥ最大バッファサイズ (0 ですべてファイルに出力)
+		undo_maxbufsize,	//アンドゥ最大バッファサイズ (0 ですべてファイルに出力)
+		layer_swap_size;	//タイルメモリがこのサイズ (MB) を超えたら、非表示レイヤをファイルに書き出す (0 でなし)
 
 	uint32_t fview,			//表示フラグ
 		foption,			//オプションフラグ
@@ -210,6 +211,7 @@ typedef struct _AppConfig
 
 	uint8_t loadimg_default_bits,	//画像読み込み時のデフォルトビット数
 		canvas_scale_method,		//キャンバス拡大縮小の補間方法
+		canvas_scale_keep_layer,	//キャンバス拡大縮小時、レイヤを維持する
 		pointer_btt_default[CONFIG_POINTERBTT_NUM], //デフォルトデバイスの各ボタンのコマンド (0:消しゴム側, 1:左ボタン, ...)
 		pointer_btt_pentab[CONFIG_POINTERBTT_NUM];  //筆圧情報があるデバイスの各ボタンのコマンド
 
@@ -258,7 +260,8 @@ enum
 	CONFIG_OPTF_MES_SAVE_OVERWRITE = 1<<0,	//上書き保存確認
 	CONFIG_OPTF_MES_SAVE_APD = 1<<1,		//上書き時、APD で保存するか確認
 	CONFIG_OPTF_SAVE_APD_NOPICT = 1<<2,		//APD 保存時、一枚絵イメージを含めない
-	CONFIG_OPTF_FILTERLIST_DBLCLK = 1<<3	//フィルタ一覧はダブルクリックで実行
+	CONFIG_OPTF_FILTERLIST_DBLCLK = 1<<3,	//フィルタ一覧はダブルクリックで実行
+	CONFIG_OPTF_LOAD_APD_LAZY = 1<<4		//APD 読み込み時、非表示レイヤのイメージは必要になった時に展開
 };
 
 /* fview */
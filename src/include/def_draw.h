@@ -33,6 +33,7 @@ $*/
 typedef struct _ImageCanvas ImageCanvas;
 typedef struct _ImageMaterial ImageMaterial;
 typedef struct _TileImage  TileImage;
+typedef struct _TileImageSelEdge TileImageSelEdge;
 typedef struct _LayerList  LayerList;
 typedef struct _LayerItem  LayerItem;
 typedef struct _FillPolygon FillPolygon;
@@ -155,6 +156,7 @@ typedef struct
 	mRect rcsel;	//選択範囲のおおよそのpx範囲 (tileimg_sel != NULL の時。範囲がなければ空状態の値)
 	
 	TileImage *tileimg_copy;	//コピーされたイメージ (ファイル出力失敗時)
+	TileImageSelEdge *edge;		//輪郭描画用のデータ (NULL でなし。キャンバス描画時に作成)
 
 	uint8_t	is_hide,	//選択範囲の枠を非表示にするか (範囲イメージ移動で、ドラッグ中に枠を表示しない場合)
 		copyimg_bits;	//コピーイメージのビット数
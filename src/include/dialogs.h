@@ -26,7 +26,8 @@ typedef struct _LayerNewOptInfo LayerNewOptInfo;
 
 typedef struct
 {
-	int w,h,dpi,method;
+	int w,h,dpi,method,
+		keep_layer;	//レイヤを維持する
 }CanvasScaleInfo;
 
 mlkbool NewCanvasDialog_run(mWindow *parent,NewCanvasValue *dst);
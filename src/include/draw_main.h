@@ -27,6 +27,7 @@ typedef struct _LoadImageOption LoadImageOption;
 typedef struct _LayerItem LayerItem;
 typedef struct _LayerTextItem LayerTextItem;
 typedef struct _TileImage TileImage;
+typedef struct _ImageCanvas ImageCanvas;
 typedef struct _mPopupProgress mPopupProgress;
 typedef struct _TileImageBlendSrcInfo TileImageBlendSrcInfo;
 
@@ -90,10 +91,13 @@ mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog);
 
 mlkbool drawImage_resizeCanvas(AppDraw *p,int w,int h,int movx,int movy,int fcrop);
 mlkbool drawImage_scaleCanvas(AppDraw *p,int w,int h,int dpi,int method);
+mlkbool drawImage_scaleCanvas_layer(AppDraw *p,int w,int h,int dpi,int method);
 
 void drawImage_blendImageReal_curbits(AppDraw *p,mPopupProgress *prog,int stepnum);
 mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum);
-mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum);
+void drawImage_blendImageReal_strip(AppDraw *p,ImageCanvas *dst,int y,int dstbits,
+	mlkbool falpha,uint8_t *table8,uint16_t *table16);
+mlkbool drawImage_createColConvTable(int dstbits,uint8_t **ppdst8,uint16_t **ppdst16);
 
 /* loadfile */
 
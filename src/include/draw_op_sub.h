@@ -39,7 +39,8 @@ enum
 	CANDRAWLAYER_TEXT,		//テキストレイヤ
 	CANDRAWLAYER_LOCK,		//ロック
 	CANDRAWLAYER_HIDE,		//レイヤが非表示
-	CANDRAWLAYER_PASTE		//切り貼りツールの貼り付けモード中
+	CANDRAWLAYER_PASTE,		//切り貼りツールの貼り付けモード中
+	CANDRAWLAYER_LOAD_ERR	//イメージの展開に失敗
 };
 
 enum
@@ -94,7 +95,7 @@ void drawOpSub_setDrawInfo_select_paste(void);
 void drawOpSub_setDrawInfo_select_cut(void);
 void drawOpSub_setDrawInfo_fillerase(mlkbool erase);
 void drawOpSub_setDrawInfo_overwrite(void);
-void drawOpSub_setDrawInfo_textlayer(AppDraw *p,mlkbool erase);
+void drawOpSub_setDrawInfo_textlayer(AppDraw *p,TileImage *img,mlkbool erase);
 void drawOpSub_setDrawInfo_filter(void);
 
 void drawOpSub_setDrawGradationInfo(AppDraw *p,TileImageDrawGradInfo *info);
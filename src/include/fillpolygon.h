@@ -38,6 +38,5 @@ void FillPolygon_getDrawRect(FillPolygon *p,mRect *rc);
 mlkbool FillPolygon_getIntersection_noAA(FillPolygon *p,int y);
 mlkbool FillPolygon_getNextLine_noAA(FillPolygon *p,int *left,int *right);
 
-mlkbool FillPolygon_setXBuf_AA(FillPolygon *p,int y);
-uint16_t *FillPolygon_getAABuf(FillPolygon *p,int *xmin,int *width);
+uint8_t *FillPolygon_getCoverage_AA(FillPolygon *p,int y,int *left,int *right);
 
@@ -28,16 +28,21 @@ typedef struct _mPopupProgress mPopupProgress;
 
 struct _ImageCanvas
 {
-	uint8_t **ppbuf;
+	uint8_t **ppbuf,
+		**ppstrip;	//Y帯イメージ時、確保されたバッファ
 	int width,
 		height,
 		bits, //8 or 16
-		line_bytes;
+		line_bytes,
+		strip_top,
+		strip_height;
 };
 
 
 ImageCanvas *ImageCanvas_new(int width,int height,int bits);
+ImageCanvas *ImageCanvas_newStrip(int width,int height,int bits,int strip_height);
 void ImageCanvas_free(ImageCanvas *p);
+void ImageCanvas_setStripPos(ImageCanvas *p,int y);
 
 uint8_t *ImageCanvas_getBufPt(ImageCanvas *p,int x,int y);
 void ImageCanvas_getPixel_rgba(ImageCanvas *p,int x,int y,void *dst);
@@ -48,6 +53,7 @@ void ImageCanvas_fillBox(ImageCanvas *p,const mBox *box,RGBcombo *col);
 void ImageCanvas_fillPlaidBox(ImageCanvas *p,const mBox *box,RGBcombo *col1,RGBcombo *col2);
 void ImageCanvas_setAlphaMax(ImageCanvas *p);
 mlkbool ImageCanvas_setThumbnailImage_8bit(ImageCanvas *p,int width,int height);
+void ImageCanvas_setReduceImage(ImageCanvas *dst,ImageCanvas *src,int div,const mBox *box);
 
 void ImageCanvas_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
@@ -55,4 +61,5 @@ void ImageCanvas_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo
 void ImageCanvas_drawPixbuf_rotate_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 
 ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,mPopupProgress *prog,int stepnum);
+ImageCanvas *ImageCanvas_resize_rgba(ImageCanvas *src,int neww,int newh,int method,mPopupProgress *prog,int stepnum,int maxthread);
 
@@ -48,6 +48,7 @@ void ImageMaterial_free(ImageMaterial *p);
 
 void ImageMaterial_clear(ImageMaterial *p);
 uint8_t ImageMaterial_getPixel_forTexture(ImageMaterial *p,int x,int y);
+void ImageMaterial_getRow_forTexture(ImageMaterial *p,uint8_t *dst,int x,int y,int w);
 
 ImageMaterial *ImageMaterial_loadTexture(mStr *strfname);
 ImageMaterial *ImageMaterial_loadBrush(mStr *strfname);
@@ -29,6 +29,8 @@ typedef struct _TileImage TileImage;
 typedef struct _ImageMaterial ImageMaterial;
 typedef struct _mPopupProgress mPopupProgress;
 typedef struct _DrawTextData DrawTextData;
+typedef struct _LayerSwapData LayerSwapData;
+typedef struct _TileImageToneCache TileImageToneCache;
 
 
 /** レイヤアイテム */
@@ -45,7 +47,11 @@ struct _LayerItem
 	
 	char *name,     	//レイヤ名 (NULL で空文字列)
 		*texture_path;	//レイヤテクスチャパス (NULL でなし)
-	uint32_t flags, 	//フラグ
+	uint8_t *pending_dat;	//未展開のイメージデータ (APD v4 遅延読み込み時。NULL でなし)
+	LayerSwapData *swap_dat;	//スワップファイルに書き出されたデータ (NULL でなし)
+	TileImageToneCache *tone_cache;	//トーン化のキャッシュ (キャンバス合成時に作成。NULL でなし)
+	uint32_t swap_stamp,	//最後にイメージがアクセスされた時のカウンタ値 (スワップ用)
+		flags, 	//フラグ
 		col;			//レイヤ色
 	int16_t tone_lines, //トーン:線数 (1=0.1)
 		tone_angle;		//トーン:角度 (-360 〜 +360)
@@ -124,10 +130,12 @@ void LayerItem_loadTextureImage(LayerItem *p);
 void LayerItem_setLayerColor(LayerItem *p,uint32_t col);
 void LayerItem_replaceImage(LayerItem *p,TileImage *img,int type);
 void LayerItem_setImage(LayerItem *p,TileImage *img);
+mlkbool LayerItem_loadPendingImage(LayerItem *p);
+mlkbool LayerItem_loadPendingImage_tree(LayerItem *item);
 
 void LayerItem_copyInfo(LayerItem *dst,LayerItem *src);
 mlkbool LayerItem_isHave_editImageFull(LayerItem *item);
-void LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate);
+mlkbool LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate);
 void LayerItem_moveImage(LayerItem *p,int relx,int rely);
 
 /* get */
@@ -102,6 +102,7 @@ void LayerList_setItemName_shiftjis(LayerList *p,LayerItem *item,const char *nam
 
 void LayerList_moveOffset_rel_all(LayerList *p,int movx,int movy);
 void LayerList_moveOffset_rel_text(LayerList *p,int movx,int movy);
-void LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog);
+mlkbool LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog);
+mlkbool LayerList_loadPendingImage_all(LayerList *p);
 
 #endif
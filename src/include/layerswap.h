@@ -0,0 +1,34 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * レイヤイメージのスワップ
+ ************************************/
+
+#ifndef AZPT_LAYERSWAP_H
+#define AZPT_LAYERSWAP_H
+
+typedef struct _LayerItem LayerItem;
+
+void LayerSwap_finish(void);
+void LayerSwap_check(void);
+mlkbool LayerSwap_load(LayerItem *p);
+void LayerSwap_free(LayerItem *p);
+
+#endif
@@ -0,0 +1,33 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * サムネイルのキャッシュ (ファイル)
+ ************************************/
+
+#ifndef AZPT_THUMBCACHE_H
+#define AZPT_THUMBCACHE_H
+
+typedef struct _Image32 Image32;
+
+mlkbool ThumbCache_read(const char *filename,Image32 *dst);
+void ThumbCache_write(const char *filename,Image32 *src);
+void ThumbCache_cleanup(void);
+
+#endif
@@ -26,6 +26,8 @@ $*/
 
 typedef struct _TileImage TileImage;
 typedef struct _TileImageDrawGradInfo TileImageDrawGradInfo;
+typedef struct _TileImageToneCache TileImageToneCache;
+typedef struct _TileImageSelEdge TileImageSelEdge;
 typedef struct _ImageCanvas ImageCanvas;
 typedef struct _ImageMaterial ImageMaterial;
 typedef struct _mPopupProgress mPopupProgress;
@@ -59,8 +61,32 @@ typedef struct _TileImageBlendSrcInfo
 	uint8_t blendmode,
 		ftone_white;	//トーン背景を白に
 	ImageMaterial *img_texture;
+	TileImageToneCache *tone_cache;	//トーン化のキャッシュ (NULL でなし。キャンバス合成時のみ)
 }TileImageBlendSrcInfo;
 
+/* 結合用情報 */
+
+typedef struct _TileImageCombineInfo
+{
+	TileImage *img;		//結合元イメージ
+	mRect rc;			//処理する px 範囲
+	TileImageBlendSrcInfo blend;	//不透明度/合成モード/トーン化/テクスチャ
+	int opacity_dst;	//結合先に適用する不透明度 (0-128)
+}TileImageCombineInfo;
+
+/* タイルメモリの情報 */
+
+typedef struct
+{
+	uint32_t tilenum,	//使用中のタイル数
+		tilenum_peak,	//使用中のタイル数のピーク (サイズごとの合計)
+		slabnum;		//スラブ数
+	uint64_t used_size,	//使用中のタイルの合計サイズ
+		reserved_size,	//確保されているメモリサイズ
+		reserved_peak;	//確保されているメモリサイズのピーク
+	int fragment;		//断片化率 (1=0.1%)
+}TileImageTileMemInfo;
+
 /* 処理範囲情報 */
 
 typedef struct
@@ -130,6 +156,7 @@ void TileImage_global_setToneToGray(int flag);
 int TileImage_global_getTileSize(int type,int bits);
 uint8_t *TileImage_global_allocTileBitMax(void);
 void *TileImage_global_getRand(void);
+void TileImage_global_getTileMemInfo(TileImageTileMemInfo *info);
 
 TileImagePixelColorFunc TileImage_global_getPixelColorFunc(int type);
 void TileImage_global_setPixelColorFunc(int type);
@@ -216,6 +243,8 @@ uint32_t *TileImage_getHistogram(TileImage *p);
 /* set pixel */
 
 void TileImage_setPixel_draw_direct(TileImage *p,int x,int y,void *colbuf);
+mlkbool TileImage_setPixel_draw_beginParallel(TileImage *p);
+void TileImage_setPixel_draw_direct_parallel(TileImage *p,int x,int y,void *colbuf,mRect *rcdraw);
 void TileImage_setPixel_draw_dot_stroke(TileImage *p,int x,int y,void *colbuf);
 void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf);
 void TileImage_setPixel_draw_dotpen_direct(TileImage *p,int x,int y,void *pix);
@@ -301,15 +330,15 @@ void TileImage_drawBrushBox(TileImage *p,mDoublePoint *pt);
 
 void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha);
 void TileImage_copyTile_convert(TileImage *p,uint8_t *dst,uint8_t *src,void *tblbuf,int bits);
-void TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *prog);
+mlkbool TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *prog);
+mlkbool TileImage_convertBits_multi(TileImage **imgs,int num,int bits,void *tblbuf,mPopupProgress *prog);
 
 void TileImage_copyImage_rect(TileImage *dst,TileImage *src,const mRect *rc);
 
 void TileImage_replaceColor_tp_to_col(TileImage *p,void *dstcol);
 void TileImage_replaceColor_col_to_col(TileImage *p,void *srccol,void *dstcol);
 
-void TileImage_combine(TileImage *dst,TileImage *src,mRect *rc,int opasrc,int opadst,
-	int blendmode,mPopupProgress *prog);
+mlkbool TileImage_combine(TileImage *dst,const TileImageCombineInfo *info,int num,mPopupProgress *prog);
 
 TileImage *TileImage_createCropImage(TileImage *src,int offx,int offy,int w,int h);
 
@@ -359,7 +388,18 @@ TileImage *TileImage_createStampImage(TileImage *src,TileImage *sel,const mRect
 void TileImage_pasteStampImage(TileImage *dst,int x,int y,int trans,TileImage *src,int srcw,int srch);
 
 void TileImage_expandSelect(TileImage *p,int pxcnt,mPopupProgress *prog);
-void TileImage_drawSelectEdge(TileImage *p,mPixbuf *pixbuf,CanvasDrawInfo *info,const mBox *boximg);
+
+/* tone cache */
+
+TileImageToneCache *TileImageToneCache_new(void);
+void TileImageToneCache_free(TileImageToneCache *p);
+
+/* select edge */
+
+TileImageSelEdge *TileImageSelEdge_new(void);
+void TileImageSelEdge_free(TileImageSelEdge *p);
+void TileImageSelEdge_clear(TileImageSelEdge *p);
+void TileImageSelEdge_draw(TileImageSelEdge *p,TileImage *img,mPixbuf *pixbuf,CanvasDrawInfo *cdinfo,const mBox *boximg);
 
 /* imagefile */
 
@@ -372,6 +412,8 @@ uint16_t *TileImage_create16fixto16_table(void);
 void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,int srcbits,mlkbool ignore_alpha);
 void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,mPopupProgress *prog,int prog_subnum);
 void TileImage_convertFromCanvas(TileImage *p,ImageCanvas *src,mPopupProgress *prog,int prog_subnum);
+void TileImage_getCanvasImage_premult(TileImage *p,ImageCanvas *dst);
+mlkbool TileImage_setCanvasImage_premult(TileImage *p,ImageCanvas *src);
 mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format,mSize *dst_size,mPopupProgress *prog);
 
 mlkerr TileImage_savePNG_rgba(TileImage *p,const char *filename,int dpi,mPopupProgress *prog);
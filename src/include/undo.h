@@ -87,4 +87,5 @@ mlkerr Undo_addChangeImageBits(void);
 mlkerr Undo_addResizeCanvas_moveOffset(int mx,int my,int w,int h);
 mlkerr Undo_addResizeCanvas_crop(int mx,int my,int w,int h);
 mlkerr Undo_addScaleCanvas(void);
+mlkerr Undo_addScaleCanvas_layer(void);
 
@@ -69,7 +69,8 @@ enum
 	UNDO_TYPE_CHANGE_IMAGE_BITS,		//イメージビット数変更
 	UNDO_TYPE_RESIZECANVAS_MOVEOFFSET,	//キャンバスサイズ変更 (オフセット移動のみ)
 	UNDO_TYPE_RESIZECANVAS_CROP,		//キャンバスサイズ変更 (範囲外切り取り)
-	UNDO_TYPE_SCALE_CANVAS				//キャンバス拡大縮小
+	UNDO_TYPE_SCALE_CANVAS,				//キャンバス拡大縮小
+	UNDO_TYPE_SCALE_CANVAS_LAYER		//キャンバス拡大縮小 (レイヤ維持)
 };
 
 /** データ確保タイプ (UndoItem_alloc() 時のサイズ) */
@@ -177,6 +178,7 @@ mlkerr UndoItem_readLayerText(UndoItem *p,LayerItem *li);
 
 mlkerr UndoItem_writeLayerInfoAndImage(UndoItem *p,LayerItem *item);
 mlkerr UndoItem_writeLayerInfo(UndoItem *p,LayerItem *li);
+mlkerr UndoItem_writeLayerImage(UndoItem *p,LayerItem *item);
 mlkerr UndoItem_writeTileImage(UndoItem *p,TileImage *img);
 
 mlkerr UndoItem_readLayerInfo_new(UndoItem *p,int parent_pos,int rel_pos,LayerItem **ppdst,int *is_folder);
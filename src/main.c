@@ -42,6 +42,8 @@ $*/
 #include "appcursor.h"
 #include "table_data.h"
 #include "undo.h"
+#include "layerswap.h"
+#include "apptrace.h"
 #include "regfont.h"
 #include "textword_list.h"
 
@@ -58,7 +60,10 @@ $*/
 
 //-----------------------
 
-#define _HELP_TEXT "[usage] exe <FILE>\n\n--help-mlk : show mlk options"
+#define _HELP_TEXT "[usage] exe [OPTION] <FILE>\n\n" \
+"--trace : show frame timing on the canvas\n" \
+"--trace-output=FILE : write Chrome trace JSON to FILE on exit\n" \
+"--help-mlk : show mlk options"
 
 //-----------------------
 /* グローバル変数定義 */
@@ -346,6 +351,10 @@ static void _finish(void)
 	Undo_free();
 
 	AppDraw_free();
+
+	LayerSwap_finish();
+
+	AppTrace_finish();
 	
 	//作業用ディレクトリ削除
 
@@ -360,11 +369,13 @@ static void _finish(void)
 
 static int _init_main(int argc,char **argv)
 {
-	int top,i;
+	const char *trace_file = NULL;
+	int top,i,fileno = -1;
+	mlkbool trace = FALSE;
 
 	if(mGuiInit(argc, argv, &top)) return 1;
 
-	//"--help"
+	//オプション
 
 	for(i = top; i < argc; i++)
 	{
@@ -374,8 +385,19 @@ static int _init_main(int argc,char **argv)
 			mGuiEnd();
 			return 1;
 		}
+		else if(strcmp(argv[i], "--trace") == 0)
+			trace = TRUE;
+		else if(strncmp(argv[i], "--trace-output=", 15) == 0)
+			trace_file = argv[i] + 15;
+		else if(fileno == -1)
+			fileno = i;
 	}
 
+	//処理時間の計測
+
+	if(trace || trace_file)
+		AppTrace_start(trace, trace_file);
+
 	//
 
 	mGuiSetWMClass("azpainter", "AzPainter");
@@ -405,8 +427,8 @@ static int _init_main(int argc,char **argv)
 
 	//ファイル開く
 
-	if(top < argc)
-		_open_arg_file(argv[top]);
+	if(fileno != -1)
+		_open_arg_file(argv[fileno]);
 
 	return 0;
 }
@@ -22,6 +22,7 @@ $*/
  ********************************/
 
 #include <stdio.h>
+#include <unistd.h>
 
 #include "mlk_gui.h"
 #include "mlk_widget_def.h"
@@ -30,6 +31,8 @@ $*/
 #include "mlk_zlib.h"
 #include "mlk_util.h"
 #include "mlk_unicode.h"
+#include "mlk_buf.h"
+#include "mlk_thread.h"
 
 #include "def_macro.h"
 #include "def_draw.h"
@@ -47,6 +50,8 @@ $*/
 
 //-------------------
 
+#define _TILEINDEX_RECSIZE  24	//タイルインデックスの1レコードのサイズ
+
 /* load */
 
 struct _apd4load
@@ -58,7 +63,13 @@ struct _apd4load
 
 	apd4info info;
 
-	off_t fpos;
+	off_t fpos,
+		idxpos;		//タイルインデックスの位置 (0 でなし)
+	uint8_t *idxbuf;	//タイルインデックス (NULL でなし)
+	uint32_t idxnum,	//インデックスのレコード数
+		idxcur;			//インデックスの現在位置
+	int layerno;	//読み込み中のレイヤ番号
+	mlkbool lazy;	//遅延読み込み
 };
 
 /* save */
@@ -72,8 +83,13 @@ struct _apd4save
 
 	uint32_t tilenum, //総数
 		curtsize;
-	int curtnum;
-	off_t fpos;
+	int curtnum,
+		layerno;	//書き込み中のレイヤ番号
+	off_t fpos,
+		idxpos;		//タイルインデックスチャンクのデータ位置 (0 でなし)
+	mBuf idxbuf;	//タイルインデックス
+	uint32_t idxnum;
+	uint16_t idxrc[4];	//現在のブロックのタイル範囲
 };
 
 //-------------------
@@ -102,6 +118,7 @@ void apd4load_close(apd4load *p)
 
 		mZlibFree(p->zlib);
 		mFree(p->workbuf);
+		mFree(p->idxbuf);
 		
 		mFree(p);
 	}
@@ -248,12 +265,14 @@ mlkerr apd4load_nextChunk(apd4load *p,uint32_t *pid,uint32_t *psize)
 	return MLKERR_OK;
 }
 
-/** すべてのチャンクをスキップしてレイヤ情報へ */
+/** すべてのチャンクをスキップしてレイヤ情報へ
+ *
+ * タイルインデックスのチャンクがあれば、位置を記録する。 */
 
 mlkerr apd4load_skipChunk(apd4load *p)
 {
 	mlkerr ret;
-	uint32_t id,size;
+	uint32_t id,size,hi,lo;
 
 	while(1)
 	{
@@ -263,6 +282,17 @@ mlkerr apd4load_skipChunk(apd4load *p)
 			break;
 		else if(ret)
 			return ret;
+
+		//タイルインデックス
+
+		if(id == APD4_CHUNK_ID_TILEINDEX && size >= 8)
+		{
+			if(mFILEreadBE32(p->fp, &hi)
+				|| mFILEreadBE32(p->fp, &lo))
+				return MLKERR_DAMAGED;
+
+			p->idxpos = ((off_t)hi << 32) | lo;
+		}
 	}
 
 	return MLKERR_OK;
@@ -418,43 +448,21 @@ static mlkerr _load_layer_ex(apd4load *p,LayerItem *pi)
 }
 
 
-//----------- レイヤ
+//----------- タイル
 
 
-/* タイルイメージ読み込み */
+/* タイルのブロックをすべて読み込み
+ *
+ * buf: タイル1つ分 + 4 byte の作業用バッファ */
 
-static mlkerr _load_layer_image(apd4load *p,TileImage *img)
+static mlkerr _load_tiles(FILE *fp,mZlib *zlib,uint8_t *buf,
+	TileImage *img,uint32_t tilenum,mPopupProgress *prog)
 {
-	FILE *fp = p->fp;
-	mZlib *zlib = p->zlib;
-	uint8_t *buf = p->workbuf;
-	uint32_t size,tilenum;
+	uint32_t size;
 	uint16_t tnum,tx,ty;
-	uint8_t comptype;
 	int i,tilesize;
 	mlkerr ret;
 
-	//圧縮タイプ, タイル総数
-
-	if(mFILEreadByte(fp, &comptype)
-		|| mFILEreadBE32(fp, &tilenum))
-		return MLKERR_DAMAGED;
-
-	if(comptype != 0)
-		return MLKERR_INVALID_VALUE;
-
-	//空イメージ
-
-	if(tilenum == 0)
-	{
-		mPopupProgressThreadAddPos(p->prog, 6);
-		return MLKERR_OK;
-	}
-
-	//--- タイル
-
-	mPopupProgressThreadSubStep_begin(p->prog, 6, tilenum);
-
 	tilesize = img->tilesize;
 
 	while(tilenum)
@@ -481,7 +489,7 @@ static mlkerr _load_layer_image(apd4load *p,TileImage *img)
 			if(!TileImage_setTile_fromSave(img, tx, ty, buf + 4))
 				return MLKERR_ALLOC;
 
-			mPopupProgressThreadSubStep_inc(p->prog);
+			mPopupProgressThreadSubStep_inc(prog);
 		}
 
 		ret = mZlibDecFinish(zlib);
@@ -495,6 +503,318 @@ static mlkerr _load_layer_image(apd4load *p,TileImage *img)
 	return MLKERR_OK;
 }
 
+
+
+//----------- タイルインデックス
+
+/* タイルインデックスのレコードは、ファイル上の順に並んでいる。
+ *
+ * [2byte] レイヤ番号 (ファイル上の順)
+ * [2byte] ブロックのタイル数
+ * [4byte] ブロックの圧縮サイズ
+ * [8byte] ブロックのファイル位置 (タイル数の位置)
+ * [2byte x 4] ブロックのタイル範囲 (x1,y1,x2,y2)
+ *  :レイヤ情報のイメージ範囲の左上を 0 としたタイル位置 */
+
+
+/* タイルインデックスを読み込み
+ *
+ * 読み込めなかった場合は、インデックスなしとする。 */
+
+static mlkerr _load_tileindex(apd4load *p)
+{
+	FILE *fp = p->fp;
+	uint32_t id,num;
+	off_t pos;
+
+	if(!p->idxpos) return MLKERR_OK;
+
+	pos = ftello(fp);
+
+	if(fseeko(fp, p->idxpos, SEEK_SET) == 0
+		&& mFILEreadBE32(fp, &id) == 0
+		&& mFILEreadBE32(fp, &num) == 0
+		&& id == APD4_CHUNK_ID_TILEINDEX
+		&& num && num < 0x1000000)
+	{
+		p->idxbuf = (uint8_t *)mMalloc(num * _TILEINDEX_RECSIZE);
+
+		if(p->idxbuf)
+		{
+			if(mFILEreadOK(fp, p->idxbuf, num * _TILEINDEX_RECSIZE))
+				mFree(p->idxbuf), p->idxbuf = NULL;
+			else
+				p->idxnum = num;
+		}
+	}
+
+	//元の位置へ
+
+	if(fseeko(fp, pos, SEEK_SET))
+		return MLKERR_DAMAGED;
+
+	return MLKERR_OK;
+}
+
+/* レコードからブロックのファイル位置を取得 */
+
+static off_t _get_index_offset(uint8_t *rec)
+{
+	return ((off_t)mGetBufBE32(rec + 8) << 32) | mGetBufBE32(rec + 12);
+}
+
+/* 現在のレイヤのブロックをインデックスから検索
+ *
+ * インデックスの内容がファイルと一致しない場合は、使わない。
+ *
+ * pptop: 先頭のレコード位置が入る
+ * return: ブロック数 (0 でインデックスを使わない) */
+
+static int _get_index_blocks(apd4load *p,uint32_t tilenum,uint8_t **pptop)
+{
+	uint8_t *ps,*top;
+	uint32_t i,sum;
+	int num;
+
+	if(!p->idxbuf) return 0;
+
+	//前のレイヤのレコードをスキップ
+
+	ps = p->idxbuf + p->idxcur * _TILEINDEX_RECSIZE;
+
+	for(i = p->idxcur; i < p->idxnum; i++, ps += _TILEINDEX_RECSIZE)
+	{
+		if(mGetBufBE16(ps) >= p->layerno) break;
+	}
+
+	p->idxcur = i;
+
+	//現在のレイヤのブロック数
+
+	top = ps;
+	sum = 0;
+	num = 0;
+
+	for(; i < p->idxnum && mGetBufBE16(ps) == p->layerno; i++, ps += _TILEINDEX_RECSIZE)
+	{
+		sum += mGetBufBE16(ps + 2);
+		num++;
+	}
+
+	//判定
+
+	if(num == 0 || sum != tilenum
+		|| _get_index_offset(top) != ftello(p->fp))
+		return 0;
+
+	*pptop = top;
+
+	return num;
+}
+
+/* 並列展開用データ */
+
+typedef struct
+{
+	int fd;
+	TileImage *img;
+	uint8_t *idx;	//先頭レコード
+	mPopupProgress *prog;
+}_parallel_load;
+
+/* [スレッド] 1つのブロックを読み込んで展開 */
+
+static int _parallel_load_job(int no,void *param)
+{
+	_parallel_load *p = (_parallel_load *)param;
+	uint8_t *rec,*dat,*buf = NULL;
+	mZlib *zlib = NULL;
+	FILE *fp = NULL;
+	uint32_t size;
+	mlkerr ret;
+
+	rec = p->idx + no * _TILEINDEX_RECSIZE;
+
+	//ブロックを読み込み (タイル数と圧縮サイズを含む)
+
+	size = mGetBufBE32(rec + 4) + 6;
+
+	dat = (uint8_t *)mMalloc(size);
+	if(!dat) return MLKERR_ALLOC;
+
+	if(pread(p->fd, dat, size, _get_index_offset(rec)) != size)
+	{
+		ret = MLKERR_DAMAGED;
+		goto END;
+	}
+
+	//展開
+
+	fp = fmemopen(dat, size, "rb");
+	zlib = mZlibDecNew(8192, -15);
+	buf = (uint8_t *)mMalloc(64 * 64 * 8 + 4);
+
+	if(!fp || !zlib || !buf)
+		ret = MLKERR_ALLOC;
+	else
+	{
+		mZlibSetIO_stdio(zlib, fp);
+
+		ret = _load_tiles(fp, zlib, buf, p->img, mGetBufBE16(rec + 2), NULL);
+	}
+
+	mPopupProgressThreadSubStep_inc(p->prog);
+
+END:
+	if(fp) fclose(fp);
+	mZlibFree(zlib);
+	mFree(buf);
+	mFree(dat);
+
+	return ret;
+}
+
+/* インデックスを使って、ブロックを並列で展開 */
+
+static mlkerr _load_tiles_parallel(apd4load *p,TileImage *img,uint8_t *idx,int blocknum)
+{
+	_parallel_load dat;
+	uint8_t *last;
+	mlkerr ret;
+
+	dat.fd = fileno(p->fp);
+	dat.img = img;
+	dat.idx = idx;
+	dat.prog = p->prog;
+
+	mPopupProgressThreadSubStep_begin(p->prog, 6, blocknum);
+
+	ret = mThreadRunParallel(blocknum, _parallel_load_job, &dat);
+	if(ret) return ret;
+
+	//タイルデータの終端へ
+
+	last = idx + (blocknum - 1) * _TILEINDEX_RECSIZE;
+
+	if(fseeko(p->fp, _get_index_offset(last) + 6 + mGetBufBE32(last + 4), SEEK_SET))
+		return MLKERR_DAMAGED;
+
+	return MLKERR_OK;
+}
+
+
+//----------- レイヤ
+
+
+/* タイルのブロックを圧縮されたまま読み込み (遅延読み込み時)
+ *
+ * [4byte] ブロックデータのサイズ
+ * [4byte] タイル総数
+ * [...] ブロックデータ (ファイル上のまま) */
+
+static mlkerr _load_tiles_pending(apd4load *p,LayerItem *item,uint32_t tilenum)
+{
+	FILE *fp = p->fp;
+	uint8_t *buf;
+	uint32_t size,num;
+	uint16_t tnum;
+	off_t pos,top;
+
+	//ブロックデータの範囲
+
+	top = ftello(fp);
+
+	for(num = tilenum; num; num -= tnum)
+	{
+		if(mFILEreadBE16(fp, &tnum)
+			|| mFILEreadBE32(fp, &size)
+			|| tnum == 0 || tnum > num
+			|| fseeko(fp, size, SEEK_CUR))
+			return MLKERR_DAMAGED;
+	}
+
+	pos = ftello(fp);
+
+	if(pos - top > 0x7fffffff)
+		return MLKERR_MAX_SIZE;
+
+	size = pos - top;
+
+	//読み込み
+
+	buf = (uint8_t *)mMalloc(size + 8);
+	if(!buf) return MLKERR_ALLOC;
+
+	*((uint32_t *)buf) = size;
+	*((uint32_t *)(buf + 4)) = tilenum;
+
+	if(fseeko(fp, top, SEEK_SET)
+		|| mFILEreadOK(fp, buf + 8, size))
+	{
+		mFree(buf);
+		return MLKERR_DAMAGED;
+	}
+
+	item->pending_dat = buf;
+
+	return MLKERR_OK;
+}
+
+/* タイルイメージ読み込み
+ *
+ * pending: TRUE で、圧縮されたまま保持する */
+
+static mlkerr _load_layer_image(apd4load *p,LayerItem *item,mlkbool pending)
+{
+	FILE *fp = p->fp;
+	uint8_t *idx;
+	uint32_t tilenum;
+	uint8_t comptype;
+	int blocknum;
+	mlkerr ret;
+
+	//圧縮タイプ, タイル総数
+
+	if(mFILEreadByte(fp, &comptype)
+		|| mFILEreadBE32(fp, &tilenum))
+		return MLKERR_DAMAGED;
+
+	if(comptype != 0)
+		return MLKERR_INVALID_VALUE;
+
+	//空イメージ
+
+	if(tilenum == 0)
+	{
+		mPopupProgressThreadAddPos(p->prog, 6);
+		return MLKERR_OK;
+	}
+
+	//遅延読み込み
+
+	if(pending)
+	{
+		ret = _load_tiles_pending(p, item, tilenum);
+
+		mPopupProgressThreadAddPos(p->prog, 6);
+
+		return ret;
+	}
+
+	//--- タイル
+
+	//インデックスがある場合、ブロックごとに並列で展開
+
+	blocknum = _get_index_blocks(p, tilenum, &idx);
+
+	if(blocknum > 1)
+		return _load_tiles_parallel(p, item->img, idx, blocknum);
+
+	mPopupProgressThreadSubStep_begin(p->prog, 6, tilenum);
+
+	return _load_tiles(fp, p->zlib, p->workbuf, item->img, tilenum, p->prog);
+}
+
 /* 一つのレイヤを読み込み
  *
  * ppitem: NULL 以外で、作成されたアイテムが入る
@@ -600,24 +920,41 @@ static mlkerr _load_layer(apd4load *p,LayerItem **ppitem,mlkbool fadd)
 		LayerItem_replaceImage(pi, img, coltype);
 		LayerItem_setLayerColor(pi, pi->col);
 
-		ret = _load_layer_image(p, img);
+		//遅延読み込み時、非表示のレイヤ (カレントは除く) は展開しない
+
+		ret = _load_layer_image(p, pi,
+			(p->lazy && !fadd && !(lflags & 2) && !LayerItem_isVisible_real(pi)));
+
 		if(ret) return ret;
 	}
 
+	p->layerno++;
+
 	return MLKERR_OK;
 }
 
-/** レイヤをすべて読み込み */
+/** レイヤをすべて読み込み
+ *
+ * lazy: TRUE で遅延読み込み。\
+ *  非表示のレイヤのイメージは圧縮されたまま保持され、
+ *  必要になった時に LayerItem_loadPendingImage() で展開される。 */
 
-mlkerr apd4load_readLayers(apd4load *p)
+mlkerr apd4load_readLayers(apd4load *p,mlkbool lazy)
 {
 	mlkerr ret;
 
+	p->lazy = lazy;
+
 	//タイルバッファ
 
 	p->workbuf = (uint8_t *)mMalloc(64 * 64 * 8 + 4);
 	if(!p->workbuf) return MLKERR_ALLOC;
 
+	//タイルインデックス
+
+	ret = _load_tileindex(p);
+	if(ret) return ret;
+
 	//
 
 	mPopupProgressThreadSetMax(p->prog, p->info.layernum * 6);
@@ -650,6 +987,11 @@ mlkerr apd4load_readLayer_append(apd4load *p,LayerItem **ppitem)
 	p->workbuf = (uint8_t *)mMalloc(64 * 64 * 8 + 4);
 	if(!p->workbuf) return MLKERR_ALLOC;
 
+	//タイルインデックス
+
+	ret = _load_tileindex(p);
+	if(ret) return ret;
+
 	//レイヤ
 
 	mPopupProgressThreadSetMax(p->prog, 6);
@@ -676,6 +1018,40 @@ mlkerr apd4load_readLayer_append(apd4load *p,LayerItem **ppitem)
 }
 
 
+/** 遅延読み込みで保持されたイメージを展開
+ *
+ * dat: LayerItem::pending_dat */
+
+mlkerr apd4load_readPendingImage(TileImage *img,uint8_t *dat)
+{
+	FILE *fp;
+	mZlib *zlib;
+	uint8_t *buf;
+	mlkerr ret;
+
+	fp = fmemopen(dat + 8, *((uint32_t *)dat), "rb");
+	if(!fp) return MLKERR_ALLOC;
+
+	zlib = mZlibDecNew(8192, -15);
+	buf = (uint8_t *)mMalloc(64 * 64 * 8 + 4);
+
+	if(!zlib || !buf)
+		ret = MLKERR_ALLOC;
+	else
+	{
+		mZlibSetIO_stdio(zlib, fp);
+
+		ret = _load_tiles(fp, zlib, buf, img, *((uint32_t *)(dat + 4)), NULL);
+	}
+
+	mFree(buf);
+	mZlibFree(zlib);
+	fclose(fp);
+
+	return ret;
+}
+
+
 //********************************
 // 保存
 //********************************
@@ -696,6 +1072,11 @@ mlkerr apd4save_saveSingleLayer(LayerItem *item,const char *filename,mPopupProgr
 	ret = apd4save_writeHeadInfo(sav, 1);
 	if(ret) goto ERR;
 
+	//タイルインデックス
+
+	ret = apd4save_writeChunk_tileindex(sav);
+	if(ret) goto ERR;
+
 	//チャンク終了
 
 	ret = apd4save_writeChunk_end(sav);
@@ -727,6 +1108,7 @@ void apd4save_close(apd4save *p)
 
 		mZlibFree(p->zlib);
 		mFree(p->tilebuf);
+		mBufFree(&p->idxbuf);
 		
 		mFree(p);
 	}
@@ -944,6 +1326,29 @@ mlkerr apd4save_writeChunk_picture(apd4save *p,uint8_t **ppbuf,int width,int hei
 	return MLKERR_OK;
 }
 
+/** チャンク: タイルインデックスを書き込み
+ *
+ * チャンクにはインデックスのファイル位置のみを書き込み、
+ * インデックス本体は、レイヤ終端の後に書き込まれる。
+ * (旧バージョンでは、チャンクもレイヤ終端後のデータも無視される) */
+
+mlkerr apd4save_writeChunk_tileindex(apd4save *p)
+{
+	if(mFILEwriteBE32(p->fp, APD4_CHUNK_ID_TILEINDEX)
+		|| mFILEwriteBE32(p->fp, 8))
+		return MLKERR_IO;
+
+	p->idxpos = ftello(p->fp);
+
+	if(mFILEwrite0(p->fp, 8))
+		return MLKERR_IO;
+
+	if(!mBufAlloc(&p->idxbuf, 4096, 4096))
+		return MLKERR_ALLOC;
+
+	return MLKERR_OK;
+}
+
 /** チャンク終端を書き込み */
 
 mlkerr apd4save_writeChunk_end(apd4save *p)
@@ -1035,6 +1440,35 @@ static mlkerr _write_layerex(apd4save *p,LayerItem *pi)
 
 //------ タイルイメージ
 
+/* インデックス: タイル範囲を追加 */
+
+static void _save_index_rect(uint16_t *rc,int tx,int ty)
+{
+	if(tx < rc[0]) rc[0] = tx;
+	if(ty < rc[1]) rc[1] = ty;
+	if(tx > rc[2]) rc[2] = tx;
+	if(ty > rc[3]) rc[3] = ty;
+}
+
+/* インデックス: 現在のブロックのレコードを追加 */
+
+static mlkerr _save_index_block(apd4save *p)
+{
+	uint8_t buf[_TILEINDEX_RECSIZE];
+
+	mSetBuf_format(buf, ">hhiii4h",
+		p->layerno, p->curtnum, mZlibEncGetSize(p->zlib),
+		(uint32_t)((uint64_t)p->fpos >> 32), (uint32_t)p->fpos,
+		p->idxrc);
+
+	if(!mBufAppend(&p->idxbuf, buf, _TILEINDEX_RECSIZE))
+		return MLKERR_ALLOC;
+
+	p->idxnum++;
+
+	return MLKERR_OK;
+}
+
 /* タイル書き込み関数 */
 
 static mlkerr _func_savetile(TileImage *img,void *param)
@@ -1053,8 +1487,16 @@ static mlkerr _func_savetile(TileImage *img,void *param)
 			return MLKERR_IO;
 
 		mZlibEncReset(p->zlib);
+
+		p->idxrc[0] = p->idxrc[1] = 0xffff;
+		p->idxrc[2] = p->idxrc[3] = 0;
 	}
 
+	//タイル範囲
+
+	if(p->idxpos)
+		_save_index_rect(p->idxrc, mGetBufBE16(p->tilebuf), mGetBufBE16(p->tilebuf + 2));
+
 	//圧縮
 
 	ret = mZlibEncSend(p->zlib, p->tilebuf, img->tilesize + 4);
@@ -1077,6 +1519,14 @@ static mlkerr _func_savetile(TileImage *img,void *param)
 			|| fseek(fp, 0, SEEK_END))
 			return MLKERR_IO;
 
+		//インデックス
+
+		if(p->idxpos)
+		{
+			ret = _save_index_block(p);
+			if(ret) return ret;
+		}
+
 		p->curtnum = 0;
 		p->curtsize = 0;
 	}
@@ -1117,6 +1567,79 @@ static mlkerr _write_tileimage(apd4save *p,TileImage *img,mRect *rc,uint32_t til
 	return TileImage_saveTiles_apd4(img, rc, p->tilebuf, _func_savetile, p);
 }
 
+/** 遅延読み込み時と同じ形式で、イメージを書き込み (レイヤのスワップ用)
+ *
+ * ファイルの現在位置から書き込まれ、apd4load_readPendingImage() で展開できる。
+ * タイル位置は、イメージのタイル配列上の位置となる。
+ *
+ * fpptr: FILE *
+ * tilenum: 空でないタイルの総数 (0 は不可)
+ * psize: 書き込んだサイズ (先頭の 8 byte を含む) */
+
+mlkerr apd4save_writePendingImage(void *fpptr,TileImage *img,uint32_t tilenum,uint32_t *psize)
+{
+	FILE *fp = (FILE *)fpptr;
+	apd4save dat;
+	mRect rc;
+	off_t top,pos;
+	uint32_t head[2];
+	mlkerr ret;
+
+	mMemset0(&dat, sizeof(apd4save));
+
+	dat.fp = fp;
+	dat.tilenum = tilenum;
+
+	//先頭情報を仮書き込み
+
+	top = ftello(fp);
+
+	if(mFILEwrite0(fp, 8))
+		return MLKERR_IO;
+
+	//タイル
+
+	dat.zlib = mZlibEncNew(8192, 6, -15, 8, 0);
+	dat.tilebuf = (uint8_t *)mMalloc(64 * 64 * 8 + 4);
+
+	if(!dat.zlib || !dat.tilebuf)
+		ret = MLKERR_ALLOC;
+	else
+	{
+		mZlibSetIO_stdio(dat.zlib, fp);
+
+		rc.x1 = img->offx;
+		rc.y1 = img->offy;
+
+		ret = TileImage_saveTiles_apd4(img, &rc, dat.tilebuf, _func_savetile, &dat);
+	}
+
+	mZlibFree(dat.zlib);
+	mFree(dat.tilebuf);
+
+	if(ret) return ret;
+
+	//先頭情報
+
+	pos = ftello(fp);
+
+	if(pos - top - 8 > 0x7fffffff)
+		return MLKERR_MAX_SIZE;
+
+	head[0] = pos - top - 8;
+	head[1] = tilenum;
+
+	if(fseeko(fp, top, SEEK_SET)
+		|| mFILEwriteOK(fp, head, 8)
+		|| fseeko(fp, pos, SEEK_SET)
+		|| fflush(fp))
+		return MLKERR_IO;
+
+	*psize = pos - top;
+
+	return MLKERR_OK;
+}
+
 /** レイヤの書き込み
  *
  * parent_root: 親レイヤを常にルートにする */
@@ -1132,6 +1655,11 @@ mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int ste
 
 	fimg = LAYERITEM_IS_IMAGE(pi);
 
+	//[!] 展開できないまま保存すると、イメージが失われる
+
+	if(!LayerItem_loadPendingImage(pi))
+		return MLKERR_ALLOC;
+
 	//親のレイヤ番号
 
 	if(parent_root || !pi->i.parent)
@@ -1185,16 +1713,40 @@ mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int ste
 		if(ret) return ret;
 	}
 
+	p->layerno++;
+
 	return MLKERR_OK;
 }
 
-/** レイヤ終端の書き込み */
+/** レイヤ終端の書き込み
+ *
+ * タイルインデックスがある場合は、その後に書き込む。 */
 
 mlkerr apd4save_writeLayer_end(apd4save *p)
 {
-	if(mFILEwriteBE16(p->fp, 0xffff))
+	FILE *fp = p->fp;
+	off_t pos;
+
+	if(mFILEwriteBE16(fp, 0xffff))
 		return MLKERR_IO;
-	else
-		return MLKERR_OK;
+
+	//タイルインデックス
+	// :[4byte] ID [4byte] レコード数 [...] レコード
+
+	if(p->idxpos)
+	{
+		pos = ftello(fp);
+
+		if(mFILEwriteBE32(fp, APD4_CHUNK_ID_TILEINDEX)
+			|| mFILEwriteBE32(fp, p->idxnum)
+			|| mFILEwriteOK(fp, p->idxbuf.buf, p->idxbuf.cursize)
+			|| fseeko(fp, p->idxpos, SEEK_SET)
+			|| mFILEwriteBE32(fp, (uint64_t)pos >> 32)
+			|| mFILEwriteBE32(fp, pos)
+			|| fseek(fp, 0, SEEK_END))
+			return MLKERR_IO;
+	}
+
+	return MLKERR_OK;
 }
 
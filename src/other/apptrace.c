@@ -0,0 +1,429 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * 処理時間の計測
+ *****************************************/
+
+#include <stdio.h>
+
+#include "mlk_gui.h"
+#include "mlk_pixbuf.h"
+#include "mlk_font.h"
+#include "mlk_thread.h"
+#include "mlk_nanotime.h"
+#include "mlk_stdio.h"
+
+#include "apptrace.h"
+
+
+/*
+  - 無効時は、AppTrace_begin/end はフラグの判定のみ。
+  - 各処理の開始/終了時間をリングバッファに記録する (古いものから上書き)。
+    終了時に、Chrome のトレース形式 (JSON) でファイルに出力できる。
+  - 合成はスレッドからも行われるため、記録時はロックする。
+  - フレーム:
+    画面への転送が終了した時点で、それまでに行われた処理の時間を、1フレーム分とする。
+    転送とタイマー処理のみの場合 (オーバーレイの更新時など) は、フレームとしない。
+  - オーバーレイは、キャンバス左上に、直前のフレームと平均の時間を表示する。
+    平均は、オーバーレイの更新間隔 (MainCanvas) ごとに計算する。
+*/
+
+//------------------
+
+#define _EVENT_NUM  65536	//リングバッファのイベント数
+
+#define _OVERLAY_X  4		//オーバーレイの位置
+#define _OVERLAY_Y  4
+#define _OVERLAY_PAD 4		//オーバーレイの余白
+#define _OVERLAY_LINES  (APPTRACE_NUM + 1)
+
+typedef struct
+{
+	uint64_t start,dur;	//ns
+	uint8_t type,tid;
+}_event;
+
+typedef struct
+{
+	mThreadMutex mutex;
+	mThreadKey key;		//スレッドごとの ID
+	mNanoTime nt_base;	//計測開始時の時間
+	_event *buf;
+	char *filename;		//出力ファイル名
+	mlkbool enable,
+		overlay;
+	uint32_t pos,		//次の書き込み位置
+		num;			//記録されているイベント数
+	int tidnum;			//割り当てたスレッド ID の数
+
+	uint64_t cur[APPTRACE_NUM],	//現在のフレームの累計
+		last[APPTRACE_NUM + 1],	//直前のフレーム ([APPTRACE_NUM] はフレーム全体)
+		sum[APPTRACE_NUM + 1],	//平均計算用の合計
+		avg[APPTRACE_NUM + 1],	//平均
+		frame_start;			//現在のフレームの開始時間 (0 でなし)
+	uint32_t frame_cnt,		//フレーム数
+		sum_cnt,			//合計のフレーム数
+		overlay_cnt;		//オーバーレイ更新時のフレーム数
+
+	AppTraceScope scope_gui[2];	//mlk 側の処理用
+}_apptrace;
+
+static _apptrace g_trace;
+
+static const char *g_type_name[] = {
+	"composite", "display", "render", "input", "stroke", "undo", "timer"
+};
+
+
+/* 計測開始時からの時間を取得 (ns) */
+
+static uint64_t _get_time(void)
+{
+	mNanoTime nt;
+	uint64_t t;
+
+	mNanoTimeGet(&nt);
+	mNanoTimeSub(&nt, &nt, &g_trace.nt_base);
+
+	t = nt.sec * 1000000000 + nt.ns;
+
+	return (t)? t: 1;
+}
+
+/* 現在のスレッドの ID を取得 (ロック中) */
+
+static int _get_tid(void)
+{
+	intptr_t id;
+
+	id = (intptr_t)mThreadKeyGetValue(g_trace.key);
+
+	if(!id)
+	{
+		if(g_trace.tidnum < 255)
+			g_trace.tidnum++;
+
+		id = g_trace.tidnum;
+
+		mThreadKeySetValue(g_trace.key, (void *)id);
+	}
+
+	return id;
+}
+
+/* フレーム終了 (ロック中) */
+
+static void _end_frame(uint64_t end)
+{
+	uint64_t *pcur;
+	int i;
+
+	pcur = g_trace.cur;
+
+	for(i = 0; i < APPTRACE_NUM; i++)
+	{
+		g_trace.last[i] = pcur[i];
+		g_trace.sum[i] += pcur[i];
+		pcur[i] = 0;
+	}
+
+	g_trace.last[APPTRACE_NUM] = end - g_trace.frame_start;
+	g_trace.sum[APPTRACE_NUM] += end - g_trace.frame_start;
+
+	g_trace.frame_start = 0;
+	g_trace.frame_cnt++;
+	g_trace.sum_cnt++;
+}
+
+/* mlk からの計測ハンドラ */
+
+static void _gui_handle(int type,mlkbool end)
+{
+	AppTraceScope *p = g_trace.scope_gui + (type == MGUI_TRACE_TIMER);
+
+	if(end)
+		AppTrace_end(p);
+	else
+		AppTrace_begin(p, (type == MGUI_TRACE_TIMER)? APPTRACE_TIMER: APPTRACE_RENDER);
+}
+
+
+//==========================
+// main
+//==========================
+
+
+/** 計測を開始 (mGuiInit() の後)
+ *
+ * overlay: キャンバスにオーバーレイを表示
+ * filename: 終了時に出力するファイル名 (NULL でなし) */
+
+mlkbool AppTrace_start(mlkbool overlay,const char *filename)
+{
+	_apptrace *p = &g_trace;
+
+	p->buf = (_event *)mMalloc(sizeof(_event) * _EVENT_NUM);
+	if(!p->buf) return FALSE;
+
+	p->mutex = mThreadMutexNew();
+	p->key = mThreadKeyNew(NULL);
+	p->filename = mStrdup(filename);
+	p->overlay = overlay;
+	p->enable = TRUE;
+
+	mNanoTimeGet(&p->nt_base);
+
+	//メインスレッドを 1 とする
+
+	_get_tid();
+
+	mGuiSetTraceHandle(_gui_handle);
+
+	return TRUE;
+}
+
+/** 終了 (ファイルに出力) */
+
+void AppTrace_finish(void)
+{
+	_apptrace *p = &g_trace;
+
+	if(!p->enable) return;
+
+	mGuiSetTraceHandle(NULL);
+
+	p->enable = FALSE;
+
+	if(p->filename)
+	{
+		if(!AppTrace_writeChromeTrace(p->filename))
+			mError("can not write trace '%s'\n", p->filename);
+	}
+
+	mThreadKeyDestroy(p->key);
+	mThreadMutexDestroy(p->mutex);
+
+	mFree(p->buf);
+	mFree(p->filename);
+}
+
+/** オーバーレイを表示するか */
+
+mlkbool AppTrace_isOverlay(void)
+{
+	return (g_trace.enable && g_trace.overlay);
+}
+
+
+//==========================
+// 計測
+//==========================
+
+
+/** 計測開始 */
+
+void AppTrace_begin(AppTraceScope *p,int type)
+{
+	if(!g_trace.enable)
+		p->start = 0;
+	else
+	{
+		p->start = _get_time();
+		p->type = type;
+	}
+}
+
+/** 計測終了 */
+
+void AppTrace_end(AppTraceScope *p)
+{
+	_event *pe;
+	uint64_t end,dur;
+	int type;
+
+	if(!p->start || !g_trace.enable) return;
+
+	end = _get_time();
+	dur = end - p->start;
+	type = p->type;
+
+	mThreadMutexLock(g_trace.mutex);
+
+	//イベント追加
+
+	pe = g_trace.buf + g_trace.pos;
+
+	pe->start = p->start;
+	pe->dur = dur;
+	pe->type = type;
+	pe->tid = _get_tid();
+
+	g_trace.pos = (g_trace.pos + 1) % _EVENT_NUM;
+
+	if(g_trace.num < _EVENT_NUM)
+		g_trace.num++;
+
+	//フレーム
+
+	if(type != APPTRACE_RENDER && type != APPTRACE_TIMER)
+	{
+		if(!g_trace.frame_start || p->start < g_trace.frame_start)
+			g_trace.frame_start = p->start;
+	}
+
+	g_trace.cur[type] += dur;
+
+	if(type == APPTRACE_RENDER)
+	{
+		if(g_trace.frame_start)
+			_end_frame(end);
+		else
+			g_trace.cur[APPTRACE_RENDER] = g_trace.cur[APPTRACE_TIMER] = 0;
+	}
+
+	mThreadMutexUnlock(g_trace.mutex);
+
+	p->start = 0;
+}
+
+
+//==========================
+// オーバーレイ
+//==========================
+
+
+/** オーバーレイの範囲を取得 (ウィジェット座標) */
+
+void AppTrace_getOverlayBox(mBox *box,mFont *font)
+{
+	box->x = _OVERLAY_X;
+	box->y = _OVERLAY_Y;
+	box->w = mFontGetTextWidth(font, "composite 0000.00 / 0000.00", -1) + _OVERLAY_PAD * 2;
+	box->h = mFontGetLineHeight(font) * _OVERLAY_LINES + _OVERLAY_PAD * 2;
+}
+
+/** オーバーレイの更新が必要か
+ *
+ * 前回から新しいフレームがある場合、平均を計算して TRUE を返す。 */
+
+mlkbool AppTrace_checkOverlayUpdate(void)
+{
+	_apptrace *p = &g_trace;
+	int i;
+
+	if(!AppTrace_isOverlay()) return FALSE;
+
+	mThreadMutexLock(p->mutex);
+
+	if(p->frame_cnt == p->overlay_cnt)
+	{
+		mThreadMutexUnlock(p->mutex);
+		return FALSE;
+	}
+
+	for(i = 0; i <= APPTRACE_NUM; i++)
+	{
+		p->avg[i] = p->sum[i] / p->sum_cnt;
+		p->sum[i] = 0;
+	}
+
+	p->sum_cnt = 0;
+	p->overlay_cnt = p->frame_cnt;
+
+	mThreadMutexUnlock(p->mutex);
+
+	return TRUE;
+}
+
+/** オーバーレイを描画 */
+
+void AppTrace_drawOverlay(mPixbuf *pixbuf,mFont *font)
+{
+	mBox box;
+	char m[64];
+	int i,n,y,lineh;
+
+	AppTrace_getOverlayBox(&box, font);
+
+	mPixbufFillBox(pixbuf, box.x, box.y, box.w, box.h, mRGBtoPix(0x202020));
+
+	lineh = mFontGetLineHeight(font);
+	y = box.y + _OVERLAY_PAD;
+
+	//(ms) 直前のフレーム / 平均
+
+	for(i = 0; i < _OVERLAY_LINES; i++, y += lineh)
+	{
+		n = (i == 0)? APPTRACE_NUM: i - 1;
+
+		snprintf(m, 64, "%-9s %7.2f / %7.2f",
+			(i == 0)? "frame": g_type_name[n],
+			g_trace.last[n] / 1000000.0, g_trace.avg[n] / 1000000.0);
+
+		mFontDrawText_pixbuf(font, pixbuf, box.x + _OVERLAY_PAD, y, m, -1,
+			(i == 0)? 0xffff80: 0xffffff);
+	}
+}
+
+
+//==========================
+// ファイル出力
+//==========================
+
+
+/** Chrome のトレース形式 (JSON) でファイルに出力
+ *
+ * chrome://tracing や Perfetto で読み込める。 */
+
+mlkbool AppTrace_writeChromeTrace(const char *filename)
+{
+	FILE *fp;
+	_event *pe;
+	uint32_t i,pos;
+
+	fp = mFILEopen(filename, "wt");
+	if(!fp) return FALSE;
+
+	fputs("{\"traceEvents\":[", fp);
+
+	mThreadMutexLock(g_trace.mutex);
+
+	//古い順
+
+	pos = (g_trace.pos + _EVENT_NUM - g_trace.num) % _EVENT_NUM;
+
+	for(i = 0; i < g_trace.num; i++)
+	{
+		pe = g_trace.buf + (pos + i) % _EVENT_NUM;
+
+		fprintf(fp, "%s\n{\"name\":\"%s\",\"cat\":\"azpainter\",\"ph\":\"X\","
+			"\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+			(i)? ",": "",
+			g_type_name[pe->type], pe->start / 1000.0, pe->dur / 1000.0, pe->tid);
+	}
+
+	mThreadMutexUnlock(g_trace.mutex);
+
+	fputs("\n],\"displayTimeUnit\":\"ms\"}\n", fp);
+
+	fclose(fp);
+
+	return TRUE;
+}
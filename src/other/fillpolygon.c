@@ -23,6 +23,7 @@ $*/
  * 多角形塗りつぶし処理
  *****************************************/
 
+#include <stdlib.h>	//qsort
 #include <math.h>
 
 #include "mlk.h"
@@ -38,16 +39,33 @@ typedef struct
 	int32_t x,dir;
 }EdgeDat;
 
+//辺データ (y1 < y2)
+
+typedef struct
+{
+	double x1,y1,x2,y2,
+		dxdy;		//Y が 1 増えた時の X の増加量
+	int32_t dir,	//元の方向 (1=下向き, -1=上向き)
+		no;			//元の辺の番号
+}LineDat;
+
 //処理用データ
 
 typedef struct _FillPolygon
 {
 	mBuf buf_pt,	//ポイントバッファ
 		buf_edge;	//交点バッファ
-	uint16_t *aabuf;	//アンチエイリアス用バッファ
+	LineDat *line;	//辺 (上端の Y 順)
+	int32_t *active;	//現在の Y に掛かる辺のインデックス (元の辺の番号順)
+	double *accbuf;		//アンチエイリアス用、符号付き面積の累積バッファ
+	uint8_t *covbuf;	//アンチエイリアス用、濃度バッファ
+	int32_t *touchbuf;	//アンチエイリアス用、各ピクセルを通過した辺の番号 (-1 でなし、-2 で複数)
 	
 	int ptnum,		//頂点の数
 		edgenum,	//現在の交点数
+		linenum,	//辺の数
+		line_next,	//次に追加する辺のインデックス
+		activenum,	//現在の Y に掛かる辺の数
 		xmin,xmax,ymin,ymax,	//全頂点の最小/最大値 (int)
 		width,			//描画のX幅
 		edge_curpos,	//現在の交点位置
@@ -56,7 +74,6 @@ typedef struct _FillPolygon
 
 
 #define _EXPAND_PTNUM  1
-#define _SUBPIXEL_Y    8
 #define _GETPT_POS(p,pos)   ((mDoublePoint *)(p)->buf_pt.buf + pos)
 
 //--------------------
@@ -75,7 +92,11 @@ void FillPolygon_free(FillPolygon *p)
 	{
 		mBufFree(&p->buf_pt);
 		mBufFree(&p->buf_edge);
-		mFree(p->aabuf);
+		mFree(p->line);
+		mFree(p->active);
+		mFree(p->accbuf);
+		mFree(p->covbuf);
+		mFree(p->touchbuf);
 		
 		mFree(p);
 	}
@@ -240,6 +261,123 @@ static void _sort_edge(FillPolygon *p)
 }
 
 
+/* qsort 比較関数 (辺の上端の Y 順) */
+
+static int _cmp_line(const void *p1,const void *p2)
+{
+	const LineDat *l1 = (const LineDat *)p1,
+		*l2 = (const LineDat *)p2;
+
+	if(l1->y1 < l2->y1)
+		return -1;
+	else if(l1->y1 > l2->y1)
+		return 1;
+	else
+		return l1->no - l2->no;
+}
+
+/* 辺のテーブルを作成
+ *
+ * 水平線は除外し、上端の Y 順に並べる。 */
+
+static mlkbool _create_line_table(FillPolygon *p)
+{
+	mDoublePoint *ptbuf,*pt1,*pt2;
+	LineDat *pl;
+	int i,num;
+
+	num = p->ptnum - _EXPAND_PTNUM;
+	if(num < 1) num = 1;
+
+	mFree(p->line);
+	mFree(p->active);
+
+	p->line = (LineDat *)mMalloc(sizeof(LineDat) * num);
+	p->active = (int32_t *)mMalloc(sizeof(int32_t) * num);
+
+	if(!p->line || !p->active) return FALSE;
+
+	//各辺
+
+	ptbuf = (mDoublePoint *)p->buf_pt.buf;
+	pl = p->line;
+
+	for(i = 0; i < p->ptnum - _EXPAND_PTNUM; i++, ptbuf++)
+	{
+		pt1 = ptbuf;
+		pt2 = ptbuf + 1;
+
+		if(pt1->y == pt2->y) continue;
+
+		if(pt1->y < pt2->y)
+			pl->dir = 1;
+		else
+		{
+			pl->dir = -1;
+			pt1 = ptbuf + 1, pt2 = ptbuf;
+		}
+
+		pl->x1 = pt1->x;
+		pl->y1 = pt1->y;
+		pl->x2 = pt2->x;
+		pl->y2 = pt2->y;
+		pl->dxdy = (pt2->x - pt1->x) / (pt2->y - pt1->y);
+		pl->no = i;
+
+		pl++;
+	}
+
+	p->linenum = pl - p->line;
+	p->line_next = 0;
+	p->activenum = 0;
+
+	qsort(p->line, p->linenum, sizeof(LineDat), _cmp_line);
+
+	return TRUE;
+}
+
+/* Y 位置 (px) に掛かる辺のリストを更新
+ *
+ * Y は昇順で処理すること。
+ * 上端が y + 1 より上の辺を追加し、下端が y 以上の辺を残す。
+ * リストは、元の辺の番号順に保つ。 */
+
+static void _update_active(FillPolygon *p,int y)
+{
+	LineDat *line = p->line;
+	int32_t *pa;
+	int i,j,num,no;
+
+	//範囲外になった辺を除外
+
+	pa = p->active;
+	num = 0;
+
+	for(i = 0; i < p->activenum; i++)
+	{
+		if(line[pa[i]].y2 > y)
+			pa[num++] = pa[i];
+	}
+
+	//新しく掛かる辺を追加 (番号順に挿入)
+
+	for(; p->line_next < p->linenum && line[p->line_next].y1 < y + 1; p->line_next++)
+	{
+		if(line[p->line_next].y2 <= y) continue;
+
+		no = line[p->line_next].no;
+
+		for(j = num; j > 0 && line[pa[j - 1]].no > no; j--)
+			pa[j] = pa[j - 1];
+
+		pa[j] = p->line_next;
+		num++;
+	}
+
+	p->activenum = num;
+}
+
+
 //================================
 // 描画用
 //================================
@@ -265,9 +403,22 @@ mlkbool FillPolygon_beginDraw(FillPolygon *p,mlkbool antialias)
 	if(antialias)
 	{
 		//アンチエイリアス用バッファ
+		// :累積バッファは、右端の次の位置まで書き込まれる
+
+		int i;
+
+		mFree(p->accbuf);
+		mFree(p->covbuf);
+		mFree(p->touchbuf);
+
+		p->accbuf = (double *)mMalloc0(sizeof(double) * (p->width + 2));
+		p->covbuf = (uint8_t *)mMalloc(p->width + 2);
+		p->touchbuf = (int32_t *)mMalloc(sizeof(int32_t) * (p->width + 2));
+
+		if(!p->accbuf || !p->covbuf || !p->touchbuf) return FALSE;
 
-		p->aabuf = (uint16_t *)mMalloc(p->width * 2);
-		if(!p->aabuf) return FALSE;
+		for(i = 0; i < p->width + 2; i++)
+			p->touchbuf[i] = -1;
 	}
 	else
 	{
@@ -298,7 +449,9 @@ mlkbool FillPolygon_beginDraw(FillPolygon *p,mlkbool antialias)
 		p->ptnum = num;
 	}
 
-	return TRUE;
+	//辺のテーブル
+
+	return _create_line_table(p);
 }
 
 /** 描画先 Y の最小/最大値取得 */
@@ -325,12 +478,14 @@ void FillPolygon_getDrawRect(FillPolygon *p,mRect *rc)
 //================================
 
 
-/** 描画 Y 位置の交点取得 (非アンチエイリアス用) */
+/** 描画 Y 位置の交点取得 (非アンチエイリアス用)
+ *
+ * Y は昇順で呼ぶこと。 */
 
 mlkbool FillPolygon_getIntersection_noAA(FillPolygon *p,int y)
 {
-	mDoublePoint *ptbuf,*pt1,*pt2;
-	int i,x,dir;
+	LineDat *pl;
+	int i,x;
 	double dy;
 
 	//交点クリア
@@ -341,37 +496,26 @@ mlkbool FillPolygon_getIntersection_noAA(FillPolygon *p,int y)
 	p->edge_curpos = 0;
 	p->edge_curparam = 0;
 
-	//各辺から交点取得
+	//Y に掛かる辺から交点取得
+	// :元の辺の順で処理する
 
-	ptbuf = (mDoublePoint *)p->buf_pt.buf;
+	_update_active(p, y);
 
 	dy = y + 0.1;
 
-	for(i = p->ptnum - _EXPAND_PTNUM; i > 0; i--, ptbuf++)
+	for(i = 0; i < p->activenum; i++)
 	{
-		pt1 = ptbuf;
-		pt2 = ptbuf + 1;
-	
-		//水平線は除外
-
-		if(pt1->y == pt2->y) continue;
-
-		//方向
-	
-		dir = (pt1->y < pt2->y)? 1: -1;
-
-		if(dir < 0)
-			pt1 = ptbuf + 1, pt2 = ptbuf;
+		pl = p->line + p->active[i];
 
 		//dy が辺の範囲外
 
-		if(dy < pt1->y || dy > pt2->y) continue;
+		if(dy < pl->y1 || dy > pl->y2) continue;
 
 		//交点 X
 
-		x = round(pt1->x + (dy - pt1->y) / (pt2->y - pt1->y) * (pt2->x - pt1->x));
+		x = round(pl->x1 + (dy - pl->y1) / (pl->y2 - pl->y1) * (pl->x2 - pl->x1));
 
-		if(!_add_edge(p, x, dir))
+		if(!_add_edge(p, x, pl->dir))
 			return FALSE;
 	}
 
@@ -418,133 +562,241 @@ mlkbool FillPolygon_getNextLine_noAA(FillPolygon *p,int *left,int *right)
 //================================
 // アンチエイリアス
 //================================
+/*
+ * - 各辺を Y 1px ごとに区切り、通過するピクセルに符号付きの面積を加算する。
+ *   X 方向に累積すると、各ピクセルの被覆率 (0.0〜1.0) になる。
+ * - 塗りつぶし規則は、累積値の絶対値を 1.0 で制限することで、非ゼロ規則となる。
+ *   ただし、辺が交差するピクセルなど、隣接しない複数の辺が通過するピクセルでは
+ *   正しくならない場合があるため、16x16 のサンプリングで求める。
+ * - 辺が通過しない範囲は処理しない。
+ */
 
 
-/* 交点リスト作成 */
+/* 1px 行内の辺の面積を累積バッファに加算
+ *
+ * x0,x1: 上端と下端の X 位置 (バッファ上の位置)
+ * d: 行内の Y の長さ (方向による符号付き) */
 
-static mlkbool _get_intersection_aa(FillPolygon *p,double y)
+static void _accumulate_line(double *buf,double x0,double x1,double d)
 {
-	mDoublePoint *ptbuf,pt1,pt2,pttmp;
-	int i,x,dir;
+	double xmf,s,x0f,x1f,a0,a1,a2,am,tmp;
+	int x0i,x1c,i;
 
-	//交点クリア
+	if(x0 > x1)
+		tmp = x0, x0 = x1, x1 = tmp;
 
-	mBufReset(&p->buf_edge);
-	
-	p->edgenum = 0;
+	x0i = (int)floor(x0);
+	x1c = (int)ceil(x1);
 
-	//各辺から交点取得
+	if(x1c <= x0i + 1)
+	{
+		//1px 内
 
-	ptbuf = (mDoublePoint *)p->buf_pt.buf;
+		xmf = 0.5 * (x0 + x1) - x0i;
 
-	for(i = p->ptnum - _EXPAND_PTNUM; i > 0; i--, ptbuf++)
+		buf[x0i] += d - d * xmf;
+		buf[x0i + 1] += d * xmf;
+	}
+	else
 	{
-		pt1 = *ptbuf;
-		pt2 = ptbuf[1];
-	
-		//水平線は除外
+		//複数 px に渡る
 
-		if(pt1.y == pt2.y) continue;
+		s = 1.0 / (x1 - x0);
+		x0f = x0 - x0i;
+		x1f = x1 - x1c + 1.0;
 
-		//方向
-	
-		dir = (pt1.y < pt2.y)? 1: -1;
-
-		if(dir < 0)
-			pttmp = pt1, pt1 = pt2, pt2 = pttmp;
+		a0 = 0.5 * s * (1.0 - x0f) * (1.0 - x0f);
+		am = 0.5 * s * x1f * x1f;
 
-		//y が辺の範囲外
+		buf[x0i] += d * a0;
 
-		if(y < pt1.y || y > pt2.y) continue;
+		if(x1c == x0i + 2)
+			buf[x0i + 1] += d * (1.0 - a0 - am);
+		else
+		{
+			a1 = s * (1.5 - x0f);
+			buf[x0i + 1] += d * (a1 - a0);
 
-		//交点 X (8bit 固定小数点。xmin からの相対位置)
+			for(i = x0i + 2; i < x1c - 1; i++)
+				buf[i] += d * s;
 
-		x = round(((y - pt1.y) / (pt2.y - pt1.y) * (pt2.x - pt1.x) + pt1.x - p->xmin) * (1<<8));
+			a2 = a1 + (x1c - x0i - 3) * s;
+			buf[x1c - 1] += d * (1.0 - a2 - am);
+		}
 
-		if(!_add_edge(p, x, dir))
-			return FALSE;
+		buf[x1c] += d * am;
 	}
+}
 
-	_sort_edge(p);
+/* 2つの辺が隣接しているか (元の辺の番号) */
 
-	return TRUE;
+static mlkbool _is_adjacent_line(FillPolygon *p,int no1,int no2)
+{
+	int num = p->ptnum - _EXPAND_PTNUM;
+
+	return (no1 == no2 || (no1 + 1) % num == no2 || (no2 + 1) % num == no1);
 }
 
-/** (アンチエイリアス用) 描画Y位置のバッファをセット
+/* ピクセルを通過した辺をセット
  *
- * return: FALSE で失敗 */
+ * x1,x2: 通過したピクセル範囲 (バッファ上の位置) */
 
-mlkbool FillPolygon_setXBuf_AA(FillPolygon *p,int y)
+static void _set_touch(FillPolygon *p,int x1,int x2,int no)
 {
-	uint16_t *xbuf,*px;
-	EdgeDat *pe;
-	double dy;
-	int iy,i,cnt,x1,x2,nx1,nx2;
-
-	xbuf = p->aabuf;
+	int32_t *pd;
 
-	mMemset0(xbuf, p->width * 2);
+	if(x1 < 0) x1 = 0;
+	if(x2 > p->width + 1) x2 = p->width + 1;
 
-	dy = y + 0.011;  //少しずらす
-
-	for(iy = 0; iy < _SUBPIXEL_Y; iy++, dy += 1.0 / _SUBPIXEL_Y)
+	for(pd = p->touchbuf + x1; x1 <= x2; x1++, pd++)
 	{
-		//交点取得
+		if(*pd == -1)
+			*pd = no;
+		else if(*pd >= 0 && !_is_adjacent_line(p, *pd, no))
+			*pd = -2;
+	}
+}
 
-		if(!_get_intersection_aa(p, dy)) return FALSE;
+/* 1px の濃度を、16x16 のサンプリングで取得 (非ゼロ規則)
+ *
+ * x: バッファ上の位置 */
 
-		//交点間
+static int _get_coverage_sample(FillPolygon *p,int x,int y)
+{
+	LineDat *pl;
+	int wind[16],i,ix,iy,cnt;
+	double dy,dx,xc;
 
-		pe = (EdgeDat *)p->buf_edge.buf;
-		cnt = 0;
+	cnt = 0;
+	dy = y + 0.5 / 16;
 
-		for(i = p->edgenum - 1; i > 0; i--, pe++)
-		{
-			cnt += pe->dir;
+	for(iy = 0; iy < 16; iy++, dy += 1.0 / 16)
+	{
+		for(ix = 0; ix < 16; ix++)
+			wind[ix] = 0;
 
-			if(!cnt) continue;
+		//サンプル点の左側を通る辺の方向を加算
 
-			//交点計算時のX小数部分を濃度に反映
-			// :x1〜x2 の範囲
-		
-			x1 = pe->x;
-			x2 = pe[1].x;
+		for(i = 0; i < p->activenum; i++)
+		{
+			pl = p->line + p->active[i];
 
-			nx1 = x1 >> 8;
-			nx2 = x2 >> 8;
+			if(dy < pl->y1 || dy >= pl->y2) continue;
 
-			px = xbuf + nx1;
+			xc = pl->x1 + (dy - pl->y1) * pl->dxdy - p->xmin;
 
-			if(nx1 == nx2)
-				*px += (x2 - x1) & 255;
-			else
+			for(ix = 0, dx = x + 0.5 / 16; ix < 16; ix++, dx += 1.0 / 16)
 			{
-				*(px++) += 255 - (x1 & 255);
-
-				for(nx1++; nx1 < nx2; nx1++)
-					*(px++) += 255;
-
-				*px += x2 & 255;
+				if(xc < dx) wind[ix] += pl->dir;
 			}
 		}
+
+		for(ix = 0; ix < 16; ix++)
+		{
+			if(wind[ix]) cnt++;
+		}
 	}
 
-	return TRUE;
+	return (cnt * 255 + 128) >> 8;
 }
 
-/** X描画分のバッファを取得
+/** (アンチエイリアス用) 描画 Y 位置の濃度を取得
  *
- * Y をオーバーサンプリングした濃度値 (MAX=255) となっているため、
- * オーバーサンプリング分を割って、濃度 0-255 を出す。
+ * Y は昇順で呼ぶこと。
  *
- * xmin: 開始X位置
- * width: 描画幅 */
+ * left,right: 濃度がある X の範囲 (px)
+ * return: left の位置の濃度バッファ (0〜255)。NULL で範囲なし */
 
-uint16_t *FillPolygon_getAABuf(FillPolygon *p,int *xmin,int *width)
+uint8_t *FillPolygon_getCoverage_AA(FillPolygon *p,int y,int *left,int *right)
 {
-	*xmin = p->xmin;
-	*width = p->width;
+	LineDat *pl;
+	double *acc,ya,yb,xa,xb,sum,c;
+	uint8_t *pd;
+	int i,xmin,xmax,x1,x2;
+
+	acc = p->accbuf;
+
+	//Y に掛かる辺の面積を加算
+
+	_update_active(p, y);
+
+	if(!p->activenum) return NULL;
+
+	xmin = p->width;
+	xmax = 0;
+
+	for(i = 0; i < p->activenum; i++)
+	{
+		pl = p->line + p->active[i];
+
+		//行内の Y 範囲
+
+		ya = (pl->y1 > y)? pl->y1: y;
+		yb = (pl->y2 < y + 1)? pl->y2: y + 1;
+
+		if(yb <= ya) continue;
+
+		//上端と下端の X (xmin からの相対位置)
+
+		xa = pl->x1 + (ya - pl->y1) * pl->dxdy - p->xmin;
+		xb = pl->x1 + (yb - pl->y1) * pl->dxdy - p->xmin;
+
+		//念の為、バッファ範囲内に調整
+
+		if(xa < 0) xa = 0; else if(xa > p->width) xa = p->width;
+		if(xb < 0) xb = 0; else if(xb > p->width) xb = p->width;
+
+		_accumulate_line(acc, xa, xb, (yb - ya) * pl->dir);
+
+		//加算した範囲 (右側は +1 の位置まで)
+
+		x1 = (int)floor((xa < xb)? xa: xb);
+		x2 = (int)ceil((xa < xb)? xb: xa) + 1;
+
+		if(x1 < xmin) xmin = x1;
+		if(x2 > xmax) xmax = x2;
+
+		//通過したピクセル
+
+		_set_touch(p, x1, (int)floor((xa < xb)? xb: xa), pl->no);
+	}
+
+	if(xmin > xmax) return NULL;
+
+	//累積して濃度に変換 (累積バッファはクリアしておく)
+
+	sum = 0;
+	x1 = -1;
+	x2 = xmin;
+
+	for(i = xmin, pd = p->covbuf + xmin; i <= xmax; i++, pd++)
+	{
+		sum += acc[i];
+		acc[i] = 0;
+
+		if(p->touchbuf[i] == -2)
+			*pd = _get_coverage_sample(p, i, y);
+		else
+		{
+			c = fabs(sum);
+
+			*pd = (c >= 1.0)? 255: (int)(c * 255 + 0.5);
+		}
+
+		p->touchbuf[i] = -1;
+
+		if(*pd)
+		{
+			if(x1 < 0) x1 = i;
+			x2 = i;
+		}
+	}
+
+	if(x1 < 0) return NULL;
+
+	*left = p->xmin + x1;
+	*right = p->xmin + x2;
 
-	return p->aabuf;
+	return p->covbuf + x1;
 }
 
@@ -37,6 +37,8 @@ $*/
 #include "layeritem.h"
 #include "tileimage.h"
 #include "materiallist.h"
+#include "apd_v4_format.h"
+#include "layerswap.h"
 
 
 //-----------------------
@@ -89,6 +91,8 @@ void LayerItem_setOpened_parent(LayerItem *p)
 
 void LayerItem_setLink(LayerItem *p,LayerItem **pptop,LayerItem **pplast)
 {
+	LayerItem_loadPendingImage(p);
+
 	if(*pptop)
 		(*pplast)->link = p;
 	else
@@ -168,6 +172,11 @@ void LayerItem_replaceImage(LayerItem *p,TileImage *img,int type)
 {
 	TileImage_free(p->img);
 
+	mFree(p->pending_dat);
+	p->pending_dat = NULL;
+
+	LayerSwap_free(p);
+
 	p->img = img;
 
 	if(type >= 0) p->type = type;
@@ -184,6 +193,58 @@ void LayerItem_setImage(LayerItem *p,TileImage *img)
 	p->col = RGBcombo_to_32bit(&img->col);
 }
 
+/** 未展開のイメージデータがあれば、展開する
+ *
+ * APD v4 の遅延読み込み時、非表示のレイヤは圧縮されたまま保持されているので、
+ * 合成・編集・保存などでイメージが必要になった時に実行する。
+ * スワップファイルに書き出されている場合も、ここで展開される。
+ *
+ * return: FALSE で展開に失敗 (データは残り、イメージは空) */
+
+mlkbool LayerItem_loadPendingImage(LayerItem *p)
+{
+	if(!p) return TRUE;
+
+	if(!LayerSwap_load(p))
+		return FALSE;
+
+	if(p->pending_dat)
+	{
+		//失敗時は、展開途中のタイルを解放し、データは残す
+
+		if(apd4load_readPendingImage(p->img, p->pending_dat))
+		{
+			TileImage_freeAllTiles(p->img);
+			return FALSE;
+		}
+
+		mFree(p->pending_dat);
+		p->pending_dat = NULL;
+	}
+
+	return TRUE;
+}
+
+/** 下位を含むすべての未展開のイメージを展開
+ *
+ * フォルダの場合は、フォルダ下のすべてのレイヤが対象。
+ *
+ * return: FALSE で展開に失敗したレイヤがある */
+
+mlkbool LayerItem_loadPendingImage_tree(LayerItem *item)
+{
+	LayerItem *pi;
+	mlkbool ret = TRUE;
+
+	for(pi = item; pi; pi = _NEXTITEM_ROOT(pi, item))
+	{
+		if(!LayerItem_loadPendingImage(pi))
+			ret = FALSE;
+	}
+
+	return ret;
+}
+
 /** 情報をコピー */
 
 void LayerItem_copyInfo(LayerItem *dst,LayerItem *src)
@@ -222,11 +283,13 @@ mlkbool LayerItem_isHave_editImageFull(LayerItem *item)
  *
  * - フォルダの場合は下位すべて対象。
  * - テキストレイヤ、空イメージは除く。
+ * - 未展開のイメージは、先に展開する (空イメージとして除外されないように)。
  *
  * type:  0=左右反転 1=上下反転 2=左90度回転 3=右90度回転
- * rcupdate: 更新範囲が入る */
+ * rcupdate: 更新範囲が入る
+ * return: FALSE で展開に失敗 (何も処理されない) */
 
-void LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate)
+mlkbool LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate)
 {
 	LayerItem *pi;
 	mRect rc,rc2;
@@ -237,6 +300,11 @@ void LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate)
 
 	mRectEmpty(&rc);
 
+	*rcupdate = rc;
+
+	if(!LayerItem_loadPendingImage_tree(item))
+		return FALSE;
+
 	for(pi = item; pi; pi = _NEXTITEM_ROOT(pi, item))
 	{
 		if(pi->img && !LAYERITEM_IS_TEXT(pi))
@@ -261,6 +329,8 @@ void LayerItem_editImage_full(LayerItem *item,int type,mRect *rcupdate)
 	}
 
 	*rcupdate = rc;
+
+	return TRUE;
 }
 
 /** イメージの位置を相対移動 */
@@ -532,6 +602,8 @@ LayerItem *LayerItem_getPrevVisibleImage_incSelf(LayerItem *p)
 		}
 	}
 
+	LayerItem_loadPendingImage(p);
+
 	return p;
 }
 
@@ -609,6 +681,8 @@ LayerItem *LayerItem_getNextVisibleImage(LayerItem *p,LayerItem *root)
 		}
 	}
 
+	LayerItem_loadPendingImage(p);
+
 	return p;
 }
 
@@ -37,6 +37,7 @@ $*/
 #include "materiallist.h"
 #include "tileimage.h"
 #include "def_tileimage.h"
+#include "layerswap.h"
 
 
 /*
@@ -86,11 +87,15 @@ static void _destroy_item(mTree *tree,mTreeItem *item)
 	//
 
 	TileImage_free(p->img);
+	TileImageToneCache_free(p->tone_cache);
 
 	mListDeleteAll(&p->list_text);
 
 	mFree(p->name);
 	mFree(p->texture_path);
+	mFree(p->pending_dat);
+
+	LayerSwap_free(p);
 }
 
 /* LayerItem 確保 (ツリーへのリンクは行わない) */
@@ -332,6 +337,9 @@ LayerItem *LayerList_dupLayer(LayerList *p,LayerItem *src)
 
 	//イメージを複製
 
+	if(!LayerItem_loadPendingImage(src))
+		return NULL;
+
 	img = TileImage_newClone(src->img);
 	if(!img) return NULL;
 
@@ -584,6 +592,8 @@ TileImage *LayerList_getMaskUnderImage(LayerList *p,LayerItem *current)
 	for(pi = _NEXT_ITEM(current);
 		pi && pi->img && LAYERITEM_IS_MASK_UNDER(pi); pi = _NEXT_ITEM(pi));
 
+	LayerItem_loadPendingImage(pi);
+
 	return (pi)? pi->img: NULL;
 }
 
@@ -1202,12 +1212,17 @@ void LayerList_moveOffset_rel_text(LayerList *p,int movx,int movy)
 	}
 }
 
-/** すべてのレイヤのイメージビット数を変更 */
+/** すべてのレイヤのイメージビット数を変更
+ *
+ * return: FALSE で変換できなかったイメージがある */
 
-void LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog)
+mlkbool LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog)
 {
 	LayerItem *pi;
+	TileImage **imgs;
 	void *tblbuf;
+	int num;
+	mlkbool ret = TRUE;
 
 	//変換用テーブル
 
@@ -1218,12 +1233,70 @@ void LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog)
 
 	//
 
+	LayerList_loadPendingImage_all(p);
+
+	//すべてのイメージをまとめて変換
+
+	num = 0;
+
 	for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
 	{
-		if(pi->img)
-			TileImage_convertBits(pi->img, bits, tblbuf, prog);
+		if(pi->img) num++;
+	}
+
+	imgs = (TileImage **)mMalloc(sizeof(TileImage *) * (num + 1));
+
+	if(imgs)
+	{
+		num = 0;
+
+		for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
+		{
+			if(pi->img)
+				imgs[num++] = pi->img;
+		}
+
+		if(!TileImage_convertBits_multi(imgs, num, bits, tblbuf, prog))
+		{
+			mFree(imgs);
+			imgs = NULL;
+		}
+	}
+
+	//メモリ不足時は、1つずつ変換
+
+	if(!imgs)
+	{
+		for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
+		{
+			if(pi->img && !TileImage_convertBits(pi->img, bits, tblbuf, prog))
+				ret = FALSE;
+		}
 	}
 
+	mFree(imgs);
 	mFree(tblbuf);
+
+	return ret;
+}
+
+/** 未展開のレイヤイメージをすべて展開
+ *
+ * すべてのレイヤのイメージが必要な処理の前に実行する。
+ *
+ * return: FALSE で展開に失敗したレイヤがある */
+
+mlkbool LayerList_loadPendingImage_all(LayerList *p)
+{
+	LayerItem *pi;
+	mlkbool ret = TRUE;
+
+	for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
+	{
+		if(!LayerItem_loadPendingImage(pi))
+			ret = FALSE;
+	}
+
+	return ret;
 }
 
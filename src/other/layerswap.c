@@ -0,0 +1,477 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * レイヤイメージのスワップ
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>	//qsort
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "mlk_gui.h"
+#include "mlk_list.h"
+#include "mlk_str.h"
+#include "mlk_tree.h"
+#include "mlk_stdio.h"
+
+#include "def_config.h"
+#include "def_draw.h"
+
+#include "layerlist.h"
+#include "layeritem.h"
+#include "tileimage.h"
+#include "appconfig.h"
+#include "apd_v4_format.h"
+
+#include "layerswap.h"
+
+
+/*
+  - 使用中のタイルメモリの総量が設定値を超えた時、非表示のレイヤのイメージを
+    作業用ディレクトリのファイルに圧縮して書き出し、タイルを解放する。
+  - 書き出しは、最後にアクセスされた時が古いレイヤから順に行う。
+  - データは APD v4 の遅延読み込み時と同じ形式。
+    イメージが必要になった時 (LayerItem_loadPendingImage)、
+    ファイルを mmap して展開し、データは破棄する。
+    展開に失敗した場合はデータを残すので、イメージは失われない。
+  - タイル配列はそのまま残るので、イメージの範囲やオフセットは変わらない。
+  - 対象は非表示のレイヤのみ。
+    表示レイヤは、キャンバスの合成時に常に展開されるため、書き出してもすぐに読み込まれる。
+  - データの破棄で生じたファイル上の空き領域は、リストで管理し、次の書き出し時に再利用する。
+    圧縮後のサイズは書き込むまでわからないため、一旦終端に書き込み、
+    収まる空き領域があれば、そこへ移して終端を切り詰める。
+*/
+
+//------------------
+
+#define _FILENAME  "layerswap"
+
+/* LayerItem::swap_dat */
+
+struct _LayerSwapData
+{
+	off_t pos;		//ファイル位置
+	uint32_t size;	//データサイズ
+};
+
+/* ファイル上の空き領域 */
+
+typedef struct
+{
+	mListItem i;
+	off_t pos,
+		size;
+}_freearea;
+
+typedef struct
+{
+	FILE *fp;
+	off_t fend;		//データの終端位置
+	int num;		//ファイル上の有効なデータ数
+	uint32_t stamp;	//アクセスカウンタ
+	mList list_free;	//空き領域 (位置順。隣接する領域は結合済み)
+}_swapfile;
+
+static _swapfile g_swap = {0};
+
+//------------------
+
+
+/* ファイルを開く */
+
+static mlkbool _open_file(void)
+{
+	mStr str = MSTR_INIT;
+
+	if(g_swap.fp) return TRUE;
+
+	if(!AppConfig_getTempPath(&str, _FILENAME))
+		return FALSE;
+
+	g_swap.fp = mFILEopen(str.buf, "w+b");
+	g_swap.fend = 0;
+
+	mStrFree(&str);
+
+	return (g_swap.fp != NULL);
+}
+
+/* ファイルの終端を切り詰める
+ *
+ * 有効なデータがなくなった時は、ファイルを空にする。 */
+
+static void _truncate_file(off_t size)
+{
+	_freearea *pi;
+
+	if(!g_swap.fp || size > g_swap.fend) return;
+
+	fflush(g_swap.fp);
+
+	if(ftruncate(fileno(g_swap.fp), size) == 0)
+	{
+		g_swap.fend = size;
+
+		//終端以降の空き領域を削除
+
+		while((pi = (_freearea *)g_swap.list_free.bottom) && pi->pos >= size)
+			mListDelete(&g_swap.list_free, MLISTITEM(pi));
+	}
+}
+
+/* 空き領域を追加
+ *
+ * 前後の領域と隣接する場合は結合する。
+ * 終端に達した場合は、ファイルを切り詰める。 */
+
+static void _add_freearea(off_t pos,off_t size)
+{
+	_freearea *pi,*prev;
+
+	//挿入位置 (pos より後の最初の領域)
+
+	for(pi = (_freearea *)g_swap.list_free.top;
+		pi && pi->pos < pos; pi = (_freearea *)pi->i.next);
+
+	prev = (_freearea *)((pi)? pi->i.prev: g_swap.list_free.bottom);
+
+	if(prev && prev->pos + prev->size == pos)
+	{
+		//前と結合
+
+		prev->size += size;
+
+		if(pi && prev->pos + prev->size == pi->pos)
+		{
+			prev->size += pi->size;
+			mListDelete(&g_swap.list_free, MLISTITEM(pi));
+		}
+
+		pi = prev;
+	}
+	else if(pi && pos + size == pi->pos)
+	{
+		//後と結合
+
+		pi->pos = pos;
+		pi->size += size;
+	}
+	else
+	{
+		//新規 (確保できなかった場合は、再利用しない)
+
+		pi = (_freearea *)mListInsertNew(&g_swap.list_free, MLISTITEM(pi), sizeof(_freearea));
+		if(!pi) return;
+
+		pi->pos = pos;
+		pi->size = size;
+	}
+
+	//終端の場合
+
+	if(pi->pos + pi->size == g_swap.fend)
+		_truncate_file(pi->pos);
+}
+
+/* size が収まる最小の空き領域を取得 */
+
+static _freearea *_find_freearea(off_t size)
+{
+	_freearea *pi,*ret = NULL;
+
+	MLK_LIST_FOR(g_swap.list_free, pi, _freearea)
+	{
+		if(pi->size >= size && (!ret || pi->size < ret->size))
+			ret = pi;
+	}
+
+	return ret;
+}
+
+/* ファイル内のデータを移動 (範囲は重ならないこと) */
+
+static mlkbool _move_data(off_t src,off_t dst,off_t size)
+{
+	uint8_t *buf;
+	int fd;
+	ssize_t n;
+	mlkbool ret = FALSE;
+
+	buf = (uint8_t *)mMalloc(64 * 1024);
+	if(!buf) return FALSE;
+
+	fd = fileno(g_swap.fp);
+
+	while(size)
+	{
+		n = (size < 64 * 1024)? size: 64 * 1024;
+
+		if(pread(fd, buf, n, src) != n
+			|| pwrite(fd, buf, n, dst) != n)
+			goto ERR;
+
+		src += n;
+		dst += n;
+		size -= n;
+	}
+
+	ret = TRUE;
+
+ERR:
+	mFree(buf);
+
+	return ret;
+}
+
+/* 一つのレイヤを書き出し */
+
+static mlkbool _swapout(LayerItem *pi,uint32_t tilenum)
+{
+	FILE *fp = g_swap.fp;
+	LayerSwapData *dat;
+	_freearea *area;
+	uint32_t size;
+
+	dat = (LayerSwapData *)mMalloc(sizeof(LayerSwapData));
+	if(!dat) return FALSE;
+
+	//終端に書き込み
+
+	if(fseeko(fp, g_swap.fend, SEEK_SET)
+		|| apd4save_writePendingImage(fp, pi->img, tilenum, &size))
+	{
+		mFree(dat);
+		_truncate_file(g_swap.fend);
+		return FALSE;
+	}
+
+	dat->size = size;
+
+	//空き領域に収まる場合は移動
+
+	area = _find_freearea(size);
+
+	if(area && _move_data(g_swap.fend, area->pos, size))
+	{
+		dat->pos = area->pos;
+
+		area->pos += size;
+		area->size -= size;
+
+		if(!area->size)
+			mListDelete(&g_swap.list_free, MLISTITEM(area));
+
+		_truncate_file(g_swap.fend);
+	}
+	else
+	{
+		dat->pos = g_swap.fend;
+		g_swap.fend += size;
+	}
+
+	g_swap.num++;
+
+	//タイルを解放
+
+	TileImage_freeAllTiles(pi->img);
+
+	pi->swap_dat = dat;
+
+	return TRUE;
+}
+
+/* ソート関数 (アクセスが古い順) */
+
+static int _cmp_stamp(const void *a,const void *b)
+{
+	uint32_t sa,sb;
+
+	//カウンタの一周を考慮し、現在値からの差で比較
+
+	sa = g_swap.stamp - (*((LayerItem **)a))->swap_stamp;
+	sb = g_swap.stamp - (*((LayerItem **)b))->swap_stamp;
+
+	return (sa < sb)? 1: ((sa > sb)? -1: 0);
+}
+
+/* 書き出し可能なレイヤか */
+
+static mlkbool _is_swappable(AppDraw *p,LayerItem *pi)
+{
+	return (pi->img
+		&& !pi->pending_dat && !pi->swap_dat
+		&& pi != p->curlayer && pi != p->masklayer
+		&& !LayerItem_isVisible_real(pi));
+}
+
+
+//========================
+// main
+//========================
+
+
+/** 終了処理 */
+
+void LayerSwap_finish(void)
+{
+	if(g_swap.fp)
+	{
+		fclose(g_swap.fp);
+		g_swap.fp = NULL;
+	}
+
+	mListDeleteAll(&g_swap.list_free);
+}
+
+/** メモリ量をチェックして、必要ならレイヤを書き出す
+ *
+ * 一つの操作が終わった後に実行する。
+ * 設定値の 90% 以下になるまで、非表示のレイヤを書き出す。 */
+
+void LayerSwap_check(void)
+{
+	AppDraw *p = APPDRAW;
+	LayerItem *pi,**items;
+	TileImageTileMemInfo info;
+	uint64_t budget;
+	uint32_t tilenum;
+	mRect rc;
+	int num,i;
+
+	if(APPCONF->layer_swap_size <= 0) return;
+
+	budget = (uint64_t)APPCONF->layer_swap_size << 20;
+
+	TileImage_global_getTileMemInfo(&info);
+
+	if(info.used_size <= budget) return;
+
+	//対象レイヤ数
+
+	num = 0;
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = (LayerItem *)mTreeItemGetNext(MTREEITEM(pi)))
+	{
+		if(_is_swappable(p, pi)) num++;
+	}
+
+	if(!num) return;
+
+	//アクセスが古い順に並べる
+
+	items = (LayerItem **)mMalloc(sizeof(LayerItem *) * num);
+	if(!items) return;
+
+	num = 0;
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = (LayerItem *)mTreeItemGetNext(MTREEITEM(pi)))
+	{
+		if(_is_swappable(p, pi))
+			items[num++] = pi;
+	}
+
+	qsort(items, num, sizeof(LayerItem *), _cmp_stamp);
+
+	//書き出し
+
+	budget = budget / 10 * 9;
+
+	if(_open_file())
+	{
+		for(i = 0; i < num && info.used_size > budget; i++)
+		{
+			pi = items[i];
+
+			if(!TileImage_getHaveImageRect_pixel(pi->img, &rc, &tilenum)
+				|| !tilenum)
+				continue;
+
+			if(!_swapout(pi, tilenum)) break;
+
+			TileImage_global_getTileMemInfo(&info);
+		}
+	}
+
+	mFree(items);
+}
+
+/** 書き出されたイメージを展開
+ *
+ * アクセスカウンタも更新される。
+ * 失敗時は、展開途中のタイルを解放し、書き出されたデータはそのまま残す (再度展開できる)。
+ *
+ * return: FALSE で失敗 */
+
+mlkbool LayerSwap_load(LayerItem *p)
+{
+	LayerSwapData *dat = p->swap_dat;
+	uint8_t *buf;
+	off_t top;
+	size_t size;
+	mlkerr ret;
+
+	p->swap_stamp = ++g_swap.stamp;
+
+	if(!dat) return TRUE;
+
+	//mmap (ファイル位置はページ境界に合わせる)
+
+	top = dat->pos & ~((off_t)sysconf(_SC_PAGESIZE) - 1);
+	size = dat->pos - top + dat->size;
+
+	buf = (uint8_t *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(g_swap.fp), top);
+	if(buf == MAP_FAILED) return FALSE;
+
+	ret = apd4load_readPendingImage(p->img, buf + (dat->pos - top));
+
+	munmap(buf, size);
+
+	//すべて展開できた場合のみ、データを破棄
+
+	if(ret)
+	{
+		TileImage_freeAllTiles(p->img);
+		return FALSE;
+	}
+
+	LayerSwap_free(p);
+
+	return TRUE;
+}
+
+/** 書き出されたデータを破棄 */
+
+void LayerSwap_free(LayerItem *p)
+{
+	LayerSwapData *dat = p->swap_dat;
+
+	if(!dat) return;
+
+	g_swap.num--;
+
+	if(g_swap.num == 0)
+		_truncate_file(0);
+	else
+		_add_freearea(dat->pos, dat->size);
+
+	mFree(dat);
+	p->swap_dat = NULL;
+}
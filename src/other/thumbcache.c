@@ -0,0 +1,335 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * サムネイルのキャッシュ (ファイル)
+ *****************************************/
+/*
+ - ファイルダイアログのプレビュー画像を、設定ディレクトリ下に保存する。
+ - ファイル名は、元ファイルのパスのハッシュ値。
+   内容に元ファイルのパス/サイズ/更新日時を含め、一致した場合のみ有効とする。
+ - スレッド内から呼ばれるため、グローバルな状態は持たない。
+*/
+
+#include <stdio.h>
+#include <stdlib.h>	//qsort
+#include <string.h>
+
+#include "mlk_gui.h"
+#include "mlk_str.h"
+#include "mlk_file.h"
+#include "mlk_filestat.h"
+#include "mlk_dir.h"
+#include "mlk_stdio.h"
+
+#include "image32.h"
+
+#include "thumbcache.h"
+
+
+//------------------
+
+#define _DIRNAME  "thumbnail"
+#define _HEADER   "AZPTHUMB"
+#define _VERSION  0
+
+#define _MAX_NUM     1000	//最大ファイル数
+#define _REMAIN_NUM  800	//超えた時に残す数
+
+typedef struct
+{
+	uint64_t time;
+	char *name;
+}_entry;
+
+//------------------
+
+
+/* キャッシュファイルのパスを取得 */
+
+static void _get_path(mStr *str,const char *filename)
+{
+	const uint8_t *ps;
+	uint64_t h = 0xcbf29ce484222325ULL;
+	char m[24];
+
+	//FNV-1a
+
+	for(ps = (const uint8_t *)filename; *ps; ps++)
+	{
+		h ^= *ps;
+		h *= 0x100000001b3ULL;
+	}
+
+	snprintf(m, 24, "%016llx", (unsigned long long)h);
+
+	mGuiGetPath_config(str, _DIRNAME);
+	mStrPathJoin(str, m);
+}
+
+/* 元ファイルのサイズと更新日時を取得 */
+
+static mlkbool _get_stat(const char *filename,uint64_t *psize,uint64_t *ptime)
+{
+	mFileStat st;
+
+	if(!mGetFileStat(filename, &st)
+		|| !(st.flags & MFILESTAT_F_NORMAL))
+		return FALSE;
+
+	*psize = st.size;
+	*ptime = st.time_modify;
+
+	return TRUE;
+}
+
+/* 64bit 値読み込み */
+
+static mlkbool _read64(FILE *fp,uint64_t *dst)
+{
+	uint32_t hi,lo;
+
+	if(mFILEreadBE32(fp, &hi) || mFILEreadBE32(fp, &lo))
+		return FALSE;
+
+	*dst = ((uint64_t)hi << 32) | lo;
+
+	return TRUE;
+}
+
+/* 64bit 値書き込み */
+
+static void _write64(FILE *fp,uint64_t val)
+{
+	mFILEwriteBE32(fp, (uint32_t)(val >> 32));
+	mFILEwriteBE32(fp, (uint32_t)val);
+}
+
+/** キャッシュから読み込み
+ *
+ * dst: キャッシュ作成時と同じサイズであること
+ * return: FALSE でキャッシュなし */
+
+mlkbool ThumbCache_read(const char *filename,Image32 *dst)
+{
+	FILE *fp;
+	mStr str = MSTR_INIT;
+	char *path = NULL;
+	uint64_t size,time,fsize,ftime;
+	uint16_t w,h;
+	uint8_t ver,*pd;
+	int i,ret = FALSE;
+
+	if(!_get_stat(filename, &size, &time))
+		return FALSE;
+
+	_get_path(&str, filename);
+
+	fp = mFILEopen(str.buf, "rb");
+
+	mStrFree(&str);
+
+	if(!fp) return FALSE;
+
+	//ヘッダ
+
+	if(mFILEreadStr_compare(fp, _HEADER)
+		|| mFILEreadByte(fp, &ver)
+		|| ver != _VERSION
+		|| mFILEreadStr_lenBE16(fp, &path) <= 0
+		|| strcmp(path, filename) != 0
+		|| !_read64(fp, &fsize)
+		|| !_read64(fp, &ftime)
+		|| fsize != size || ftime != time
+		|| mFILEreadFormatBE(fp, "hh", &w, &h)
+		|| w != dst->w || h != dst->h)
+		goto END;
+
+	//イメージ
+
+	pd = dst->buf;
+
+	for(i = h; i; i--, pd += dst->pitch)
+	{
+		if(mFILEreadOK(fp, pd, w * 4))
+			goto END;
+	}
+
+	ret = TRUE;
+
+END:
+	mFree(path);
+	fclose(fp);
+
+	return ret;
+}
+
+/** キャッシュに書き込み
+ *
+ * 一時ファイルに書き込んだ後、名前を変更する。 */
+
+void ThumbCache_write(const char *filename,Image32 *src)
+{
+	FILE *fp;
+	mStr str = MSTR_INIT,strtmp = MSTR_INIT;
+	uint64_t size,time;
+	uint8_t *ps;
+	int i,ret = FALSE;
+
+	if(!_get_stat(filename, &size, &time))
+		return;
+
+	//ディレクトリ作成
+
+	mGuiGetPath_config(&str, _DIRNAME);
+	mCreateDir_parents(str.buf, -1);
+
+	//開く
+
+	_get_path(&str, filename);
+
+	mStrCopy(&strtmp, &str);
+	mStrAppendText(&strtmp, ".tmp");
+
+	fp = mFILEopen(strtmp.buf, "wb");
+	if(!fp) goto END;
+
+	//ヘッダ
+
+	fputs(_HEADER, fp);
+	mFILEwriteByte(fp, _VERSION);
+
+	if(mFILEwriteStr_lenBE16(fp, filename, -1) < 0)
+	{
+		fclose(fp);
+		goto END;
+	}
+
+	_write64(fp, size);
+	_write64(fp, time);
+
+	mFILEwriteBE16(fp, src->w);
+	mFILEwriteBE16(fp, src->h);
+
+	//イメージ
+
+	ps = src->buf;
+
+	for(i = src->h; i; i--, ps += src->pitch)
+		mFILEwriteOK(fp, ps, src->w * 4);
+
+	ret = (fclose(fp) == 0);
+
+	//置き換え
+
+	if(ret)
+		ret = (rename(strtmp.buf, str.buf) == 0);
+
+END:
+	if(!ret)
+		mDeleteFile(strtmp.buf);
+
+	mStrFree(&str);
+	mStrFree(&strtmp);
+}
+
+/* qsort 比較関数 (更新日時の新しい順) */
+
+static int _cmp_entry(const void *p1,const void *p2)
+{
+	uint64_t t1,t2;
+
+	t1 = ((const _entry *)p1)->time;
+	t2 = ((const _entry *)p2)->time;
+
+	if(t1 > t2)
+		return -1;
+	else if(t1 < t2)
+		return 1;
+	else
+		return 0;
+}
+
+/** ファイル数が最大を超えている場合、古いものから削除 */
+
+void ThumbCache_cleanup(void)
+{
+	mDir *dir;
+	mStr str = MSTR_INIT;
+	mFileStat st;
+	_entry *buf,*pe;
+	int num,max,i;
+
+	mGuiGetPath_config(&str, _DIRNAME);
+
+	dir = mDirOpen(str.buf);
+	if(!dir) goto END;
+
+	//ファイルを列挙
+
+	buf = NULL;
+	num = max = 0;
+
+	while(mDirNext(dir))
+	{
+		if(mDirIsDirectory(dir) || !mDirGetStat(dir, &st))
+			continue;
+
+		if(num == max)
+		{
+			max += 256;
+
+			pe = (_entry *)mRealloc(buf, sizeof(_entry) * max);
+			if(!pe) break;
+
+			buf = pe;
+		}
+
+		pe = buf + num;
+		pe->time = st.time_modify;
+		pe->name = mStrdup(mDirGetFilename(dir));
+
+		if(pe->name) num++;
+	}
+
+	mDirClose(dir);
+
+	//古いものを削除
+
+	if(num > _MAX_NUM)
+	{
+		qsort(buf, num, sizeof(_entry), _cmp_entry);
+
+		for(i = _REMAIN_NUM; i < num; i++)
+		{
+			mGuiGetPath_config(&str, _DIRNAME);
+			mStrPathJoin(&str, buf[i].name);
+
+			mDeleteFile(str.buf);
+		}
+	}
+
+	for(i = 0; i < num; i++)
+		mFree(buf[i].name);
+
+	mFree(buf);
+
+END:
+	mStrFree(&str);
+}
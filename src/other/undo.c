@@ -39,6 +39,7 @@ $*/
 #include "undo.h"
 #include "undoitem.h"
 #include "pv_undo.h"
+#include "apptrace.h"
 
 
 //--------------------
@@ -259,6 +260,15 @@ static mlkerr _setreverse_handle(mUndo *undo,
 				return UndoItem_setdat_layer(dst, LayerList_getTopItem(APPDRAW->layerlist));
 			else
 				return UndoItem_setdat_layerAll(dst);
+
+		//キャンバス拡大縮小 (レイヤ維持)
+		case UNDO_TYPE_SCALE_CANVAS_LAYER:
+			dst->val[0] = APPDRAW->imgw;
+			dst->val[1] = APPDRAW->imgh;
+			dst->val[2] = APPDRAW->imgdpi;
+			dst->val[3] = LayerList_getItemIndex(APPDRAW->layerlist, APPDRAW->curlayer);
+
+			return UndoItem_setdat_layerAll(dst);
 	}
 
 	return MLKERR_OK;
@@ -386,6 +396,7 @@ static mlkerr _run_handle(mUndo *undoptr,mListItem *runitem,int runtype)
 
 		//キャンバス拡大縮小
 		case UNDO_TYPE_SCALE_CANVAS:
+		case UNDO_TYPE_SCALE_CANVAS_LAYER:
 			return UndoItem_runCanvasScale(item, update, runtype);
 	}
 
@@ -406,6 +417,25 @@ static mlkerr _add_item(int type,UndoItem **ppdst)
 	mListItem *pi;
 	mlkerr ret;
 
+	//すべてのレイヤのイメージを保存する場合、未展開のレイヤイメージをすべて展開
+	// :単体のレイヤのイメージは、書き込み時に展開される (UndoItem_writeLayerImage)。
+	// :レイヤ情報のみの場合は、展開しない。
+
+	switch(type)
+	{
+		case UNDO_TYPE_LAYER_COMBINE_ALL:
+		case UNDO_TYPE_CHANGE_IMAGE_BITS:
+		case UNDO_TYPE_RESIZECANVAS_CROP:
+		case UNDO_TYPE_SCALE_CANVAS:
+		case UNDO_TYPE_SCALE_CANVAS_LAYER:
+			if(!LayerList_loadPendingImage_all(APPDRAW->layerlist))
+			{
+				_on_failed();
+				return MLKERR_ALLOC;
+			}
+			break;
+	}
+
 	ret = _newitem_handle(&APPUNDO->undo, &pi);
 	if(ret)
 	{
@@ -550,8 +580,11 @@ void Undo_deleteAll(void)
 
 mlkerr Undo_runUndoRedo(mlkbool redo,UndoUpdateInfo *info)
 {
+	AppTraceScope trace;
 	mlkerr ret;
 
+	AppTrace_begin(&trace, APPTRACE_UNDO);
+
 	if(redo)
 		ret = mUndoRun_redo(&APPUNDO->undo);
 	else
@@ -559,6 +592,8 @@ mlkerr Undo_runUndoRedo(mlkbool redo,UndoUpdateInfo *info)
 
 	*info = APPUNDO->update;
 
+	AppTrace_end(&trace);
+
 	return ret;
 }
 
@@ -575,23 +610,30 @@ mlkerr Undo_runUndoRedo(mlkbool redo,UndoUpdateInfo *info)
 mlkerr Undo_addTilesImage(TileImageInfo *info,mRect *rc)
 {
 	UndoItem *pi;
+	AppTraceScope trace;
 	mlkerr ret;
 
+	AppTrace_begin(&trace, APPTRACE_UNDO);
+
 	ret = _add_item(UNDO_TYPE_TILEIMAGE, &pi);
-	if(ret) return ret;
 
-	//[0] レイヤ番号 [1..4] 更新イメージ範囲
+	if(ret == MLKERR_OK)
+	{
+		//[0] レイヤ番号 [1..4] 更新イメージ範囲
 
-	UndoItem_setval_curlayer(pi, 0);
+		UndoItem_setval_curlayer(pi, 0);
 
-	pi->val[1] = rc->x1;
-	pi->val[2] = rc->y1;
-	pi->val[3] = rc->x2;
-	pi->val[4] = rc->y2;
+		pi->val[1] = rc->x1;
+		pi->val[2] = rc->y1;
+		pi->val[3] = rc->x2;
+		pi->val[4] = rc->y2;
 
-	ret = UndoItem_setdat_tileimage(pi, info);
-	if(ret)
-		_on_failed();
+		ret = UndoItem_setdat_tileimage(pi, info);
+		if(ret)
+			_on_failed();
+	}
+
+	AppTrace_end(&trace);
 
 	return ret;
 }
@@ -1122,3 +1164,25 @@ mlkerr Undo_addScaleCanvas(void)
 	return ret;
 }
 
+/** キャンバス拡大縮小 (レイヤ維持) */
+
+mlkerr Undo_addScaleCanvas_layer(void)
+{
+	UndoItem *pi;
+	mlkerr ret;
+
+	ret = _add_item(UNDO_TYPE_SCALE_CANVAS_LAYER, &pi);
+	if(ret) return ret;
+
+	pi->val[0] = APPDRAW->imgw;
+	pi->val[1] = APPDRAW->imgh;
+	pi->val[2] = APPDRAW->imgdpi;
+	pi->val[3] = LayerList_getItemIndex(APPDRAW->layerlist, APPDRAW->curlayer);
+
+	ret = UndoItem_setdat_layerAll(pi);
+	if(ret)
+		_on_failed();
+
+	return ret;
+}
+
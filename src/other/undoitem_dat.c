@@ -253,7 +253,7 @@ mlkerr UndoItem_setdat_layerImage(UndoItem *p,LayerItem *item)
 	ret = UndoItem_beginWrite_file_zlib(p);
 	if(ret) return ret;
 
-	ret = UndoItem_writeTileImage(p, item->img);
+	ret = UndoItem_writeLayerImage(p, item);
 
 	UndoItem_endWrite_file_zlib(p);
 
@@ -309,7 +309,7 @@ mlkerr UndoItem_setdat_layerImage_folder(UndoItem *p,LayerItem *item)
 
 			//イメージ
 			
-			ret = UndoItem_writeTileImage(p, li->img);
+			ret = UndoItem_writeLayerImage(p, li);
 			if(ret) goto ERR;
 		}
 	}
@@ -358,7 +358,7 @@ mlkerr UndoItem_setdat_layerImage_all(UndoItem *p,int type)
 
 			//イメージ
 			
-			ret = UndoItem_writeTileImage(p, li->img);
+			ret = UndoItem_writeLayerImage(p, li);
 			if(ret) goto ERR;
 		}
 	}
@@ -435,10 +435,10 @@ mlkerr UndoItem_setdat_layerImage_double(UndoItem *p,LayerItem *item)
 	ret = UndoItem_beginWrite_file_zlib(p);
 	if(ret) return ret;
 
-	ret = UndoItem_writeTileImage(p, item->img);
+	ret = UndoItem_writeLayerImage(p, item);
 
 	if(ret == MLKERR_OK)
-		ret = UndoItem_writeTileImage(p, LAYERITEM(item->i.next)->img);
+		ret = UndoItem_writeLayerImage(p, LAYERITEM(item->i.next));
 
 	UndoItem_endWrite_file_zlib(p);
 
@@ -975,7 +975,7 @@ mlkerr UndoItem_setdat_layerTextAndImage(UndoItem *p,LayerItem *item)
 	ret = UndoItem_writeLayerText(p, item);
 
 	if(ret == MLKERR_OK)
-		ret = UndoItem_writeTileImage(p, item->img);
+		ret = UndoItem_writeLayerImage(p, item);
 
 	UndoItem_endWrite_file_zlib(p);
 
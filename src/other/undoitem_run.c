@@ -410,7 +410,8 @@ mlkerr UndoItem_runLayerEditFull(UndoItem *p,UndoUpdateInfo *info)
 	{
 		//左右上下反転
 		
-		LayerItem_editImage_full(li, p->val[1], &info->rc);
+		if(!LayerItem_editImage_full(li, p->val[1], &info->rc))
+			return MLKERR_ALLOC;
 
 		return MLKERR_OK;
 	}
@@ -609,7 +610,20 @@ mlkerr UndoItem_runCanvasScale(UndoItem *p,UndoUpdateInfo *info,int runtype)
 
 	_CURSOR_WAIT;
 
-	if(runtype == MUNDO_TYPE_UNDO)
+	if(p->type == UNDO_TYPE_SCALE_CANVAS_LAYER)
+	{
+		//レイヤ維持時: レイヤすべて削除 + 全レイヤ復元
+
+		LayerList_clear(APPDRAW->layerlist);
+
+		ret = UndoItem_restore_layerMulti(p, &rc);
+
+		APPDRAW->curlayer = LayerList_getItemAtIndex(APPDRAW->layerlist, p->val[3]);
+
+		if(!APPDRAW->curlayer)
+			APPDRAW->curlayer = LayerList_getTopItem(APPDRAW->layerlist);
+	}
+	else if(runtype == MUNDO_TYPE_UNDO)
 	{
 		//UNDO: 全レイヤ復元 + 結合後レイヤを削除
 
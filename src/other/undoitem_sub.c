@@ -87,13 +87,23 @@ typedef struct
 //==================================
 // レイヤ番号など
 //==================================
+/* アンドゥ/リドゥ時は、取得したレイヤのイメージを参照・変更する場合があるため、
+ * 未展開のイメージ (スワップ含む) は、取得時に展開しておく。
+ * 展開に失敗した場合は、レイヤなしとしてエラーにする。 */
 
 
 /** レイヤ番号からレイヤ取得 */
 
 LayerItem *UndoItem_getLayerAtIndex(int no)
 {
-	return LayerList_getItemAtIndex(APPDRAW->layerlist, no);
+	LayerItem *item;
+
+	item = LayerList_getItemAtIndex(APPDRAW->layerlist, no);
+
+	if(!LayerItem_loadPendingImage(item))
+		return NULL;
+
+	return item;
 }
 
 /** 親と相対位置のレイヤ番号から、レイヤ取得 */
@@ -104,12 +114,15 @@ LayerItem *UndoItem_getLayerAtIndex_forParent(int parent,int pos)
 
 	LayerList_getItems_fromIndex(APPDRAW->layerlist, item, parent, pos);
 
+	if(!LayerItem_loadPendingImage(item[1]))
+		return NULL;
+
 	return item[1];
 }
 
 /** LayerItem と LayerTextItem をインデックスから取得
  *
- * return: FALSE でいずれかが NULL */
+ * return: FALSE でいずれかが NULL、またはイメージの展開に失敗 */
 
 mlkbool UndoItem_getLayerText_atIndex(int layerno,int index,LayerItem **pplayer,LayerTextItem **pptext)
 {
@@ -122,6 +135,9 @@ mlkbool UndoItem_getLayerText_atIndex(int layerno,int index,LayerItem **pplayer,
 	text = LayerItem_getTextItem_atIndex(layer, index);
 	if(!text) return FALSE;
 
+	if(!LayerItem_loadPendingImage(layer))
+		return FALSE;
+
 	*pplayer = layer;
 	*pptext = text;
 
@@ -460,6 +476,18 @@ mlkerr UndoItem_writeLayerInfoAndImage(UndoItem *p,LayerItem *item)
 
 	//イメージ
 	
+	return UndoItem_writeLayerImage(p, item);
+}
+
+/** レイヤのイメージを書き込み
+ *
+ * 未展開のイメージがある場合は、先に展開する。 */
+
+mlkerr UndoItem_writeLayerImage(UndoItem *p,LayerItem *item)
+{
+	if(!LayerItem_loadPendingImage(item))
+		return MLKERR_ALLOC;
+
 	return UndoItem_writeTileImage(p, item->img);
 }
 
@@ -727,9 +755,9 @@ mlkerr UndoItem_readLayerImage(UndoItem *p,LayerItem *item)
 	if(ret) return ret;
 
 	//既存イメージは削除
+	// :未展開のデータも破棄する。
 
-	TileImage_free(item->img);
-	item->img = NULL;
+	LayerItem_replaceImage(item, NULL, -1);
 
 	//イメージ作成
 
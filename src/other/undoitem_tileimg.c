@@ -121,7 +121,9 @@ void undo_decode16(uint8_t *dst,uint8_t *src,int size);
 //==================================
 
 
-/* 対象のレイヤイメージ取得 */
+/* 対象のレイヤイメージ取得
+ *
+ * 未展開のイメージは、レイヤ取得時に展開される。 */
 
 static TileImage *_get_layerimg(UndoItem *p)
 {
@@ -56,7 +56,8 @@ enum
 	TRID_RATIO,
 	TRID_KEEP_ASPECT,
 	TRID_CHANGE_DPI,
-	TRID_METHOD
+	TRID_METHOD,
+	TRID_KEEP_LAYER
 };
 
 //--------------------
@@ -191,6 +192,7 @@ typedef struct
 	mCheckButton *ck_aspect,
 		*ck_dpi;
 	mComboBox *cb_type;
+	mCheckButton *ck_layer;
 
 	CanvasScaleInfo *info;
 
@@ -207,7 +209,8 @@ enum
 	WID_SCALE_CK_KEEP_ASPECT,
 	WID_SCALE_CK_CHANGE_DPI,
 	WID_SCALE_EDIT_DPI,
-	WID_SCALE_CB_TYPE
+	WID_SCALE_CB_TYPE,
+	WID_SCALE_CK_KEEP_LAYER
 };
 
 //----------------------
@@ -441,6 +444,11 @@ static _dlg_scale *_scale_create(mWindow *parent,CanvasScaleInfo *info)
 	mComboBoxSetAutoWidth(p->cb_type);
 	mComboBoxSetSelItem_atIndex(p->cb_type, APPCONF->canvas_scale_method);
 
+	//レイヤを維持
+
+	p->ck_layer = mCheckButtonCreate(MLK_WIDGET(p), WID_SCALE_CK_KEEP_LAYER, 0, MLK_MAKE32_4(0,10,0,0),
+		0, MLK_TR(TRID_KEEP_LAYER), APPCONF->canvas_scale_keep_layer);
+
 	//OK/cancel
 
 	mContainerCreateButtons_okcancel(MLK_WIDGET(p), MLK_MAKE32_4(0,15,0,0));
@@ -470,8 +478,10 @@ mlkbool CanvasDialog_scale(mWindow *parent,CanvasScaleInfo *info)
 		info->h = mLineEditGetNum(p->edit[1]);
 		info->dpi = (mCheckButtonIsChecked(p->ck_dpi))? mLineEditGetNum(p->edit_dpi): -1;
 		info->method = mComboBoxGetItemParam(p->cb_type, -1);
+		info->keep_layer = mCheckButtonIsChecked(p->ck_layer);
 
 		APPCONF->canvas_scale_method = info->method;
+		APPCONF->canvas_scale_keep_layer = info->keep_layer;
 	}
 
 	mWidgetDestroy(MLK_WIDGET(p));
@@ -109,6 +109,7 @@ static void _config_to_data(EnvOptData *pd,AppConfig *cf)
 	pd->img_defbits = cf->loadimg_default_bits;
 	pd->undo_maxnum = cf->undo_maxnum;
 	pd->undo_maxbufsize = cf->undo_maxbufsize;
+	pd->layer_swap_size = cf->layer_swap_size;
 	pd->canv_zoom_step = cf->canvas_zoom_step_hi;
 	pd->canv_rotate_step = cf->canvas_angle_step;
 
@@ -199,6 +200,7 @@ static int _data_to_config(AppConfig *cf,EnvOptData *pd)
 	cf->loadimg_default_bits = pd->img_defbits;
 	cf->undo_maxnum = pd->undo_maxnum;
 	cf->undo_maxbufsize = pd->undo_maxbufsize;
+	cf->layer_swap_size = pd->layer_swap_size;
 	cf->canvas_zoom_step_hi = pd->canv_zoom_step;
 	cf->canvas_angle_step = pd->canv_rotate_step;
 	
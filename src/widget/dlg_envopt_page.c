@@ -71,7 +71,8 @@ typedef struct
 		*edit_undonum,
 		*edit_undobuf,
 		*edit_zoom_step,
-		*edit_rotate_step;
+		*edit_rotate_step,
+		*edit_swap_size;
 	mCheckButton *ck_bits8;
 }_pagedata_opt1;
 
@@ -166,6 +167,8 @@ static mlkbool _opt1_getdata(mPager *p,void *pagedat,void *dst)
 
 	dat->canv_rotate_step = mLineEditGetNum(pd->edit_rotate_step);
 
+	dat->layer_swap_size = mLineEditGetNum(pd->edit_swap_size);
+
 	return TRUE;
 }
 
@@ -287,6 +290,12 @@ mlkbool EnvOpt_createPage_opt1(mPager *p,mPagerInfo *info)
 
 	_widget_set_margin(MLK_WIDGET(pd->edit_rotate_step));
 
+	//非表示レイヤを書き出すメモリ量
+
+	pd->edit_swap_size = widget_createLabelEditNum(ct, MLK_TR(TRID_OPT1_LAYER_SWAP_SIZE), 7, 0, 1000000, dat->layer_swap_size);
+
+	_widget_set_margin(MLK_WIDGET(pd->edit_swap_size));
+
 	return TRUE;
 }
 
@@ -295,7 +304,7 @@ mlkbool EnvOpt_createPage_opt1(mPager *p,mPagerInfo *info)
 // フラグ
 //**********************************
 
-#define FLAGS_CKNUM  4
+#define FLAGS_CKNUM  5
 
 typedef struct
 {
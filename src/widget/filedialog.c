@@ -32,11 +32,13 @@ $*/
 #include "mlk_checkbutton.h"
 #include "mlk_label.h"
 #include "mlk_str.h"
+#include "mlk_thread.h"
 
 #include "def_config.h"
 #include "def_draw_sub.h"
 
 #include "image32.h"
+#include "thumbcache.h"
 #include "trid.h"
 
 
@@ -72,12 +74,175 @@ enum
 /*************************************
  * 画像プレビュー
  *************************************/
+/*
+ - 画像の読み込みはスレッドで行い、選択が変わるたびに要求番号を +1 する。
+   スレッドは最新の要求のみ処理し、読み込み中に要求が変わった場合は結果を破棄する。
+ - 読み込んだ結果はタイマーで確認して、表示用イメージにコピーする。
+ - プレビュー画像は、ファイルにキャッシュされる (thumbcache.c)。
+*/
 
-//mWidget::param1 = (Image32 *)
+typedef struct
+{
+	mWidget wg;
+
+	Image32 *img,		//表示用
+		*img_result;	//スレッドの読み込み結果
+	mThread *th;
+	mStr strfile;		//読み込むファイル名 (空で読み込みなし)
+	uint32_t req_no,	//要求番号
+		load_no,		//スレッドが処理中の要求番号
+		result_no;		//img_result の要求番号
+	mlkbool fquit;		//スレッドを終了
+}_imgprev;
 
 #define _IMGPREV_SIZE  100	//枠を除くプレビュー部分のサイズ
 #define _IMGPREV_BKGND 0x808080
+#define _IMGPREV_TIMER_MSEC  30
+
+
+/* 要求がキャンセルされたか */
+
+static mlkbool _imgprev_is_cancel(_imgprev *p,uint32_t no)
+{
+	mlkbool ret;
+
+	mThreadMutexLock(p->th->mutex);
+	ret = (no != p->req_no || p->fquit);
+	mThreadMutexUnlock(p->th->mutex);
+
+	return ret;
+}
+
+/* [スレッド] プレビュー画像を読み込み
+ *
+ * return: FALSE でキャンセルされた */
+
+static mlkbool _imgprev_load(_imgprev *p,Image32 *img,const char *filename,uint32_t no)
+{
+	Image32 *imgsrc;
+
+	Image32_clear(img, _IMGPREV_BKGND);
+
+	//キャッシュ
+
+	if(ThumbCache_read(filename, img))
+		return TRUE;
+
+	//大きいファイルの読み込み前に、キャンセルされていないか
+
+	if(_imgprev_is_cancel(p, no))
+		return FALSE;
+
+	//読み込み
+
+	imgsrc = Image32_loadFile(filename,
+		IMAGE32_LOAD_F_BLEND_WHITE | IMAGE32_LOAD_F_THUMBNAIL);
+
+	if(imgsrc)
+	{
+		Image32_drawResize(img, imgsrc);
+		Image32_free(imgsrc);
 
+		ThumbCache_write(filename, img);
+	}
+
+	return TRUE;
+}
+
+/* スレッド関数 */
+
+static void _imgprev_thread(mThread *th)
+{
+	_imgprev *p = (_imgprev *)th->param;
+	Image32 *img;
+	mStr str = MSTR_INIT;
+	uint32_t no;
+	mlkbool ret;
+
+	ThumbCache_cleanup();
+
+	img = Image32_new(_IMGPREV_SIZE, _IMGPREV_SIZE);
+
+	mThreadMutexLock(th->mutex);
+
+	while(1)
+	{
+		//要求が来るまで待つ
+
+		while(!p->fquit && p->load_no == p->req_no)
+			mThreadCondWait(th->cond, th->mutex);
+
+		if(p->fquit) break;
+
+		no = p->load_no = p->req_no;
+
+		mStrCopy(&str, &p->strfile);
+
+		mThreadMutexUnlock(th->mutex);
+
+		//読み込み
+		// :作業用イメージが確保できなかった場合も、結果 (背景色のみ) を返す。
+		// :結果を返さないと、タイマーが止まらない。
+
+		if(mStrIsEmpty(&str))
+			ret = FALSE;
+		else if(!img)
+			ret = TRUE;
+		else
+			ret = _imgprev_load(p, img, str.buf, no);
+
+		//結果をセット (最新の要求の場合のみ)
+
+		mThreadMutexLock(th->mutex);
+
+		if(ret && no == p->req_no)
+		{
+			if(img)
+				Image32_blt(p->img_result, 0, 0, img, 0, 0, _IMGPREV_SIZE, _IMGPREV_SIZE);
+			else
+				Image32_clear(p->img_result, _IMGPREV_BKGND);
+
+			p->result_no = no;
+		}
+	}
+
+	mThreadMutexUnlock(th->mutex);
+
+	Image32_free(img);
+	mStrFree(&str);
+}
+
+/* タイマー: 読み込み結果を確認 */
+
+static void _imgprev_timer(_imgprev *p)
+{
+	mlkbool done;
+
+	mThreadMutexLock(p->th->mutex);
+
+	done = (p->result_no == p->req_no);
+
+	if(done)
+		Image32_blt(p->img, 0, 0, p->img_result, 0, 0, _IMGPREV_SIZE, _IMGPREV_SIZE);
+
+	mThreadMutexUnlock(p->th->mutex);
+
+	if(done)
+	{
+		mWidgetTimerDelete(MLK_WIDGET(p), 0);
+		mWidgetRedraw(MLK_WIDGET(p));
+	}
+}
+
+/* イベント */
+
+static int _imgprev_event(mWidget *wg,mEvent *ev)
+{
+	if(ev->type == MEVENT_TIMER)
+		_imgprev_timer((_imgprev *)wg);
+
+	return 1;
+}
 
 /* 描画 */
 
@@ -85,70 +250,119 @@ static void _imgprev_draw(mWidget *wg,mPixbuf *pixbuf)
 {
 	mPixbufBox(pixbuf, 0, 0, wg->w, wg->h, 0);
 
-	Image32_putPixbuf((Image32 *)wg->param1, pixbuf, 1, 1);
+	Image32_putPixbuf(((_imgprev *)wg)->img, pixbuf, 1, 1);
 }
 
 /* 破棄ハンドラ */
 
 static void _imgprev_destroy(mWidget *wg)
 {
-	Image32_free((Image32 *)wg->param1);
+	_imgprev *p = (_imgprev *)wg;
+
+	//スレッド終了
+	// :読み込み中の場合は、終わるまで待つ。
+
+	if(p->th)
+	{
+		mThreadMutexLock(p->th->mutex);
+		p->fquit = TRUE;
+		mThreadCondSignal(p->th->cond);
+		mThreadMutexUnlock(p->th->mutex);
+
+		mThreadWait(p->th);
+		mThreadDestroy(p->th);
+	}
+
+	Image32_free(p->img);
+	Image32_free(p->img_result);
+	mStrFree(&p->strfile);
 }
 
 /* 画像プレビュー作成 */
 
 static mWidget *_create_imgprev(mWidget *parent)
 {
-	mWidget *p;
-	Image32 *img;
+	_imgprev *p;
 
-	p = mWidgetNew(parent, 0);
+	p = (_imgprev *)mWidgetNew(parent, sizeof(_imgprev));
 
-	p->destroy = _imgprev_destroy;
-	p->draw = _imgprev_draw;
-	p->flayout = MLF_FIX_WH;
-	p->w = p->h = _IMGPREV_SIZE + 2;
+	p->wg.destroy = _imgprev_destroy;
+	p->wg.draw = _imgprev_draw;
+	p->wg.event = _imgprev_event;
+	p->wg.flayout = MLF_FIX_WH;
+	p->wg.w = p->wg.h = _IMGPREV_SIZE + 2;
 
 	//画像
 
-	img = Image32_new(_IMGPREV_SIZE, _IMGPREV_SIZE);
+	p->img = Image32_new(_IMGPREV_SIZE, _IMGPREV_SIZE);
+	p->img_result = Image32_new(_IMGPREV_SIZE, _IMGPREV_SIZE);
 
-	p->param1 = (intptr_t)img;
+	Image32_clear(p->img, _IMGPREV_BKGND);
 
-	Image32_clear(img, _IMGPREV_BKGND);
+	//スレッド
 
-	return p;
+	if(p->img_result)
+	{
+		p->th = mThreadNew(0, _imgprev_thread, p);
+
+		if(p->th && !mThreadRun(p->th))
+		{
+			mThreadDestroy(p->th);
+			p->th = NULL;
+		}
+	}
+
+	return MLK_WIDGET(p);
 }
 
 /* 画像変更
  *
  * filename: NULL でクリア */
 
-static void _imgprev_set_image(mWidget *p,const char *filename)
+static void _imgprev_set_image(mWidget *wg,const char *filename)
 {
-	Image32 *imgdst,*imgsrc;
-
-	imgdst = (Image32 *)p->param1;
+	_imgprev *p = (_imgprev *)wg;
+	Image32 *img;
 
 	//クリア
 
-	Image32_clear(imgdst, _IMGPREV_BKGND);
+	Image32_clear(p->img, _IMGPREV_BKGND);
 
-	//読み込み
+	mWidgetRedraw(wg);
+
+	//スレッドで読み込み
+
+	if(p->th)
+	{
+		mThreadMutexLock(p->th->mutex);
+
+		p->req_no++;
+		mStrSetText(&p->strfile, filename);
+
+		mThreadCondSignal(p->th->cond);
+		mThreadMutexUnlock(p->th->mutex);
+
+		if(filename)
+			mWidgetTimerAdd_ifnothave(wg, 0, _IMGPREV_TIMER_MSEC, 0);
+		else
+			mWidgetTimerDelete(wg, 0);
+
+		return;
+	}
+
+	//スレッドが使えない場合、直接読み込み
 
 	if(filename)
 	{
-		imgsrc = Image32_loadFile(filename,
+		img = Image32_loadFile(filename,
 			IMAGE32_LOAD_F_BLEND_WHITE | IMAGE32_LOAD_F_THUMBNAIL);
 
-		if(imgsrc)
+		if(img)
 		{
-			Image32_drawResize(imgdst, imgsrc);
-			Image32_free(imgsrc);
+			Image32_drawResize(p->img, img);
+			Image32_free(img);
 		}
 	}
-
-	mWidgetRedraw(p);
 }
 
 
@@ -44,10 +44,12 @@ $*/
 
 #include "layeritem.h"
 #include "appcursor.h"
+#include "apptrace.h"
 
 #include "draw_main.h"
 #include "draw_calc.h"
 #include "draw_op_main.h"
+#include "draw_op_def.h"
 
 
 //----------------
@@ -71,9 +73,12 @@ enum
 	_TIMERID_UPDATE_MOVE_SELECT_IMAGE,
 	_TIMERID_UPDATE_PASTE_MOVE,
 	_TIMERID_SCROLL,
-	_TIMERID_LAYERNAME
+	_TIMERID_LAYERNAME,
+	_TIMERID_TRACE
 };
 
+#define _TRACE_OVERLAY_INTERVAL  500	//計測のオーバーレイの更新間隔 (ms)
+
 
 /* グラブする */
 
@@ -118,6 +123,24 @@ static void _page_ungrab(MainCanvasPage *p)
 
 static void _page_event_timer(MainCanvasPage *p,int id)
 {
+	AppTraceScope trace;
+	mBox box;
+
+	//計測のオーバーレイ (タイマーは継続)
+	// :新しいフレームがあれば、オーバーレイ部分のみ更新
+
+	if(id == _TIMERID_TRACE)
+	{
+		if(AppTrace_checkOverlayUpdate())
+		{
+			AppTrace_getOverlayBox(&box, mWidgetGetFont(MLK_WIDGET(p)));
+			mWidgetRedrawBox(MLK_WIDGET(p), &box);
+		}
+		return;
+	}
+
+	AppTrace_begin(&trace, APPTRACE_TIMER);
+
 	//タイマー削除
 	
 	mWidgetTimerDelete(MLK_WIDGET(p), id);
@@ -168,6 +191,8 @@ static void _page_event_timer(MainCanvasPage *p,int id)
 			p->ttip_layername = NULL;
 			break;
 	}
+
+	AppTrace_end(&trace);
 }
 
 /* キー押し時 */
@@ -201,21 +226,44 @@ static void _page_event_keydown(MainCanvasPage *p,mEventKey *ev)
 	}
 }
 
+/* ポインタ移動時
+ *
+ * 結合された MOTION の履歴は、すべての位置が必要な操作中のみ処理する。 */
+
+static void _page_event_motion(mEvent *ev)
+{
+	mEvent ev2;
+	int i,type;
+
+	type = APPDRAW->w.optype;
+
+	if(type == DRAW_OPTYPE_DRAW_FREE || type == DRAW_OPTYPE_XOR_LASSO)
+	{
+		for(i = 0; mGuiGetPenTabletHistory(ev, i, &ev2); i++)
+			drawOp_onMotion(APPDRAW, &ev2);
+	}
+
+	drawOp_onMotion(APPDRAW, ev);
+}
+
 /* イベントハンドラ */
 
 static int _page_event_handle(mWidget *wg,mEvent *ev)
 {
 	MainCanvasPage *p = (MainCanvasPage *)wg;
+	AppTraceScope trace;
 
 	switch(ev->type)
 	{
 		//ポインタデバイス
 		case MEVENT_PENTABLET:
+			AppTrace_begin(&trace, APPTRACE_INPUT);
+		
 			switch(ev->pentab.act)
 			{
 				//移動
 				case MEVENT_POINTER_ACT_MOTION:
-					drawOp_onMotion(APPDRAW, ev);
+					_page_event_motion(ev);
 					break;
 				//ダブルクリック
 				case MEVENT_POINTER_ACT_DBLCLK:
@@ -239,6 +287,8 @@ static int _page_event_handle(mWidget *wg,mEvent *ev)
 						_page_ungrab(p);
 					break;
 			}
+
+			AppTrace_end(&trace);
 			break;
 
 		//ポインタデバイス (ダイアログ表示中)
@@ -342,7 +392,7 @@ static MainCanvasPage *_create_page(mWidget *parent)
 	p->wg.event = _page_event_handle;
 	p->wg.resize = _page_resize_handle;
 	
-	p->wg.fevent |= MWIDGET_EVENT_PENTABLET | MWIDGET_EVENT_KEY;
+	p->wg.fevent |= MWIDGET_EVENT_PENTABLET | MWIDGET_EVENT_KEY | MWIDGET_EVENT_COMBINE_MOTION;
 	p->wg.fstate |= MWIDGET_STATE_TAKE_FOCUS | MWIDGET_STATE_ENABLE_DROP;
 	p->wg.facceptkey = MWIDGET_ACCEPTKEY_ENTER | MWIDGET_ACCEPTKEY_ESCAPE;
 	p->wg.foption |= MWIDGET_OPTION_SCROLL_TO_POINTER;
@@ -350,6 +400,11 @@ static MainCanvasPage *_create_page(mWidget *parent)
 	p->box_update.x = -1;
 	p->pressed_rawkey = -1;
 
+	//計測のオーバーレイ
+
+	if(AppTrace_isOverlay())
+		mWidgetTimerAdd(MLK_WIDGET(p), _TIMERID_TRACE, _TRACE_OVERLAY_INTERVAL, 0);
+
 	//カーソル
 
 	MainCanvasPage_setCursor_forTool();
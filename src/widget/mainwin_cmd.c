@@ -48,6 +48,7 @@ $*/
 #include "tileimage.h"
 #include "toollist.h"
 #include "undo.h"
+#include "layerswap.h"
 
 #include "draw_main.h"
 #include "draw_calc.h"
@@ -218,6 +219,10 @@ void MainWindow_undo_redo(MainWindow *p,mlkbool redo)
 			MainWindow_updateNewCanvas(p, NULL);
 			break;
 	}
+
+	//アンドゥ/リドゥで展開されたレイヤを、必要に応じて書き出す
+
+	LayerSwap_check();
 }
 
 
@@ -359,11 +364,12 @@ void MainWindow_cmd_resizeCanvas(MainWindow *p)
 	MainWindow_updateNewCanvas(p, NULL);
 }
 
-/** 画像を統合して拡大縮小 */
+/** 画像を統合して拡大縮小 (レイヤ維持も可) */
 
 void MainWindow_cmd_scaleCanvas(MainWindow *p)
 {
 	CanvasScaleInfo info;
+	mlkbool ret;
 
 	//ダイアログ
 
@@ -381,7 +387,12 @@ void MainWindow_cmd_scaleCanvas(MainWindow *p)
 
 	//実行
 
-	if(!drawImage_scaleCanvas(APPDRAW, info.w, info.h, info.dpi, info.method))
+	if(info.keep_layer)
+		ret = drawImage_scaleCanvas_layer(APPDRAW, info.w, info.h, info.dpi, info.method);
+	else
+		ret = drawImage_scaleCanvas(APPDRAW, info.w, info.h, info.dpi, info.method);
+
+	if(!ret)
 		MainWindow_errmes(MLKERR_ALLOC, NULL);
 	
 	MainWindow_updateNewCanvas(p, NULL);
@@ -553,7 +553,8 @@ static int _thread_save(mPopupProgress *prog,void *data)
 	else
 	{
 		//----- PNG/JPEG/BMP/GIF/TIFF/WEBP
-		// :プログレスは、合成時と保存時で２周する。
+		// :GIF 以外は、保存時に Y帯単位で合成される。
+		// :GIF のプログレスは、合成時と保存時で２周する。
 
 		dstbits = 8;
 		falpha = FALSE;
@@ -581,18 +582,16 @@ static int _thread_save(mPopupProgress *prog,void *data)
 			}
 		}
 
-		//合成イメージ
+		//合成イメージ (GIF)
+		// :パレット作成のため、全体が必要。
 
-		mPopupProgressThreadSetMax(prog, 20);
+		if(format & FILEFORMAT_GIF)
+		{
+			mPopupProgressThreadSetMax(prog, 20);
 
-		if(falpha)
-			//アルファ付き
-			ret = drawImage_blendImageReal_alpha(APPDRAW, dstbits, prog, 20);
-		else
-			//アルファなし
 			ret = drawImage_blendImageReal_normal(APPDRAW, dstbits, prog, 20);
-
-		if(ret) return ret;
+			if(ret) return ret;
+		}
 
 		//保存
 
@@ -600,7 +599,8 @@ static int _thread_save(mPopupProgress *prog,void *data)
 
 		//合成イメージ再セット
 
-		drawUpdate_blendImage_full(APPDRAW, NULL);
+		if(format & FILEFORMAT_GIF)
+			drawUpdate_blendImage_full(APPDRAW, NULL);
 	}
 
 	return ret;
@@ -29,6 +29,7 @@ $*/
 #include "mlk_iconbar.h"
 #include "mlk_event.h"
 #include "mlk_menu.h"
+#include "mlk_rectbox.h"
 
 #include "def_widget.h"
 #include "def_config.h"
@@ -36,6 +37,7 @@ $*/
 
 #include "panel.h"
 #include "appresource.h"
+#include "imagecanvas.h"
 
 #include "pv_panel_canvview.h"
 
@@ -65,6 +67,9 @@ enum
 	TRID_TB_FLIP_HORZ
 };
 
+#define _TIMERID_UPDATE      0
+#define _UPDATE_TIMER_MSEC   50	//範囲更新の間隔 (描画中に頻繁に更新される場合)
+
 //メニューデータ
 
 static const uint16_t g_menudat[] = {
@@ -99,6 +104,46 @@ static void _update_page(CanvView *p)
 	mWidgetRedraw(MLK_WIDGET(p->page));
 }
 
+/* 指定イメージの範囲のみ更新 */
+
+static void _update_imgbox(CanvView *p,const mBox *boximg)
+{
+	mPoint pt1,pt2;
+	mBox box;
+	int cw,ch;
+
+	cw = MLK_WIDGET(p->page)->w;
+	ch = MLK_WIDGET(p->page)->h;
+
+	//イメージ -> キャンバス座標
+
+	CanvView_image_to_canvas(p, &pt1, boximg->x, boximg->y);
+	CanvView_image_to_canvas(p, &pt2, boximg->x + boximg->w, boximg->y + boximg->h);
+
+	pt1.x--, pt1.y--;
+	pt2.x++, pt2.y++;
+
+	//キャンバス範囲外判定
+
+	if(pt2.x < 0 || pt2.y < 0 || pt1.x >= cw || pt1.y >= ch)
+		return;
+
+	//調整
+
+	if(pt1.x < 0) pt1.x = 0;
+	if(pt1.y < 0) pt1.y = 0;
+	if(pt2.x >= cw) pt2.x = cw - 1;
+	if(pt2.y >= ch) pt2.y = ch - 1;
+
+	//更新
+
+	box.x = pt1.x, box.y = pt1.y;
+	box.w = pt2.x - pt1.x + 1;
+	box.h = pt2.y - pt1.y + 1;
+
+	mWidgetRedrawBox(MLK_WIDGET(p->page), &box);	
+}
+
 /* mIconBar ボタンの有効/無効セット */
 
 static void _iconbar_enable(CanvView *p)
@@ -323,6 +368,25 @@ static void _event_command(CanvView *p,mEventCommand *ev)
 	}
 }
 
+/* タイマー: 範囲更新
+ *
+ * 更新範囲をまとめて、一定間隔でページを更新する。 */
+
+static void _timer_update(CanvView *p)
+{
+	mBox box;
+
+	mWidgetTimerDelete(MLK_WIDGET(p), _TIMERID_UPDATE);
+
+	if(!mRectIsEmpty(&p->rc_update))
+	{
+		mBoxSetRect(&box, &p->rc_update);
+		mRectEmpty(&p->rc_update);
+
+		_update_imgbox(p, &box);
+	}
+}
+
 /* イベント */
 
 static int _event_handle(mWidget *wg,mEvent *ev)
@@ -331,6 +395,11 @@ static int _event_handle(mWidget *wg,mEvent *ev)
 
 	switch(ev->type)
 	{
+		//範囲更新
+		case MEVENT_TIMER:
+			_timer_update(p);
+			break;
+
 		//page からの通知
 		case MEVENT_NOTIFY:
 			if(ev->notify.widget_from == (mWidget *)p->page)
@@ -364,6 +433,13 @@ static int _event_handle(mWidget *wg,mEvent *ev)
 //==============================
 
 
+/* 破棄ハンドラ */
+
+static void _destroy_handle(mWidget *wg)
+{
+	ImageCanvas_free(((CanvView *)wg)->img_reduce);
+}
+
 /* パネル内容作成 */
 
 static mWidget *_panel_create_handle(mPanel *panel,int id,mWidget *parent)
@@ -382,11 +458,15 @@ static mWidget *_panel_create_handle(mPanel *panel,int id,mWidget *parent)
 
 	p->wg.flayout = MLF_EXPAND_WH;
 	p->wg.event = _event_handle;
+	p->wg.destroy = _destroy_handle;
 	p->wg.notify_to = MWIDGET_NOTIFYTO_SELF;
 	p->wg.draw = NULL;
 
 	p->ex = ex;
 
+	mRectEmpty(&p->rc_reduce);
+	mRectEmpty(&p->rc_update);
+
 	//mIconBar
 
 	p->iconbar = ib = mIconBarCreate(MLK_WIDGET(p), 0, MLF_EXPAND_H, 0, MICONBAR_S_TOOLTIP | MICONBAR_S_VERT);
@@ -617,76 +697,57 @@ void PanelCanvasView_changeImageSize(void)
 	_scroll_reset(ex);
 
 	//ウィジェットが作成されている時
+	// :縮小イメージは、描画時に再作成させる
 
 	if(p)
+	{
+		ImageCanvas_free(p->img_reduce);
+		p->img_reduce = NULL;
+		
 		_update_page(p);
+	}
 }
 
 /** イメージ全体を更新 */
 
 void PanelCanvasView_update(void)
 {
-	CanvView *p;
+	CanvView *p = _get_canvview();
+
+	if(!p) return;
+
+	//縮小イメージは、非表示時も更新範囲を記録する
+
+	mRectSetBox_d(&p->rc_reduce, 0, 0, APPDRAW->imgw, APPDRAW->imgh);
 
 	if(Panel_isVisible(PANEL_CANVAS_VIEW))
 	{
-		p = _get_canvview();
+		mWidgetTimerDelete(MLK_WIDGET(p), _TIMERID_UPDATE);
+		mRectEmpty(&p->rc_update);
 		
 		mWidgetRedraw(MLK_WIDGET(p->page));
 	}
 }
 
-/* 指定イメージの範囲のみ更新 */
-
-static void _update_imgbox(CanvView *p,const mBox *boximg)
-{
-	mPoint pt1,pt2;
-	mBox box;
-	int cw,ch;
-
-	cw = MLK_WIDGET(p->page)->w;
-	ch = MLK_WIDGET(p->page)->h;
-
-	//イメージ -> キャンバス座標
-
-	CanvView_image_to_canvas(p, &pt1, boximg->x, boximg->y);
-	CanvView_image_to_canvas(p, &pt2, boximg->x + boximg->w, boximg->y + boximg->h);
-
-	pt1.x--, pt1.y--;
-	pt2.x++, pt2.y++;
-
-	//キャンバス範囲外判定
-
-	if(pt2.x < 0 || pt2.y < 0 || pt1.x >= cw || pt1.y >= ch)
-		return;
-
-	//調整
-
-	if(pt1.x < 0) pt1.x = 0;
-	if(pt1.y < 0) pt1.y = 0;
-	if(pt2.x >= cw) pt2.x = cw - 1;
-	if(pt2.y >= ch) pt2.y = ch - 1;
-
-	//更新
-
-	box.x = pt1.x, box.y = pt1.y;
-	box.w = pt2.x - pt1.x + 1;
-	box.h = pt2.y - pt1.y + 1;
-
-	mWidgetRedrawBox(MLK_WIDGET(p->page), &box);	
-}
-
 /** 指定範囲更新
+ *
+ * 描画中などで頻繁に呼ばれるため、範囲を追加して、タイマーで更新する。
  *
  * boximg: イメージの範囲 */
 
 void PanelCanvasView_updateBox(const mBox *boximg)
 {
+	CanvView *p = _get_canvview();
+
+	if(!p) return;
+
+	mRectUnion_box(&p->rc_reduce, boximg);
+
 	if(Panel_isVisible(PANEL_CANVAS_VIEW))
 	{
-		CanvView *p = _get_canvview();
-		
-		_update_imgbox(p, boximg);
+		mRectUnion_box(&p->rc_update, boximg);
+
+		mWidgetTimerAdd_ifnothave(MLK_WIDGET(p), _TIMERID_UPDATE, _UPDATE_TIMER_MSEC, 0);
 	}
 }
 
@@ -27,6 +27,7 @@ $*/
 #include "mlk_event.h"
 #include "mlk_pixbuf.h"
 #include "mlk_guicol.h"
+#include "mlk_rectbox.h"
 
 #include "def_config.h"
 #include "def_draw.h"
@@ -170,6 +171,74 @@ static void _proc_zoom(CanvViewPage *p,int y)
 }
 
 
+/* 縮小表示用のイメージを取得
+ *
+ * 1/2 以下の縮小表示時、imgcanvas を 1/n (2 のべき乗) に縮小したイメージを使う。
+ * 表示サイズに近いイメージから描画するため、イメージサイズに関係なく描画できる。
+ * 未更新範囲がある場合は、imgcanvas から更新する。
+ *
+ * pdiv: 縮小率が入る
+ * return: NULL で縮小イメージを使わない */
+
+static ImageCanvas *_get_reduce_image(CanvViewPage *p,int *pdiv)
+{
+	CanvView *cv = _get_canvview(p);
+	ImageCanvas *src,*img;
+	mRect rc;
+	mBox box;
+	int div,w,h;
+
+	//縮小率
+
+	for(div = 1; div * 2 <= p->ex->dscalediv && div < 1024; div <<= 1);
+
+	if(div < 2) return NULL;
+
+	src = APPDRAW->imgcanvas;
+	w = (src->width + div - 1) / div;
+	h = (src->height + div - 1) / div;
+
+	//作成 (縮小率/サイズが変わった時)
+
+	img = cv->img_reduce;
+
+	if(!img || cv->reduce_div != div
+		|| img->width != w || img->height != h || img->bits != src->bits)
+	{
+		ImageCanvas_free(img);
+
+		cv->img_reduce = img = ImageCanvas_new(w, h, src->bits);
+		if(!img) return NULL;
+
+		cv->reduce_div = div;
+
+		mRectSetBox_d(&cv->rc_reduce, 0, 0, src->width, src->height);
+	}
+
+	//未更新範囲を更新
+
+	if(!mRectIsEmpty(&cv->rc_reduce))
+	{
+		rc.x1 = cv->rc_reduce.x1 / div;
+		rc.y1 = cv->rc_reduce.y1 / div;
+		rc.x2 = cv->rc_reduce.x2 / div;
+		rc.y2 = cv->rc_reduce.y2 / div;
+
+		if(mRectClipBox_d(&rc, 0, 0, w, h))
+		{
+			mBoxSetRect(&box, &rc);
+			ImageCanvas_setReduceImage(img, src, div, &box);
+		}
+
+		mRectEmpty(&cv->rc_reduce);
+	}
+
+	*pdiv = div;
+
+	return img;
+}
+
+
 //==========================
 // ハンドラ
 //==========================
@@ -322,7 +391,9 @@ static void _draw_handle(mWidget *wg,mPixbuf *pixbuf)
 	CanvViewEx *ex = p->ex;
 	CanvasDrawInfo info;
 	CanvasViewParam param;
+	ImageCanvas *img;
 	mBox box;
+	int div;
 
 	if(APPDRAW->in_thread_imgcanvas
 		|| mWidgetGetDrawBox(wg, &box) == -1)
@@ -334,11 +405,21 @@ static void _draw_handle(mWidget *wg,mPixbuf *pixbuf)
 
 	APPDRAW->is_canvview_update = TRUE;
 
+	//描画元イメージ
+
+	img = _get_reduce_image(p, &div);
+
+	if(!img)
+	{
+		img = APPDRAW->imgcanvas;
+		div = 1;
+	}
+
 	//キャンバス
 
 	info.boxdst = box;
-	info.originx = ex->ptimgct.x;
-	info.originy = ex->ptimgct.y;
+	info.originx = ex->ptimgct.x / div;
+	info.originy = ex->ptimgct.y / div;
 	info.scrollx = ex->pt_scroll.x - wg->w / 2;
 	info.scrolly = ex->pt_scroll.y - wg->h / 2;
 	info.mirror = ex->mirror;
@@ -347,13 +428,13 @@ static void _draw_handle(mWidget *wg,mPixbuf *pixbuf)
 	info.bkgndcol = APPCONF->canvasbkcol;
 	info.param = &param;
 
-	param.scalediv = ex->dscalediv;
+	param.scalediv = ex->dscalediv / div;
 
 	if(ex->zoom != 1000 && ex->zoom < 2000 && p->dragbtt == 0)
 		//縮小時 (ドラッグ時は除く)
-		ImageCanvas_drawPixbuf_oversamp(APPDRAW->imgcanvas, pixbuf, &info);
+		ImageCanvas_drawPixbuf_oversamp(img, pixbuf, &info);
 	else
-		ImageCanvas_drawPixbuf_nearest(APPDRAW->imgcanvas, pixbuf, &info);
+		ImageCanvas_drawPixbuf_nearest(img, pixbuf, &info);
 
 	//ツールバー切り替えバー
 
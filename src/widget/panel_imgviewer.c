@@ -56,6 +56,7 @@ $*/
 
 #define _IS_ZOOM_FIT  (APPCONF->imgviewer.flags & CONFIG_IMAGEVIEWER_F_FIT)
 #define _FILELIST_EXTS "png:jpg:jpeg:bmp:gif:tif:tiff:webp:psd"
+#define _WAIT_TIMER_MSEC  30
 
 enum
 {
@@ -110,6 +111,9 @@ int PopupZoomSlider_run(mWidget *parent,mBox *box,
 
 void PanelViewer_optionDlg_run(mWindow *parent,uint8_t *dstbuf,mlkbool is_imageviewer);
 
+static void _timer_wait(ImgViewer *p);
+static void _load_image(ImgViewer *p,const char *filename,mFileListItem *item);
+
 //------------------
 
 
@@ -173,6 +177,31 @@ static int _func_filelist_add(const char *fname,const mFileStat *st,void *param)
 	return mStrPathCompareExts(pstr, _FILELIST_EXTS); 
 }
 
+/* 指定ファイルと同じディレクトリのファイルリストを作成
+ *
+ * return: リスト内の指定ファイルのアイテム (NULL でなし) */
+
+static mFileListItem *_create_filelist(mList *list,const char *filename)
+{
+	mStr str = MSTR_INIT;
+	mFileListItem *pi = NULL;
+
+	mStrPathGetDir(&str, filename);
+
+	if(mFileList_create(list, str.buf, _func_filelist_add, &str))
+	{
+		mFileList_sort_name(list);
+
+		mStrPathGetBasename(&str, filename);
+
+		pi = mFileList_find_name(list, str.buf);
+	}
+
+	mStrFree(&str);
+
+	return pi;
+}
+
 /* 次/前のファイル */
 
 static void _cmd_prevnext_file(ImgViewer *p,mlkbool fnext)
@@ -180,31 +209,31 @@ static void _cmd_prevnext_file(ImgViewer *p,mlkbool fnext)
 	mList list = MLIST_INIT;
 	mStr str = MSTR_INIT;
 	mFileListItem *pi;
+	const char *curname;
 
-	if(!p->ex->img) return;
-
-	//リスト作成
+	//現在のファイル (読み込み待ちの場合はそのファイル)
 
-	if(!mFileList_create(&list, APPCONF->strImageViewerDir.buf, _func_filelist_add, &str))
+	if(mStrIsnotEmpty(&p->ex->strWait))
+		curname = p->ex->strWait.buf;
+	else if(p->ex->img)
+		curname = p->ex->strFilename.buf;
+	else
 		return;
 
-	mFileList_sort_name(&list);
-
-	//
-
-	mStrPathGetBasename(&str, p->ex->strFilename.buf);
+	//リスト作成
+	// :先読みするファイルの取得にも使う
 
-	pi = mFileList_find_name(&list, str.buf);
+	pi = _create_filelist(&list, curname);
 
 	if(pi)
 	{
 		pi = (mFileListItem *)((fnext)? pi->i.next: pi->i.prev);
 		if(pi)
 		{
-			mStrPathGetDir(&str, p->ex->strFilename.buf);
+			mStrPathGetDir(&str, curname);
 			mStrPathJoin(&str, pi->name);
 
-			ImgViewer_loadImage(p, str.buf);
+			_load_image(p, str.buf, pi);
 		}
 	}
 
@@ -218,10 +247,22 @@ static void _cmd_prevnext_file(ImgViewer *p,mlkbool fnext)
 
 static void _clear_image(ImgViewer *p)
 {
-	Image32_free(p->ex->img);
-	p->ex->img = NULL;
+	ImgViewerEx *ex = p->ex;
+
+	Image32_free(ex->img);
+	Image32_free(ex->img_fit);
+
+	ex->img = ex->img_fit = NULL;
 
-	mStrEmpty(&p->ex->strFilename);
+	mStrEmpty(&ex->strFilename);
+
+	//読み込み待ちを解除
+
+	mStrEmpty(&ex->strWait);
+	mWidgetTimerDelete(MLK_WIDGET(p), 0);
+
+	if(ex->cache)
+		ImgViewerCache_request(ex->cache, NULL, FALSE, NULL, 0, 0, 0);
 
 	_update_page(p);
 }
@@ -420,6 +461,11 @@ static int _event_handle(mWidget *wg,mEvent *ev)
 		case MEVENT_COMMAND:
 			_event_command((ImgViewer *)wg, (mEventCommand *)ev);
 			break;
+
+		//読み込み待ち
+		case MEVENT_TIMER:
+			_timer_wait((ImgViewer *)wg);
+			break;
 	}
 
 	return 1;
@@ -487,9 +533,13 @@ static void _panel_destroy_handle(mPanel *p,void *exdat)
 {
 	ImgViewerEx *ex = (ImgViewerEx *)exdat;
 
+	ImgViewerCache_free(ex->cache);
+
 	Image32_free(ex->img);
+	Image32_free(ex->img_fit);
 
 	mStrFree(&ex->strFilename);
+	mStrFree(&ex->strWait);
 }
 
 /** 作成 */
@@ -518,38 +568,191 @@ void PanelImageViewer_new(mPanelState *state)
 	mPanelCreateWidget(p);
 }
 
-/** 画像を開く */
+/* 表示する画像をセット
+ *
+ * 現在の画像は、キャッシュに戻す (同じファイルの場合は破棄)。 */
 
-void ImgViewer_loadImage(ImgViewer *p,const char *filename)
+static void _set_image(ImgViewer *p,const char *filename,
+	Image32 *img,Image32 *imgfit,const ImgViewerFileStamp *stamp)
 {
 	ImgViewerEx *ex = p->ex;
 
-	Image32_free(ex->img);
+	if(ex->img && ex->cache && !mStrCompareEq(&ex->strFilename, filename))
+		ImgViewerCache_put(ex->cache, ex->strFilename.buf, ex->img, ex->img_fit, &ex->stamp);
+	else
+	{
+		Image32_free(ex->img);
+		Image32_free(ex->img_fit);
+	}
 
-	//読み込み
+	ex->img = img;
+	ex->img_fit = imgfit;
 
-	ex->img = Image32_loadFile(filename, IMAGE32_LOAD_F_BLEND_WHITE);
+	if(stamp)
+		ex->stamp = *stamp;
+	else
+		mMemset0(&ex->stamp, sizeof(ImgViewerFileStamp));
 
-	if(!ex->img)
-		_clear_image(p);
+	//ファイル名セット
+
+	mStrSetText(&ex->strFilename, filename);
+
+	//ディレクトリ記録
+
+	mStrPathGetDir(&APPCONF->strImageViewerDir, filename);
+
+	//更新
+
+	ImgViewer_setImageCenter(p, TRUE);
+
+	_update_page(p);
+}
+
+/* 読み込み要求
+ *
+ * 前後のファイルを先読みさせる。
+ * pi: ファイルリスト内の filename のアイテム (NULL でリストを作成する)
+ * wait: TRUE で、filename を最優先で読み込む */
+
+static void _request_load(ImgViewer *p,const char *filename,mFileListItem *pi,mlkbool wait)
+{
+	mList list = MLIST_INIT;
+	mFileListItem *next,*prev;
+	mStr str[IMGVIEWER_PREFETCH_NUM * 2];
+	char *names[IMGVIEWER_PREFETCH_NUM * 2];
+	int i,num = 0;
+
+	//先読みするファイル (次,前,次,前...の順)
+
+	if(!pi)
+		pi = _create_filelist(&list, filename);
+
+	if(pi)
+	{
+		next = (mFileListItem *)pi->i.next;
+		prev = (mFileListItem *)pi->i.prev;
+
+		for(i = 0; i < IMGVIEWER_PREFETCH_NUM; i++)
+		{
+			if(next)
+			{
+				mStrInit(str + num);
+				mStrPathGetDir(str + num, filename);
+				mStrPathJoin(str + num, next->name);
+				names[num] = str[num].buf;
+				num++;
+
+				next = (mFileListItem *)next->i.next;
+			}
+
+			if(prev)
+			{
+				mStrInit(str + num);
+				mStrPathGetDir(str + num, filename);
+				mStrPathJoin(str + num, prev->name);
+				names[num] = str[num].buf;
+				num++;
+
+				prev = (mFileListItem *)prev->i.prev;
+			}
+		}
+	}
+
+	ImgViewerCache_request(p->ex->cache, filename, wait, names, num,
+		MLK_WIDGET(p->page)->w, MLK_WIDGET(p->page)->h);
+
+	for(i = 0; i < num; i++)
+		mStrFree(str + i);
+
+	mListDeleteAll(&list);
+}
+
+/* タイマー: 読み込み待ちの画像を確認 */
+
+static void _timer_wait(ImgViewer *p)
+{
+	ImgViewerEx *ex = p->ex;
+	Image32 *img,*imgfit;
+	ImgViewerFileStamp stamp;
+	mStr str = MSTR_INIT;
+	int ret;
+
+	ret = ImgViewerCache_take(ex->cache, ex->strWait.buf, &img, &imgfit, &stamp);
+	if(ret == 1) return;
+
+	mWidgetTimerDelete(MLK_WIDGET(p), 0);
+
+	mStrCopy(&str, &ex->strWait);
+	mStrEmpty(&ex->strWait);
+
+	if(ret == 0)
+		_set_image(p, str.buf, img, imgfit, &stamp);
 	else
+		_clear_image(p);
+
+	mStrFree(&str);
+}
+
+/* 画像を開く
+ *
+ * item: ファイルリスト内の filename のアイテム (NULL でなし) */
+
+static void _load_image(ImgViewer *p,const char *filename,mFileListItem *item)
+{
+	ImgViewerEx *ex = p->ex;
+	Image32 *img,*imgfit;
+	ImgViewerFileStamp stamp;
+
+	if(!ex->cache)
+		ex->cache = ImgViewerCache_new();
+
+	//スレッドが使えない場合、直接読み込み
+
+	if(!ex->cache)
 	{
-		//ファイル名セット
-		
-		mStrSetText(&ex->strFilename, filename);
+		img = Image32_loadFile(filename, IMAGE32_LOAD_F_BLEND_WHITE);
 
-		//ディレクトリ記録
+		if(!img)
+			_clear_image(p);
+		else
+			_set_image(p, filename, img, NULL, NULL);
 
-		mStrPathGetDir(&APPCONF->strImageViewerDir, filename);
+		return;
+	}
 
-		//更新
+	//キャッシュから
 
-		ImgViewer_setImageCenter(p, TRUE);
+	if(ImgViewerCache_take(ex->cache, filename, &img, &imgfit, &stamp) == 0)
+	{
+		mStrEmpty(&ex->strWait);
+		mWidgetTimerDelete(MLK_WIDGET(p), 0);
 
-		_update_page(p);
+		_set_image(p, filename, img, imgfit, &stamp);
+
+		_request_load(p, filename, item, FALSE);
+	}
+	else
+	{
+		//読み込み待ち
+
+		mStrSetText(&ex->strWait, filename);
+
+		_request_load(p, filename, item, TRUE);
+
+		mWidgetTimerAdd_ifnothave(MLK_WIDGET(p), 0, _WAIT_TIMER_MSEC, 0);
 	}
 }
 
+/** 画像を開く
+ *
+ * キャッシュにある場合は、すぐに表示する。
+ * ない場合は、スレッドで読み込み、完了したら表示する。 */
+
+void ImgViewer_loadImage(ImgViewer *p,const char *filename)
+{
+	_load_image(p, filename, NULL);
+}
+
 /** イメージ -> キャンバス位置 */
 
 void ImgViewer_image_to_canvas(ImgViewer *p,mPoint *dst,double x,double y)
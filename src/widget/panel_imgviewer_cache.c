@@ -0,0 +1,513 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * [panel] イメージビューアの画像キャッシュ
+ *****************************************/
+/*
+ - 画像の読み込みは、すべてスレッドで行う。
+ - 表示する画像 (待ち) を最優先で読み込み、その後、前後のファイルを先読みする。
+ - 読み込んだ画像は、最近使われた順のリストに追加し、
+   合計サイズが上限を超えたら、古いものから削除する。
+ - 表示中の画像は ImgViewerEx が所有し、キャッシュには含まない。
+   他の画像に変わった時に、キャッシュに戻す。
+ - 全体表示用に、表示エリアに合わせて縮小したイメージも作成する。
+ - 読み込み時のファイルの更新日時とサイズを記録し、取り出す時に現在の状態と比較する。
+   ファイルが変更されていた場合は破棄して、読み込み直す。
+*/
+
+#include <string.h>
+
+#include "mlk_gui.h"
+#include "mlk_widget_def.h"
+#include "mlk_str.h"
+#include "mlk_list.h"
+#include "mlk_rectbox.h"
+#include "mlk_thread.h"
+#include "mlk_file.h"
+#include "mlk_filestat.h"
+
+#include "image32.h"
+
+#include "pv_panel_imgviewer.h"
+
+
+//------------------
+
+#define _CACHE_MAXSIZE  (256 * 1024 * 1024)	//キャッシュの最大サイズ (バイト)
+#define _PREFETCH_MAX   (IMGVIEWER_PREFETCH_NUM * 2)
+
+typedef struct
+{
+	mListItem i;
+
+	char *name;
+	Image32 *img,
+		*imgfit;	//全体表示用 (NULL でなし)
+	mlksize size;
+	ImgViewerFileStamp stamp;	//読み込み時のファイル状態
+}_item;
+
+struct _ImgViewerCache
+{
+	mThread *th;
+	mList list;			//キャッシュ (先頭が新しい)
+	mlksize cursize;	//キャッシュの合計サイズ
+	mStr strcur,		//表示中のファイル (先読みしない)
+		strwait;		//表示待ちのファイル (空でなし)
+	char *prefetch[_PREFETCH_MAX];	//先読みするファイル (NULL でなし/処理済み)
+	int areaw,areah;	//全体表示時の表示エリアサイズ
+	mlkbool fquit,
+		fwait_failed;	//表示待ちのファイルの読み込みに失敗した
+};
+
+//------------------
+
+
+/** 全体表示時の縮小サイズを取得
+ *
+ * return: FALSE で縮小の必要なし */
+
+mlkbool ImgViewerCache_getFitSize(mSize *dst,int imgw,int imgh,int areaw,int areah)
+{
+	mBox box;
+
+	if(areaw < 1 || areah < 1) return FALSE;
+
+	mBoxSet(&box, 0, 0, imgw, imgh);
+	mBoxResize_keepaspect(&box, areaw, areah, TRUE);
+
+	if(box.w >= imgw && box.h >= imgh)
+		return FALSE;
+
+	dst->w = box.w;
+	dst->h = box.h;
+
+	return TRUE;
+}
+
+/** 全体表示用のイメージを作成
+ *
+ * return: NULL で縮小の必要なし、または失敗 */
+
+Image32 *ImgViewerCache_createFitImage(Image32 *src,int areaw,int areah)
+{
+	Image32 *img;
+	mSize size;
+
+	if(!ImgViewerCache_getFitSize(&size, src->w, src->h, areaw, areah))
+		return NULL;
+
+	img = Image32_new(size.w, size.h);
+	if(img)
+		Image32_drawResize(img, src);
+
+	return img;
+}
+
+
+/* ファイルの現在の状態を取得
+ *
+ * 取得できない場合は 0。 */
+
+static void _get_stamp(const char *name,ImgViewerFileStamp *dst)
+{
+	mFileStat st;
+
+	if(mGetFileStat(name, &st))
+	{
+		dst->mtime = st.time_modify;
+		dst->size = st.size;
+	}
+	else
+	{
+		dst->mtime = 0;
+		dst->size = 0;
+	}
+}
+
+
+//=========================
+// リスト
+//=========================
+
+
+/* アイテム破棄ハンドラ */
+
+static void _item_destroy(mList *list,mListItem *item)
+{
+	_item *pi = (_item *)item;
+
+	mFree(pi->name);
+	Image32_free(pi->img);
+	Image32_free(pi->imgfit);
+}
+
+/* ファイル名から検索 */
+
+static _item *_find_item(ImgViewerCache *p,const char *name)
+{
+	_item *pi;
+
+	MLK_LIST_FOR(p->list, pi, _item)
+	{
+		if(strcmp(pi->name, name) == 0)
+			return pi;
+	}
+
+	return NULL;
+}
+
+/* 先頭に追加
+ *
+ * 合計サイズが上限を超えたら、古いものから削除する。
+ * 追加したアイテムは削除しない。 */
+
+static void _insert_item(ImgViewerCache *p,const char *name,
+	Image32 *img,Image32 *imgfit,const ImgViewerFileStamp *stamp)
+{
+	_item *pi,*prev;
+
+	pi = (_item *)mListInsertNew(&p->list, p->list.top, sizeof(_item));
+	if(!pi)
+	{
+		Image32_free(img);
+		Image32_free(imgfit);
+		return;
+	}
+
+	pi->name = mStrdup(name);
+	pi->img = img;
+	pi->imgfit = imgfit;
+	pi->stamp = *stamp;
+	pi->size = (mlksize)img->pitch * img->h;
+
+	if(imgfit)
+		pi->size += (mlksize)imgfit->pitch * imgfit->h;
+
+	p->cursize += pi->size;
+
+	//古いものを削除 (表示待ちのファイルは除く)
+
+	pi = (_item *)p->list.bottom;
+
+	while(p->cursize > _CACHE_MAXSIZE && pi && pi != (_item *)p->list.top)
+	{
+		prev = (_item *)pi->i.prev;
+
+		if(!mStrCompareEq(&p->strwait, pi->name))
+		{
+			p->cursize -= pi->size;
+
+			mListDelete(&p->list, MLISTITEM(pi));
+		}
+
+		pi = prev;
+	}
+}
+
+
+//=========================
+// スレッド
+//=========================
+
+
+/* 次に読み込むファイルを取得 (ロック中)
+ *
+ * return: FALSE でなし */
+
+static mlkbool _get_job(ImgViewerCache *p,mStr *dst)
+{
+	int i;
+
+	//表示待ち
+
+	if(mStrIsnotEmpty(&p->strwait)
+		&& !p->fwait_failed
+		&& !_find_item(p, p->strwait.buf))
+	{
+		mStrCopy(dst, &p->strwait);
+		return TRUE;
+	}
+
+	//先読み
+
+	for(i = 0; i < _PREFETCH_MAX; i++)
+	{
+		if(!p->prefetch[i]) continue;
+
+		if(_find_item(p, p->prefetch[i])
+			|| mStrCompareEq(&p->strcur, p->prefetch[i]))
+		{
+			mFree(p->prefetch[i]);
+			p->prefetch[i] = NULL;
+			continue;
+		}
+
+		mStrSetText(dst, p->prefetch[i]);
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/* 先読み対象から外す (ロック中) */
+
+static void _remove_prefetch(ImgViewerCache *p,const char *name)
+{
+	int i;
+
+	for(i = 0; i < _PREFETCH_MAX; i++)
+	{
+		if(p->prefetch[i] && strcmp(p->prefetch[i], name) == 0)
+		{
+			mFree(p->prefetch[i]);
+			p->prefetch[i] = NULL;
+		}
+	}
+}
+
+/* スレッド関数 */
+
+static void _thread_func(mThread *th)
+{
+	ImgViewerCache *p = (ImgViewerCache *)th->param;
+	mStr str = MSTR_INIT;
+	Image32 *img,*imgfit;
+	ImgViewerFileStamp stamp;
+	int areaw,areah;
+
+	mThreadMutexLock(th->mutex);
+
+	while(1)
+	{
+		//読み込むファイルが来るまで待つ
+
+		while(!p->fquit && !_get_job(p, &str))
+			mThreadCondWait(th->cond, th->mutex);
+
+		if(p->fquit) break;
+
+		areaw = p->areaw;
+		areah = p->areah;
+
+		mThreadMutexUnlock(th->mutex);
+
+		//読み込み
+		// :ファイル状態は、読み込み前に取得する (読み込み中に変更された場合、次回に読み直す)
+
+		imgfit = NULL;
+
+		_get_stamp(str.buf, &stamp);
+
+		img = Image32_loadFile(str.buf, IMAGE32_LOAD_F_BLEND_WHITE);
+
+		if(img)
+			imgfit = ImgViewerCache_createFitImage(img, areaw, areah);
+
+		//結果
+
+		mThreadMutexLock(th->mutex);
+
+		if(img)
+			_insert_item(p, str.buf, img, imgfit, &stamp);
+		else if(mStrCompareEq(&p->strwait, str.buf))
+			p->fwait_failed = TRUE;
+
+		_remove_prefetch(p, str.buf);
+	}
+
+	mThreadMutexUnlock(th->mutex);
+
+	mStrFree(&str);
+}
+
+
+//=========================
+// main
+//=========================
+
+
+/** 作成 */
+
+ImgViewerCache *ImgViewerCache_new(void)
+{
+	ImgViewerCache *p;
+
+	p = (ImgViewerCache *)mMalloc0(sizeof(ImgViewerCache));
+	if(!p) return NULL;
+
+	p->list.item_destroy = _item_destroy;
+
+	p->th = mThreadNew(0, _thread_func, p);
+
+	if(!p->th || !mThreadRun(p->th))
+	{
+		mThreadDestroy(p->th);
+		mFree(p);
+		return NULL;
+	}
+
+	return p;
+}
+
+/** 解放
+ *
+ * 読み込み中の場合は、終わるまで待つ。 */
+
+void ImgViewerCache_free(ImgViewerCache *p)
+{
+	int i;
+
+	if(!p) return;
+
+	mThreadMutexLock(p->th->mutex);
+	p->fquit = TRUE;
+	mThreadCondSignal(p->th->cond);
+	mThreadMutexUnlock(p->th->mutex);
+
+	mThreadWait(p->th);
+	mThreadDestroy(p->th);
+
+	//
+
+	mListDeleteAll(&p->list);
+
+	for(i = 0; i < _PREFETCH_MAX; i++)
+		mFree(p->prefetch[i]);
+
+	mStrFree(&p->strcur);
+	mStrFree(&p->strwait);
+	mFree(p);
+}
+
+/** 読み込み要求をセット
+ *
+ * 以前の要求は取り消される。
+ *
+ * cur: 表示するファイル
+ * wait: TRUE で、cur がキャッシュにないため、最優先で読み込む
+ * prefetch: 先読みするファイル (最大 IMGVIEWER_PREFETCH_NUM * 2 個。優先順)
+ * areaw,areah: 表示エリアのサイズ */
+
+void ImgViewerCache_request(ImgViewerCache *p,const char *cur,mlkbool wait,
+	char **prefetch,int num,int areaw,int areah)
+{
+	int i;
+
+	if(num > _PREFETCH_MAX) num = _PREFETCH_MAX;
+
+	mThreadMutexLock(p->th->mutex);
+
+	mStrSetText(&p->strcur, cur);
+	mStrSetText(&p->strwait, (wait)? cur: NULL);
+
+	p->fwait_failed = FALSE;
+	p->areaw = areaw;
+	p->areah = areah;
+
+	for(i = 0; i < _PREFETCH_MAX; i++)
+	{
+		mFree(p->prefetch[i]);
+		p->prefetch[i] = (i < num)? mStrdup(prefetch[i]): NULL;
+	}
+
+	mThreadCondSignal(p->th->cond);
+	mThreadMutexUnlock(p->th->mutex);
+}
+
+/** キャッシュから画像を取り出す
+ *
+ * キャッシュからは削除され、イメージは呼び出し側の所有となる。
+ * ファイルが読み込み時から変更されている場合は、破棄して、まだ読み込まれていないものとする。
+ *
+ * ppfit: 全体表示用のイメージ (NULL の場合あり)
+ * stamp: 読み込み時のファイル状態が入る
+ * return: 0=成功, 1=まだ読み込まれていない, -1=読み込みに失敗した */
+
+int ImgViewerCache_take(ImgViewerCache *p,const char *name,
+	Image32 **ppimg,Image32 **ppfit,ImgViewerFileStamp *stamp)
+{
+	_item *pi;
+	ImgViewerFileStamp cur;
+	int ret;
+
+	_get_stamp(name, &cur);
+
+	mThreadMutexLock(p->th->mutex);
+
+	pi = _find_item(p, name);
+
+	//変更されている場合は破棄 (表示待ちなら、スレッドで読み込み直す)
+
+	if(pi && (pi->stamp.mtime != cur.mtime || pi->stamp.size != cur.size))
+	{
+		p->cursize -= pi->size;
+
+		mListDelete(&p->list, MLISTITEM(pi));
+
+		mThreadCondSignal(p->th->cond);
+
+		pi = NULL;
+	}
+
+	if(pi)
+	{
+		*ppimg = pi->img;
+		*ppfit = pi->imgfit;
+		*stamp = pi->stamp;
+
+		p->cursize -= pi->size;
+
+		pi->img = pi->imgfit = NULL;
+		mListDelete(&p->list, MLISTITEM(pi));
+
+		ret = 0;
+	}
+	else if(p->fwait_failed && mStrCompareEq(&p->strwait, name))
+		ret = -1;
+	else
+		ret = 1;
+
+	mThreadMutexUnlock(p->th->mutex);
+
+	return ret;
+}
+
+/** 画像をキャッシュに戻す
+ *
+ * イメージはキャッシュの所有となる。
+ *
+ * stamp: 取り出した時のファイル状態 */
+
+void ImgViewerCache_put(ImgViewerCache *p,const char *name,
+	Image32 *img,Image32 *imgfit,const ImgViewerFileStamp *stamp)
+{
+	mThreadMutexLock(p->th->mutex);
+
+	if(_find_item(p, name))
+	{
+		Image32_free(img);
+		Image32_free(imgfit);
+	}
+	else
+		_insert_item(p, name, img, imgfit, stamp);
+
+	mThreadMutexUnlock(p->th->mutex);
+}
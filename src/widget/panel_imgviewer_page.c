@@ -42,6 +42,7 @@ $*/
 
 /*
  - ドラッグ中はニアレストネイバーで描画される。
+ - 全体表示時は、表示エリアに合わせて縮小したイメージを描画する。
 */
 
 //-------------------
@@ -384,6 +385,29 @@ static int _event_handle(mWidget *wg,mEvent *ev)
 //==========================
 
 
+/* 全体表示用の縮小イメージが使えるか
+ *
+ * 表示エリアのサイズと合わない場合は、作成し直す。 */
+
+static mlkbool _check_fit_image(ImgViewerPage *p)
+{
+	ImgViewerEx *ex = p->ex;
+	mSize size;
+
+	if(!ImgViewerCache_getFitSize(&size, ex->img->w, ex->img->h, p->wg.w, p->wg.h))
+		return FALSE;
+
+	if(ex->img_fit
+		&& ex->img_fit->w == size.w && ex->img_fit->h == size.h)
+		return TRUE;
+
+	Image32_free(ex->img_fit);
+
+	ex->img_fit = ImgViewerCache_createFitImage(ex->img, p->wg.w, p->wg.h);
+
+	return (ex->img_fit != NULL);
+}
+
 /* サイズ変更時 */
 
 static void _resize_handle(mWidget *wg)
@@ -404,6 +428,7 @@ static void _draw_handle(mWidget *wg,mPixbuf *pixbuf)
 	{
 		Image32CanvasInfo info;
 		mBox box;
+		double d;
 
 		box.x = box.y = 0;
 		box.w = wg->w;
@@ -418,8 +443,24 @@ static void _draw_handle(mWidget *wg,mPixbuf *pixbuf)
 		info.bkgndcol = _BKGND_COL;
 
 		if(ex->zoom < 1000 && p->dragbtt == 0)
+		{
 			//縮小時 (ドラッグ中は除く)
-			Image32_drawCanvas_oversamp(ex->img, pixbuf, &box, &info);
+
+			if(_IS_ZOOM_FIT && _check_fit_image(p))
+			{
+				//全体表示時は、縮小済みのイメージを使う
+
+				d = (double)ex->img_fit->w / ex->img->w;
+
+				info.origin_x *= d;
+				info.origin_y *= d;
+				info.scalediv *= d;
+
+				Image32_drawCanvas_nearest(ex->img_fit, pixbuf, &box, &info);
+			}
+			else
+				Image32_drawCanvas_oversamp(ex->img, pixbuf, &box, &info);
+		}
 		else
 			Image32_drawCanvas_nearest(ex->img, pixbuf, &box, &info);
 	}
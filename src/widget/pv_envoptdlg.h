@@ -32,6 +32,7 @@ typedef struct
 		undo_maxbufsize,
 		canv_zoom_step,
 		canv_rotate_step,
+		layer_swap_size,
 		iconsize[3],
 		toolbar_btts_size,
 		cursor_hotspot[2];
@@ -76,6 +77,7 @@ enum
 	TRID_OPT1_UNDO_MAXBUFSIZE,
 	TRID_OPT1_CANVAS_ZOOM_STEP,
 	TRID_OPT1_CANVAS_ROTATE_STEP,
+	TRID_OPT1_LAYER_SWAP_SIZE,
 
 	//フラグ
 	TRID_FLAGS_TOP = 150,
@@ -22,6 +22,7 @@ $*/
  *************************************/
 
 typedef struct _CanvViewPage CanvViewPage;
+typedef struct _ImageCanvas ImageCanvas;
 
 #define CANVVIEW_ZOOM_MAX   20000
 
@@ -51,6 +52,11 @@ typedef struct
 
 	CanvViewPage *page;
 	mIconBar *iconbar;
+
+	ImageCanvas *img_reduce;	//縮小表示用イメージ (NULL でなし)
+	int reduce_div;		//img_reduce の縮小率 (1/n)
+	mRect rc_reduce,	//img_reduce の未更新範囲 (イメージ座標)
+		rc_update;		//ページの更新待ち範囲 (イメージ座標)
 }CanvView;
 
 /* page からの通知 */
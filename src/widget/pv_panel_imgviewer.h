@@ -22,15 +22,29 @@ $*/
  *************************************/
 
 typedef struct _ImgViewerPage ImgViewerPage;
+typedef struct _ImgViewerCache ImgViewerCache;
 
 #define IMGVIEWER_ZOOM_MAX  10000
+#define IMGVIEWER_PREFETCH_NUM  2	//前後それぞれの先読み数
+
+/* 画像ファイルの状態 (キャッシュが有効かの判定用) */
+
+typedef struct
+{
+	uint64_t mtime;	//更新日時
+	mlkfoff size;	//ファイルサイズ
+}ImgViewerFileStamp;
 
 /* パネルの拡張データ */
 
 typedef struct
 {
-	Image32 *img;
-	mStr strFilename;	//現在の画像ファイル名
+	Image32 *img,
+		*img_fit;		//全体表示用の縮小イメージ (NULL でなし)
+	ImgViewerCache *cache;	//画像キャッシュ (NULL でなし)
+	mStr strFilename,	//現在の画像ファイル名
+		strWait;		//読み込み待ちのファイル名 (空でなし)
+	ImgViewerFileStamp stamp;	//現在の画像の読み込み時のファイル状態
 
 	int scrx,scry,		//画像スクロール位置
 		zoom;			//表示倍率 (1=0.1%)
@@ -62,3 +76,16 @@ void ImgViewer_setZoom_fit(ImgViewer *p);
 void ImgViewer_setZoom(ImgViewer *p,int zoom);
 void ImgViewer_adjustScroll(ImgViewer *p);
 
+/* panel_imgviewer_cache.c */
+
+ImgViewerCache *ImgViewerCache_new(void);
+void ImgViewerCache_free(ImgViewerCache *p);
+void ImgViewerCache_request(ImgViewerCache *p,const char *cur,mlkbool wait,
+	char **prefetch,int num,int areaw,int areah);
+int ImgViewerCache_take(ImgViewerCache *p,const char *name,
+	Image32 **ppimg,Image32 **ppfit,ImgViewerFileStamp *stamp);
+void ImgViewerCache_put(ImgViewerCache *p,const char *name,
+	Image32 *img,Image32 *imgfit,const ImgViewerFileStamp *stamp);
+
+mlkbool ImgViewerCache_getFitSize(mSize *dst,int imgw,int imgh,int areaw,int areah);
+Image32 *ImgViewerCache_createFitImage(Image32 *src,int areaw,int areah);